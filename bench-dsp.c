@@ -0,0 +1,316 @@
+/*
+   fonulator 3 - foneBRIDGE configuration daemon
+   (C) 2005-2007 Redfone Communications, LLC.
+   www.red-fone.com
+
+   DSP Channel Table Benchmark
+*/
+/** @file
+ *
+ * Times the DSP channel table operations of dsp.c, which hold the
+ * channels as per-type bit planes, against the array of one
+ * dsp_chantype per channel that dsp.c used before. The array model
+ * below is that code, less the context.
+ *
+ * Every operation is run on both models and the results compared, so
+ * a run also checks that the planes agree with the arrays.
+ *
+ *     bench-dsp [iterations]
+ *
+ * dsp.c is linked on its own; the rest of fonulator it calls is
+ * stubbed out here, and never reached by the operations timed.
+ */
+#include "fonulator.h"
+
+#if defined(STDC_HEADERS) || defined(HAVE_STDLIB_H)
+#include <stdlib.h>
+#endif
+
+#include <sys/time.h>
+
+/** Iterations of each operation unless given on the command line */
+#define BENCH_ITERATIONS 1000000
+/** User channels of a four span E1 device */
+#define BENCH_USER_CHANNELS (IDT_LINKS * 31)
+
+int vbose = 0;
+
+/** @struct T_ARRAY_DSP
+ *
+ * The DSP tables as arrays, the representation before the planes
+ */
+typedef struct
+{
+  dsp_chantype dsp_config[DSP_MAX_CHANNELS];
+  dsp_chantype flash_config[DSP_MAX_CHANNELS];
+  dsp_chantype user_config[DSP_MAX_CHANNELS];
+}
+T_ARRAY_DSP;
+
+/* Stand-ins for the parts of fonulator dsp.c links against */
+T_SPAN *
+get_span (T_CONTEXT * ctx, int num)
+{
+  return NULL;
+}
+
+T_SPAN *
+get_first_span (T_CONTEXT * ctx)
+{
+  return NULL;
+}
+
+unsigned int
+statusGetSpans (T_CONTEXT * ctx)
+{
+  return IDT_LINKS;
+}
+
+unsigned int
+statusGetDSPChannels (T_CONTEXT * ctx)
+{
+  return DSP_MAX_CHANNELS;
+}
+
+int
+stopTDMoE (T_CONTEXT * ctx, libfb_t * f)
+{
+  return 0;
+}
+
+bool
+interactiveReboot (libfb_t * f)
+{
+  return false;
+}
+
+int
+fbt_custom_cmd (libfb_t * f, int cmd, int param, char *data, int len)
+{
+  return FBLIB_ESUCCESS;
+}
+
+int
+fbt_custom_cmd_reply (libfb_t * f, int cmd, int param, char *data,
+		      int len, char *reply, int reply_len)
+{
+  return FBLIB_ESUCCESS;
+}
+
+int
+fbt_ec_set_chantype (libfb_t * f, int mode, uint32_t * mask)
+{
+  return FBLIB_ESUCCESS;
+}
+
+/** @return the mask of channels of `type' on `span', as an array */
+static uint32_t
+array_getmask (T_ARRAY_DSP * a, int span, dsp_chantype type)
+{
+  uint32_t mask = 0;
+  int i;
+
+  for (i = 0; i < 32; i++)
+    if (a->dsp_config[32 * span + i] == type)
+      mask |= 1 << i;
+  return mask;
+}
+
+/** @return true if flash_config and dsp_config differ, as arrays */
+static bool
+array_differ (T_ARRAY_DSP * a)
+{
+  int i = 0;
+  bool differ = false;
+  do
+    {
+      if (a->dsp_config[i] != a->flash_config[i])
+	differ = true;
+      i++;
+    }
+  while (i < DSP_MAX_CHANNELS && !differ);
+  return differ;
+}
+
+/** @brief Set user channels min to max to `type', as an array */
+static void
+array_set_userrange (T_ARRAY_DSP * a, dsp_chantype type, int min, int max)
+{
+  int i;
+  for (i = min; i <= max; i++)
+    a->user_config[i] = type;
+}
+
+/** @brief Copy the user's channels in by span, as an array */
+static void
+array_user_to_native (T_ARRAY_DSP * a)
+{
+  int i, j, done_chan = 0;
+
+  for (i = 0; i < IDT_LINKS; i++)
+    for (j = 0; j < 31; j++)
+      a->dsp_config[32 * i + j] = a->user_config[++done_chan];
+}
+
+/** @return microseconds from `start' to now */
+static double
+bench_elapsed (struct timeval *start)
+{
+  struct timeval now;
+  gettimeofday (&now, NULL);
+  return (now.tv_sec - start->tv_sec) * 1e6 + (now.tv_usec - start->tv_usec);
+}
+
+/** @brief Print the time per operation of both models */
+static void
+bench_report (const char *op, double array_us, double planes_us, long n)
+{
+  printf ("%-16s %10.1f ns %10.1f ns %8.1fx\n", op,
+	  array_us * 1000 / n, planes_us * 1000 / n,
+	  planes_us > 0 ? array_us / planes_us : 0);
+}
+
+/** @brief Give both models the same user table, one range per span */
+static void
+bench_fill (T_CONTEXT * ctx, T_ARRAY_DSP * a, unsigned int seed)
+{
+  int span, first, last;
+
+  dspconfig_init_userconfig (ctx);
+  array_set_userrange (a, DSP_OFF, 0, DSP_MAX_CHANNELS - 1);
+  for (span = 0; span < IDT_LINKS; span++)
+    {
+      seed = seed * 1103515245 + 12345;
+      first = 31 * span + 1 + (seed >> 16) % 15;
+      last = first + (seed >> 8) % 16;
+      dspconfig_set_userrange (ctx, span % 3, first, last);
+      array_set_userrange (a, span % 3, first, last);
+    }
+}
+
+/** @return true if both models hold the same DSP configuration */
+static bool
+bench_check (T_CONTEXT * ctx, T_ARRAY_DSP * a)
+{
+  int span, t;
+
+  for (span = 0; span < IDT_LINKS; span++)
+    for (t = 0; t < DSP_MAX; t++)
+      if (dspconfig_getmask (ctx, span, t) != array_getmask (a, span, t))
+	{
+	  fprintf (stderr, "Mask of span %d type %d differs\n", span, t);
+	  return false;
+	}
+  if (dspconfig_differ (ctx) != array_differ (a))
+    {
+      fprintf (stderr, "The models disagree on the flash difference\n");
+      return false;
+    }
+  return true;
+}
+
+int
+main (int argc, char **argv)
+{
+  long n = (argc > 1) ? atol (argv[1]) : BENCH_ITERATIONS, i;
+  unsigned char flash[DSP_MAX_CHANNELS];
+  volatile uint32_t sink = 0;
+  T_CONTEXT ctx;
+  T_ARRAY_DSP a;
+  struct timeval start;
+  double array_us, planes_us;
+  int span, t;
+
+  if (n <= 0)
+    {
+      fprintf (stderr, "usage: %s [iterations]\n", argv[0]);
+      return EXIT_FAILURE;
+    }
+
+  memset (&ctx, 0, sizeof (ctx));
+  for (i = 0; i < DSP_MAX_CHANNELS; i++)
+    a.dsp_config[i] = DSP_OFF;
+  ctx.dsp = dspconfig_create ();
+  if (ctx.dsp == NULL || dspconfig_init (&ctx, DSP_MAX_CHANNELS) != E_SUCCESS)
+    return EXIT_FAILURE;
+
+  /* The tables both models start from, checked against each other */
+  bench_fill (&ctx, &a, 1);
+  dspconfig_user_to_native (&ctx);
+  array_user_to_native (&a);
+  for (i = 0; i < DSP_MAX_CHANNELS; i++)
+    flash[i] = a.flash_config[i] = a.dsp_config[i];
+  flash[DSP_MAX_CHANNELS - 1] = a.flash_config[DSP_MAX_CHANNELS - 1] = DSP_A;
+  dspconfig_initflash (&ctx, flash, DSP_MAX_CHANNELS);
+
+  if (!bench_check (&ctx, &a))
+    return EXIT_FAILURE;
+
+  printf ("%ld iterations, time per operation\n", n);
+  printf ("%-16s %13s %13s %9s\n", "Operation", "Array", "Planes",
+	  "Speedup");
+
+  /* All masks of a device, as configureDSP() fetches them */
+  gettimeofday (&start, NULL);
+  for (i = 0; i < n; i++)
+    for (span = 0; span < IDT_LINKS; span++)
+      for (t = 0; t < DSP_MAX; t++)
+	sink += array_getmask (&a, span, t);
+  array_us = bench_elapsed (&start);
+  gettimeofday (&start, NULL);
+  for (i = 0; i < n; i++)
+    for (span = 0; span < IDT_LINKS; span++)
+      for (t = 0; t < DSP_MAX; t++)
+	sink += dspconfig_getmask (&ctx, span, t);
+  planes_us = bench_elapsed (&start);
+  bench_report ("getmask (all)", array_us, planes_us, n);
+
+  /* The tables differ only in their last channel, the worst case */
+  gettimeofday (&start, NULL);
+  for (i = 0; i < n; i++)
+    sink += array_differ (&a);
+  array_us = bench_elapsed (&start);
+  gettimeofday (&start, NULL);
+  for (i = 0; i < n; i++)
+    sink += dspconfig_differ (&ctx);
+  planes_us = bench_elapsed (&start);
+  bench_report ("differ", array_us, planes_us, n);
+
+  /* A [dsp] block of one range per span */
+  gettimeofday (&start, NULL);
+  for (i = 0; i < n; i++)
+    {
+      array_set_userrange (&a, DSP_OFF, 1, BENCH_USER_CHANNELS);
+      for (span = 0; span < IDT_LINKS; span++)
+	array_set_userrange (&a, span % 3, 31 * span + 1 + i % 8,
+			     31 * span + 20 + i % 8);
+    }
+  array_us = bench_elapsed (&start);
+  gettimeofday (&start, NULL);
+  for (i = 0; i < n; i++)
+    {
+      dspconfig_set_userrange (&ctx, DSP_OFF, 1, BENCH_USER_CHANNELS);
+      for (span = 0; span < IDT_LINKS; span++)
+	dspconfig_set_userrange (&ctx, span % 3, 31 * span + 1 + i % 8,
+				 31 * span + 20 + i % 8);
+    }
+  planes_us = bench_elapsed (&start);
+  bench_report ("set_userrange", array_us, planes_us, n);
+
+  gettimeofday (&start, NULL);
+  for (i = 0; i < n; i++)
+    array_user_to_native (&a);
+  array_us = bench_elapsed (&start);
+  gettimeofday (&start, NULL);
+  for (i = 0; i < n; i++)
+    dspconfig_user_to_native (&ctx);
+  planes_us = bench_elapsed (&start);
+  bench_report ("user_to_native", array_us, planes_us, n);
+
+  /* The last pass left both models with the same tables */
+  if (!bench_check (&ctx, &a))
+    return EXIT_FAILURE;
+
+  dspconfig_destroy (ctx.dsp);
+  return (sink == 0xFFFFFFFF) ? EXIT_FAILURE : EXIT_SUCCESS;
+}
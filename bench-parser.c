@@ -0,0 +1,707 @@
+/*
+   fonulator 3 - foneBRIDGE configuration daemon
+   (C) 2005-2007 Redfone Communications, LLC.
+   www.red-fone.com
+
+   Configuration Parser Benchmark
+*/
+/** @file
+ *
+ * Times treeParser() on a generated configuration file, and counts
+ * the heap allocations made per parse, against the two parsers it
+ * replaced. Both are kept below as reference models, that code less
+ * the site sections and license keys, which the generated file has
+ * none of:
+ *
+ * - list_parse(), the token list: every token scanned is copied into
+ *   a T_LIST_TOKEN of its own, linked into a DList, and the list is
+ *   applied through the switch statement treeTokens() had then, once
+ *   the file has been scanned.
+ * - switch_parse(), tokens applied as they are scanned, as now, but
+ *   through that switch rather than the parse_rules table.
+ *
+ * The file is also run through the scanner alone, so that the cost of
+ * dispatch and handlers can be told apart from that of scanning, and
+ * every model's context is compared with treeParser()'s. The file has
+ * a [globals] block, [spanN] blocks repeated until most of the lines
+ * are used, and a [dsp] block of ranges and single channels after
+ * them, with a comment every few lines.
+ *
+ *     bench-parser [lines [iterations]]
+ *
+ * fonulator.c is built into the benchmark without its main(), and
+ * the allocator is wrapped (ld --wrap) to count the calls made.
+ */
+#include "fonulator.h"
+
+#if defined(STDC_HEADERS) || defined(HAVE_STDLIB_H)
+#include <stdlib.h>
+#endif
+
+#include <sys/time.h>
+
+/** Lines of the generated configuration unless given */
+#define BENCH_LINES 10000
+/** Parses timed per round unless given */
+#define BENCH_ITERATIONS 100
+/** Rounds timed of each parser, the fastest counting */
+#define BENCH_ROUNDS 5
+/** Bytes of a token value the token list kept, S_LEN of old */
+#define LIST_SVAL_LEN 148
+
+/** @struct T_LIST_TOKEN
+ *
+ * A token as the token list held it, its value copied out of the
+ * scanner's buffer
+ */
+typedef struct
+{
+  int token;
+  int ival;
+  char sval[LIST_SVAL_LEN];
+  int lineno;
+}
+T_LIST_TOKEN;
+
+/** State the switch model keeps from one token to the next */
+typedef struct
+{
+  T_CONTEXT *ctx;
+  dsp_chantype chantype;
+}
+T_SWITCH;
+
+/** A parser under test, filling in a fresh context from a file */
+typedef FB_STATUS (*T_BENCH_PARSER) (T_CONTEXT * ctx, FILE * fp);
+
+/** Allocator calls since they were last reset */
+static long allocs;
+
+void *__real_malloc (size_t size);
+void *__real_calloc (size_t nmemb, size_t size);
+void *__real_realloc (void *ptr, size_t size);
+char *__real_strdup (const char *s);
+void *__wrap_malloc (size_t size);
+void *__wrap_calloc (size_t nmemb, size_t size);
+void *__wrap_realloc (void *ptr, size_t size);
+char *__wrap_strdup (const char *s);
+
+void *
+__wrap_malloc (size_t size)
+{
+  allocs++;
+  return __real_malloc (size);
+}
+
+void *
+__wrap_calloc (size_t nmemb, size_t size)
+{
+  allocs++;
+  return __real_calloc (nmemb, size);
+}
+
+void *
+__wrap_realloc (void *ptr, size_t size)
+{
+  allocs++;
+  return __real_realloc (ptr, size);
+}
+
+/* The C library's strdup() does not allocate through the wrapper */
+char *
+__wrap_strdup (const char *s)
+{
+  allocs++;
+  return __real_strdup (s);
+}
+
+/** @brief Write a configuration of `lines' lines
+ *
+ * @param fp the file to write to
+ * @param lines the number of lines, at least 64
+ */
+static void
+bench_config (FILE * fp, int lines)
+{
+  static const char *span_lines[] = {
+    "framing=ccs", "encoding=hdb3", "crc4", "shorthaul=1", "# span",
+    "dejitter"
+  };
+  int n = 5, span = 0, chan = 1, i;
+
+  fprintf (fp, "[globals]\nfb=192.168.1.222\nport=1\n"
+	   "server=00:11:22:33:44:55\npriorities=0,1,2,3\n");
+
+  /* Nine tenths spans, the rest [dsp] */
+  while (n + 7 < lines - lines / 10)
+    {
+      fprintf (fp, "\n[span%d]\n", span % IDT_LINKS + 1);
+      for (i = 0; i < 6; i++)
+	fprintf (fp, "%s\n", span_lines[i]);
+      n += 8;
+      span++;
+    }
+
+  fprintf (fp, "\n[dsp]\ndsp=ulaw\n");
+  n += 3;
+  for (; n < lines; n += 2)
+    {
+      fprintf (fp, "voiceA=%d-%d\ndata=%d\n", chan, chan + 22, chan + 23);
+      chan = (chan + 24 > 100) ? 1 : chan + 24;
+    }
+}
+
+/** @return microseconds from `start' to now */
+static double
+bench_elapsed (struct timeval *start)
+{
+  struct timeval now;
+  gettimeofday (&now, NULL);
+  return (now.tv_sec - start->tv_sec) * 1e6 + (now.tv_usec - start->tv_usec);
+}
+
+/** @brief Apply one token, as the switch in treeTokens() did
+ *
+ * @return success/failure code
+ */
+static FB_STATUS
+switch_token (T_SWITCH * sw, T_TOKEN * current)
+{
+  T_CONTEXT *ctx = sw->ctx;
+  FB_STATUS status;
+  T_SPAN *s;
+
+  switch (current->token)
+    {
+    case TOK_GLOBALS:
+      if (ctx->state == STATE_NONE)
+	ctx->state = STATE_GLOBAL;
+      else
+	return E_BADSTATE;
+      break;
+
+    case TOK_PORT:
+      if (ctx->state == STATE_GLOBAL)
+	ctx->port = current->ival;
+      else
+	return E_BADSTATE;
+      break;
+
+    case TOK_PRIO:
+      if (ctx->state == STATE_GLOBAL)
+	{
+	  char *p = current->sval;
+	  int i;
+	  for (i = 0; *p != '\0'; i++)
+	    {
+	      if (i >= IDT_LINKS)
+		return E_BADVALUE;
+	      ctx->priorities[i] = strtoul (p, &p, 10);
+	      if (*p == ',')
+		p++;
+	    }
+	}
+      else
+	return E_BADSTATE;
+      break;
+
+    case TOK_WPLLOFF:
+      if (ctx->state == STATE_GLOBAL)
+	ctx->wpll = 0;
+      else
+	return E_BADSTATE;
+      break;
+
+    case TOK_ULAW:
+      ctx->companding = DSP_COMP_TYPE_ULAW;
+      break;
+    case TOK_ALAW:
+      ctx->companding = DSP_COMP_TYPE_ALAW;
+      break;
+    case TOK_DSP_OFF:
+      ctx->companding = -1;
+      break;
+    case TOK_DSP_DISABLED:
+      ctx->companding = -1;
+      ctx->dspdisabled = true;
+      break;
+
+    case TOK_FB_CONFIG:
+      if (ctx->state != STATE_GLOBAL)
+	return E_BADSTATE;
+      ctx->fonebridge = malloc (strlen (current->sval) + 1);
+      if (ctx->fonebridge == NULL)
+	return E_SYSTEM;
+      strcpy (ctx->fonebridge, current->sval);
+      break;
+
+    case TOK_SERVER_CONFIG:
+      if (ctx->state != STATE_GLOBAL)
+	return E_BADSTATE;
+      ctx->server = malloc (1 + strlen (current->sval));
+      if (ctx->server == NULL)
+	return E_SYSTEM;
+      strcpy (ctx->server, current->sval);
+      break;
+
+    case TOK_DSP_HEADER:
+      if (ctx->state == STATE_GLOBAL || ctx->state == STATE_SPAN)
+	{
+	  ctx->state = STATE_DSP;
+	  dspconfig_init_userconfig (ctx);
+	}
+      else
+	return E_BADSTATE;
+      break;
+
+    case TOK_VOICEA:
+    case TOK_VOICEB:
+    case TOK_DATA:
+      if (ctx->state != STATE_DSP)
+	return E_BADSTATE;
+      ctx->state = DSPSTATE_WAIT_FOR_VALUE;
+      sw->chantype = (current->token == TOK_VOICEA) ? DSP_A
+	: (current->token == TOK_VOICEB) ? DSP_B : DSP_DATA;
+      break;
+
+    case TOK_DIGIT:
+      if (ctx->state != DSPSTATE_WAIT_FOR_VALUE)
+	return E_BADSTATE;
+      status = dspconfig_set_userdigit (ctx, sw->chantype, current->ival);
+      ctx->state = STATE_DSP;
+      if (status != E_SUCCESS)
+	return status;
+      break;
+
+    case TOK_RANGE:
+      {
+	char *dash = strchr (current->sval, '-');
+	if (ctx->state != DSPSTATE_WAIT_FOR_VALUE)
+	  return E_BADSTATE;
+	if (dash == NULL)
+	  return E_BADINPUT;
+	status = dspconfig_set_userrange (ctx, sw->chantype,
+					  atoi (current->sval),
+					  atoi (dash + 1));
+	ctx->state = STATE_DSP;
+	if (status != E_SUCCESS)
+	  return status;
+      }
+      break;
+
+    case TOK_SPAN:
+      if (ctx->state == STATE_GLOBAL)
+	ctx->state = STATE_SPAN;
+      else if (ctx->state != STATE_SPAN)
+	return E_BADSTATE;
+      if (ctx->span == current->ival)
+	return E_DUPLICATE;
+      if (current->ival < 1 || current->ival > IDT_LINKS)
+	return E_BADVALUE;
+      ctx->span = current->ival;
+      break;
+
+    case TOK_FRAMING:
+      if (ctx->state != STATE_SPAN)
+	return E_BADSTATE;
+      s = get_span (ctx, ctx->span);
+      if (!strcmp (current->sval, "cas"))
+	{
+	  s->config.E1Mode = 1;
+	  s->config.rbs_en = 1;
+	  s->config.framing = 0;
+	}
+      else if (!strcmp (current->sval, "ccs"))
+	{
+	  s->config.E1Mode = 1;
+	  s->config.rbs_en = 0;
+	  s->config.framing = 0;
+	}
+      else if (!strcmp (current->sval, "esf"))
+	{
+	  s->config.E1Mode = 0;
+	  s->config.framing = 1;
+	}
+      else if (!strcmp (current->sval, "sf"))
+	{
+	  s->config.E1Mode = 0;
+	  s->config.framing = 0;
+	}
+      else
+	return E_BADVALUE;
+      break;
+
+    case TOK_ENCODING:
+      if (ctx->state != STATE_SPAN)
+	return E_BADSTATE;
+      s = get_span (ctx, ctx->span);
+      if (!strcmp (current->sval, "hdb3"))
+	{
+	  s->config.E1Mode = 1;
+	  s->config.encoding = 0;
+	}
+      else if (!strcmp (current->sval, "b8zs"))
+	{
+	  s->config.E1Mode = 0;
+	  s->config.encoding = 0;
+	}
+      else if (!strcmp (current->sval, "ami"))
+	s->config.encoding = 1;
+      else
+	return E_BADVALUE;
+      break;
+
+    case TOK_CRCMF:
+      if (ctx->state != STATE_SPAN)
+	return E_BADSTATE;
+      get_span (ctx, ctx->span)->config.CRCMF = 1;
+      break;
+
+    case TOK_J1:
+      if (ctx->state != STATE_SPAN)
+	return E_BADSTATE;
+      s = get_span (ctx, ctx->span);
+      s->config.J1Mode = 1;
+      s->config.E1Mode = 0;
+      break;
+
+    case TOK_RBS:
+      if (ctx->state != STATE_SPAN)
+	return E_BADSTATE;
+      get_span (ctx, ctx->span)->config.rbs_en = 1;
+      break;
+
+    case TOK_LOOPBACK:
+      if (ctx->state != STATE_SPAN)
+	return E_BADSTATE;
+      get_span (ctx, ctx->span)->config.rlb = 1;
+      break;
+
+    case TOK_SLAVE:
+      if (ctx->state == STATE_SPAN)
+	get_span (ctx, ctx->span)->slave = true;
+      break;
+
+    case TOK_SHORTHAUL:
+      if (ctx->state != STATE_SPAN)
+	return E_BADSTATE;
+      s = get_span (ctx, ctx->span);
+      if (s->longhaul || current->ival < 0 || current->ival >= MAX_SHORTLBO)
+	return E_BADVALUE;
+      s->shorthaul = true;
+      s->config.LBO = shortlbo[current->ival] & 0xF;
+      break;
+
+    case TOK_LONGHAUL:
+      if (ctx->state != STATE_SPAN)
+	return E_BADSTATE;
+      s = get_span (ctx, ctx->span);
+      if (s->shorthaul || current->ival < 0 || current->ival >= MAX_LONGLBO)
+	return E_BADVALUE;
+      s->longhaul = true;
+      s->config.LBO = longlbo[current->ival] & 0xF;
+      s->config.EQ = true;
+      break;
+
+    case TOK_DEJITTER:
+      if (ctx->state != STATE_SPAN)
+	return E_BADSTATE;
+      get_span (ctx, ctx->span)->dejitter = true;
+      break;
+
+    default:
+      return E_BADTOKEN;
+    }
+  return E_SUCCESS;
+}
+
+/** @brief Apply the tokens as they are scanned, through the switch
+ *
+ * @return success/failure code
+ */
+static FB_STATUS
+switch_parse (T_CONTEXT * ctx, FILE * fp)
+{
+  T_SWITCH sw = { ctx, DSP_DATA };
+  T_TOKEN token;
+  yyscan_t scanner;
+  FB_STATUS status = E_SUCCESS;
+
+  if (yylex_init_extra (&token, &scanner) != 0)
+    return E_SYSTEM;
+  yyset_in (fp, scanner);
+  ctx->wpll = 1;
+
+  while (status == E_SUCCESS
+	 && (token.ival = 0, token.token = yylex (scanner)) != TOK_LEX_EOF)
+    {
+      token.sval = yyget_text (scanner);
+      token.lineno = yyget_lineno (scanner);
+      status = switch_token (&sw, &token);
+    }
+  yylex_destroy (scanner);
+  return status;
+}
+
+/** @brief Scan the whole file into a token list, then apply the list
+ * through the switch
+ *
+ * @return success/failure code
+ */
+static FB_STATUS
+list_parse (T_CONTEXT * ctx, FILE * fp)
+{
+  T_SWITCH sw = { ctx, DSP_DATA };
+  T_TOKEN token;
+  T_LIST_TOKEN *current;
+  DListElmt *element;
+  DList tokens;
+  yyscan_t scanner;
+  FB_STATUS status = E_SUCCESS;
+
+  if (yylex_init_extra (&token, &scanner) != 0)
+    return E_SYSTEM;
+  yyset_in (fp, scanner);
+  dlist_init (&tokens, free);
+
+  /* lexParser(): one allocation and one copy per token */
+  do
+    {
+      current = malloc (sizeof (T_LIST_TOKEN));
+      if (current == NULL
+	  || dlist_ins_next (&tokens, dlist_tail (&tokens), current) < 0)
+	{
+	  free (current);
+	  status = E_SYSTEM;
+	  break;
+	}
+      token.ival = 0;
+      current->token = yylex (scanner);
+      current->ival = token.ival;
+      strncpy (current->sval, yyget_text (scanner), LIST_SVAL_LEN - 1);
+      current->sval[LIST_SVAL_LEN - 1] = '\0';
+      current->lineno = yyget_lineno (scanner);
+    }
+  while (current->token != TOK_LEX_EOF);
+  yylex_destroy (scanner);
+
+  ctx->wpll = 1;
+  for (element = dlist_head (&tokens); status == E_SUCCESS
+       && element != NULL; element = dlist_next (element))
+    {
+      current = dlist_data (element);
+      if (current->token == TOK_LEX_EOF)
+	break;
+      token.token = current->token;
+      token.ival = current->ival;
+      token.sval = current->sval;
+      token.lineno = current->lineno;
+      status = switch_token (&sw, &token);
+    }
+
+  dlist_destroy (&tokens);
+  return status;
+}
+
+/** @brief treeParser() on a single device file */
+static FB_STATUS
+tree_parse (T_CONTEXT * ctx, FILE * fp)
+{
+  return treeParser (ctx, NULL, fp);
+}
+
+/** @brief Parse the file once into a fresh context
+ *
+ * @param parser the parser to run
+ * @param fp the configuration file
+ * @param keep if not NULL, set to the context, to be destroyed by the
+ * caller; otherwise the context is destroyed
+ * @return success/error code of the parser
+ */
+static FB_STATUS
+bench_parse (T_BENCH_PARSER parser, FILE * fp, T_CONTEXT ** keep)
+{
+  T_CONTEXT *ctx = contextCreate ();
+  FB_STATUS status;
+
+  if (ctx == NULL)
+    return E_SYSTEM;
+  rewind (fp);
+  status = parser (ctx, fp);
+  if (keep != NULL)
+    *keep = ctx;
+  else
+    contextDestroy (ctx);
+  return status;
+}
+
+/** @return true if two parsed contexts hold the same configuration */
+static bool
+bench_same (T_CONTEXT * a, T_CONTEXT * b)
+{
+  static T_DSP_USER da, db;
+  int i;
+
+  if (a->state != b->state || a->port != b->port
+      || a->companding != b->companding || a->wpll != b->wpll
+      || a->dspdisabled != b->dspdisabled
+      || strcmp (a->fonebridge, b->fonebridge) != 0
+      || strcmp (a->server, b->server) != 0
+      || memcmp (a->priorities, b->priorities, sizeof (a->priorities)) != 0
+      || a->span_slots != b->span_slots)
+    return false;
+
+  for (i = 0; i < a->span_slots; i++)
+    if ((a->spans[i] == NULL) != (b->spans[i] == NULL)
+	|| (a->spans[i] != NULL
+	    && memcmp (a->spans[i], b->spans[i], sizeof (T_SPAN)) != 0))
+      return false;
+
+  memset (&da, 0, sizeof (da));
+  memset (&db, 0, sizeof (db));
+  dspconfig_user_export (a, &da);
+  dspconfig_user_export (b, &db);
+  return memcmp (&da, &db, sizeof (da)) == 0;
+}
+
+/** @brief Scan the file once, applying none of the tokens
+ *
+ * @return the number of tokens, or -1 on error
+ */
+static long
+bench_scan (FILE * fp)
+{
+  T_TOKEN token;
+  yyscan_t scanner;
+  long tokens = 0;
+
+  if (yylex_init_extra (&token, &scanner) != 0)
+    return -1;
+  rewind (fp);
+  yyset_in (fp, scanner);
+  while (yylex (scanner) != TOK_LEX_EOF)
+    tokens++;
+  yylex_destroy (scanner);
+  return tokens;
+}
+
+/** @brief Scan the file into a fresh context, applying none of the
+ * tokens: the floor under every parser */
+static FB_STATUS
+scan_parse (T_CONTEXT * ctx, FILE * fp)
+{
+  return bench_scan (fp) > 0 ? E_SUCCESS : E_BADINPUT;
+}
+
+/** @brief Time parses of the file with one parser
+ *
+ * `n' parses are timed BENCH_ROUNDS times, and the fastest round
+ * counts, so that other work on the machine does not.
+ *
+ * @param allocations set to the allocations made by one parse
+ * @return microseconds per parse
+ */
+static double
+bench_time (T_BENCH_PARSER parser, FILE * fp, long n, long *allocations)
+{
+  struct timeval start;
+  double us, best = 0;
+  long i;
+  int round;
+
+  allocs = 0;
+  bench_parse (parser, fp, NULL);
+  *allocations = allocs;
+
+  for (round = 0; round < BENCH_ROUNDS; round++)
+    {
+      gettimeofday (&start, NULL);
+      for (i = 0; i < n; i++)
+	bench_parse (parser, fp, NULL);
+      us = bench_elapsed (&start);
+      if (round == 0 || us < best)
+	best = us;
+    }
+  return best / n;
+}
+
+int
+main (int argc, char **argv)
+{
+  static const struct
+  {
+    const char *name;
+    T_BENCH_PARSER parser;
+  }
+  models[] = {
+    {"scan only", scan_parse}, {"token list", list_parse},
+    {"switch", switch_parse}, {"treeParser", tree_parse}
+  };
+  int lines = (argc > 1) ? atoi (argv[1]) : BENCH_LINES;
+  long n = (argc > 2) ? atol (argv[2]) : BENCH_ITERATIONS, tokens, count;
+  T_CONTEXT *tree, *model;
+  FB_STATUS status;
+  double us, scan_us = 0;
+  FILE *fp;
+  int m;
+
+  if (lines < 64 || n <= 0)
+    {
+      fprintf (stderr, "usage: %s [lines [iterations]]\n", argv[0]);
+      return EXIT_FAILURE;
+    }
+
+  fp = tmpfile ();
+  if (fp == NULL)
+    {
+      perror ("tmpfile");
+      return EXIT_FAILURE;
+    }
+  bench_config (fp, lines);
+
+  /* Once untimed, to check the models against treeParser() */
+  status = bench_parse (tree_parse, fp, &tree);
+  if (status != E_SUCCESS)
+    {
+      fberror ("treeParser", status);
+      return EXIT_FAILURE;
+    }
+  for (m = 1; m < sizeof (models) / sizeof (models[0]) - 1; m++)
+    {
+      status = bench_parse (models[m].parser, fp, &model);
+      if (status != E_SUCCESS || !bench_same (tree, model))
+	{
+	  fprintf (stderr, "The %s model disagrees with treeParser\n",
+		   models[m].name);
+	  return EXIT_FAILURE;
+	}
+      contextDestroy (model);
+    }
+  contextDestroy (tree);
+
+  tokens = bench_scan (fp);
+  if (tokens <= 0)
+    {
+      fprintf (stderr, "Unable to scan the configuration\n");
+      return EXIT_FAILURE;
+    }
+
+  printf ("%d lines, %ld tokens, best of %d rounds of %ld parses\n\n",
+	  lines, tokens, BENCH_ROUNDS, n);
+  printf ("%-12s %10s %12s %10s %8s\n", "Parser", "ms/parse", "lines/s",
+	  "ns/token", "allocs");
+
+  /* ns/token is the time past scanning alone, per token */
+  for (m = 0; m < sizeof (models) / sizeof (models[0]); m++)
+    {
+      us = bench_time (models[m].parser, fp, n, &count);
+      if (m == 0)
+	scan_us = us;
+      printf ("%-12s %10.3f %12.0f %10.1f %8ld\n", models[m].name,
+	      us / 1000, lines / (us / 1e6), (us - scan_us) * 1000 / tokens,
+	      count);
+    }
+
+  fclose (fp);
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,322 @@
+/*
+   fonulator 3 - foneBRIDGE configuration daemon
+   (C) 2005-2007 Redfone Communications, LLC.
+   www.red-fone.com
+
+   Configuration Cache
+*/
+/** @file
+ *
+ * With --cache, a configuration file that parsed successfully is
+ * saved beside it as a T_CACHE: the globals, span settings,
+ * priorities, DSP channel map and license keys it resolved to, in one
+ * fixed layout record. The record holds the fnv1a64() hash of the
+ * file it was compiled from, so a later run that finds the same
+ * contents maps the record and copies it into the context instead of
+ * scanning the file. Nothing is parsed then, but the copy is not free
+ * of allocation: the context owns its fb= and server= strings and its
+ * spans, so those are strdup()'d and get_span()'d as the parser would.
+ *
+ * The record is the in-memory layout of this build, and carries
+ * CACHE_VERSION along with the fonulator version and build number
+ * that wrote it. A cache written by another build, or of another
+ * size, is ignored, as is one whose hash does not match; either way
+ * the file is parsed and the cache rewritten. An upgrade thus
+ * invalidates every cache, even one whose layout did not change.
+ */
+#include "fonulator.h"
+
+#if defined(STDC_HEADERS) || defined(HAVE_STDLIB_H)
+# include <stdlib.h>
+#endif
+
+#if HAVE_UNISTD_H
+#include <unistd.h>
+#endif
+
+#include <errno.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include "ver.h"
+
+extern int vbose;
+
+/** Identifies a configuration cache */
+#define CACHE_MAGIC "FBCONF01"
+/** Layout of T_CACHE and of the records it contains (T_SPAN,
+ * KEY_ENTRY, T_DSP_USER). Bump it whenever one of them changes, or
+ * what the parser stores in them does, even if the size stays the
+ * same. */
+#define CACHE_VERSION 2
+/** Longest fb= or server= value a cache can hold, with its NUL */
+#define CACHE_STR 256
+
+/** The parsed configuration of one file */
+typedef struct
+{
+  char magic[8];		/**< CACHE_MAGIC */
+  uint32_t size;		/**< sizeof (T_CACHE) */
+  uint32_t version;		/**< CACHE_VERSION */
+  char package[16];		/**< FONULATOR_VERSION of the writer */
+  uint32_t build;		/**< BUILD_NUM of the writer */
+  uint64_t hash;		/**< fnv1a64() of the configuration file */
+
+  int32_t state;
+  int32_t span;
+  int32_t port;
+  int32_t companding;
+  uint32_t total_spans;
+  uint8_t dspconfig;
+  uint8_t dspdisabled;
+  uint8_t wpll;
+  uint8_t have_server;
+  char fonebridge[CACHE_STR];
+  char server[CACHE_STR];
+  int32_t priorities[IDT_LINKS];
+
+  uint8_t have_span[IDT_LINKS];	/**< True if spans[i] was configured */
+  T_SPAN spans[IDT_LINKS];
+
+  KEY_ENTRY all_keys[MAX_KEYS];
+  int32_t valid_keys[MAX_KEYS];
+
+  T_DSP_USER dsp;		/**< The user's DSP channel table */
+}
+T_CACHE;
+
+/** True if loadConfig() reads and writes configuration caches */
+bool cache_enabled = false;
+
+/** @return the cache file name for a configuration file, to be
+ * free'd, or NULL if memory could not be allocated */
+static char *
+cache_path (const char *config)
+{
+  size_t len = strlen (config) + sizeof (CACHE_SUFFIX);
+  char *path = malloc (len);
+
+  if (path == NULL)
+    perror ("malloc");
+  else
+    snprintf (path, len, "%s%s", config, CACHE_SUFFIX);
+  return path;
+}
+
+/** @return true if a mapped record can be used for `hash' */
+static bool
+cache_valid (const T_CACHE * c, uint64_t hash)
+{
+  return memcmp (c->magic, CACHE_MAGIC, sizeof (c->magic)) == 0
+    && c->size == sizeof (T_CACHE) && c->version == CACHE_VERSION
+    && strncmp (c->package, FONULATOR_VERSION, sizeof (c->package)) == 0
+    && c->build == BUILD_NUM && c->hash == hash
+    && memchr (c->fonebridge, '\0', CACHE_STR) != NULL
+    && memchr (c->server, '\0', CACHE_STR) != NULL;
+}
+
+/** @brief Copy a cache record into a fresh context
+ *
+ * @return success/error code
+ */
+static FB_STATUS
+cache_apply (T_CONTEXT * ctx, const T_CACHE * c)
+{
+  int i;
+
+  ctx->port = c->port;
+  ctx->companding = c->companding;
+  ctx->dspdisabled = c->dspdisabled;
+  ctx->wpll = c->wpll;
+  for (i = 0; i < IDT_LINKS; i++)
+    ctx->priorities[i] = c->priorities[i];
+
+  ctx->fonebridge = strdup (c->fonebridge);
+  if (ctx->fonebridge == NULL
+      || (c->have_server && (ctx->server = strdup (c->server)) == NULL))
+    {
+      perror ("strdup");
+      return E_SYSTEM;
+    }
+
+  for (i = 0; i < IDT_LINKS; i++)
+    {
+      T_SPAN *s;
+      if (!c->have_span[i])
+	continue;
+      s = get_span (ctx, i + 1);
+      if (s == NULL)
+	return E_SYSTEM;
+      memcpy (s, &c->spans[i], sizeof (T_SPAN));
+    }
+
+  memcpy (ctx->all_keys, c->all_keys, sizeof (ctx->all_keys));
+  for (i = 0; i < MAX_KEYS; i++)
+    ctx->valid_keys[i] = c->valid_keys[i];
+
+  if (c->dspconfig && dspconfig_user_import (ctx, &c->dsp) != E_SUCCESS)
+    return E_SYSTEM;
+  ctx->dspconfig = c->dspconfig;
+
+  ctx->total_spans = c->total_spans;
+  ctx->span = c->span;
+  ctx->state = c->state;
+  return E_SUCCESS;
+}
+
+/** @brief Load the cached configuration of a file
+ *
+ * @param ctx a context fresh from contextCreate()
+ * @param config the configuration file
+ * @param hash fnv1a64() of the configuration file
+ * @return E_SUCCESS if the context was filled in from the cache,
+ * E_BADINPUT if there is no usable cache and the context is
+ * untouched, or another error code if the context is unusable
+ */
+FB_STATUS
+cacheLoadConfig (T_CONTEXT * ctx, const char *config, uint64_t hash)
+{
+  char *path = cache_path (config);
+  struct stat st;
+  T_CACHE *c;
+  FB_STATUS status;
+  int fd;
+
+  if (path == NULL)
+    return E_BADINPUT;
+
+  fd = open (path, O_RDONLY);
+  if (fd < 0)
+    {
+      if (errno != ENOENT)
+	perror (path);
+      free (path);
+      return E_BADINPUT;
+    }
+  free (path);
+
+  if (fstat (fd, &st) != 0 || st.st_size != sizeof (T_CACHE))
+    {
+      close (fd);
+      return E_BADINPUT;
+    }
+
+  c = mmap (NULL, sizeof (T_CACHE), PROT_READ, MAP_PRIVATE, fd, 0);
+  close (fd);
+  if (c == MAP_FAILED)
+    {
+      perror ("mmap");
+      return E_BADINPUT;
+    }
+
+  if (!cache_valid (c, hash))
+    status = E_BADINPUT;
+  else
+    status = cache_apply (ctx, c);
+
+  munmap (c, sizeof (T_CACHE));
+
+  if (status == E_SUCCESS && vbose > 1)
+    printf ("Configuration loaded from %s%s\n", config, CACHE_SUFFIX);
+  return status;
+}
+
+/** @brief Save the parsed configuration of a file to its cache
+ *
+ * The cache is written to a new temporary file, created with
+ * mkstemp() in the same directory, and renamed into place. A run
+ * reading it never sees a partial record, and concurrent writers
+ * never share a temporary file.
+ *
+ * @param ctx a context filled in by treeParser()
+ * @param config the configuration file
+ * @param hash fnv1a64() of the configuration file
+ * @return success/error code
+ */
+FB_STATUS
+cacheSaveConfig (T_CONTEXT * ctx, const char *config, uint64_t hash)
+{
+  char *path, *tmp;
+  T_CACHE *c;
+  FILE *fp = NULL;
+  bool ok;
+  int i, fd;
+
+  if (ctx->fonebridge == NULL || strlen (ctx->fonebridge) >= CACHE_STR
+      || (ctx->server != NULL && strlen (ctx->server) >= CACHE_STR)
+      || ctx->span_slots > IDT_LINKS)
+    return E_BADINPUT;
+
+  c = calloc (1, sizeof (T_CACHE));
+  path = cache_path (config);
+  tmp = path ? malloc (strlen (path) + 8) : NULL;
+  if (c == NULL || tmp == NULL)
+    {
+      perror ("malloc");
+      free (c);
+      free (path);
+      return E_SYSTEM;
+    }
+  sprintf (tmp, "%s.XXXXXX", path);
+
+  memcpy (c->magic, CACHE_MAGIC, sizeof (c->magic));
+  c->size = sizeof (T_CACHE);
+  c->version = CACHE_VERSION;
+  strncpy (c->package, FONULATOR_VERSION, sizeof (c->package));
+  c->build = BUILD_NUM;
+  c->hash = hash;
+
+  c->state = ctx->state;
+  c->span = ctx->span;
+  c->port = ctx->port;
+  c->companding = ctx->companding;
+  c->total_spans = ctx->total_spans;
+  c->dspconfig = ctx->dspconfig;
+  c->dspdisabled = ctx->dspdisabled;
+  c->wpll = ctx->wpll;
+  strcpy (c->fonebridge, ctx->fonebridge);
+  if (ctx->server != NULL)
+    {
+      c->have_server = true;
+      strcpy (c->server, ctx->server);
+    }
+  for (i = 0; i < IDT_LINKS; i++)
+    c->priorities[i] = ctx->priorities[i];
+
+  for (i = 0; i < ctx->span_slots; i++)
+    if (ctx->spans[i] != NULL)
+      {
+	c->have_span[i] = true;
+	memcpy (&c->spans[i], ctx->spans[i], sizeof (T_SPAN));
+      }
+
+  memcpy (c->all_keys, ctx->all_keys, sizeof (c->all_keys));
+  for (i = 0; i < MAX_KEYS; i++)
+    c->valid_keys[i] = ctx->valid_keys[i];
+
+  if (ctx->dspconfig)
+    dspconfig_user_export (ctx, &c->dsp);
+
+  fd = mkstemp (tmp);
+  if (fd >= 0 && (fp = fdopen (fd, "wb")) == NULL)
+    close (fd);
+  ok = fp != NULL && fwrite (c, sizeof (T_CACHE), 1, fp) == 1;
+  if (fp != NULL && fclose (fp) != 0)
+    ok = false;
+  if (ok && rename (tmp, path) != 0)
+    ok = false;
+
+  if (!ok)
+    {
+      if (vbose > 0)
+	perror (path);
+      if (fd >= 0)
+	unlink (tmp);
+    }
+
+  free (c);
+  free (tmp);
+  free (path);
+  return ok ? E_SUCCESS : E_SYSTEM;
+}
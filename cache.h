@@ -0,0 +1,26 @@
+/*
+   fonulator 3 - foneBRIDGE configuration daemon
+   (C) 2005-2007 Redfone Communications, LLC.
+   www.red-fone.com
+
+   Configuration Cache
+*/
+/** @file
+ *
+ * Compiled copies of parsed configuration files, kept beside them.
+ */
+#ifndef CACHE_H
+#define CACHE_H
+
+/** Appended to a configuration file name to name its cache */
+#define CACHE_SUFFIX ".cache"
+
+/** True if loadConfig() reads and writes configuration caches */
+extern bool cache_enabled;
+
+FB_STATUS cacheLoadConfig (T_CONTEXT * ctx, const char *config,
+			   uint64_t hash);
+FB_STATUS cacheSaveConfig (T_CONTEXT * ctx, const char *config,
+			   uint64_t hash);
+
+#endif
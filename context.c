@@ -0,0 +1,234 @@
+/*
+   fonulator 3 - foneBRIDGE configuration daemon
+   (C) 2005-2007 Redfone Communications, LLC.
+   www.red-fone.com
+
+   Device Context
+*/
+/** @file
+ *
+ * Creation and destruction of the per-device T_CONTEXT. Every piece
+ * of state belonging to one device lives in its context, so any
+ * number of devices may be handled by one process.
+ */
+#include "fonulator.h"
+
+#if defined(STDC_HEADERS) || defined(HAVE_STDLIB_H)
+# include <stdlib.h>
+#endif
+
+/** @brief Free a span
+ *
+ * @param span the span to be free'd
+ */
+void
+cleanupSpan (T_SPAN * span)
+{
+  free (span);
+  span = NULL;
+}
+
+/** @brief Allocate a context for one device
+ *
+ * The context starts out in STATE_NONE with no spans and default
+ * priorities, ready for treeParser().
+ *
+ * @return the new context, or NULL if memory could not be allocated
+ */
+T_CONTEXT *
+contextCreate (void)
+{
+  T_CONTEXT *ctx;
+  int i;
+
+  ctx = calloc (1, sizeof (T_CONTEXT));
+  if (ctx == NULL)
+    {
+      perror ("calloc");
+      return NULL;
+    }
+
+  ctx->state = STATE_NONE;
+  ctx->sections = SECTION_ALL;
+  for (i = 0; i < IDT_LINKS; i++)
+    ctx->priorities[i] = -1;
+
+  ctx->dsp = dspconfig_create ();
+  if (ctx->dsp == NULL)
+    {
+      perror ("malloc");
+      free (ctx);
+      return NULL;
+    }
+
+  return ctx;
+}
+
+/** @brief Copy the parsed configuration of a context
+ *
+ * The copy owns its own spans, strings and DSP tables. Nothing read
+ * from a device is copied.
+ *
+ * @param src the context to copy
+ * @return the new context, or NULL if memory could not be allocated
+ */
+T_CONTEXT *
+contextClone (T_CONTEXT * src)
+{
+  T_CONTEXT *ctx;
+  bool ok;
+  int i;
+
+  ctx = malloc (sizeof (T_CONTEXT));
+  if (ctx == NULL)
+    {
+      perror ("malloc");
+      return NULL;
+    }
+
+  memcpy (ctx, src, sizeof (T_CONTEXT));
+  ctx->fonebridge = ctx->server = NULL;
+  ctx->spans = NULL;
+  ctx->span_slots = 0;
+  ctx->snapshot = NULL;
+  ctx->dsi = NULL;
+
+  ctx->dsp = dspconfig_clone (src->dsp);
+  ok = ctx->dsp != NULL
+    && (src->fonebridge == NULL
+	|| (ctx->fonebridge = strdup (src->fonebridge)) != NULL)
+    && (src->server == NULL || (ctx->server = strdup (src->server)) != NULL);
+
+  if (ok && src->span_slots > 0)
+    {
+      ctx->spans = calloc (src->span_slots, sizeof (T_SPAN *));
+      ok = ctx->spans != NULL;
+      if (ok)
+	ctx->span_slots = src->span_slots;
+    }
+
+  for (i = 0; ok && i < src->span_slots; i++)
+    if (src->spans[i] != NULL)
+      {
+	ctx->spans[i] = malloc (sizeof (T_SPAN));
+	ok = ctx->spans[i] != NULL;
+	if (ok)
+	  memcpy (ctx->spans[i], src->spans[i], sizeof (T_SPAN));
+      }
+
+  if (!ok)
+    {
+      perror ("malloc");
+      contextDestroy (ctx);
+      return NULL;
+    }
+  return ctx;
+}
+
+/** @return true if two spans, either of which may be missing, differ */
+static bool
+span_differs (T_SPAN * a, T_SPAN * b)
+{
+  if (a == NULL || b == NULL)
+    return a != b;
+  return memcmp (&a->config, &b->config, sizeof (IDT_LINK_CONFIG)) != 0
+    || a->slave != b->slave || a->dejitter != b->dejitter;
+}
+
+/** @return true if two strings, either of which may be NULL, differ */
+static bool
+string_differs (const char *a, const char *b)
+{
+  if (a == NULL || b == NULL)
+    return a != b;
+  return strcmp (a, b) != 0;
+}
+
+/** @brief Compare two parsed configurations section by section
+ *
+ * Both contexts must be as treeParser() left them, before
+ * prepareConfig() has filled in any spans. A span whose framing
+ * changes between E1 and T1, or whose signalling changes, also
+ * changes the default DSP channel map, so its [dsp] is reported as
+ * changed too.
+ *
+ * @param old the configuration last applied, or NULL if none was
+ * @param new the configuration to apply
+ * @return the SECTION_* mask of the sections that differ
+ */
+unsigned int
+contextDiff (T_CONTEXT * old, T_CONTEXT * new)
+{
+  T_DSP_USER a, b;
+  unsigned int sections = 0;
+  int i;
+
+  if (old == NULL)
+    return SECTION_ALL;
+
+  if (string_differs (old->fonebridge, new->fonebridge)
+      || string_differs (old->server, new->server) || old->port != new->port
+      || old->wpll != new->wpll
+      || memcmp (old->priorities, new->priorities,
+		 sizeof (old->priorities)) != 0)
+    sections |= SECTION_GLOBALS;
+
+  /* Spans left out of a configuration are copied from the last one */
+  if (old->total_spans != new->total_spans)
+    sections |= SECTION_SPANS | SECTION_DSP;
+
+  for (i = 0; i < IDT_LINKS; i++)
+    {
+      T_SPAN *s = i < old->span_slots ? old->spans[i] : NULL;
+      T_SPAN *t = i < new->span_slots ? new->spans[i] : NULL;
+
+      if (!span_differs (s, t))
+	continue;
+      sections |= SECTION_SPAN (i + 1);
+      if (s == NULL || t == NULL || s->config.E1Mode != t->config.E1Mode
+	  || s->config.rbs_en != t->config.rbs_en)
+	sections |= SECTION_DSP;
+    }
+
+  dspconfig_user_export (old, &a);
+  dspconfig_user_export (new, &b);
+  if (old->dspconfig != new->dspconfig || old->dspdisabled != new->dspdisabled
+      || old->companding != new->companding
+      || memcmp (&a, &b, sizeof (T_DSP_USER)) != 0)
+    sections |= SECTION_DSP;
+
+  if (memcmp (old->valid_keys, new->valid_keys, sizeof (old->valid_keys)))
+    sections |= SECTION_KEYS;
+  for (i = 0; i < MAX_KEYS; i++)
+    if (new->valid_keys[i]
+	&& memcmp (&old->all_keys[i], &new->all_keys[i], sizeof (KEY_ENTRY)))
+      sections |= SECTION_KEYS;
+
+  return sections;
+}
+
+/** @brief Free a context and everything it owns
+ *
+ * @param ctx the context, may be NULL
+ */
+void
+contextDestroy (T_CONTEXT * ctx)
+{
+  int i;
+
+  if (ctx == NULL)
+    return;
+
+  for (i = 0; i < ctx->span_slots; i++)
+    cleanupSpan (ctx->spans[i]);
+  free (ctx->spans);
+
+  if (ctx->fonebridge)
+    free (ctx->fonebridge);
+  if (ctx->server)
+    free (ctx->server);
+
+  dspconfig_destroy (ctx->dsp);
+  statusCleanup (ctx);
+  free (ctx);
+}
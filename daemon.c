@@ -0,0 +1,402 @@
+/*
+   fonulator 3 - foneBRIDGE configuration daemon
+   (C) 2005-2007 Redfone Communications, LLC.
+   www.red-fone.com
+
+   Resident Daemon
+*/
+/** @file
+ *
+ * A resident fonulator, run with --daemon or as fonulatord. It keeps
+ * the parsed configuration, libfb context and device snapshot of
+ * every device it has been asked about, so a request costs one local
+ * round trip plus whatever the device itself has to be asked.
+ *
+ * Clients connect to a Unix domain socket and send one request per
+ * line, naming a device by its configuration file:
+ *
+ *   query <config>              check the device and print its status
+ *   stats <config>              print the link statistics
+ *   plan <config> [save|clear]  print what apply would send
+ *   apply <config> [save|clear] configure the device
+ *   reboot <config>             reboot the device
+ *   forget <config>             close the device
+ *
+ * Whatever the request prints is sent back, followed by a line
+ * reading "OK" or "ERR <code>". A configuration file is parsed again
+ * when it changes on disk. Clients are served one at a time.
+ */
+#include "fonulator.h"
+
+#if defined(STDC_HEADERS) || defined(HAVE_STDLIB_H)
+# include <stdlib.h>
+#endif
+
+#if HAVE_UNISTD_H
+#include <unistd.h>
+#endif
+
+#include <errno.h>
+#include <signal.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/time.h>
+#include <sys/un.h>
+
+extern int vbose;
+
+/** Seconds a client may stay silent before it is dropped */
+#define DAEMON_CLIENT_TIMEOUT 30
+
+/** A device kept open by the daemon */
+typedef struct
+{
+  char *config;			/**< Configuration file naming the device */
+  uint64_t hash;		/**< fnv1a64() of the file it was parsed from */
+  T_CONTEXT *ctx;
+  libfb_t *fb;
+  bool fresh;			/**< Snapshot was just read by connecting */
+}
+T_DAEMON_DEVICE;
+
+static volatile sig_atomic_t daemon_stop = 0;
+
+/** @brief SIGINT/SIGTERM handler: stop serving */
+static void
+daemon_signal (int sig)
+{
+  daemon_stop = 1;
+}
+
+/** @brief Close a device and free its entry */
+static void
+daemon_device_destroy (T_DAEMON_DEVICE * dev)
+{
+  if (dev->fb)
+    libfb_destroy (dev->fb);
+  contextDestroy (dev->ctx);
+  free (dev->config);
+  free (dev);
+}
+
+/** @return the list element holding the device for `config', or NULL */
+static DListElmt *
+daemon_find (DList * devices, const char *config)
+{
+  DListElmt *element;
+
+  for (element = dlist_head (devices); element != NULL;
+       element = dlist_next (element))
+    {
+      T_DAEMON_DEVICE *dev = dlist_data (element);
+      if (strcmp (dev->config, config) == 0)
+	return element;
+    }
+  return NULL;
+}
+
+/** @brief Close the device for `config', if it is open */
+static void
+daemon_forget (DList * devices, const char *config)
+{
+  DListElmt *element;
+  T_DAEMON_DEVICE *dev;
+
+  element = daemon_find (devices, config);
+  if (element == NULL)
+    return;
+
+  dlist_remove (devices, element, (void **) &dev);
+  daemon_device_destroy (dev);
+}
+
+/** @brief Find or open the device named by a configuration file
+ *
+ * An open device is reused as long as the contents of its
+ * configuration file hash the same. The modification time is not
+ * enough: it has one second resolution on some filesystems, so two
+ * edits within a second would go unnoticed. Otherwise the file is
+ * parsed into a new context and the device connected to again.
+ *
+ * @param devices the open devices
+ * @param config the configuration file
+ * @return the device, or NULL on failure
+ */
+static T_DAEMON_DEVICE *
+daemon_device (DList * devices, const char *config)
+{
+  DListElmt *element;
+  T_DAEMON_DEVICE *dev;
+  FILE *cf;
+  uint64_t hash;
+  FB_STATUS status;
+
+  cf = fopen (config, "r");
+  if (cf == NULL)
+    {
+      fprintf (stderr, "Error opening configuration file %s.\n", config);
+      return NULL;
+    }
+  status = fnv1a64_file (cf, &hash);
+  fclose (cf);
+  if (status != E_SUCCESS)
+    return NULL;
+
+  element = daemon_find (devices, config);
+  if (element != NULL)
+    {
+      dev = dlist_data (element);
+      if (dev->hash == hash)
+	return dev;
+      daemon_forget (devices, config);
+    }
+
+  dev = calloc (1, sizeof (T_DAEMON_DEVICE));
+  if (dev == NULL || (dev->config = strdup (config)) == NULL
+      || (dev->ctx = contextCreate ()) == NULL)
+    {
+      perror ("malloc");
+      if (dev != NULL)
+	free (dev->config);
+      free (dev);
+      return NULL;
+    }
+  dev->hash = hash;
+  dev->ctx->interactive = false;
+
+  if (loadConfig (dev->ctx, config) != E_SUCCESS
+      || (dev->fb = connectDevice (dev->ctx)) == NULL)
+    {
+      daemon_device_destroy (dev);
+      return NULL;
+    }
+
+  dev->fresh = true;
+  dlist_ins_next (devices, dlist_tail (devices), dev);
+  return dev;
+}
+
+/** @brief Carry out one request line
+ *
+ * @param devices the open devices
+ * @param line the request, modified
+ * @return success/error code
+ */
+static FB_STATUS
+daemon_request (DList * devices, char *line)
+{
+  char *save, *verb, *config, *opt;
+  bool save_config = false, clear_config = false;
+  T_DAEMON_DEVICE *dev;
+  FB_STATUS status;
+
+  verb = strtok_r (line, " \t\r\n", &save);
+  config = strtok_r (NULL, " \t\r\n", &save);
+  opt = strtok_r (NULL, " \t\r\n", &save);
+
+  if (verb == NULL || config == NULL)
+    {
+      printf ("usage: query|stats|plan|apply|reboot|forget <config> "
+	      "[save|clear]\n");
+      return E_BADINPUT;
+    }
+
+  if (opt != NULL)
+    {
+      if (strcmp (opt, "save") == 0)
+	save_config = true;
+      else if (strcmp (opt, "clear") == 0)
+	clear_config = true;
+      else
+	{
+	  printf ("Unknown option %s\n", opt);
+	  return E_BADINPUT;
+	}
+    }
+
+  if (strcmp (verb, "forget") == 0)
+    {
+      daemon_forget (devices, config);
+      return E_SUCCESS;
+    }
+
+  if (strcmp (verb, "query") && strcmp (verb, "stats")
+      && strcmp (verb, "plan") && strcmp (verb, "apply")
+      && strcmp (verb, "reboot"))
+    {
+      printf ("Unknown request %s\n", verb);
+      return E_BADINPUT;
+    }
+
+  dev = daemon_device (devices, config);
+  if (dev == NULL)
+    return E_FBLIB;
+
+  if (strcmp (verb, "stats") == 0)
+    return statusRunPMON (dev->ctx, dev->fb) ? E_SUCCESS : E_FBLIB;
+
+  if (strcmp (verb, "reboot") == 0)
+    {
+      status = simpleReboot (dev->fb) ? E_SUCCESS : E_FBLIB;
+      daemon_forget (devices, config);
+      return status;
+    }
+
+  /* Everything else needs the current state of the device */
+  status = dev->fresh ? E_SUCCESS : statusSnapshot (dev->ctx, dev->fb);
+  dev->fresh = false;
+  if (status != E_SUCCESS)
+    {
+      fprintf (stderr, "Device of %s did not answer.\n", config);
+      return status;
+    }
+
+  if (strcmp (verb, "query") == 0)
+    return queryFonebridge (dev->ctx, dev->fb) ? E_SUCCESS : E_FBLIB;
+
+  if (strcmp (verb, "plan") == 0)
+    return planConfig (dev->ctx, save_config, clear_config);
+
+  status = prepareConfig (dev->ctx, dev->fb);
+  if (status == E_SUCCESS)
+    status = configureFonebridge (dev->ctx, dev->fb);
+  if (status == E_SUCCESS && (save_config || clear_config)
+      && storeConfig (dev->fb, clear_config) != FBLIB_ESUCCESS)
+    status = E_FBLIB;
+  return status;
+}
+
+/** @brief Serve the requests of one client until it hangs up
+ *
+ * stdout and stderr are pointed at the client while a request runs,
+ * so everything the request prints is sent back to it.
+ */
+static void
+daemon_serve (DList * devices, int client)
+{
+  struct timeval timeout = { DAEMON_CLIENT_TIMEOUT, 0 };
+  char line[1024];
+  FILE *in;
+  int out, err;
+
+  setsockopt (client, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof (timeout));
+
+  in = fdopen (client, "r");
+  if (in == NULL)
+    {
+      perror ("fdopen");
+      close (client);
+      return;
+    }
+
+  while (!daemon_stop && fgets (line, sizeof (line), in) != NULL)
+    {
+      FB_STATUS status;
+
+      fflush (stdout);
+      fflush (stderr);
+      out = dup (STDOUT_FILENO);
+      err = dup (STDERR_FILENO);
+      dup2 (client, STDOUT_FILENO);
+      dup2 (client, STDERR_FILENO);
+
+      status = daemon_request (devices, line);
+      if (status == E_SUCCESS)
+	printf ("OK\n");
+      else
+	printf ("ERR %d\n", status);
+
+      fflush (stdout);
+      fflush (stderr);
+      dup2 (out, STDOUT_FILENO);
+      dup2 (err, STDERR_FILENO);
+      close (out);
+      close (err);
+    }
+
+  fclose (in);
+}
+
+/** @brief Run the resident daemon until SIGINT or SIGTERM
+ *
+ * The socket is created accessible to its owner only, since anyone
+ * who can connect may reconfigure or reboot the devices.
+ *
+ * @param path the Unix domain socket to listen on
+ * @return EXIT_SUCCESS on a clean shutdown
+ */
+int
+runDaemon (const char *path)
+{
+  struct sockaddr_un addr;
+  struct sigaction sa;
+  DList devices;
+  mode_t mask;
+  int fd;
+
+  memset (&addr, 0, sizeof (addr));
+  addr.sun_family = AF_UNIX;
+  if (strlen (path) >= sizeof (addr.sun_path))
+    {
+      fprintf (stderr, "Socket path %s is too long.\n", path);
+      return EXIT_FAILURE;
+    }
+  strcpy (addr.sun_path, path);
+
+  fd = socket (AF_UNIX, SOCK_STREAM, 0);
+  if (fd < 0)
+    {
+      perror ("socket");
+      return EXIT_FAILURE;
+    }
+
+  unlink (path);
+  mask = umask (077);
+  if (bind (fd, (struct sockaddr *) &addr, sizeof (addr)) != 0)
+    {
+      perror ("bind");
+      umask (mask);
+      close (fd);
+      return EXIT_FAILURE;
+    }
+  umask (mask);
+
+  if (listen (fd, 8) != 0)
+    {
+      perror ("listen");
+      close (fd);
+      unlink (path);
+      return EXIT_FAILURE;
+    }
+
+  /* No SA_RESTART, so a signal interrupts accept() */
+  memset (&sa, 0, sizeof (sa));
+  sa.sa_handler = daemon_signal;
+  sigemptyset (&sa.sa_mask);
+  sigaction (SIGINT, &sa, NULL);
+  sigaction (SIGTERM, &sa, NULL);
+  /* A client hanging up early must not kill the daemon */
+  signal (SIGPIPE, SIG_IGN);
+
+  dlist_init (&devices, (void (*)(void *)) (daemon_device_destroy));
+
+  if (vbose > 0)
+    printf ("Listening on %s\n", path);
+
+  while (!daemon_stop)
+    {
+      int client = accept (fd, NULL, NULL);
+      if (client < 0)
+	{
+	  if (errno != EINTR)
+	    perror ("accept");
+	  continue;
+	}
+      daemon_serve (&devices, client);
+    }
+
+  dlist_destroy (&devices);
+  close (fd);
+  unlink (path);
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,26 @@
+/*
+   fonulator 3 - foneBRIDGE configuration daemon
+   (C) 2005-2007 Redfone Communications, LLC.
+   www.red-fone.com
+
+   DOOF Definitions
+*/
+/** @file
+ *
+ * DOOF protocol constants fonulator needs that libfb does not export.
+ * The framing of the requests is left entirely to libfb.
+ */
+#ifndef DOOF_H
+#define DOOF_H
+
+/** UDP configuration socket port on foneBRIDGE devices */
+#define DOOF_UDP_PORT 1024
+
+/* Commands libfb does not define yet */
+#ifndef DOOF_CMD_PCONFIG_STORE
+#define DOOF_CMD_PCONFIG_STORE 39	/* Execute a store p_config command */
+#define DOOF_CMD_PCONFIG_CLEAR 40	/* Execute a clear on the p_config
+					   structure */
+#endif
+
+#endif
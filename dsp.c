@@ -13,12 +13,13 @@
  * DSP Configuration Implementation
 
  * user_config represents the configuration from the user's
- * prespective, the first channel is '1' and the last is '124'. This
- * corresponds to 31 channels times 4 spans. 
+ * prespective, the first channel is '1' and the last is 31 or 24 per
+ * span, 124 on a 4 span E1 device.
  *
- * Internally the DSP has 128 channels and so 4 channels are
- * unused. Our DSP routines are responsible for mapping from the
- * user's perspective with 124 channels to the DSP's perspective with 128 channels.
+ * Internally the DSP has 32 channels per span, as many as the device
+ * reports, and so 1 or 8 channels per span are unused. Our DSP
+ * routines are responsible for mapping from the user's perspective to
+ * the DSP's perspective.
 
  */
 #include "fonulator.h"
@@ -27,74 +28,284 @@
 # include <stdlib.h>
 #endif
 
+extern int vbose;
 
-/** @struct dsp_config
- * 
- * This structure represents the 128 channels on the DSP. It is
- * configured into the desired representation (E1, T1, Data, etc) and
- * then programmed to the DSP. This is taken from user_config but is
- * translated into the DSP's perspective.
- */
 
-static struct
+/** @struct T_DSP_PLANES
+ *
+ * The type of every DSP channel, held as one bit plane per
+ * dsp_chantype: bit (c % 32) of word c / 32 of plane `type' is set if
+ * channel c is of that type. Each channel is in exactly one plane, so
+ * the channels of one type and span are a single word, and two tables
+ * of the same size hold the same configuration if and only if their
+ * planes are equal.
+ *
+ * Tables are sized at run time, from the device for the DSP's own
+ * tables and from the highest channel named for the user's. A channel
+ * beyond the end of a table is of type `fill'.
+ */
+typedef struct
 {
-  dsp_chantype dsp[128];
+  int channels;			/**< Channels held, a multiple of 32 */
+  dsp_chantype fill;		/**< Type of the channels beyond them */
+  uint32_t *bits;		/**< DSP_MAX planes of channels / 32 words */
 }
-dsp_config;
+T_DSP_PLANES;
 
-/** @struct flash_config
+/** @struct dspstate
  *
- * Global structure holding state of all 128 channels as configured in
- * device currently.
+ * The DSP channel tables of one device, owned by its T_CONTEXT.
  */
-static struct
+struct dspstate
+{
+  /** This represents the channels on the DSP. It is configured into
+   * the desired representation (E1, T1, Data, etc) and then
+   * programmed to the DSP. This is taken from user_config but is
+   * translated into the DSP's perspective.
+   */
+  T_DSP_PLANES dsp_config;
+
+  /** State of all channels as configured in device currently. */
+  T_DSP_PLANES flash_config;
+
+  /** State of the channels as configured by the user, from their
+   * perspective
+   */
+  T_DSP_PLANES user_config;
+
+  /** Highest channel of user_config the user named, 0 if none */
+  int user_max;
+};
+
+/** @return a mask of `n' bits, n from 0 to 32 */
+static inline uint32_t
+planes_bits (int n)
 {
-  dsp_chantype dsp[128];
+  return (n >= 32) ? 0xFFFFFFFFU : ((uint32_t) 1 << n) - 1;
 }
-flash_config;
 
-/** @struct user_config
+/** @return plane `type' of a table */
+static inline uint32_t *
+planes_plane (T_DSP_PLANES * p, dsp_chantype type)
+{
+  return p->bits + type * (p->channels / 32);
+}
+
+/** @return word `w' of plane `type', past the end of the table too */
+static inline uint32_t
+planes_word (T_DSP_PLANES * p, dsp_chantype type, int w)
+{
+  if (w < p->channels / 32)
+    return planes_plane (p, type)[w];
+  return (type == p->fill) ? 0xFFFFFFFFU : 0;
+}
+
+/** @brief Resize a table
+ *
+ * Channels kept keep their type and channels added are of the fill
+ * type.
  *
- * Global structure holding state of all 128 channels as configured by
- * the user, from their perspective
+ * @param p the table
+ * @param channels the channels it must hold, rounded up to 32
+ * @return success/error code
  */
-static struct
+static FB_STATUS
+planes_resize (T_DSP_PLANES * p, int channels)
 {
-  dsp_chantype dsp[128];
+  int words = (channels + 31) / 32, w;
+  uint32_t *bits;
+  dsp_chantype t;
+
+  if (words == p->channels / 32)
+    return E_SUCCESS;
+
+  bits = malloc ((words ? words : 1) * DSP_MAX * sizeof (uint32_t));
+  if (bits == NULL)
+    {
+      perror ("malloc");
+      return E_SYSTEM;
+    }
+
+  for (t = DSP_DATA; t < DSP_MAX; t++)
+    for (w = 0; w < words; w++)
+      bits[t * words + w] = planes_word (p, t, w);
+
+  free (p->bits);
+  p->bits = bits;
+  p->channels = words * 32;
+  return E_SUCCESS;
 }
-user_config;
 
-/** File-global pointer to GPAK flash configuration. Set by
-    dspconfig_get_gpak_flash() */
-static GPAK_FLASH_PARMS *gpak_flash;
+/** @brief Set every channel of a table to `type'
+ *
+ * A `type' of DSP_MAX leaves every channel out of every plane.
+ */
+static void
+planes_fill (T_DSP_PLANES * p, dsp_chantype type)
+{
+  int words = p->channels / 32;
+
+  p->fill = type;
+  if (words == 0)
+    return;
+  memset (p->bits, 0, words * DSP_MAX * sizeof (uint32_t));
+  if (type < DSP_MAX)
+    memset (planes_plane (p, type), 0xFF, words * sizeof (uint32_t));
+}
 
-/** @brief Sets gpak_flash
+/** @brief Set channels first to first + n - 1 of a table to `type'
  *
- * @param f pointer to libfb context
- * @return FB_STATUS code
+ * The table grows to hold them if it must.
  *
- * Retrieves the GPAK flash parameters from the target device.
+ * @return success/error code
  */
 static FB_STATUS
-dspconfig_get_gpak_flash (libfb_t * f)
+planes_set_range (T_DSP_PLANES * p, int first, int n, dsp_chantype type)
 {
-  int status;
-  if (gpak_flash == NULL)
+  if (first + n > p->channels
+      && planes_resize (p, first + n) != E_SUCCESS)
+    return E_SYSTEM;
+
+  while (n > 0)
     {
-      gpak_flash = malloc (sizeof (GPAK_FLASH_PARMS));
-      if (gpak_flash == NULL)
-	{
-	  perror ("malloc");
-	  return E_SYSTEM;
-	}
+      int w = first / 32, b = first % 32;
+      int k = (n < 32 - b) ? n : 32 - b;
+      uint32_t bits = planes_bits (k) << b;
+      dsp_chantype t;
+
+      for (t = DSP_DATA; t < DSP_MAX; t++)
+	planes_plane (p, t)[w] &= ~bits;
+      planes_plane (p, type)[w] |= bits;
+
+      first += k;
+      n -= k;
     }
+  return E_SUCCESS;
+}
 
-  memset (gpak_flash, 0, sizeof (GPAK_FLASH_PARMS));
-  status = custom_cmd_reply (f, DOOF_CMD_GET_GPAK_FLASH_PARMS, 0, NULL, 0,
-			     (char *) gpak_flash, sizeof (GPAK_FLASH_PARMS));
-  return status;
+/** @return the type of channel `chan' of a table */
+static dsp_chantype
+planes_get (T_DSP_PLANES * p, int chan)
+{
+  dsp_chantype t;
+
+  for (t = DSP_DATA; t < DSP_MAX; t++)
+    if (planes_word (p, t, chan / 32) & ((uint32_t) 1 << (chan % 32)))
+      break;
+  return t;
 }
 
+/** @return `n' bits, n up to 32, of a plane starting at channel `first' */
+static uint32_t
+planes_extract (T_DSP_PLANES * p, dsp_chantype type, int first, int n)
+{
+  int w = first / 32, b = first % 32;
+  uint32_t bits = planes_word (p, type, w) >> b;
+
+  if (b + n > 32)
+    bits |= planes_word (p, type, w + 1) << (32 - b);
+  return bits & planes_bits (n);
+}
+
+/** @brief Copy the types of `n' channels from one table to another
+ *
+ * Channels past the end of `src' are copied as its fill type. `dst'
+ * must already hold channels `to' to `to + n - 1'.
+ *
+ * @param dst the table to copy to
+ * @param to the first channel to copy to
+ * @param src the table to copy from
+ * @param from the first channel to copy from
+ * @param n the number of channels
+ */
+static void
+planes_copy (T_DSP_PLANES * dst, int to, T_DSP_PLANES * src, int from, int n)
+{
+  while (n > 0)
+    {
+      int w = to / 32, b = to % 32;
+      int k = (n < 32 - b) ? n : 32 - b;
+      uint32_t keep = ~(planes_bits (k) << b);
+      dsp_chantype t;
+
+      for (t = DSP_DATA; t < DSP_MAX; t++)
+	planes_plane (dst, t)[w] = (planes_plane (dst, t)[w] & keep)
+	  | (planes_extract (src, t, from, k) << b);
+
+      to += k;
+      from += k;
+      n -= k;
+    }
+}
+
+/** @brief Allocate the DSP channel tables for one device
+ *
+ * The tables start out empty, with every channel DSP_DATA, and are
+ * sized by configureDSP() once the device is known.
+ *
+ * @return the tables, or NULL if memory could not be allocated
+ */
+struct dspstate *
+dspconfig_create (void)
+{
+  struct dspstate *d = calloc (1, sizeof (struct dspstate));
+
+  if (d == NULL)
+    return NULL;
+
+  planes_fill (&d->dsp_config, DSP_DATA);
+  planes_fill (&d->flash_config, DSP_DATA);
+  planes_fill (&d->user_config, DSP_DATA);
+  return d;
+}
+
+/** @brief Copy a table, which must be empty */
+static FB_STATUS
+planes_clone (T_DSP_PLANES * dst, T_DSP_PLANES * src)
+{
+  dst->fill = src->fill;
+  if (planes_resize (dst, src->channels) != E_SUCCESS)
+    return E_SYSTEM;
+  if (src->channels > 0)
+    memcpy (dst->bits, src->bits,
+	    DSP_MAX * src->channels / 32 * sizeof (uint32_t));
+  return E_SUCCESS;
+}
+
+/** @brief Copy the DSP channel tables of a device
+ *
+ * @return the copy, or NULL if memory could not be allocated
+ */
+struct dspstate *
+dspconfig_clone (struct dspstate *d)
+{
+  struct dspstate *c = calloc (1, sizeof (struct dspstate));
+
+  if (c == NULL)
+    return NULL;
+
+  c->user_max = d->user_max;
+  if (planes_clone (&c->dsp_config, &d->dsp_config) != E_SUCCESS
+      || planes_clone (&c->flash_config, &d->flash_config) != E_SUCCESS
+      || planes_clone (&c->user_config, &d->user_config) != E_SUCCESS)
+    {
+      dspconfig_destroy (c);
+      return NULL;
+    }
+  return c;
+}
+
+/** @brief Free the DSP channel tables of a device */
+void
+dspconfig_destroy (struct dspstate *d)
+{
+  if (d == NULL)
+    return;
+  free (d->dsp_config.bits);
+  free (d->flash_config.bits);
+  free (d->user_config.bits);
+  free (d);
+}
 
 /** @brief Transforms a dsp_chantype value into its string representation.
  * 
@@ -131,89 +342,95 @@ dspchan_to_string (dsp_chantype chan)
  * This does not actually program the DSP. It only sets up the
  * dsp_config structure.
  *
+ * Span n uses the 32 DSP channels from 32 * (n - 1). A span with no
+ * DSP channels of its own is left alone.
+ *
+ * @param ctx the device context
  * @param span The span you wish to set up a default DSP configuration for
  * @return FB_STATUS code indicating success or failure 
  */
 
 FB_STATUS
-dspconfig_setdefault (T_SPAN * span)
+dspconfig_setdefault (T_CONTEXT * ctx, T_SPAN * span)
 {
-  int num = span->num;
-  int maxchan, prichan, i;
-  if (num < 1 || num > 4)
+  int num, maxchan, prichan;
+
+  if (span == NULL)
+    return E_BADVALUE;
+  num = span->num;
+  if (num < 1 || 32 * num > ctx->dsp->dsp_config.channels)
     return E_BADVALUE;
 
   maxchan = (span->config.E1Mode) ? 31 : 24;
   prichan = (span->config.E1Mode) ? 16 : 24;
 
-  for (i = 0; i < maxchan; i++)
-    {
-      int I;
-
-      I = 32 * (num - 1) + (i);
-
-      if (!span->config.rbs_en && (i + 1) == prichan)
-	{
-	  dsp_config.dsp[I] = DSP_DATA;
-	}
-      else
-	{
-	  dsp_config.dsp[I] = DSP_B;
-	}
-    }
+  planes_set_range (&ctx->dsp->dsp_config, 32 * (num - 1), maxchan, DSP_B);
+  if (!span->config.rbs_en)
+    planes_set_range (&ctx->dsp->dsp_config, 32 * (num - 1) + prichan - 1,
+		      1, DSP_DATA);
 
   return E_SUCCESS;
 }
 
 /** @brief Return current mask for channels of particular type and span 
  *
+ * @param ctx the device context
  * @param span the span number we are interested in
  * @param type which type of channels we are interested in
  * @return A bitmask representing which channels are currently set to the specified type in the specified span
  */
 uint32_t
-dspconfig_getmask (int span, dsp_chantype type)
+dspconfig_getmask (T_CONTEXT * ctx, int span, dsp_chantype type)
 {
-  uint32_t mask = 0;
-  int i;
-
-  for (i = 0; i < 32; i++)
-    {
-      int j;
-      j = 32 * span + i;
-      if (dsp_config.dsp[j] == type)
-	mask |= 1 << i;
-    }
-  return mask;
+  if (span >= ctx->dsp->dsp_config.channels / 32)
+    return 0;
+  return planes_plane (&ctx->dsp->dsp_config, type)[span];
 }
 
 
 /** @brief fill in the flash_config struct from the native DSP data
-    structure */
+    structure
+ *
+ * @param ctx the device context
+ * @param flashes the type of each DSP channel
+ * @param channels the number of DSP channels, a multiple of 32
+ * @return success/error code
+ */
 FB_STATUS
-dspconfig_initflash (unsigned char *flashes)
+dspconfig_initflash (T_CONTEXT * ctx, unsigned char *flashes, int channels)
 {
+  T_DSP_PLANES *p = &ctx->dsp->flash_config;
   int i;
-  for (i = 0; i < 128; i++)
-    flash_config.dsp[i] = flashes[i];
+
+  if (planes_resize (p, channels) != E_SUCCESS)
+    return E_SYSTEM;
+
+  /* A channel of unknown type is left out of every plane, so it
+   * differs from any configuration */
+  planes_fill (p, DSP_MAX);
+  for (i = 0; i < channels; i++)
+    if (flashes[i] < DSP_MAX)
+      planes_plane (p, flashes[i])[i / 32] |= (uint32_t) 1 << (i % 32);
   return E_SUCCESS;
 }
 
 
 /** @brief Print the current DSP configuration
+ * @param ctx the device context
  * @param flash prints the flash configuration if true, if false prints the dsp_config configuration
  *
  * If the parameter flash is false then the desired (parsed)
  * configuration is printed. Useful for debugging parsing routines.
  */
 FB_STATUS
-dspconfig_showconfig (bool flash)
+dspconfig_showconfig (T_CONTEXT * ctx, bool flash)
 {
+  struct dspstate *d = ctx->dsp;
   int i;
-  for (i = 0; i < 128; i++)
+  for (i = 0; i < d->dsp_config.channels; i++)
     printf ("%s[%03d] is %s\n", flash ? "flash" : "dsp", i,
-	    dspchan_to_string (flash ? flash_config.dsp[i] : dsp_config.
-			       dsp[i]));
+	    dspchan_to_string (planes_get (flash ? &d->flash_config :
+					   &d->dsp_config, i)));
   return E_SUCCESS;
 }
 
@@ -222,82 +439,145 @@ dspconfig_showconfig (bool flash)
  * @return true if flash_config and dsp_config do not represent the same configuration 
  */
 bool
-dspconfig_differ ()
+dspconfig_differ (T_CONTEXT * ctx)
 {
-  int i = 0;
-  bool differ = false;
-  do
-    {
-      if (dsp_config.dsp[i] != flash_config.dsp[i])
-	differ = true;
+  T_DSP_PLANES *dsp = &ctx->dsp->dsp_config, *flash = &ctx->dsp->flash_config;
 
-      i++;
-    }
-  while (i < 128 && !differ);
-  return differ;
+  return dsp->channels != flash->channels
+    || memcmp (dsp->bits, flash->bits,
+	       DSP_MAX * dsp->channels / 32 * sizeof (uint32_t)) != 0;
 }
 
-/** @brief places dsp_config into default state (all channels off) */
-void
-dspconfig_init (void)
+/**
+ *
+ * @return true if the channels set to `type' differ between
+ * flash_config and dsp_config
+ */
+static bool
+dspconfig_mode_differs (T_CONTEXT * ctx, dsp_chantype type)
 {
-  int i;
-  for (i = 0; i < 128; i++)
-    dsp_config.dsp[i] = DSP_OFF;
+  T_DSP_PLANES *dsp = &ctx->dsp->dsp_config, *flash = &ctx->dsp->flash_config;
+
+  return dsp->channels != flash->channels
+    || memcmp (planes_plane (dsp, type), planes_plane (flash, type),
+	       dsp->channels / 32 * sizeof (uint32_t)) != 0;
+}
+
+/** @brief places dsp_config into default state (all channels off)
+ *
+ * @param ctx the device context
+ * @param channels the number of DSP channels, a multiple of 32
+ * @return success/error code
+ */
+FB_STATUS
+dspconfig_init (T_CONTEXT * ctx, int channels)
+{
+  if (planes_resize (&ctx->dsp->dsp_config, channels) != E_SUCCESS)
+    return E_SYSTEM;
+  planes_fill (&ctx->dsp->dsp_config, DSP_OFF);
+  return E_SUCCESS;
 }
 
 
 /** @brief places user_config into default state (all channels off) */
 void
-dspconfig_init_userconfig (void)
+dspconfig_init_userconfig (T_CONTEXT * ctx)
 {
-  int i;
-
-  smachine.dspconfig = true;
-
-  for (i = 0; i < 128; i++)
-    user_config.dsp[i] = DSP_OFF;
+  ctx->dspconfig = true;
+  planes_fill (&ctx->dsp->user_config, DSP_OFF);
+  ctx->dsp->user_max = 0;
 }
 
 
 /** @brief sets user_config channel `chan' into state `type'
  *
+ * Channels are checked against the device by
+ * dspconfig_user_to_native(), since the configuration is parsed
+ * before the device is known.
+ *
+ * @param ctx the device context
  * @param chan the channel to configure
  * @param type the type to set
  * @return success/error code
  * 
  */
 FB_STATUS
-dspconfig_set_userdigit (dsp_chantype type, int chan)
+dspconfig_set_userdigit (T_CONTEXT * ctx, dsp_chantype type, int chan)
 {
-  if (chan < 1 || chan > 124)
-    {
-      /* Not a possible user-land channel */
-      return E_BADINPUT;
-    }
-  user_config.dsp[chan] = type;
-  return E_SUCCESS;
+  return dspconfig_set_userrange (ctx, type, chan, chan);
 }
 
 /** @brief sets a range of user_config channels all to the same type
  *
  * All channels in the range {min,max} are set to `type', min and max
- * inclusive.
+ * inclusive. A single channel is a range with min equal to max.
  *
+ * @param ctx the device context
  * @param type the type to set
  * @param min the lower channel
  * @param max the upper channel
  * @return succes/error code
  */
 FB_STATUS
-dspconfig_set_userrange (dsp_chantype type, int min, int max)
+dspconfig_set_userrange (T_CONTEXT * ctx, dsp_chantype type, int min,
+			 int max)
 {
-  int i;
-  if (min < 1 || min > 123 || max < 2 || max > 124 || min >= max)
+  struct dspstate *d = ctx->dsp;
+
+  /* Not possible user-land channels on any device */
+  if (min < 1 || max >= DSP_MAX_CHANNELS || min > max)
     return E_BADINPUT;
 
-  for (i = min; i <= max; i++)
-    user_config.dsp[i] = type;
+  if (planes_set_range (&d->user_config, min, max - min + 1, type)
+      != E_SUCCESS)
+    return E_SYSTEM;
+  if (max > d->user_max)
+    d->user_max = max;
+  return E_SUCCESS;
+}
+
+/** @brief Copy user_config out for the configuration cache
+ *
+ * @param ctx the device context
+ * @param out where to store the table
+ */
+void
+dspconfig_user_export (T_CONTEXT * ctx, T_DSP_USER * out)
+{
+  T_DSP_PLANES *p = &ctx->dsp->user_config;
+
+  memset (out, 0, sizeof (T_DSP_USER));
+  out->channels = p->channels;
+  out->fill = p->fill;
+  out->user_max = ctx->dsp->user_max;
+  if (p->channels > 0)
+    memcpy (out->bits, p->bits,
+	    DSP_MAX * p->channels / 32 * sizeof (uint32_t));
+}
+
+/** @brief Restore user_config from the configuration cache
+ *
+ * @param ctx the device context
+ * @param in the table saved by dspconfig_user_export()
+ * @return success/error code
+ */
+FB_STATUS
+dspconfig_user_import (T_CONTEXT * ctx, const T_DSP_USER * in)
+{
+  T_DSP_PLANES *p = &ctx->dsp->user_config;
+
+  if (in->channels < 0 || in->channels > DSP_MAX_CHANNELS
+      || in->channels % 32 != 0 || in->fill < DSP_DATA
+      || in->fill > DSP_MAX)
+    return E_BADINPUT;
+
+  if (planes_resize (p, in->channels) != E_SUCCESS)
+    return E_SYSTEM;
+  if (in->channels > 0)
+    memcpy (p->bits, in->bits,
+	    DSP_MAX * in->channels / 32 * sizeof (uint32_t));
+  p->fill = in->fill;
+  ctx->dsp->user_max = in->user_max;
   return E_SUCCESS;
 }
 
@@ -312,74 +592,71 @@ dspconfig_set_userrange (dsp_chantype type, int min, int max)
  * This must only be called when user_config is completely filled as
  * desired. dsp_config will be populated based on those choices.
  *
+ * @param ctx the device context
  * @return success/failure code
  */
 FB_STATUS
-dspconfig_user_to_native (void)
+dspconfig_user_to_native (T_CONTEXT * ctx)
 {
-  bool e1[4];
+  struct dspstate *d = ctx->dsp;
   register int chan = 0;
-  int done_chan = 0;
-  int boundaries[] = { 0, 32, 64, 96 };
+  int done_chan = 0, spans;
   register int i;
 
-  for (i = 0; i < 4; i++)
+  /* Every span with DSP channels of its own takes 31 or 24 of the
+   * user's channels */
+  spans = d->dsp_config.channels / 32;
+  if (statusGetSpans (ctx) < spans)
+    spans = statusGetSpans (ctx);
+
+  for (i = 0; i < spans; i++)
+    {
+      T_SPAN *s = get_span (ctx, i + 1);
+      done_chan += (s == NULL || s->config.E1Mode) ? 31 : 24;
+    }
+
+  if (d->user_max > done_chan)
     {
-      T_SPAN *s = get_span (i + 1);
-      if (s)
-	e1[i] = s->config.E1Mode;
-      else
-	e1[i] = true;
+      printf ("DSP channel %d was configured but the device has only %d.\n",
+	      d->user_max, done_chan);
+      return E_BADINPUT;
     }
+  done_chan = 0;
+
 #if 1
   /* Method 1: Fixed boundaries every 32 channels */
-  for (i = 0; i < 4; i++)
+  for (i = 0; i < spans; i++)
     {
-      register int j;
-      dsp_chantype *dsp, *user;
-      chan = boundaries[i];	/* We start on a particular boundary */
+      T_SPAN *s = get_span (ctx, i + 1);
+      int n = (s == NULL || s->config.E1Mode) ? 31 : 24;
+      chan = 32 * i;		/* We start on a particular boundary */
 
       /* Previous foneBRIDGE hardware required channel '0' to be
          skipped. This is no longer the case. */
 #if 0
-      dsp_config.dsp[chan] = DSP_OFF;	/* and always turn that channel off */
+      planes_set_range (&d->dsp_config, chan, 1, DSP_OFF);	/* and always turn that channel off */
       chan++;			/* and start reading the user's settings in on the next channel */
 #endif
 
-      user = &user_config.dsp[done_chan + 1];	/* user channels are numbered starting with 1 */
-      dsp = &dsp_config.dsp[chan];
-
-      /* Copy the user's settings in. */
-      for (j = 0; j < (e1[i] ? 31 : 24); j++)
-	{
-	  *dsp = *user;
-	  user++;
-	  dsp++;
-	  done_chan++;
-	}
+      /* Copy the user's settings in. User channels are numbered
+	 starting with 1 */
+      planes_copy (&d->dsp_config, chan, &d->user_config, done_chan + 1, n);
+      done_chan += n;
     }
 #else
   /* Method 2: Boundaries at end of spans, exactly */
-  for (i = 0; i < 4; i++)
+  for (i = 0; i < spans; i++)
     {
-      register int j;
-      dsp_chantype *dsp, *user;
+      T_SPAN *s = get_span (ctx, i + 1);
+      int n = (s == NULL || s->config.E1Mode) ? 31 : 24;
 
-      dsp_config.dsp[chan] = DSP_OFF;	/* as in method 1, turn off the 0th channel */
+      planes_set_range (&d->dsp_config, chan, 1, DSP_OFF);	/* as in method 1, turn off the 0th channel */
       chan++;
 
-      user = &user_config.dsp[done_chan + 1];
-      dsp = &dsp_config.dsp[chan];
-
       /* Copy in their settings */
-      for (j = 0; j < (e1[i] ? 31 : 24); j++)
-	{
-	  *dsp = *user;
-	  user++;
-	  dsp++;
-	  done_chan++;
-	  chan++;
-	}
+      planes_copy (&d->dsp_config, chan, &d->user_config, done_chan + 1, n);
+      done_chan += n;
+      chan += n;
     }
 #endif
 
@@ -399,8 +676,8 @@ bypassDSP (libfb_t * f, bool enable)
   uint8_t param, val = 1;
   param = enable ? DOOF_CMD_TDM_REGCTL_SET : DOOF_CMD_TDM_REGCTL_CLR;
   retval =
-    custom_cmd_reply (f, DOOF_CMD_TDM_LB_SEL, param, (char *) &val, 1,
-		      (char *) &val, 1);
+    fbt_custom_cmd_reply (f, DOOF_CMD_TDM_LB_SEL, param, (char *) &val, 1,
+			  (char *) &val, 1);
   DBG (printf ("TDM Reg reads: 0x%X\n", val));
   PRINT_MAPPED_ERROR_IF_FAIL (retval);
   if (retval != FBLIB_ESUCCESS)
@@ -412,91 +689,109 @@ bypassDSP (libfb_t * f, bool enable)
 /** @brief configure the DSP on a device
  *
  * Initalizes data structures, populates them, and the configures the
- * DSP
+ * DSP. The channel types and companding in the GPAK flash are taken
+ * from the device snapshot, and TDMoE is only stopped if either has
+ * to change.
  *
+ * @param ctx the device context, holding the parsed T_SPANs
  * @param f the libfb context of the device to configure
- * @param span_head the head of the linked list of T_SPANs 
  * @return success/error code
  */
 FB_STATUS
-configureDSP (libfb_t * f, DList * list)
+configureDSP (T_CONTEXT * ctx, libfb_t * f)
 {
-  int i;
-  uint32_t new_type[4];
-  T_SPAN *first_span;
+  int i, channels;
+  T_SPAN *first_span = get_first_span (ctx);
   bool need_update = false, need_update_companding = false;
+  GPAK_FLASH_PARMS *gpak_flash = &ctx->snapshot->gpak_flash;
 
-  if (list == NULL || dlist_head (list) == NULL)
+  if (first_span == NULL)
     return E_BADINPUT;
 
-  first_span = dlist_data (dlist_head (list));
-
 
   /* If the DSP is to be disabled, we enable the bypass and return */
-  if (smachine.dspdisabled)
+  if (ctx->dspdisabled)
     return bypassDSP (f, true);
   else
     bypassDSP (f, false);
 
 
-  memset (new_type, 0, sizeof (uint32_t) * 4);
-
-  if (dspconfig_get_gpak_flash (f) != E_SUCCESS)
+  if (ctx->snapshot->result[SNAP_GPAK] != FBLIB_ESUCCESS)
     {
       printf ("Failed to read current DSP channel configuration.\n");
       return E_SYSTEM;
     }
 
+  /* Every table is sized to the DSP of this device */
+  channels = statusGetDSPChannels (ctx);
+
   /* Read what is in the foneBRIDGE flash */
-  dspconfig_initflash (gpak_flash->dsp_chan_type);
+  if (dspconfig_initflash (ctx, gpak_flash->dsp_chan_type, channels)
+      != E_SUCCESS)
+    return E_SYSTEM;
 
   /* Set up defaults, putting unneeded channels OFF first */
-  dspconfig_init ();
+  if (dspconfig_init (ctx, channels) != E_SUCCESS)
+    return E_SYSTEM;
 
-  for (i = 0; i < statusGetSpans (); i++)
-    dspconfig_setdefault (get_span (i + 1));
+  for (i = 0; i < statusGetSpans (ctx); i++)
+    dspconfig_setdefault (ctx, get_span (ctx, i + 1));
 
   /* Copy the user's configuration into the DSP's native channel numbers */
-  if (smachine.dspconfig)
-    dspconfig_user_to_native ();
+  if (ctx->dspconfig && dspconfig_user_to_native (ctx) != E_SUCCESS)
+    return E_BADINPUT;
 
-  //  dspconfig_showconfig (false);
+  //  dspconfig_showconfig (ctx, false);
 
   /* First set companding if user didn't */
-  if (smachine.companding == 0)
-    smachine.companding =
+  if (ctx->companding == 0)
+    ctx->companding =
       (first_span->config.E1Mode) ? DSP_COMP_TYPE_ALAW : DSP_COMP_TYPE_ULAW;
-  else if (smachine.companding == -1)
+  else if (ctx->companding == -1)
     {
       /* Set all channels to DSP_DATA */
-      memset (&dsp_config, 0, sizeof (dsp_config));
+      planes_fill (&ctx->dsp->dsp_config, DSP_DATA);
     }
 
-  if (smachine.companding != gpak_flash->dsp_companding_type
-      && smachine.companding != -1)
+  if (ctx->companding != gpak_flash->dsp_companding_type
+      && ctx->companding != -1)
     {
       need_update_companding = true;
       printf ("Companding types differ in flash, update needed.\n");
     }
 
-  if (dspconfig_differ ())
+  if (dspconfig_differ (ctx))
     need_update = true;
 
-  /* Run four updates for each DSP */
+  /* Only interrupt traffic if the DSP really has to change */
+  if ((need_update || need_update_companding) && stopTDMoE (ctx, f) < 0)
+    return E_FBLIB;
+
+  /* Program only the modes whose set of channels changed. Every
+   * channel that moved leaves one mode and joins another, so both of
+   * them are sent. */
   if (need_update)
     {
       dsp_chantype cfg_mode;
       for (cfg_mode = DSP_DATA; cfg_mode < DSP_MAX; cfg_mode++)
 	{
-	  uint32_t mask[4];
+	  uint32_t mask[DSP_MAX_CHANNELS / 32];
+
+	  if (!dspconfig_mode_differs (ctx, cfg_mode))
+	    {
+	      if (vbose > 1)
+		printf ("Mode %s unchanged\n", dspchan_to_string (cfg_mode));
+	      continue;
+	    }
+
 	  printf ("Setting mode %s\n", dspchan_to_string (cfg_mode));
-	  for (i = 0; i < 4; i++)
+	  for (i = 0; i < DSP_MAX_CHANNELS / 32; i++)
 	    {
-	      mask[i] = dspconfig_getmask (i, cfg_mode);
+	      mask[i] = dspconfig_getmask (ctx, i, cfg_mode);
 	      DBG (printf ("%d: 0x%08X ", i, mask[i]));
 	    }
 	  DBG (printf ("\n"));
-	  if (ec_set_chantype (f, cfg_mode, mask) != E_SUCCESS)
+	  if (fbt_ec_set_chantype (f, cfg_mode, mask) != E_SUCCESS)
 	    {
 	      printf ("DSP channel configuration failed in %s mode.\n",
 		      dspchan_to_string (cfg_mode));
@@ -506,12 +801,17 @@ configureDSP (libfb_t * f, DList * list)
 	  printf ("Successfully set %s mode.\n",
 		  dspchan_to_string (cfg_mode));
 	}
+
+      /* The snapshot now matches the channels the DSP runs */
+      for (i = 0; i < channels; i++)
+	gpak_flash->dsp_chan_type[i] = planes_get (&ctx->dsp->dsp_config, i);
     }
 
   if (need_update_companding)
     {
-      if (custom_cmd (f, DOOF_CMD_EC_SETPARM, DOOF_CMD_EC_SETPARM_COMP_TYPE,
-		      (char *) &(smachine.companding), 1) != E_SUCCESS)
+      if (fbt_custom_cmd (f, DOOF_CMD_EC_SETPARM,
+			  DOOF_CMD_EC_SETPARM_COMP_TYPE,
+			  (char *) &(ctx->companding), 1) != E_SUCCESS)
 	{
 	  printf ("Error setting companding type\n");
 	  return E_SYSTEM;
@@ -522,7 +822,8 @@ configureDSP (libfb_t * f, DList * list)
 	("The foneBRIDGE requires a reset to set the companding type..\n");
       printf
 	("You will have to rerun fonulator after the reset is complete.\n");
-      interactiveReboot (f);
+      if (ctx->interactive)
+	interactiveReboot (f);
       return E_REBOOTDSP;
     }
 
@@ -20,9 +20,44 @@ typedef enum
 { DSP_DATA = 0, DSP_A, DSP_B, DSP_OFF, DSP_MAX }
 dsp_chantype;
 
+/** The most DSP channels libfb can program: the masks of
+ * ec_set_chantype() and the channel table of GPAK_FLASH_PARMS both
+ * stop at 128 */
+#define DSP_MAX_CHANNELS 128
+
+/** True if a DSP reporting `n' channels can be configured */
+#define DSP_SUPPORTED(n) ((n) >= 32 && (n) <= DSP_MAX_CHANNELS && (n) % 32 == 0)
+
+/** @struct T_DSP_USER
+ *
+ * The user's DSP channel table in a fixed layout, as kept by the
+ * configuration cache.
+ */
+typedef struct
+{
+  int32_t channels;		/**< Channels held, a multiple of 32 */
+  int32_t fill;			/**< Type of the channels beyond them */
+  int32_t user_max;		/**< Highest channel the user named */
+  uint32_t bits[DSP_MAX * DSP_MAX_CHANNELS / 32];	/**< The planes */
+}
+T_DSP_USER;
+
 char *dspchan_to_string (dsp_chantype chan);
 
-FB_STATUS configureDSP (libfb_t * f, DList * list);
-void dspconfig_init_userconfig ();
-FB_STATUS dspconfig_set_userdigit (dsp_chantype type, int chan);
-FB_STATUS dspconfig_set_userrange (dsp_chantype type, int min, int max);
+struct dspstate *dspconfig_create (void);
+struct dspstate *dspconfig_clone (struct dspstate *d);
+void dspconfig_destroy (struct dspstate *d);
+FB_STATUS dspconfig_init (T_CONTEXT * ctx, int channels);
+FB_STATUS dspconfig_initflash (T_CONTEXT * ctx, unsigned char *flashes,
+			       int channels);
+uint32_t dspconfig_getmask (T_CONTEXT * ctx, int span, dsp_chantype type);
+bool dspconfig_differ (T_CONTEXT * ctx);
+FB_STATUS dspconfig_user_to_native (T_CONTEXT * ctx);
+FB_STATUS configureDSP (T_CONTEXT * ctx, libfb_t * f);
+void dspconfig_init_userconfig (T_CONTEXT * ctx);
+FB_STATUS dspconfig_set_userdigit (T_CONTEXT * ctx, dsp_chantype type,
+				  int chan);
+FB_STATUS dspconfig_set_userrange (T_CONTEXT * ctx, dsp_chantype type,
+				  int min, int max);
+void dspconfig_user_export (T_CONTEXT * ctx, T_DSP_USER * out);
+FB_STATUS dspconfig_user_import (T_CONTEXT * ctx, const T_DSP_USER * in);
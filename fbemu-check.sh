@@ -0,0 +1,38 @@
+#!/bin/sh
+# Configure an emulated foneBRIDGE with the sample configuration, using
+# fonulator-emu (fonulator linked against the fbemu.c stub of libfb).
+# The plan taken beforehand must rewrite the links, the configure run
+# must succeed, and the plan taken afterwards must find the links
+# already in place.
+
+srcdir=${srcdir:-.}
+conf=$srcdir/redfone_sample.conf.txt
+FBEMU_STATE=fbemu-check.state
+export FBEMU_STATE
+
+rm -f $FBEMU_STATE fbemu-check.out
+trap 'rm -f $FBEMU_STATE fbemu-check.out' 0
+
+fail ()
+{
+  echo "fbemu-check: $1" >&2
+  cat fbemu-check.out >&2
+  exit 1
+}
+
+./fonulator-emu --plan $conf > fbemu-check.out 2>&1 \
+  || fail "plan before configuring failed"
+grep config_fb_udp_linkconfig fbemu-check.out > /dev/null \
+  || fail "plan before configuring does not rewrite the links"
+
+./fonulator-emu -v $conf > fbemu-check.out 2>&1 \
+  || fail "configure run failed"
+grep "foneBRIDGE reconfigured!" fbemu-check.out > /dev/null \
+  || fail "configure run did not finish"
+
+./fonulator-emu --plan $conf > fbemu-check.out 2>&1 \
+  || fail "plan after configuring failed"
+grep config_fb_udp_linkconfig fbemu-check.out > /dev/null \
+  && fail "plan after configuring rewrites the links again"
+
+exit 0
@@ -0,0 +1,691 @@
+/*
+   fonulator 3 - foneBRIDGE configuration daemon
+   (C) 2005-2007 Redfone Communications, LLC.
+   www.red-fone.com
+
+   foneBRIDGE Emulator
+*/
+/** @file
+ *
+ * A link-time stand-in for the device side of libfb. fonulator-emu is
+ * fonulator linked with this file and with the linker told to wrap
+ * (ld --wrap) every libfb call that reaches a device, so each of those
+ * calls lands in the __wrap_ function of the same name below instead
+ * of on the network. The rest of libfb, such as its register tables,
+ * feature sets and printing helpers, is the real library. fonulator
+ * itself is not changed, so every device path can be exercised and
+ * timed against the emulator without lab hardware.
+ *
+ * Devices are created on the first libfb_connect() to their address
+ * and are shared by every context connected to it, as the contexts of
+ * an fbpool are. The emulator is configured from the environment:
+ *
+ *     FBEMU_SPANS    spans to report (default: 4)
+ *     FBEMU_BUILD    firmware build number to report (default: 0)
+ *     FBEMU_IEC      1 to emulate an inline echo canceller
+ *     FBEMU_DSP      0 to emulate a unit without DSP
+ *     FBEMU_LATENCY  delay added to every call, in ms
+ *     FBEMU_JITTER   maximum additional random delay, in ms
+ *     FBEMU_LOSS     percentage of calls that time out
+ *     FBEMU_REORDER  percentage of calls held back, see emu_path()
+ *     FBEMU_SEED     random seed for the jitter, loss and reordering
+ *     FBEMU_STATE    file the devices are loaded from and saved to,
+ *                    so that successive runs see the same devices
+ *
+ * For example, to emulate a 20 ms round trip with 1% loss:
+ *
+ *     FBEMU_LATENCY=20 FBEMU_JITTER=2 FBEMU_LOSS=1 \
+ *         fonulator-emu --timing redfone.conf
+ */
+#include "fonulator.h"
+
+#if defined(STDC_HEADERS) || defined(HAVE_STDLIB_H)
+#include <stdlib.h>
+#endif
+
+#if HAVE_UNISTD_H
+#include <unistd.h>
+#endif
+
+#include <errno.h>
+#include <pthread.h>
+#include <arpa/inet.h>
+
+/** Number of EPCS blocks in the emulated flash */
+#define EMU_EPCS_BLOCKS 32
+/** Number of IDT registers emulated for each link */
+#define EMU_IDT_REGS 256
+/** Longest device address kept */
+#define EMU_HOST_LEN 64
+
+/** @struct T_EMU_DEVICE
+ *
+ * State of one emulated device. Plain data only, so the devices can
+ * be saved to FBEMU_STATE as they are.
+ */
+typedef struct
+{
+  char host[EMU_HOST_LEN];	/**< Address it was connected to */
+  DOOF_STATIC_INFO dsi;
+  IDT_LINK_CONFIG links[IDT_LINKS];
+  uint8_t prio[IDT_LINKS];
+  GPAK_FLASH_PARMS gpak;
+  uint32_t clksel;
+  bool tdmoe;
+  uint8_t dstmac[ETHER_ADDR_LEN];
+  uint8_t stage[EPCS_BLK_SIZE];
+  uint8_t idt[IDT_LINKS][EMU_IDT_REGS];
+  uint8_t pmon[IDT_LINKS][EMU_IDT_REGS];
+  uint8_t flash[EMU_EPCS_BLOCKS * EPCS_BLK_SIZE];
+}
+T_EMU_DEVICE;
+
+/** A libfb context, as handed out by __wrap_libfb_init() */
+typedef struct
+{
+  T_EMU_DEVICE *dev;		/**< Device connected to, or NULL */
+}
+T_EMU_HANDLE;
+
+/** @struct emu
+ *
+ * The emulated devices and the impairments applied to every call.
+ */
+static struct
+{
+  pthread_mutex_t lock;
+  DList devices;		/**< T_EMU_DEVICE */
+  unsigned int seed;
+
+  int spans, build;
+  bool iec, dsp;
+  int latency, jitter, loss, reorder;
+  const char *state;
+}
+emu = { PTHREAD_MUTEX_INITIALIZER };
+
+static pthread_once_t emu_once = PTHREAD_ONCE_INIT;
+
+/* The real functions are replaced, so declare their stand-ins */
+libfb_t *__wrap_libfb_init (char *device, int mode, char *errstr);
+int __wrap_libfb_connect (libfb_t * f, const char *host, int port);
+int __wrap_libfb_destroy (libfb_t * f);
+void __wrap_set_reftime (libfb_t * f);
+int __wrap_custom_cmd (libfb_t * f, int cmd, int param, char *data, int len);
+int __wrap_custom_cmd_reply (libfb_t * f, int cmd, int param, char *data,
+			     int len, char *reply, int reply_len);
+int __wrap_udp_read_blk (libfb_t * f, uint32_t addr, uint16_t len,
+			 uint8_t * buffer);
+int __wrap_udp_write_to_blk (libfb_t * f, uint32_t offset, uint16_t len,
+			     uint8_t * data);
+int __wrap_udp_start_blk_write (libfb_t * f, uint32_t blk);
+int __wrap_udp_get_static_info (libfb_t * f, DOOF_STATIC_INFO * dsi);
+int __wrap_configcheck_fb_udp (libfb_t * f, IDT_LINK_CONFIG * links);
+int __wrap_config_fb_udp_linkconfig (libfb_t * f, IDT_LINK_CONFIG * links);
+int __wrap_writeidt (libfb_t * f, int link, int reg, int val);
+int __wrap_libfb_readidt_pmon (libfb_t * f, int span, int addr,
+			       uint8_t * data);
+int __wrap_libfb_updat_pmon (libfb_t * f, int span);
+int __wrap_ec_set_chantype (libfb_t * f, int mode, uint32_t * mask);
+
+/** @return the integer value of an environment variable, or `def' */
+static int
+emu_getenv (const char *name, int def)
+{
+  const char *v = getenv (name);
+  return (v != NULL && *v != '\0') ? atoi (v) : def;
+}
+
+/** @brief Load the devices saved in FBEMU_STATE, if there are any */
+static void
+emu_load (void)
+{
+  FILE *fp;
+  T_EMU_DEVICE *dev;
+
+  if (emu.state == NULL || (fp = fopen (emu.state, "rb")) == NULL)
+    return;
+
+  for (;;)
+    {
+      dev = malloc (sizeof (T_EMU_DEVICE));
+      if (dev == NULL)
+	{
+	  perror ("fbemu: malloc");
+	  break;
+	}
+      if (fread (dev, sizeof (T_EMU_DEVICE), 1, fp) != 1)
+	{
+	  free (dev);
+	  break;
+	}
+      dlist_ins_next (&emu.devices, dlist_tail (&emu.devices), dev);
+    }
+  fclose (fp);
+}
+
+/** @brief Save every device to FBEMU_STATE */
+static void
+emu_save (void)
+{
+  FILE *fp;
+  DListElmt *element;
+
+  if (emu.state == NULL)
+    return;
+
+  fp = fopen (emu.state, "wb");
+  if (fp == NULL)
+    {
+      perror ("fbemu: fopen");
+      return;
+    }
+  for (element = dlist_head (&emu.devices); element != NULL;
+       element = dlist_next (element))
+    if (fwrite (dlist_data (element), sizeof (T_EMU_DEVICE), 1, fp) != 1)
+      {
+	perror ("fbemu: fwrite");
+	break;
+      }
+  fclose (fp);
+}
+
+/** @brief Read the emulator settings, once per process */
+static void
+emu_setup (void)
+{
+  emu.spans = emu_getenv ("FBEMU_SPANS", IDT_LINKS);
+  if (emu.spans < 1 || emu.spans > IDT_LINKS)
+    emu.spans = IDT_LINKS;
+  emu.build = emu_getenv ("FBEMU_BUILD", 0);
+  emu.iec = emu_getenv ("FBEMU_IEC", 0) != 0;
+  emu.dsp = emu_getenv ("FBEMU_DSP", 1) != 0;
+  emu.latency = emu_getenv ("FBEMU_LATENCY", 0);
+  emu.jitter = emu_getenv ("FBEMU_JITTER", 0);
+  emu.loss = emu_getenv ("FBEMU_LOSS", 0);
+  emu.reorder = emu_getenv ("FBEMU_REORDER", 0);
+  emu.seed = emu_getenv ("FBEMU_SEED", 1);
+  emu.state = getenv ("FBEMU_STATE");
+
+  dlist_init (&emu.devices, free);
+  emu_load ();
+}
+
+/** @brief Put a new device into its power-on state
+ *
+ * @param host the address the device answers on
+ * @return the device, or NULL if out of memory
+ */
+static T_EMU_DEVICE *
+emu_device_create (const char *host)
+{
+  uint8_t mac[ETHER_ADDR_LEN] = { 0x00, 0x50, 0xC2, 0x65, 0xD0, 0x00 };
+  EPCS_CONFIG *epcs;
+  T_EMU_DEVICE *dev;
+  struct in_addr in;
+  int i;
+
+  dev = calloc (1, sizeof (T_EMU_DEVICE));
+  if (dev == NULL)
+    {
+      perror ("fbemu: calloc");
+      return NULL;
+    }
+
+  snprintf (dev->host, sizeof (dev->host), "%s", host);
+
+  dev->dsi.spans = emu.spans;
+  dev->dsi.devices = 1;
+  dev->dsi.build_num = emu.build;
+  dev->dsi.epcs_blocks = EMU_EPCS_BLOCKS;
+  dev->dsi.gpak_config.max_channels = emu.dsp ? DSP_MAX_CHANNELS : 0;
+  snprintf ((char *) dev->dsi.sw_ver, sizeof (dev->dsi.sw_ver), "emu-%d",
+	    emu.build);
+  snprintf ((char *) dev->dsi.sw_compile_date,
+	    sizeof (dev->dsi.sw_compile_date), "%s", __DATE__);
+
+  /* Each device gets its own MAC, numbered in order of creation */
+  mac[ETHER_ADDR_LEN - 1] = dlist_size (&emu.devices) + 1;
+  memcpy (dev->dsi.epcs_config.mac_addr, mac, ETHER_ADDR_LEN);
+  if (inet_aton (host, &in) != 0)
+    dev->dsi.epcs_config.ip_address[0] = in.s_addr;
+  dev->dsi.epcs_config.cfg_flags = emu.iec ? 1 : 0;
+
+  /* The configuration table lives two blocks from the end of flash */
+  epcs = (EPCS_CONFIG *) (dev->flash + (EMU_EPCS_BLOCKS - 2) * EPCS_BLK_SIZE);
+  memcpy (epcs, &dev->dsi.epcs_config, sizeof (EPCS_CONFIG));
+  epcs->crc16 = crc_16 ((uint8_t *) epcs, sizeof (EPCS_CONFIG) - 2);
+
+  for (i = 0; i < IDT_LINKS; i++)
+    {
+      dev->links[i].E1Mode = 1;
+      dev->prio[i] = i;
+    }
+
+  for (i = 0; i < DSP_MAX_CHANNELS; i++)
+    dev->gpak.dsp_chan_type[i] = DSP_OFF;
+  dev->gpak.dsp_companding_type = DSP_COMP_TYPE_ALAW;
+
+  return dev;
+}
+
+/** @brief Apply the path impairments to one call
+ *
+ * Sleeps for the emulated round trip. Must be called without the
+ * emulator lock, so that the contexts of a pool overlap their calls
+ * as they would on a real link.
+ *
+ * A call picked for reordering is held back for another round trip,
+ * of at least 1 ms, before it reaches the device, so calls made after
+ * it on other contexts overtake it. A context waits for each reply,
+ * so the calls of one context are never reordered among themselves:
+ * reordering needs a pool, as --window and --jobs set up.
+ *
+ * @return true if the call is lost and must time out
+ */
+static bool
+emu_path (void)
+{
+  unsigned int seed;
+  int delay;
+  bool lost;
+
+  pthread_mutex_lock (&emu.lock);
+  seed = emu.seed = emu.seed * 1103515245 + 12345;
+  pthread_mutex_unlock (&emu.lock);
+
+  delay = emu.latency;
+  if (emu.jitter > 0)
+    delay += (seed >> 8) % (emu.jitter + 1);
+  lost = emu.loss > 0 && (int) ((seed >> 16) % 100) < emu.loss;
+  if (emu.reorder > 0 && (int) ((seed >> 24) % 100) < emu.reorder)
+    delay += (emu.latency + emu.jitter > 0) ? emu.latency + emu.jitter : 1;
+
+  if (delay > 0)
+    usleep (delay * 1000);
+  return lost;
+}
+
+/** @brief Begin a call on a context
+ *
+ * Applies the path impairments and takes the emulator lock.
+ *
+ * @param f the libfb context
+ * @param ret set to what the call returns if it cannot go on
+ * @return the device the context is connected to, or NULL if the
+ * call fails with `ret'
+ */
+static T_EMU_DEVICE *
+emu_begin (libfb_t * f, int *ret)
+{
+  T_EMU_HANDLE *h = (T_EMU_HANDLE *) f;
+
+  if (h == NULL || h->dev == NULL)
+    {
+      errno = ENOTCONN;
+      *ret = FBLIB_EERRNO;
+      return NULL;
+    }
+  if (emu_path ())
+    {
+      *ret = FBLIB_ETIMEDOUT;
+      return NULL;
+    }
+  pthread_mutex_lock (&emu.lock);
+  return h->dev;
+}
+
+/** @brief End a call begun by emu_begin() */
+static int
+emu_end (int ret)
+{
+  pthread_mutex_unlock (&emu.lock);
+  return ret;
+}
+
+/** @brief Fail a call the emulated device would reject */
+static int
+emu_reject (void)
+{
+  errno = EINVAL;
+  return emu_end (FBLIB_EERRNO);
+}
+
+libfb_t *
+__wrap_libfb_init (char *device, int mode, char *errstr)
+{
+  T_EMU_HANDLE *h;
+
+  pthread_once (&emu_once, emu_setup);
+
+  h = calloc (1, sizeof (T_EMU_HANDLE));
+  if (h == NULL)
+    {
+      snprintf (errstr, LIBFB_ERRBUF_SIZE, "fbemu: out of memory");
+      return NULL;
+    }
+
+  return (libfb_t *) h;
+}
+
+int
+__wrap_libfb_connect (libfb_t * f, const char *host, int port)
+{
+  T_EMU_HANDLE *h = (T_EMU_HANDLE *) f;
+  DListElmt *element;
+  T_EMU_DEVICE *dev = NULL;
+
+  if (host == NULL || port != DOOF_UDP_PORT)
+    {
+      errno = ECONNREFUSED;
+      return FBLIB_EERRNO;
+    }
+
+  pthread_mutex_lock (&emu.lock);
+  for (element = dlist_head (&emu.devices); element != NULL;
+       element = dlist_next (element))
+    if (strncmp (((T_EMU_DEVICE *) dlist_data (element))->host, host,
+		 EMU_HOST_LEN) == 0)
+      {
+	dev = dlist_data (element);
+	break;
+      }
+
+  if (dev == NULL && (dev = emu_device_create (host)) != NULL)
+    dlist_ins_next (&emu.devices, dlist_tail (&emu.devices), dev);
+  pthread_mutex_unlock (&emu.lock);
+
+  if (dev == NULL)
+    {
+      errno = ENOMEM;
+      return FBLIB_EERRNO;
+    }
+
+  h->dev = dev;
+  return FBLIB_ESUCCESS;
+}
+
+int
+__wrap_libfb_destroy (libfb_t * f)
+{
+  if (f == NULL)
+    return 0;
+  free (f);
+
+  /* Save the devices as each context goes, the last one wins */
+  pthread_mutex_lock (&emu.lock);
+  emu_save ();
+  pthread_mutex_unlock (&emu.lock);
+  return 0;
+}
+
+void
+__wrap_set_reftime (libfb_t * f)
+{
+}
+
+/** @brief Execute one DOOF custom command against a device
+ *
+ * @param dev the device, with the emulator lock held
+ * @param reply storage for the reply, or NULL if none is wanted
+ * @param reply_len the size of `reply'
+ * @return libfb status code
+ */
+static int
+emu_custom (T_EMU_DEVICE * dev, int cmd, int param, char *data, int len,
+	    char *reply, int reply_len)
+{
+  int i;
+
+  switch (cmd)
+    {
+    case DOOF_CMD_SET_PRIORITY:
+      /* Parameter 0 reads the current priorities back */
+      if (param != 0 && len >= IDT_LINKS)
+	memcpy (dev->prio, data, IDT_LINKS);
+      if (reply != NULL)
+	memcpy (reply, dev->prio,
+		reply_len < IDT_LINKS ? reply_len : IDT_LINKS);
+      return FBLIB_ESUCCESS;
+
+    case DOOF_CMD_GET_GPAK_FLASH_PARMS:
+      if (reply != NULL)
+	memcpy (reply, &dev->gpak,
+		reply_len < (int) sizeof (GPAK_FLASH_PARMS) ?
+		reply_len : sizeof (GPAK_FLASH_PARMS));
+      return FBLIB_ESUCCESS;
+
+    case DOOF_CMD_EC_SETPARM:
+      if (param == DOOF_CMD_EC_SETPARM_COMP_TYPE && len >= 1)
+	dev->gpak.dsp_companding_type = data[0];
+      return FBLIB_ESUCCESS;
+
+    case DOOF_CMD_CLKSEL_PIO:
+      if (reply != NULL && reply_len >= 4)
+	memcpy (reply, &dev->clksel, 4);
+      if (len >= 4)
+	{
+	  uint32_t bits;
+	  memcpy (&bits, data, 4);
+	  if (param == 1)
+	    dev->clksel &= ~bits;
+	  else if (param == 2)
+	    dev->clksel |= bits;
+	}
+      return FBLIB_ESUCCESS;
+
+    case DOOF_CMD_TDMOE_TXCTL:
+      dev->tdmoe = param;
+      return FBLIB_ESUCCESS;
+
+    case DOOF_CMD_TDMOE_DSTMAC:
+      if (len < ETHER_ADDR_LEN)
+	return FBLIB_EERRNO;
+      memcpy (dev->dstmac, data, ETHER_ADDR_LEN);
+      return FBLIB_ESUCCESS;
+
+    case DOOF_CMD_TDM_LB_SEL:
+      if (reply != NULL && reply_len >= 1 && len >= 1)
+	reply[0] = data[0];
+      return FBLIB_ESUCCESS;
+
+    case DOOF_CMD_RESET:
+      /* Running configuration is lost, the saved one is kept */
+      dev->tdmoe = false;
+      for (i = 0; i < IDT_LINKS; i++)
+	memset (dev->idt[i], 0, EMU_IDT_REGS);
+      return FBLIB_ESUCCESS;
+
+    case DOOF_CMD_KEY_WRITE:
+    case DOOF_CMD_PCONFIG_STORE:
+    case DOOF_CMD_PCONFIG_CLEAR:
+      return FBLIB_ESUCCESS;
+
+    default:
+      DBG (printf ("fbemu: unknown DOOF command 0x%02X\n", cmd));
+      return FBLIB_EERRNO;
+    }
+}
+
+int
+__wrap_custom_cmd (libfb_t * f, int cmd, int param, char *data, int len)
+{
+  T_EMU_DEVICE *dev;
+  int ret;
+
+  if ((dev = emu_begin (f, &ret)) == NULL)
+    return ret;
+  ret = emu_custom (dev, cmd, param, data, len, NULL, 0);
+  if (ret != FBLIB_ESUCCESS)
+    return emu_reject ();
+  return emu_end (ret);
+}
+
+int
+__wrap_custom_cmd_reply (libfb_t * f, int cmd, int param, char *data,
+			 int len, char *reply, int reply_len)
+{
+  T_EMU_DEVICE *dev;
+  int ret;
+
+  if ((dev = emu_begin (f, &ret)) == NULL)
+    return ret;
+  ret = emu_custom (dev, cmd, param, data, len, reply, reply_len);
+  if (ret != FBLIB_ESUCCESS)
+    return emu_reject ();
+  return emu_end (ret);
+}
+
+int
+__wrap_udp_read_blk (libfb_t * f, uint32_t addr, uint16_t len,
+		     uint8_t * buffer)
+{
+  T_EMU_DEVICE *dev;
+  int ret;
+
+  if ((dev = emu_begin (f, &ret)) == NULL)
+    return ret;
+  /* Written so that a large addr cannot wrap the sum */
+  if (addr > sizeof (dev->flash) || len > sizeof (dev->flash) - addr)
+    return emu_reject ();
+  memcpy (buffer, dev->flash + addr, len);
+  return emu_end (FBLIB_ESUCCESS);
+}
+
+int
+__wrap_udp_write_to_blk (libfb_t * f, uint32_t offset, uint16_t len,
+			 uint8_t * data)
+{
+  T_EMU_DEVICE *dev;
+  int ret;
+
+  if ((dev = emu_begin (f, &ret)) == NULL)
+    return ret;
+  if (offset > EPCS_BLK_SIZE || len > EPCS_BLK_SIZE - offset)
+    return emu_reject ();
+  memcpy (dev->stage + offset, data, len);
+  return emu_end (FBLIB_ESUCCESS);
+}
+
+int
+__wrap_udp_start_blk_write (libfb_t * f, uint32_t blk)
+{
+  T_EMU_DEVICE *dev;
+  int ret;
+
+  if ((dev = emu_begin (f, &ret)) == NULL)
+    return ret;
+  if (blk >= EMU_EPCS_BLOCKS)
+    return emu_reject ();
+  memcpy (dev->flash + blk * EPCS_BLK_SIZE, dev->stage, EPCS_BLK_SIZE);
+  if (blk == EMU_EPCS_BLOCKS - 2)
+    memcpy (&dev->dsi.epcs_config, dev->stage, sizeof (EPCS_CONFIG));
+  return emu_end (FBLIB_ESUCCESS);
+}
+
+int
+__wrap_udp_get_static_info (libfb_t * f, DOOF_STATIC_INFO * dsi)
+{
+  T_EMU_DEVICE *dev;
+  int ret;
+
+  if ((dev = emu_begin (f, &ret)) == NULL)
+    return ret;
+  memcpy (dsi, &dev->dsi, sizeof (DOOF_STATIC_INFO));
+  return emu_end (FBLIB_ESUCCESS);
+}
+
+int
+__wrap_configcheck_fb_udp (libfb_t * f, IDT_LINK_CONFIG * links)
+{
+  T_EMU_DEVICE *dev;
+  int ret;
+
+  if ((dev = emu_begin (f, &ret)) == NULL)
+    return ret;
+  memcpy (links, dev->links, sizeof (dev->links));
+  return emu_end (FBLIB_ESUCCESS);
+}
+
+int
+__wrap_config_fb_udp_linkconfig (libfb_t * f, IDT_LINK_CONFIG * links)
+{
+  T_EMU_DEVICE *dev;
+  int ret;
+
+  if ((dev = emu_begin (f, &ret)) == NULL)
+    return ret;
+  memcpy (dev->links, links, sizeof (dev->links));
+  return emu_end (FBLIB_ESUCCESS);
+}
+
+int
+__wrap_writeidt (libfb_t * f, int link, int reg, int val)
+{
+  T_EMU_DEVICE *dev;
+  int ret;
+
+  if ((dev = emu_begin (f, &ret)) == NULL)
+    return ret;
+  if (link < 0 || link >= IDT_LINKS || reg < 0 || reg >= EMU_IDT_REGS)
+    return emu_reject ();
+  dev->idt[link][reg] = val;
+  return emu_end (FBLIB_ESUCCESS);
+}
+
+int
+__wrap_libfb_readidt_pmon (libfb_t * f, int span, int addr, uint8_t * data)
+{
+  T_EMU_DEVICE *dev;
+  int ret;
+
+  if ((dev = emu_begin (f, &ret)) == NULL)
+    return ret;
+  if (span < 0 || span >= IDT_LINKS || addr < 0 || addr >= EMU_IDT_REGS)
+    return emu_reject ();
+  *data = dev->pmon[span][addr];
+  return emu_end (FBLIB_ESUCCESS);
+}
+
+/** Advance every PMON counter on a span, as an UPDAT would.
+ *
+ * Counters are stored little-endian, two bytes at a time, which
+ * matches how statusRegisterValue() reassembles them.
+ */
+int
+__wrap_libfb_updat_pmon (libfb_t * f, int span)
+{
+  T_EMU_DEVICE *dev;
+  int ret, addr;
+
+  if ((dev = emu_begin (f, &ret)) == NULL)
+    return ret;
+  if (span < 0 || span >= IDT_LINKS)
+    return emu_reject ();
+  for (addr = 0; addr + 1 < EMU_IDT_REGS; addr += 2)
+    {
+      uint16_t v = dev->pmon[span][addr] | (dev->pmon[span][addr + 1] << 8);
+      v += (emu.seed = emu.seed * 1103515245 + 12345) >> 16 & 3;
+      dev->pmon[span][addr] = v & 0xFF;
+      dev->pmon[span][addr + 1] = v >> 8;
+    }
+  return emu_end (FBLIB_ESUCCESS);
+}
+
+/** Move the channels of a mask into a mode in the GPAK flash table */
+int
+__wrap_ec_set_chantype (libfb_t * f, int mode, uint32_t * mask)
+{
+  T_EMU_DEVICE *dev;
+  int ret, word, bit;
+
+  if ((dev = emu_begin (f, &ret)) == NULL)
+    return ret;
+  if (mode < 0 || mode >= DSP_MAX)
+    return emu_reject ();
+  for (word = 0; word < DSP_MAX_CHANNELS / 32; word++)
+    for (bit = 0; bit < 32; bit++)
+      if (mask[word] & (1U << bit))
+	dev->gpak.dsp_chan_type[32 * word + bit] = mode;
+  return emu_end (FBLIB_ESUCCESS);
+}
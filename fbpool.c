@@ -0,0 +1,257 @@
+/*
+   fonulator 3 - foneBRIDGE configuration daemon
+   (C) 2005-2007 Redfone Communications, LLC.
+   www.red-fone.com
+
+   libfb Context Pool
+*/
+/** @file
+ *
+ * libfb only offers blocking request/reply calls, so a single context
+ * can never have more than one request outstanding. The pool opens
+ * `width' contexts to the same device, each with its own UDP socket,
+ * and runs one worker thread per context. Replies are matched to their
+ * requests by the socket they arrive on, giving a window of `width'
+ * requests in flight. A job that fails is resent on its own, up to the
+ * retry limit, without disturbing the rest of the window.
+ *
+ * No libfb context is ever shared between threads.
+ */
+#include "fonulator.h"
+
+#if defined(STDC_HEADERS) || defined(HAVE_STDLIB_H)
+# include <stdlib.h>
+#endif
+
+#include <pthread.h>
+
+struct fbpool
+{
+  int width;
+  libfb_t **fb;
+
+  /* State of the current fbpool_run(), guarded by lock */
+  pthread_mutex_t lock;
+  int next;
+  int njobs;
+  int retries;
+  fbpool_job fn;
+  void *arg;
+  bool failed;
+  FBPOOL_STATS stats;
+};
+
+/** Argument handed to each worker thread */
+typedef struct
+{
+  FBPOOL *pool;
+  libfb_t *fb;
+}
+T_WORKER;
+
+/** @brief Open a pool of contexts to one device
+ *
+ * @param host the device's address
+ * @param port the device's UDP configuration port
+ * @param width the number of requests to keep in flight
+ * @return the pool, or NULL on failure
+ */
+FBPOOL *
+fbpool_create (const char *host, int port, int width)
+{
+  FBPOOL *pool;
+  char errstr[LIBFB_ERRBUF_SIZE];
+  int i;
+
+  if (host == NULL || width < 1)
+    return NULL;
+
+  pool = calloc (1, sizeof (FBPOOL));
+  if (pool == NULL)
+    {
+      perror ("calloc");
+      return NULL;
+    }
+
+  pool->fb = calloc (width, sizeof (libfb_t *));
+  if (pool->fb == NULL)
+    {
+      perror ("calloc");
+      free (pool);
+      return NULL;
+    }
+
+  pthread_mutex_init (&pool->lock, NULL);
+
+  for (i = 0; i < width; i++)
+    {
+      pool->fb[i] = libfb_init (NULL, LIBFB_ETHERNET_OFF, errstr);
+      if (pool->fb[i] == NULL)
+	{
+	  fprintf (stderr, "libfb: %s\n", errstr);
+	  break;
+	}
+      pool->width++;
+
+      if (libfb_connect (pool->fb[i], host, port) != FBLIB_ESUCCESS)
+	{
+	  fprintf (stderr, "fbpool: Unable to connect context %d to %s\n",
+		   i, host);
+	  break;
+	}
+    }
+
+  if (pool->width != width)
+    {
+      fbpool_destroy (pool);
+      return NULL;
+    }
+
+  return pool;
+}
+
+/** @brief Close every context in a pool and free it */
+void
+fbpool_destroy (FBPOOL * pool)
+{
+  int i;
+
+  if (pool == NULL)
+    return;
+
+  for (i = 0; i < pool->width; i++)
+    libfb_destroy (pool->fb[i]);
+
+  pthread_mutex_destroy (&pool->lock);
+  free (pool->fb);
+  free (pool);
+}
+
+/**
+ * @return the number of requests the pool keeps in flight
+ */
+int
+fbpool_width (FBPOOL * pool)
+{
+  return pool->width;
+}
+
+/** @brief Worker thread body: take jobs until none are left */
+static void *
+fbpool_worker (void *data)
+{
+  T_WORKER *w = data;
+  FBPOOL *pool = w->pool;
+
+  for (;;)
+    {
+      int job, attempt;
+      fblib_err ret = FBLIB_ESUCCESS;
+
+      pthread_mutex_lock (&pool->lock);
+      if (pool->failed || pool->next >= pool->njobs)
+	{
+	  pthread_mutex_unlock (&pool->lock);
+	  break;
+	}
+      job = pool->next++;
+      pthread_mutex_unlock (&pool->lock);
+
+      for (attempt = 0; attempt <= pool->retries; attempt++)
+	{
+	  ret = pool->fn (w->fb, job, pool->arg);
+	  if (ret == FBLIB_ESUCCESS)
+	    break;
+	  if (attempt < pool->retries)
+	    timing_retry ();
+	  DBG (printf ("fbpool: job %d failed (%d), attempt %d\n", job, ret,
+		       attempt));
+	}
+
+      pthread_mutex_lock (&pool->lock);
+      pool->stats.retransmits += attempt > pool->retries ? attempt - 1 : attempt;
+      if (ret == FBLIB_ESUCCESS)
+	pool->stats.completed++;
+      else if (!pool->failed || job < pool->stats.failed_job)
+	{
+	  pool->failed = true;
+	  pool->stats.failed_job = job;
+	}
+      pthread_mutex_unlock (&pool->lock);
+    }
+
+  return NULL;
+}
+
+/** @brief Run `njobs' jobs across the pool
+ *
+ * Blocks until every job has completed or one has failed after
+ * `retries' retransmissions. Once a job fails no further jobs are
+ * started, but those already in flight are allowed to finish.
+ *
+ * @param pool the context pool
+ * @param njobs the number of jobs
+ * @param fn the job function
+ * @param arg opaque argument passed to every job
+ * @param retries how many times a failed job is resent
+ * @param stats if not NULL, filled in with the results of the run
+ * @return success/error code
+ */
+FB_STATUS
+fbpool_run (FBPOOL * pool, int njobs, fbpool_job fn, void *arg, int retries,
+	    FBPOOL_STATS * stats)
+{
+  pthread_t *threads;
+  T_WORKER *workers;
+  int i, started = 0;
+
+  threads = calloc (pool->width, sizeof (pthread_t));
+  workers = calloc (pool->width, sizeof (T_WORKER));
+  if (threads == NULL || workers == NULL)
+    {
+      perror ("calloc");
+      free (threads);
+      free (workers);
+      return E_SYSTEM;
+    }
+
+  pool->next = 0;
+  pool->njobs = njobs;
+  pool->retries = retries;
+  pool->fn = fn;
+  pool->arg = arg;
+  pool->failed = false;
+  memset (&pool->stats, 0, sizeof (FBPOOL_STATS));
+  pool->stats.failed_job = -1;
+
+  for (i = 0; i < pool->width && i < njobs; i++)
+    {
+      workers[i].pool = pool;
+      workers[i].fb = pool->fb[i];
+      if (pthread_create (&threads[i], NULL, fbpool_worker, &workers[i]) != 0)
+	{
+	  perror ("pthread_create");
+	  break;
+	}
+      started++;
+    }
+
+  /* Nothing could be started: run the jobs on the first context */
+  if (started == 0 && njobs > 0)
+    {
+      workers[0].pool = pool;
+      workers[0].fb = pool->fb[0];
+      fbpool_worker (&workers[0]);
+    }
+
+  for (i = 0; i < started; i++)
+    pthread_join (threads[i], NULL);
+
+  if (stats != NULL)
+    memcpy (stats, &pool->stats, sizeof (FBPOOL_STATS));
+
+  free (threads);
+  free (workers);
+
+  return pool->failed ? E_FBLIB : E_SUCCESS;
+}
@@ -0,0 +1,42 @@
+/*
+   fonulator 3 - foneBRIDGE configuration daemon
+   (C) 2005-2007 Redfone Communications, LLC.
+   www.red-fone.com
+
+   libfb Context Pool
+*/
+/** @file
+ *
+ * A pool of libfb contexts connected to the same device, used to keep
+ * several DOOF requests in flight at once.
+ */
+#ifndef FBPOOL_H
+#define FBPOOL_H
+
+/** @brief A job run by the pool
+ *
+ * @param f the libfb context of the worker running the job
+ * @param job the job index, from 0 to njobs - 1
+ * @param arg the opaque argument given to fbpool_run()
+ * @return FBLIB_ESUCCESS if the job completed
+ */
+typedef fblib_err (*fbpool_job) (libfb_t * f, int job, void *arg);
+
+/** Results of a single fbpool_run() */
+typedef struct
+{
+  unsigned long completed;	/**< Jobs that succeeded */
+  unsigned long retransmits;	/**< Jobs that had to be resent */
+  int failed_job;		/**< First job that failed, or -1 */
+}
+FBPOOL_STATS;
+
+typedef struct fbpool FBPOOL;
+
+FBPOOL *fbpool_create (const char *host, int port, int width);
+void fbpool_destroy (FBPOOL * pool);
+int fbpool_width (FBPOOL * pool);
+FB_STATUS fbpool_run (FBPOOL * pool, int njobs, fbpool_job fn, void *arg,
+		      int retries, FBPOOL_STATS * stats);
+
+#endif
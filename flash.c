@@ -1,188 +1,563 @@
 #include "fonulator.h"
 
-extern DOOF_STATIC_INFO *dsi;
+#include <sys/time.h>
+#include <pthread.h>
+#include <sys/stat.h>
 
-/** @brief Compare two files for differences
- * 
- * Both files must be open already and seek'd to the starting point
- * the comparison should begin at.
+#if HAVE_UNISTD_H
+#include <unistd.h>
+#endif
+
+extern int vbose;
+
+/** Bytes carried by each udp_write_to_blk() during an upload */
+#define FLASH_WRITE_SIZE 256
+/** How many times a lost write is resent before the upload fails */
+#define FLASH_RETRIES 5
+
+/** @return seconds elapsed since `start' */
+static double
+flash_elapsed (struct timeval *start)
+{
+  struct timeval now;
+  gettimeofday (&now, NULL);
+  return (now.tv_sec - start->tv_sec) + (now.tv_usec - start->tv_usec) / 1e6;
+}
+
+/** First line of a flash upload journal */
+#define JOURNAL_MAGIC "fonulator-flash-journal 1"
+
+/** @brief Open the progress journal of an upload
  *
- * @param file1 the file to compare with file2
- * @param file2 the file to compare with file1
- * @return 0 if the files are the same, and -1 if they are different
+ * A journal records the image hash and size, the device MAC address
+ * and the first block of the upload, followed by one `commit' line
+ * for every block that was written, committed and verified. If the
+ * existing journal describes the same upload, the blocks it lists are
+ * marked in `done' and new entries are appended. Otherwise the journal
+ * is started over.
+ *
+ * @param path the journal file
+ * @param mac the MAC address of the device
+ * @param hash the image hash
+ * @param size the image size in bytes
+ * @param blk the first block of the upload
+ * @param done marks blocks (indexed from `blk') already committed
+ * @param nblocks the number of blocks in the image
+ * @return the journal, open for appending, or NULL on error
  */
-int
-diff_file (FILE * file1, FILE * file2)
+static FILE *
+journal_open (const char *path, const uint8_t * mac, uint64_t hash,
+	      long size, int blk, bool * done, int nblocks)
 {
-  unsigned char *buf1, *buf2;
-  int x, y, z, retval = 0;
-  int blk = 0;
+  char header[256], line[256];
+  FILE *j;
+  int resumed = 0;
+
+  snprintf (header, sizeof (header),
+	    "%s\nimage %016llx %ld\ndevice %02X:%02X:%02X:%02X:%02X:%02X\n"
+	    "start %d\n", JOURNAL_MAGIC, (unsigned long long) hash, size,
+	    mac[0], mac[1], mac[2], mac[3], mac[4], mac[5], blk);
 
-  buf1 = malloc (EPCS_BLK_SIZE);
-  buf2 = malloc (EPCS_BLK_SIZE);
+  j = fopen (path, "r");
+  if (j != NULL)
+    {
+      char existing[sizeof (header)];
+      size_t n = fread (existing, 1, strlen (header), j);
+
+      if (n == strlen (header) && !memcmp (existing, header, n))
+	{
+	  while (fgets (line, sizeof (line), j) != NULL)
+	    {
+	      int committed;
+	      size_t len = strlen (line);
+	      /* A torn final line, or one starting with a NUL, is
+	         simply not counted */
+	      if (len > 0 && line[len - 1] == '\n'
+		  && sscanf (line, "commit %d", &committed) == 1
+		  && committed >= blk && committed - blk < nblocks)
+		{
+		  done[committed - blk] = true;
+		  resumed++;
+		}
+	    }
+	}
+      fclose (j);
+    }
 
-  if (!buf1 || !buf2)
+  if (resumed > 0)
     {
-      perror ("Error allocating buffers");
-      return -1;
+      printf ("Resuming upload, %d blocks already committed\n", resumed);
+      j = fopen (path, "a");
+    }
+  else
+    {
+      j = fopen (path, "w");
+      if (j != NULL)
+	fputs (header, j);
     }
 
-  while (1)
+  if (j == NULL)
     {
-      x = fread ((void *) buf1, 1, EPCS_BLK_SIZE, file1);
-      y = fread ((void *) buf2, 1, EPCS_BLK_SIZE, file2);
+      fprintf (stderr, "Unable to open flash journal %s\n", path);
+      perror ("fopen");
+      return NULL;
+    }
 
-      if (x != y)
+  fflush (j);
+  return j;
+}
+
+/** @brief Durably record a committed and verified block */
+static void
+journal_commit (FILE * j, int blk)
+{
+  fprintf (j, "commit %d\n", blk);
+  fflush (j);
+  fsync (fileno (j));
+}
+
+/** @brief Pool job: write one FLASH_WRITE_SIZE chunk of a staged block
+ *
+ * @param f the worker's device context
+ * @param job the chunk number within the block
+ * @param arg the block payload
+ */
+static fblib_err
+flash_write_job (libfb_t * f, int job, void *arg)
+{
+  uint8_t *payload = arg;
+  return fbt_udp_write_to_blk (f, job * FLASH_WRITE_SIZE, FLASH_WRITE_SIZE,
+			       payload + job * FLASH_WRITE_SIZE);
+}
+
+/** State shared by the chunks of one block under verification */
+typedef struct
+{
+  const uint8_t *expect;	/**< Source image data for the block */
+  int address;			/**< Flash address of the block */
+  int len;			/**< Number of bytes to verify */
+  pthread_mutex_t lock;
+  int mismatch;			/**< Lowest mismatching offset, or -1 */
+}
+T_VERIFY;
+
+/** @brief Pool job: read back one chunk of a block and compare it
+ *
+ * The chunk is compared against the source image in memory as soon
+ * as it arrives. Chunks beyond an already detected mismatch are not
+ * read at all.
+ *
+ * @param f the worker's device context
+ * @param job the chunk number within the block
+ * @param arg the T_VERIFY state of the block
+ */
+static fblib_err
+flash_verify_job (libfb_t * f, int job, void *arg)
+{
+  T_VERIFY *v = arg;
+  uint8_t buffer[FLASH_WRITE_SIZE];
+  int offset = job * FLASH_WRITE_SIZE;
+  int i, n = v->len - offset;
+  bool skip;
+  fblib_err ret;
+
+  if (n > FLASH_WRITE_SIZE)
+    n = FLASH_WRITE_SIZE;
+
+  pthread_mutex_lock (&v->lock);
+  skip = (v->mismatch >= 0 && v->mismatch < offset);
+  pthread_mutex_unlock (&v->lock);
+  if (skip)
+    return FBLIB_ESUCCESS;
+
+  ret = fbt_udp_read_blk (f, v->address + offset, n, buffer);
+  if (ret != FBLIB_ESUCCESS)
+    return ret;
+
+  for (i = 0; i < n; i++)
+    {
+      if (buffer[i] != v->expect[offset + i])
 	{
-	  retval = -1;
+	  pthread_mutex_lock (&v->lock);
+	  if (v->mismatch < 0 || offset + i < v->mismatch)
+	    v->mismatch = offset + i;
+	  pthread_mutex_unlock (&v->lock);
 	  break;
 	}
-      if (!x)
-	break;
+    }
+  return FBLIB_ESUCCESS;
+}
+
+/** @brief Compare one block of flash against the source image
+ *
+ * The block is read back in FLASH_WRITE_SIZE chunks, pipelined
+ * through `pool' when one is given, and each chunk is compared in
+ * memory as it arrives. On return v->mismatch holds the first
+ * differing offset, or -1 if the block matches.
+ *
+ * @param f the device context
+ * @param pool context pool to pipeline reads through, or NULL
+ * @param v the block to compare
+ * @return an error code if the block could not be read
+ */
+static FB_STATUS
+flash_compare_block (libfb_t * f, FBPOOL * pool, T_VERIFY * v)
+{
+  int i, chunks = (v->len + FLASH_WRITE_SIZE - 1) / FLASH_WRITE_SIZE;
+
+  v->mismatch = -1;
+
+  if (pool != NULL)
+    return fbpool_run (pool, chunks, flash_verify_job, v, FLASH_RETRIES,
+		       NULL);
+
+  for (i = 0; i < chunks && v->mismatch < 0; i++)
+    if (flash_verify_job (f, i, v) != FBLIB_ESUCCESS)
+      return E_FBLIB;
+
+  return E_SUCCESS;
+}
+
+/** @brief Stage one block on the device and commit it
+ *
+ * @param f the device context
+ * @param pool context pool to pipeline writes through, or NULL
+ * @param payload the block data, EPCS_BLK_SIZE bytes
+ * @param blk the block number to commit
+ * @param retransmits incremented by the number of writes resent
+ * @return an error code if applicable
+ */
+static FB_STATUS
+flash_write_block (libfb_t * f, FBPOOL * pool, uint8_t * payload, int blk,
+		   unsigned long *retransmits)
+{
+  int i;
 
-      printf ("Checking block %d\n", blk);
+  if (pool != NULL)
+    {
+      FBPOOL_STATS stats;
 
-      for (z = 0; z < y; z++)
+      if (fbpool_run (pool, EPCS_BLK_SIZE / FLASH_WRITE_SIZE,
+		      flash_write_job, payload, FLASH_RETRIES,
+		      &stats) != E_SUCCESS)
+	{
+	  i = stats.failed_job * FLASH_WRITE_SIZE;
+	  fprintf (stderr, "Error writing to block %d at offset %d (0x%X)\n",
+		   blk, i, i);
+	  return E_FBLIB;
+	}
+      *retransmits += stats.retransmits;
+    }
+  else
+    {
+      for (i = 0; i < EPCS_BLK_SIZE; i += FLASH_WRITE_SIZE)
 	{
-	  if (buf1[z] != buf2[z])
+	  if (fbt_udp_write_to_blk (f, i, FLASH_WRITE_SIZE, payload + i) !=
+	      FBLIB_ESUCCESS)
 	    {
-	      printf ("Error verifying block %d, offset %d\n", blk, z);
-	      retval = -1;
-	      break;
+	      fprintf (stderr,
+		       "Error writing to block %d at offset %d (0x%X)\n", blk,
+		       i, i);
+	      return E_FBLIB;
 	    }
 	}
-
-      blk++;
-
     }
 
-  free (buf1);
-  free (buf2);
+  if (fbt_udp_start_blk_write (f, blk) != FBLIB_ESUCCESS)
+    {
+      fprintf (stderr, "Error executing write on block %d\n", blk);
+      return E_FBLIB;
+    }
 
-  return retval;
+  return E_SUCCESS;
 }
 
-
-
-/**
+/** @brief Verify flash contents against a source image
+ *
+ * The image is read again one block at a time and each readback is
+ * compared in memory as it arrives. Verification stops at the first
+ * block that differs.
  *
  * @param f the device context
- * @param bin the file to store the data in, it must already be opened for writing
- * @param address the address to read from
- * @param len the number of bytes to read
+ * @param pool context pool to pipeline reads through, or NULL
+ * @param bin the source image, it must already be opened for reading
+ * @param buffer scratch space of EPCS_BLK_SIZE bytes
+ * @param blk the block number the image was written to
+ * @param checked if not NULL, blocks already known to match the
+ * image (indexed from the first block) are not read again
+ * @param nblocks entries of `checked'; blocks past them are read
  * @return an error code if applicable
  */
-FB_STATUS
-read_flash_to_file (libfb_t * f, FILE * bin, int address, int len)
+static FB_STATUS
+flash_verify (libfb_t * f, FBPOOL * pool, FILE * bin, uint8_t * buffer,
+	      int blk, const bool * checked, int nblocks)
 {
-  while (len > 0)
+  T_VERIFY v;
+  int bytes, n = 0;
+  FB_STATUS result = E_SUCCESS;
+
+  pthread_mutex_init (&v.lock, NULL);
+  v.expect = buffer;
+
+  rewind (bin);
+  while (result == E_SUCCESS
+	 && (bytes = fread (buffer, 1, EPCS_BLK_SIZE, bin)) > 0)
     {
-      uint8_t buffer[256];
-      if (udp_read_blk (f, address, (len > 256) ? 256 : len, buffer) !=
-	  FBLIB_ESUCCESS)
+      if (checked == NULL || n >= nblocks || !checked[n])
 	{
-	  fprintf (stderr, "Unable to read flash data from device!\n");
-	  return E_FBLIB;
+	  v.address = blk * EPCS_BLK_SIZE;
+	  v.len = bytes;
+
+	  if (vbose > 0)
+	    printf ("Checking block %d\n", blk);
+
+	  if (flash_compare_block (f, pool, &v) != E_SUCCESS)
+	    {
+	      fprintf (stderr, "Unable to read flash data from device!\n");
+	      result = E_FBLIB;
+	    }
+	  else if (v.mismatch >= 0)
+	    {
+	      fprintf (stderr, "Error verifying block %d, offset %d\n", blk,
+		       v.mismatch);
+	      result = E_FBLIB;
+	    }
 	}
-      fwrite (buffer, 1, (len > 256) ? 256 : len, bin);
-      len -= 256;
-      address += 256;
+
+      blk++;
+      n++;
     }
-  return E_SUCCESS;
+
+  pthread_mutex_destroy (&v.lock);
+  return result;
 }
 
 /**
  *
- * @param f the device context
+ * Each EPCS block is staged on the device with FLASH_WRITE_SIZE byte
+ * writes and then committed with udp_start_blk_write(). With a window
+ * of one, every write waits for its acknowledgement before the next
+ * is sent. A larger window keeps that many writes of the block in
+ * flight through an fbpool, so the upload time is bound by bandwidth
+ * rather than by the round trip time. The block commit remains the
+ * barrier between blocks. The image is then verified with
+ * flash_verify() through the same window.
+ *
+ * In delta mode each block is first read back and compared with the
+ * image. Blocks that already match are neither rewritten nor verified
+ * a second time, which saves both upload time and flash wear when the
+ * same image, or a small revision of it, is rolled out again.
+ *
+ * With a journal every block is verified right after its commit and
+ * then recorded. An interrupted upload of the same image to the same
+ * device resumes at the first block not yet recorded, and the journal
+ * is removed once the whole image has been verified. Blocks recorded
+ * by an earlier run are not written again, but the final verification
+ * still reads them back.
+ *
+ * @param ctx the device context, after statusInitalize()
+ * @param f the libfb context of the device
  * @param bin the file to write, it must already be opened for reading
  * @param blk the block number to begin the write
+ * @param opts upload options
  * @return an error code if applicable
  */
 FB_STATUS
-write_file_to_flash (libfb_t * f, FILE * bin, int blk)
+write_file_to_flash (T_CONTEXT * ctx, libfb_t * f, FILE * bin, int blk,
+		     T_FLASH_OPTS * opts)
 {
   uint8_t *payload;
-  int bytes, len, orig_blk;
-  FILE *tmp;
-  FB_STATUS result;
+  int bytes, len, orig_blk, nblocks;
+  int written = 0, written_bytes = 0, skipped = 0;
+  bool *done = NULL, *checked = NULL;
+  FB_STATUS result = E_SUCCESS;
+  FBPOOL *pool = NULL;
+  unsigned long retransmits = 0;
+  struct timeval start, step;
+  double secs, write_secs = 0, compare_secs = 0;
+  struct stat filestat;
+  T_VERIFY v;
+  FILE *journal = NULL;
 
   orig_blk = blk;
 
+  if (fstat (fileno (bin), &filestat) != 0)
+    {
+      perror ("fstat");
+      return E_SYSTEM;
+    }
+  nblocks = (filestat.st_size + EPCS_BLK_SIZE - 1) / EPCS_BLK_SIZE;
+
   payload = malloc (EPCS_BLK_SIZE);
-  if (payload == NULL)
+  done = calloc (nblocks + 1, sizeof (bool));
+  checked = calloc (nblocks + 1, sizeof (bool));
+  if (payload == NULL || done == NULL || checked == NULL)
     {
       fprintf (stderr,
 	       "Unable to allocate enough memeory for flash upload operation.\n");
       perror ("malloc");
+      free (payload);
+      free (done);
+      free (checked);
       return E_SYSTEM;
     }
 
+  if (opts->journal != NULL)
+    {
+      uint64_t hash;
+
+      if (ctx->dsi == NULL)
+	result = E_BADSTATE;
+      else if ((result = fnv1a64_file (bin, &hash)) == E_SUCCESS)
+	{
+	  journal = journal_open (opts->journal,
+				  ctx->dsi->epcs_config.mac_addr, hash,
+				  filestat.st_size, blk, done, nblocks);
+	  if (journal == NULL)
+	    result = E_SYSTEM;
+	}
+
+      if (result != E_SUCCESS)
+	{
+	  free (payload);
+	  free (done);
+	  free (checked);
+	  return result;
+	}
+    }
+
+  if (opts->window > 1)
+    {
+      pool = fbpool_create (ctx->fonebridge, DOOF_UDP_PORT, opts->window);
+      if (pool == NULL)
+	fprintf (stderr,
+		 "Unable to open %d device contexts, uploading without a window.\n",
+		 opts->window);
+      else if (vbose > 0)
+	printf ("Uploading with %d writes in flight\n", opts->window);
+    }
+
+  pthread_mutex_init (&v.lock, NULL);
+  v.expect = payload;
+
+  gettimeofday (&start, NULL);
+
   bytes = len = 0;
-  while ((bytes = fread (payload, 1, EPCS_BLK_SIZE, bin)) > 0)
+  while (result == E_SUCCESS
+	 && (bytes = fread (payload, 1, EPCS_BLK_SIZE, bin)) > 0)
     {
-      int i;
+      int n = blk - orig_blk;
 
       len += bytes;
-      printf ("Read in %d bytes, Block %d\n", bytes, blk);
 
-      for (i = 0; i < EPCS_BLK_SIZE; i += 256)
+      if (n < nblocks && done[n])
 	{
-	  if (udp_write_to_blk (f, i, 256, payload + i) != FBLIB_ESUCCESS)
+	  if (vbose > 0)
+	    printf ("Block %d already committed, skipping\n", blk);
+	  skipped++;
+	  blk++;
+	  continue;
+	}
+
+      if (opts->delta && n < nblocks)
+	{
+	  gettimeofday (&step, NULL);
+	  v.address = blk * EPCS_BLK_SIZE;
+	  v.len = bytes;
+	  result = flash_compare_block (f, pool, &v);
+	  compare_secs += flash_elapsed (&step);
+	  if (result != E_SUCCESS)
 	    {
-	      fprintf (stderr,
-		       "Error writing to block %d at offset %d (0x%X)\n", blk,
-		       i, i);
-	      free (payload);
-	      return E_FBLIB;
+	      fprintf (stderr, "Unable to read block %d from device!\n", blk);
+	      break;
+	    }
+	  if (v.mismatch < 0)
+	    {
+	      if (vbose > 0)
+		printf ("Block %d unchanged, skipping\n", blk);
+	      checked[n] = true;
+	      skipped++;
+	      blk++;
+	      continue;
 	    }
 	}
 
-      if (udp_start_blk_write (f, blk) != FBLIB_ESUCCESS)
+      printf ("Read in %d bytes, Block %d\n", bytes, blk);
+
+      gettimeofday (&step, NULL);
+      result = flash_write_block (f, pool, payload, blk, &retransmits);
+      write_secs += flash_elapsed (&step);
+      written_bytes += bytes;
+      if (result == E_SUCCESS && journal != NULL)
 	{
-	  fprintf (stderr, "Error executing write on block %d\n", blk);
-	  free (payload);
-	  return E_FBLIB;
+	  v.address = blk * EPCS_BLK_SIZE;
+	  v.len = bytes;
+	  result = flash_compare_block (f, pool, &v);
+	  if (result == E_SUCCESS && v.mismatch >= 0)
+	    {
+	      fprintf (stderr, "Error verifying block %d, offset %d\n", blk,
+		       v.mismatch);
+	      result = E_FBLIB;
+	    }
+	  if (result == E_SUCCESS)
+	    {
+	      journal_commit (journal, blk);
+	      if (n < nblocks)
+		checked[n] = true;
+	    }
 	}
-
+      written++;
       blk++;
     }
 
-  printf ("Starting flash verification\n");
+  pthread_mutex_destroy (&v.lock);
 
-  /* Verify success of flashing */
-  tmp = tmpfile ();
-  if (tmp == NULL)
+  if (result == E_SUCCESS)
     {
-      perror ("tmpfile");
-      free (payload);
-      return E_SYSTEM;
-    }
+      secs = flash_elapsed (&start);
+      /* Skipped blocks cost no writes, so they are left out of the
+         throughput */
+      printf ("Uploaded %d bytes in %.2f s, wrote %d bytes (%.1f KB/s), "
+	      "%lu retransmissions\n", len, secs, written_bytes,
+	      write_secs > 0 ? written_bytes / write_secs / 1024 : 0.0,
+	      retransmits);
+
+      if (opts->delta || journal != NULL)
+	{
+	  /* Each skipped block would have cost an average block write */
+	  double saved = 0;
+	  if (written > 0)
+	    saved = skipped * (write_secs / written) - compare_secs;
+	  printf ("%d of %d blocks unchanged or already committed, "
+		  "about %.2f s saved\n", skipped, skipped + written,
+		  saved > 0 ? saved : 0.0);
+	}
 
-  free (payload);
-  if ((result =
-       read_flash_to_file (f, tmp, orig_blk * EPCS_BLK_SIZE,
-			   len)) != E_SUCCESS)
-    {
-      fprintf (stderr, "Error reading flash to check results!\n");
-      fclose (tmp);
-      return result;
-    }
+      printf ("Starting flash verification\n");
 
-  rewind (bin);
-  rewind (tmp);
+      /* Verify success of flashing, skipping the blocks delta mode
+         or the journal has just compared */
+      result = flash_verify (f, pool, bin, payload, orig_blk, checked,
+			     nblocks);
+      if (result != E_SUCCESS)
+	fprintf (stderr, "Comparision between input and flash failed!\n");
+    }
 
-  if (diff_file (tmp, bin) != 0)
+  if (journal != NULL)
     {
-      fprintf (stderr, "Comparision between input and flash failed!\n");
-      fclose (tmp);
-      return E_FBLIB;
+      fclose (journal);
+      /* A verified image leaves nothing to resume */
+      if (result == E_SUCCESS)
+	unlink (opts->journal);
     }
 
-  fclose (tmp);
-  return E_SUCCESS;
+  fbpool_destroy (pool);
+  free (done);
+  free (checked);
+  free (payload);
+  return result;
 }
 
-
 void
 show_warning ()
 {
@@ -202,23 +577,24 @@ show_warning ()
  *
  *  Must be called after statusInitalize()
  * 
- *  @param f the device context
+ *  @param ctx the device context
+ *  @param f the libfb context of the device
  *  @param bytes the file length in bytes
  *  @return an error code, if applicable
  */
 FB_STATUS
-flash_set_gpaklen (libfb_t * f, size_t bytes)
+flash_set_gpaklen (T_CONTEXT * ctx, libfb_t * f, size_t bytes)
 {
   int epcs_blk, epcs_location;
   EPCS_CONFIG current;
 
-  if (dsi == NULL)
+  if (ctx->dsi == NULL)
     return E_BADSTATE;
 
-  epcs_blk = dsi->epcs_blocks - 2;
+  epcs_blk = ctx->dsi->epcs_blocks - 2;
   epcs_location = epcs_blk * 65536;
 
-  if (udp_read_blk
+  if (fbt_udp_read_blk
       (f, epcs_location, sizeof (EPCS_CONFIG),
        (uint8_t *) & current) != FBLIB_ESUCCESS)
     return E_FBLIB;
@@ -229,10 +605,10 @@ flash_set_gpaklen (libfb_t * f, size_t bytes)
       current.gpak_len = bytes;
       current.crc16 =
 	crc_16 ((uint8_t *) & current, sizeof (EPCS_CONFIG) - 2);
-      if (udp_write_to_blk (f, 0, sizeof (EPCS_CONFIG), (uint8_t *) & current)
-	  != FBLIB_ESUCCESS)
+      if (fbt_udp_write_to_blk (f, 0, sizeof (EPCS_CONFIG),
+				(uint8_t *) & current) != FBLIB_ESUCCESS)
 	return E_FBLIB;
-      if (udp_start_blk_write (f, epcs_blk) != FBLIB_ESUCCESS)
+      if (fbt_udp_start_blk_write (f, epcs_blk) != FBLIB_ESUCCESS)
 	return E_FBLIB;
     }
 
@@ -0,0 +1,427 @@
+/*
+   fonulator 3 - foneBRIDGE configuration daemon
+   (C) 2005-2007 Redfone Communications, LLC.
+   www.red-fone.com
+
+   Fleet Configuration
+*/
+/** @file
+ *
+ * Configure many devices from one invocation. The fleet list names one
+ * configuration file per line. Each device is configured in its own
+ * T_CONTEXT, which keeps its state isolated from every other device,
+ * by one of up to `jobs' worker threads. When all of them have
+ * finished a summary of per-device results and timings is printed.
+ *
+ * In plan mode the devices are not changed; the libfb calls each
+ * would be made are printed instead. A line may then name a snapshot saved
+ * with --save-snapshot after the configuration file, separated by
+ * white space, to plan that device without contacting it.
+ *
+ * The devices of a site file can be run the same way, see runSite().
+ * The file is parsed once and each worker is handed the context of
+ * its device ready made.
+ */
+#include "fonulator.h"
+
+#if defined(STDC_HEADERS) || defined(HAVE_STDLIB_H)
+# include <stdlib.h>
+#endif
+
+#include <pthread.h>
+#include <sys/time.h>
+
+extern int vbose;
+
+/** One device of a fleet run */
+typedef struct
+{
+  char *config;			/**< Configuration file of the device */
+  char *snapshot;		/**< Saved snapshot of the device, or NULL */
+  T_CONTEXT *ctx;		/**< Parsed configuration, or NULL to load config */
+  FB_STATUS status;		/**< Result of configuring it */
+  double secs;			/**< Wall time it took */
+}
+T_FLEET_DEVICE;
+
+/** State shared by the workers of a fleet run */
+typedef struct
+{
+  pthread_mutex_t lock;
+  DListElmt *next;		/**< Next device to configure, guarded by lock */
+  bool save_config;
+  bool clear_config;
+  bool plan;			/**< Print plans instead of configuring */
+}
+T_FLEET;
+
+/** @brief free a fleet device entry */
+static void
+fleet_destroy (T_FLEET_DEVICE * dev)
+{
+  contextDestroy (dev->ctx);
+  free (dev->config);
+  free (dev->snapshot);
+  free (dev);
+}
+
+/** @return seconds elapsed since `start' */
+static double
+fleet_elapsed (struct timeval *start)
+{
+  struct timeval now;
+  gettimeofday (&now, NULL);
+  return (now.tv_sec - start->tv_sec) + (now.tv_usec - start->tv_usec) / 1e6;
+}
+
+/** @brief Read the fleet list into a linked list of devices
+ *
+ * Blank lines and lines starting with '#' are ignored. Anything
+ * after the first white space of a line names a snapshot file.
+ *
+ * @param path the fleet list file
+ * @param devices an initialized list to fill
+ * @return success/error code
+ */
+static FB_STATUS
+fleet_read_list (const char *path, DList * devices)
+{
+  char line[1024];
+  FILE *fp = fopen (path, "r");
+
+  if (fp == NULL)
+    {
+      fprintf (stderr, "Error opening fleet list %s.\n", path);
+      perror ("fopen");
+      return E_SYSTEM;
+    }
+
+  while (fgets (line, sizeof (line), fp) != NULL)
+    {
+      T_FLEET_DEVICE *dev;
+      char *start = line, *end, *snapshot;
+
+      while (*start == ' ' || *start == '\t')
+	start++;
+      end = start + strlen (start);
+      while (end > start && (end[-1] == '\n' || end[-1] == '\r'
+			     || end[-1] == ' ' || end[-1] == '\t'))
+	*--end = '\0';
+
+      if (*start == '\0' || *start == '#')
+	continue;
+
+      snapshot = start + strcspn (start, " \t");
+      if (*snapshot != '\0')
+	{
+	  *snapshot++ = '\0';
+	  snapshot += strspn (snapshot, " \t");
+	}
+
+      dev = calloc (1, sizeof (T_FLEET_DEVICE));
+      if (dev == NULL || (dev->config = strdup (start)) == NULL
+	  || (*snapshot != '\0' && (dev->snapshot = strdup (snapshot)) == NULL))
+	{
+	  perror ("malloc");
+	  if (dev != NULL)
+	    free (dev->config);
+	  free (dev);
+	  fclose (fp);
+	  return E_SYSTEM;
+	}
+      dlist_ins_next (devices, dlist_tail (devices), dev);
+    }
+
+  fclose (fp);
+  return E_SUCCESS;
+}
+
+/** @brief Print the per-device results of a fleet run */
+static int
+fleet_summary (DList * devices, double secs, bool plan)
+{
+  DListElmt *element;
+  int failed = 0;
+
+  printf ("\n%-40s %-12s %8s\n", "Configuration", "Result", "Time (s)");
+  for (element = dlist_head (devices); element != NULL;
+       element = dlist_next (element))
+    {
+      T_FLEET_DEVICE *dev = dlist_data (element);
+      char result[32];
+
+      if (dev->status == E_SUCCESS)
+	strcpy (result, "ok");
+      else
+	{
+	  snprintf (result, sizeof (result), "failed (%d)", dev->status);
+	  failed++;
+	}
+
+      printf ("%-40s %-12s %8.2f\n", dev->config, result, dev->secs);
+    }
+
+  printf ("\n%d of %d devices %s in %.2f s\n",
+	  dlist_size (devices) - failed, dlist_size (devices),
+	  plan ? "planned" : "configured", secs);
+  return failed;
+}
+
+/** @brief Configure one device of a fleet
+ *
+ * @param fleet the fleet run
+ * @param dev the device to configure
+ * @return success/error code
+ */
+static FB_STATUS
+fleet_configure (T_FLEET * fleet, T_FLEET_DEVICE * dev)
+{
+  T_CONTEXT *ctx;
+  libfb_t *fb;
+  FB_STATUS status = E_SUCCESS;
+
+  if (dev->ctx != NULL)
+    {
+      ctx = dev->ctx;
+      dev->ctx = NULL;
+    }
+  else
+    {
+      ctx = contextCreate ();
+      if (ctx == NULL)
+	return E_SYSTEM;
+      status = loadConfig (ctx, dev->config);
+    }
+
+  /* Nobody can answer a prompt in the middle of a fleet */
+  ctx->interactive = false;
+
+  if (status != E_SUCCESS)
+    {
+      contextDestroy (ctx);
+      return status;
+    }
+
+  if (fleet->plan && dev->snapshot != NULL)
+    {
+      status = statusLoadSnapshot (ctx, dev->snapshot);
+      if (status == E_SUCCESS)
+	status = planConfig (ctx, fleet->save_config, fleet->clear_config);
+      contextDestroy (ctx);
+      return status;
+    }
+
+  fb = connectDevice (ctx);
+  if (fb == NULL)
+    {
+      contextDestroy (ctx);
+      return E_FBLIB;
+    }
+
+  if (fleet->plan)
+    status = planConfig (ctx, fleet->save_config, fleet->clear_config);
+  else if ((status = prepareConfig (ctx, fb)) == E_SUCCESS)
+    {
+      status = configureFonebridge (ctx, fb);
+      if (status != E_SUCCESS)
+	fprintf (stderr, "%s: configureFonebridge failed (%d)\n",
+		 dev->config, status);
+      else if (fleet->clear_config || fleet->save_config)
+	{
+	  if (storeConfig (fb, fleet->clear_config) != FBLIB_ESUCCESS)
+	    status = E_FBLIB;
+	}
+    }
+
+  libfb_destroy (fb);
+  contextDestroy (ctx);
+  return status;
+}
+
+/** @brief Worker thread body: configure devices until none are left */
+static void *
+fleet_worker (void *data)
+{
+  T_FLEET *fleet = data;
+
+  for (;;)
+    {
+      T_FLEET_DEVICE *dev;
+      struct timeval start;
+
+      pthread_mutex_lock (&fleet->lock);
+      if (fleet->next == NULL)
+	{
+	  pthread_mutex_unlock (&fleet->lock);
+	  break;
+	}
+      dev = dlist_data (fleet->next);
+      fleet->next = dlist_next (fleet->next);
+      pthread_mutex_unlock (&fleet->lock);
+
+      if (vbose > 0)
+	printf ("Configuring %s\n", dev->config);
+
+      gettimeofday (&start, NULL);
+      dev->status = fleet_configure (fleet, dev);
+      dev->secs = fleet_elapsed (&start);
+    }
+
+  return NULL;
+}
+
+/** @brief Configure a list of devices concurrently
+ *
+ * Each device gets its own T_CONTEXT and libfb context, so nothing is
+ * shared between the worker threads but the list of devices left to
+ * configure. Prompts are disabled for the whole run.
+ *
+ * @param devices the devices, destroyed when done
+ * @param jobs the maximum number of devices configured at once
+ * @param save_config save the configuration on each device afterwards
+ * @param clear_config clear the saved configuration on each device
+ * @param plan print what each device would be sent instead
+ * @return EXIT_SUCCESS if every device was configured
+ */
+static int
+fleet_run (DList * devices, int jobs, bool save_config, bool clear_config,
+	   bool plan)
+{
+  T_FLEET fleet;
+  pthread_t *threads;
+  struct timeval start;
+  int i, started = 0, failed;
+
+  if (jobs < 1)
+    jobs = 1;
+  if (jobs > dlist_size (devices))
+    jobs = dlist_size (devices);
+
+  threads = calloc (jobs, sizeof (pthread_t));
+  if (threads == NULL)
+    {
+      perror ("calloc");
+      dlist_destroy (devices);
+      return EXIT_FAILURE;
+    }
+
+  pthread_mutex_init (&fleet.lock, NULL);
+  fleet.next = dlist_head (devices);
+  fleet.save_config = save_config;
+  fleet.clear_config = clear_config;
+  fleet.plan = plan;
+
+  gettimeofday (&start, NULL);
+
+  for (i = 0; i < jobs; i++)
+    {
+      if (pthread_create (&threads[i], NULL, fleet_worker, &fleet) != 0)
+	{
+	  perror ("pthread_create");
+	  break;
+	}
+      started++;
+    }
+
+  /* Nothing could be started: configure the devices one at a time */
+  if (started == 0)
+    fleet_worker (&fleet);
+
+  for (i = 0; i < started; i++)
+    pthread_join (threads[i], NULL);
+
+  failed = fleet_summary (devices, fleet_elapsed (&start), plan);
+
+  pthread_mutex_destroy (&fleet.lock);
+  free (threads);
+  dlist_destroy (devices);
+  return failed ? EXIT_FAILURE : EXIT_SUCCESS;
+}
+
+/** @brief Configure every device of a fleet list concurrently
+ *
+ * @param list the fleet list file
+ * @param jobs the maximum number of devices configured at once
+ * @param save_config save the configuration on each device afterwards
+ * @param clear_config clear the saved configuration on each device
+ * @param plan print what each device would be sent instead
+ * @return EXIT_SUCCESS if every device was configured
+ */
+int
+runFleet (const char *list, int jobs, bool save_config, bool clear_config,
+	  bool plan)
+{
+  DList devices;
+
+  dlist_init (&devices, (void (*)(void *)) (fleet_destroy));
+
+  if (fleet_read_list (list, &devices) != E_SUCCESS)
+    return EXIT_FAILURE;
+
+  if (dlist_size (&devices) == 0)
+    {
+      fprintf (stderr, "Fleet list %s names no devices.\n", list);
+      return EXIT_FAILURE;
+    }
+
+  return fleet_run (&devices, jobs, save_config, clear_config, plan);
+}
+
+/** @brief Configure several devices of a site file concurrently
+ *
+ * The site file is parsed once. Every device is looked up before any
+ * is configured, so a misspelt name changes nothing.
+ *
+ * @param path the site file
+ * @param keys the names or addresses of the devices
+ * @param nkeys the number of keys
+ * @param jobs the maximum number of devices configured at once
+ * @param save_config save the configuration on each device afterwards
+ * @param clear_config clear the saved configuration on each device
+ * @param plan print what each device would be sent instead
+ * @return EXIT_SUCCESS if every device was configured
+ */
+int
+runSite (const char *path, const char **keys, int nkeys, int jobs,
+	 bool save_config, bool clear_config, bool plan)
+{
+  DList devices;
+  T_SITE *site;
+  int i;
+
+  site = siteLoad (path);
+  if (site == NULL)
+    return EXIT_FAILURE;
+
+  dlist_init (&devices, (void (*)(void *)) (fleet_destroy));
+
+  for (i = 0; i < nkeys; i++)
+    {
+      T_FLEET_DEVICE *dev = calloc (1, sizeof (T_FLEET_DEVICE));
+
+      if (dev == NULL || (dev->config = strdup (keys[i])) == NULL)
+	{
+	  perror ("malloc");
+	  free (dev);
+	  break;
+	}
+      dlist_ins_next (&devices, dlist_tail (&devices), dev);
+
+      dev->ctx = siteTake (site, keys[i]);
+      if (dev->ctx == NULL)
+	{
+	  fprintf (stderr, "No device %s in %s, or it is named twice.\n",
+		   keys[i], path);
+	  break;
+	}
+    }
+  siteDestroy (site);
+
+  if (i < nkeys)
+    {
+      dlist_destroy (&devices);
+      return EXIT_FAILURE;
+    }
+
+  return fleet_run (&devices, jobs, save_config, clear_config, plan);
+}
@@ -26,10 +26,13 @@
  * command line options. Except when special operations are selected
  * the default behavior is then to read the selected configuration
  * file and begin parsing. This is accomplished by using the `flex'
- * fast lexical analyzer generator. The lexParser() routine repeatedly
- * calls yylex() which returns the type of the next token in the
- * specified configuration file. A linked list of tokens (and their
- * ancillary data) is stored in token_list.
+ * fast lexical analyzer generator. The treeParser() routine repeatedly
+ * calls lexToken(), which has yylex() return the type of the next
+ * token in the specified configuration file, and applies each token
+ * to the device's T_CONTEXT as soon as it is read. The context holds
+ * all of the state belonging to one device, and the scanner is
+ * reentrant with its state held per parse, so any number of files
+ * can be parsed at once.
  * 
  * @subsubsection tokens_sec Tokens
  *
@@ -40,13 +43,15 @@
  * actions to take when a token is encountered in a configuration
  * file. Similarly the fonulator program must be told what actions to
  * take for each token. These behaviors are specified in tokens.l and
- * in treeParser() respectively.
+ * in the parse_rules table of treeParser() respectively. A new token
+ * needs a rule there naming the parser states it is allowed in and
+ * its handler.
  *
  * @subsubsection treeparser_sec  Tree Parser
  *
- * The token_list linked list is complete once the lexical analyzer
- * has finished parsing the input file. The treeParser() routine now
- * iterates over the tokens list, ensuring that:
+ * Tokens are not kept once they have been applied, so parsing takes
+ * no memory per token. The treeParser() routine consumes the tokens
+ * in file order, ensuring that:
  *
  * <ul> <li> The configuration file was properly formatted.
  *
@@ -67,9 +72,9 @@
  * Various special functions are now called if required by the user,
  * such as rebooting the device or programming it with license
  * files. Otherwise the device is reconfigured, this requires that we
- * have a span_list linked list that has an entry for each physical
- * span on the device and no more. If this is not the case
- * completeSpans() is called or the error condition is reported.
+ * have a span table that has an entry for each physical span on the
+ * device and no more. If this is not the case completeSpans() is
+ * called or the error condition is reported.
  *
  * If a DSP is available on the target device configureDSP() is
  * run. Ultimately configureFonebridge() is called which runs the
@@ -95,47 +100,19 @@
 #endif
 
 /** UDP configuration socket port on foneBRIDGE devices */
-#define UDP_CONFIG_PORT 1024
+#define UDP_CONFIG_PORT DOOF_UDP_PORT
 /** default location of the configuration file */
 #define DEFAULT_CONFIG "/etc/redfone.conf"
+/** default number of devices configured at once in fleet mode */
+#define DEFAULT_FLEET_JOBS 8
+/** default control socket when run as fonulatord */
+#define DEFAULT_DAEMON_SOCKET "/var/run/fonulatord.sock"
 
 #include "ver.h"
 
-/* flex externals */
-extern int yylval;
-extern char *yytext;
-extern FILE *yyin;
-extern int yylineno;
-extern int yylex (void);
-extern int yylex_destroy (void);
-
 /* fonulator globals */
 
-/** @var state
- *
- * The internal state of the fonulator parsing, configuration and
- * other routines.  See state.h for enumation of possible states.
- */
-static STATE state = STATE_NONE;
-
-/** @var token_list
- * The file local pointer to the head of the linked list of tokens.
- */
-static DList *token_list = NULL;
-
-/** @var span_list
- * The file local pointer to the head of the linked list of spans.
- */
-static DList *span_list = NULL;
-
-/** The maximum number of keys that we can store in flash memory */
-#define MAX_KEYS 32
-/** An array of keys/licenses parsed for programming to the device. */
-static KEY_ENTRY all_keys[MAX_KEYS];
-/** For each valid key, k, in all_keys valid_keys[k] is true. */
-static int valid_keys[MAX_KEYS];
-
-static bool priorities_valid ();
+static bool priorities_valid (T_CONTEXT * ctx);
 /** Verbosity level */
 int vbose = 0;
 
@@ -239,37 +216,72 @@ parse_huge_hexnumber (char *hexnum, int size, unsigned char *store)
 }
 
 
+/** @brief Add span `num' to the span table
+ *
+ * @param ctx the device context
+ * @param num the span number, from 1
+ * @return the new span, or NULL if memory could not be allocated
+ */
+static T_SPAN *
+span_create (T_CONTEXT * ctx, int num)
+{
+  T_SPAN *current;
+
+  if (num > ctx->span_slots)
+    {
+      T_SPAN **spans = realloc (ctx->spans, num * sizeof (T_SPAN *));
+      if (spans == NULL)
+	{
+	  perror ("realloc");
+	  return NULL;
+	}
+      memset (spans + ctx->span_slots, 0,
+	      (num - ctx->span_slots) * sizeof (T_SPAN *));
+      ctx->spans = spans;
+      ctx->span_slots = num;
+    }
+
+  current = malloc (sizeof (T_SPAN));
+  if (current == NULL)
+    {
+      perror ("malloc");
+      return NULL;
+    }
+  memset (current, 0, sizeof (T_SPAN));
+  current->num = num;
+  ctx->total_spans++;
+  ctx->spans[num - 1] = current;
+  return current;
+}
+
 /** @brief Return a pointer to the T_SPAN structure with number `num'.
  *
  * The span number is indexed from 1. For example, '1' is the first
  * span on a foneBRIDGE and '4' is the last span on a quad foneBRIDGE.
  * 
- * If a span number is not found in the list then it is created and
- * added to the linked list of T_SPAN pointers. This means that a
- * pointer to the right T_SPAN is always returned except if memory is
- * not available to allocate the space. 
+ * Spans are held in a table indexed by span number, which grows as
+ * higher numbered spans are parsed. If a span is not in the table
+ * then it is created, unless the configuration is already being
+ * run. This means that a pointer to the right T_SPAN is always
+ * returned while parsing except if memory is not available to
+ * allocate the space.
  * 
+ * @param ctx the device context
+ * @param num the span number
  * @return pointer to the desired T_SPAN. Always creates a new entry
  * if not found. Returns NULL if creation failed.
  */
 T_SPAN *
-get_span (int num)
+get_span (T_CONTEXT * ctx, int num)
 {
-  T_SPAN *current;
-  DListElmt *element;
+  if (num < 1)
+    return NULL;
 
   /* Find span, or create it */
+  if (num <= ctx->span_slots && ctx->spans[num - 1] != NULL)
+    return ctx->spans[num - 1];
 
-  element = dlist_head (span_list);
-  while (element != NULL)
-    {
-      current = dlist_data (element);
-      if (current->num == num)
-	return current;
-      element = dlist_next (element);
-    }
-
-  if (state == STATE_RUN)
+  if (ctx->state == STATE_RUN)
     {
       DBG (printf ("Couldn't find span %d.\n", num));
       return NULL;
@@ -278,548 +290,624 @@ get_span (int num)
   DBG (printf ("Couldn't find span %d, creating.\n", num));
 
   /* Couldn't find it. Create. */
-  element = dlist_tail (span_list);
-  current = malloc (sizeof (T_SPAN));
-  if (current == NULL)
-    {
-      perror ("malloc");
-      return NULL;
-    }
-  memset (current, 0, sizeof (T_SPAN));
-  current->num = num;
-  smachine.total_spans++;
-  dlist_ins_next (span_list, element, current);
-  return current;
+  return span_create (ctx, num);
+}
+
+/**
+ * @param ctx the device context
+ * @return the lowest numbered span configured, or NULL if there is none
+ */
+T_SPAN *
+get_first_span (T_CONTEXT * ctx)
+{
+  int i;
+
+  for (i = 0; i < ctx->span_slots; i++)
+    if (ctx->spans[i] != NULL)
+      return ctx->spans[i];
+  return NULL;
 }
 
 /**
- * treeParser goes through the entire list of parsed tokens
- * (token_list) and for each token it executes a specific behavior to
- * that token type. If any behavior fails the entire routine fails,
- * likely because some part of the configuration is invalid.
  *
- * @return success/failure code
+ * Reads the next token of the configuration file. The string value
+ * points into the scanner's buffer and is only valid until the next
+ * token is read.
+ *
+ * @param scanner the scanner, created with `token' as its extra data
+ * @param token where to store the token
+ * @return the token type, TOK_LEX_EOF at end of file
  */
-FB_STATUS
-treeParser (void)
+static int
+lexToken (yyscan_t scanner, T_TOKEN * token)
 {
-  T_TOKEN *current;
-  DListElmt *element;
-  int current_key = -1;
-  bool exit = false;
-  FB_STATUS status;
+  token->ival = 0;
+  token->token = yylex (scanner);
+  token->sval = yyget_text (scanner);
+  token->lineno = yyget_lineno (scanner);
+  return token->token;
+}
 
-  smachine.wpll=1; //by default the wpll is enabled
+/** Parser state kept from one token to the next, see treeTokens() */
+typedef struct
+{
+  T_CONTEXT *ctx;		/**< Context the tokens are applied to */
+  T_SITE *site;			/**< Site being parsed, or NULL */
+  int key;			/**< Key slot being read, -1 if none */
+  dsp_chantype chantype;	/**< Channel type the next [dsp] value sets */
+}
+T_PARSE;
 
-  dsp_chantype current_chantype = DSP_DATA;
+/** Applies one token, the state having been checked already */
+typedef FB_STATUS (*T_PARSE_HANDLER) (T_PARSE * p, T_TOKEN * t);
 
-  element = dlist_head (token_list);
-  current = dlist_data (element);
+/** Bit of parser state `s' in T_PARSE_RULE states */
+#define PARSE_IN(s) (1U << ((s) - STATE_NONE))
+/** Every state the parser can be in */
+#define PARSE_ANY (PARSE_IN (STATE_RUN) - 1)
 
-  while (!exit || current != NULL)
-    {
-      switch (current->token)
-	{
-	case TOK_GLOBALS:
-	  if (state == STATE_NONE)
-	    state = STATE_GLOBAL;
-	  else
-	    {
-	      /*
-	       * We are in some other state and cannot go
-	       * back to global.
-	       */
-	      return E_BADSTATE;
-	    }
-	  break;
+/** How one token type is parsed */
+typedef struct
+{
+  const char *name;		/**< Name used in error messages */
+  unsigned int states;		/**< PARSE_IN() mask of the states allowed */
+  T_PARSE_HANDLER handler;
+}
+T_PARSE_RULE;
 
-	case TOK_PORT:
-	  if (state == STATE_GLOBAL)
-	    {
-	      smachine.port = current->ival;
-	      DBG (printf ("Set port to %d\n", smachine.port));
-	    }
-	  else
-	    {
-	      return E_BADSTATE;
-	    }
-	  break;
+/** @return the span being parsed, created on first use */
+static T_SPAN *
+parse_span_of (T_PARSE * p)
+{
+  return get_span (p->ctx, p->ctx->span);
+}
 
-	case TOK_PRIO:
-	  if (state == STATE_GLOBAL)
-	    {
-	      int i;
-	      for (i = 0; i < 7; i += 2)
-		{
-		  smachine.priorities[i / 2] =
-		    strtoul (&current->sval[i], NULL, 10);
-		}
-	    }
-	  else
-	    return E_BADSTATE;
-	  break;
+static FB_STATUS
+parse_globals (T_PARSE * p, T_TOKEN * t)
+{
+  p->ctx->state = STATE_GLOBAL;
+  return E_SUCCESS;
+}
 
-	case TOK_WPLLOFF:
-	  if (state == STATE_GLOBAL)
-	    {
-	       smachine.wpll = 0;
-            }
-	  else
-	    return E_BADSTATE;
-	  break;
-		
-	case TOK_ULAW:
-	  smachine.companding = DSP_COMP_TYPE_ULAW;
-	  break;
-	case TOK_ALAW:
-	  smachine.companding = DSP_COMP_TYPE_ALAW;
-	  break;
-	case TOK_DSP_OFF:
-	  smachine.companding = -1;
-	  break;
-	case TOK_DSP_DISABLED:
-	  smachine.companding = -1;
-	  smachine.dspdisabled = true;
-	  break;
-
-	case TOK_FB_CONFIG:
-	  if (state == STATE_GLOBAL)
-	    {
-	      DBG (printf ("Setting up FB: %s\n", current->sval));
-	      smachine.fonebridge = malloc (strlen (current->sval) + 1);
-
-	      if (smachine.fonebridge == NULL)
-		{
-		  perror ("malloc");
-		  return E_SYSTEM;
-		}
-	      strcpy (smachine.fonebridge, current->sval);
-	    }
-	  else
-	    {
-	      return E_BADSTATE;
-	    }
-	  break;
+static FB_STATUS
+parse_section (T_PARSE * p, T_TOKEN * t)
+{
+  if (p->site == NULL)
+    {
+      fprintf (stderr, "Site file section on line %d; select a "
+	       "device with --device.\n", t->lineno);
+      return E_BADSTATE;
+    }
+  /* Every later token goes to the new section */
+  p->ctx = siteSection (p->site, t->token == TOK_DEVICE, t->sval,
+			t->lineno);
+  if (p->ctx == NULL)
+    return E_BADVALUE;
+  p->key = -1;
+  p->chantype = DSP_DATA;
+  return E_SUCCESS;
+}
 
-	case TOK_SERVER_CONFIG:
-	  if (state == STATE_GLOBAL)
-	    {
-	      DBG (printf ("Setting up server: %s\n", current->sval));
-	      smachine.server = malloc (1 + strlen (current->sval));
-	      if (smachine.server == NULL)
-		{
-		  perror ("malloc");
-		  return E_SYSTEM;
-		}
-	      strcpy (smachine.server, current->sval);
-	    }
-	  else
-	    {
-	      return E_BADSTATE;
-	    }
-	  break;
+static FB_STATUS
+parse_inherit (T_PARSE * p, T_TOKEN * t)
+{
+  if (p->site == NULL)
+    return E_BADSTATE;
+  p->ctx = siteInherit (p->site, t->sval, t->lineno);
+  return p->ctx ? E_SUCCESS : E_BADVALUE;
+}
 
-	  /* DSP Block Handlers */
-	case TOK_DSP_HEADER:
-	  if (state == STATE_GLOBAL || state == STATE_SPAN)
-	    {
-	      state = STATE_DSP;
-	      dspconfig_init_userconfig ();
-	    }
-	  else
-	    {
-	      return E_BADSTATE;
-	    }
-	  break;
-
-	case TOK_VOICEA:
-	  if (state != STATE_DSP)
-	    return E_BADSTATE;
-	  state = DSPSTATE_WAIT_FOR_VALUE;
-	  current_chantype = DSP_A;
-	  break;
-
-	case TOK_VOICEB:
-	  if (state != STATE_DSP)
-	    return E_BADSTATE;
-	  state = DSPSTATE_WAIT_FOR_VALUE;
-	  current_chantype = DSP_B;
-	  break;
-
-	case TOK_DATA:
-	  if (state != STATE_DSP)
-	    return E_BADSTATE;
-	  state = DSPSTATE_WAIT_FOR_VALUE;
-	  current_chantype = DSP_DATA;
-	  break;
-
-	case TOK_DIGIT:
-	  if (state != DSPSTATE_WAIT_FOR_VALUE)
-	    return E_BADSTATE;
-	  status = dspconfig_set_userdigit (current_chantype, current->ival);
-	  state = STATE_DSP;
-	  if (status != E_SUCCESS)
-	    return status;
-	  break;
-
-	case TOK_RANGE:
-	  if (state != DSPSTATE_WAIT_FOR_VALUE)
-	    return E_BADSTATE;
-	  char *dash = strchr (current->sval, '-');
-	  if (dash == NULL)
-	    return E_BADINPUT;
-	  int min, max;
-	  *dash = '\0';
-	  min = atoi (current->sval);
-	  dash++;
-	  max = atoi (dash);
-
-	  status = dspconfig_set_userrange (current_chantype, min, max);
-	  state = STATE_DSP;
-	  if (status != E_SUCCESS)
-	    return status;
-	  break;
-
-	case TOK_SPAN:
-	  if (state == STATE_GLOBAL)
-	    {
-	      state = STATE_SPAN;
-	    }
-	  else if (state != STATE_SPAN)
-	    {
-	      return E_BADSTATE;
-	    }
-	  if (smachine.span == current->ival)
-	    return E_DUPLICATE;
+static FB_STATUS
+parse_port (T_PARSE * p, T_TOKEN * t)
+{
+  p->ctx->port = t->ival;
+  DBG (printf ("Set port to %d\n", p->ctx->port));
+  return E_SUCCESS;
+}
 
-	  smachine.span = current->ival;
+static FB_STATUS
+parse_priorities (T_PARSE * p, T_TOKEN * t)
+{
+  char *s = t->sval;
+  int i;
 
-	  DBG (printf ("Starting parse for Span %d\n", smachine.span));
-	  break;
+  for (i = 0; *s != '\0'; i++)
+    {
+      if (i >= IDT_LINKS)
+	return E_BADVALUE;
+      p->ctx->priorities[i] = strtoul (s, &s, 10);
+      if (*s == ',')
+	s++;
+    }
+  return E_SUCCESS;
+}
 
-	case TOK_FRAMING:
-	  if (state == STATE_SPAN)
-	    {
-	      T_SPAN *s = get_span (smachine.span);	/* get current span */
-	      if (!strcmp (current->sval, "cas"))
-		{
-		  s->config.E1Mode = 1;
-		  /*
-		   * RBS should never be reset to '0'
-		   * elsewhere in parsing routines or
-		   * this functionality might break
-		   */
-		  s->config.rbs_en = 1;
-		  s->config.framing = 0;
-		}
-	      else if (!strcmp (current->sval, "ccs"))
-		{
-		  s->config.E1Mode = 1;
-		  s->config.rbs_en = 0;
-		  s->config.framing = 0;
-		}
-	      else if (!strcmp (current->sval, "esf"))
-		{
-		  s->config.E1Mode = 0;
-		  s->config.framing = 1;
-		}
-	      else if (!strcmp (current->sval, "sf"))
-		{
-		  s->config.E1Mode = 0;
-		  s->config.framing = 0;
-		}
-	      else
-		{
-		  return E_BADVALUE;
-		}
-	    }
-	  else
-	    {
-	      return E_BADSTATE;
-	    }
-	  break;
+static FB_STATUS
+parse_wplloff (T_PARSE * p, T_TOKEN * t)
+{
+  p->ctx->wpll = 0;
+  return E_SUCCESS;
+}
 
-	case TOK_ENCODING:
-	  if (state == STATE_SPAN)
-	    {
-	      T_SPAN *s = get_span (smachine.span);	/* get current span */
-	      if (!strcmp (current->sval, "hdb3"))
-		{
-		  s->config.E1Mode = 1;
-		  s->config.encoding = 0;
-		}
-	      else if (!strcmp (current->sval, "b8zs"))
-		{
-		  s->config.E1Mode = 0;
-		  s->config.encoding = 0;
-		}
-	      else if (!strcmp (current->sval, "ami"))
-		{
-		  /* Could be E1 or T1 */
-		  s->config.encoding = 1;
-		}
-	      else
-		{
-		  return E_BADVALUE;
-		}
-	    }
-	  else
-	    {
-	      return E_BADSTATE;
-	    }
-	  break;
+static FB_STATUS
+parse_ulaw (T_PARSE * p, T_TOKEN * t)
+{
+  p->ctx->companding = DSP_COMP_TYPE_ULAW;
+  return E_SUCCESS;
+}
 
-	case TOK_CRCMF:
-	  if (state == STATE_SPAN)
-	    {
-	      T_SPAN *s = get_span (smachine.span);	/* get current span */
-	      s->config.CRCMF = 1;
-	    }
-	  else
-	    {
-	      return E_BADSTATE;
-	    }
-	  break;
+static FB_STATUS
+parse_alaw (T_PARSE * p, T_TOKEN * t)
+{
+  p->ctx->companding = DSP_COMP_TYPE_ALAW;
+  return E_SUCCESS;
+}
 
-	case TOK_J1:
-	  if (state == STATE_SPAN)
-	    {
-	      T_SPAN *s = get_span (smachine.span);
-	      s->config.J1Mode = 1;
-	      s->config.E1Mode = 0;
-	    }
-	  else
-	    {
-	      return E_BADSTATE;
-	    }
-	  break;
+static FB_STATUS
+parse_dsp_off (T_PARSE * p, T_TOKEN * t)
+{
+  p->ctx->companding = -1;
+  return E_SUCCESS;
+}
 
+static FB_STATUS
+parse_dsp_disabled (T_PARSE * p, T_TOKEN * t)
+{
+  p->ctx->companding = -1;
+  p->ctx->dspdisabled = true;
+  return E_SUCCESS;
+}
 
-	case TOK_RBS:
-	  if (state == STATE_SPAN)
-	    {
-	      T_SPAN *s = get_span (smachine.span);	/* get current span */
-	      DBG (printf ("RBS on span %d\n", s->num));
-	      s->config.rbs_en = 1;
-	    }
-	  else
-	    {
-	      return E_BADSTATE;
-	    }
-	  break;
+static FB_STATUS
+parse_fonebridge (T_PARSE * p, T_TOKEN * t)
+{
+  DBG (printf ("Setting up FB: %s\n", t->sval));
+  free (p->ctx->fonebridge);
+  p->ctx->fonebridge = strdup (t->sval);
+  if (p->ctx->fonebridge == NULL)
+    {
+      perror ("malloc");
+      return E_SYSTEM;
+    }
+  return E_SUCCESS;
+}
 
-	case TOK_LOOPBACK:
-	  if (state == STATE_SPAN)
-	    {
-	      T_SPAN *s = get_span (smachine.span);	/* get current span */
-	      DBG (printf ("LOOPBACK on span %d\n", s->num));
-	      s->config.rlb = 1;
-	    }
-	  else
-	    {
-	      return E_BADSTATE;
-	    }
-	  break;
+static FB_STATUS
+parse_server (T_PARSE * p, T_TOKEN * t)
+{
+  DBG (printf ("Setting up server: %s\n", t->sval));
+  free (p->ctx->server);
+  p->ctx->server = strdup (t->sval);
+  if (p->ctx->server == NULL)
+    {
+      perror ("malloc");
+      return E_SYSTEM;
+    }
+  return E_SUCCESS;
+}
 
-	case TOK_SLAVE:
-	  if (state == STATE_SPAN)
-	    {
-	      T_SPAN *s = get_span (smachine.span);	/* get current span */
-	      DBG (printf ("SLAVE on span %d\n", s->num));
-	      s->slave = true;
-	    }
-	  break;
+static FB_STATUS
+parse_dsp_header (T_PARSE * p, T_TOKEN * t)
+{
+  p->ctx->state = STATE_DSP;
+  dspconfig_init_userconfig (p->ctx);
+  return E_SUCCESS;
+}
 
-	case TOK_SHORTHAUL:
-	  if (state == STATE_SPAN)
-	    {
-	      T_SPAN *s = get_span (smachine.span);	/* get current span */
-	      if (s->longhaul)
-		{
-		  fprintf (stderr,
-			   "Shorthaul specified on line %d but longhaul already specified for this span.\n",
-			   current->lineno);
-
-		  return E_BADVALUE;
-		}
-
-	      if (current->ival < 0 || current->ival >= MAX_SHORTLBO)
-		{
-		  fprintf (stderr,
-			   "Invalid shorthaul configuration on line %d!\n",
-			   current->lineno);
-		  return E_BADVALUE;
-		}
-
-	      s->shorthaul = true;
-	      s->config.LBO = shortlbo[current->ival] & 0xF;
-	    }
-	  else
-	    {
-	      return E_BADSTATE;
-	    }
-	  break;
+/** voiceA=, voiceB= and data=: the next value sets channels to a type */
+static FB_STATUS
+parse_chantype (T_PARSE * p, T_TOKEN * t)
+{
+  p->ctx->state = DSPSTATE_WAIT_FOR_VALUE;
+  p->chantype = (t->token == TOK_VOICEA) ? DSP_A
+    : (t->token == TOK_VOICEB) ? DSP_B : DSP_DATA;
+  return E_SUCCESS;
+}
 
-	case TOK_LONGHAUL:
-	  if (state == STATE_SPAN)
-	    {
-	      T_SPAN *s = get_span (smachine.span);	/* get current span */
-	      if (s->shorthaul)
-		{
-		  fprintf (stderr,
-			   "Longhaul specified on line %d but shorthaul already specified for this span.\n",
-			   current->lineno);
-		  return E_BADVALUE;
-		}
-	      DBG (printf ("Adaptive equalizer on span %d\n", s->num));
-	      DBG (printf ("Longhaul value: %d\n", current->ival));
-
-	      if (current->ival < 0 || current->ival >= MAX_LONGLBO)
-		{
-		  fprintf (stderr,
-			   "Invalid longhaul configuration on line %d!\n",
-			   current->lineno);
-		  return E_BADVALUE;
-		}
-
-	      s->longhaul = true;
-	      s->config.LBO = longlbo[current->ival] & 0xF;
-	      s->config.EQ = true;
-	    }
-	  else
-	    {
-	      return E_BADSTATE;
-	    }
-	  break;
+static FB_STATUS
+parse_digit (T_PARSE * p, T_TOKEN * t)
+{
+  p->ctx->state = STATE_DSP;
+  return dspconfig_set_userdigit (p->ctx, p->chantype, t->ival);
+}
 
-	case TOK_DEJITTER:
-	  if (state == STATE_SPAN)
-	    {
-	      T_SPAN *s = get_span (smachine.span);	/* get current span */
-	      DBG (printf ("DEJITTER on span %d\n", s->num));
-	      s->dejitter = true;
-	    }
-	  else
-	    {
-	      return E_BADSTATE;
-	    }
-	  break;
+static FB_STATUS
+parse_range (T_PARSE * p, T_TOKEN * t)
+{
+  char *dash = strchr (t->sval, '-');
 
-	case TOK_BEGIN_KEY:
-	  break;
+  p->ctx->state = STATE_DSP;
+  if (dash == NULL)
+    return E_BADINPUT;
+  return dspconfig_set_userrange (p->ctx, p->chantype, atoi (t->sval),
+				  atoi (dash + 1));
+}
 
-	case TOK_SLOT_ID:
-	  current_key = strtol (current->sval, NULL, 16);
-	  DBG (printf ("Slot ID: %i\n", current_key));
-	  if (!(current_key >= 0 && current_key < MAX_KEYS))
-	    {
-	      fprintf (stderr, "Invalid slot ID for license key!\n");
-	      return E_BADTOKEN;
-	    }
-	  break;
+static FB_STATUS
+parse_span (T_PARSE * p, T_TOKEN * t)
+{
+  if (p->ctx->span == t->ival)
+    return E_DUPLICATE;
+  /* One span per link libfb can configure */
+  if (t->ival < 1 || t->ival > IDT_LINKS)
+    return E_BADVALUE;
+
+  p->ctx->state = STATE_SPAN;
+  p->ctx->span = t->ival;
+  DBG (printf ("Starting parse for Span %d\n", p->ctx->span));
+  return E_SUCCESS;
+}
 
-	case TOK_CUSTOMER_KEY:
-	  parse_huge_hexnumber (current->sval, CUSTOMER_KEY_SZ,
-				all_keys[current_key].customer_key);
-	  break;
+static FB_STATUS
+parse_framing (T_PARSE * p, T_TOKEN * t)
+{
+  T_SPAN *s = parse_span_of (p);
 
-	case TOK_END_KEY:
-	  valid_keys[current_key] = 1;
-	  break;
+  if (s == NULL)
+    return E_SYSTEM;
 
-	case TOK_LEX_EOF:
-	  exit = true;
-	  break;
+  if (!strcmp (t->sval, "cas"))
+    {
+      s->config.E1Mode = 1;
+      /*
+       * RBS should never be reset to '0'
+       * elsewhere in parsing routines or
+       * this functionality might break
+       */
+      s->config.rbs_en = 1;
+      s->config.framing = 0;
+    }
+  else if (!strcmp (t->sval, "ccs"))
+    {
+      s->config.E1Mode = 1;
+      s->config.rbs_en = 0;
+      s->config.framing = 0;
+    }
+  else if (!strcmp (t->sval, "esf"))
+    {
+      s->config.E1Mode = 0;
+      s->config.framing = 1;
+    }
+  else if (!strcmp (t->sval, "sf"))
+    {
+      s->config.E1Mode = 0;
+      s->config.framing = 0;
+    }
+  else
+    return E_BADVALUE;
+  return E_SUCCESS;
+}
 
-	case TOK_UNKNOWN:
-	default:
-	  printf ("Bad token in configuration file on line %d.\n",
-		  current->lineno);
-	  DBG (printf ("(%s) [%d]\n", current->sval, current->token));
-	  return E_BADTOKEN;
-	}
+static FB_STATUS
+parse_encoding (T_PARSE * p, T_TOKEN * t)
+{
+  T_SPAN *s = parse_span_of (p);
 
-      element = dlist_next (element);
-      if (element != NULL)
-	current = dlist_data (element);
-      else
-	current = NULL;
+  if (s == NULL)
+    return E_SYSTEM;
 
+  if (!strcmp (t->sval, "hdb3"))
+    {
+      s->config.E1Mode = 1;
+      s->config.encoding = 0;
+    }
+  else if (!strcmp (t->sval, "b8zs"))
+    {
+      s->config.E1Mode = 0;
+      s->config.encoding = 0;
     }
+  else if (!strcmp (t->sval, "ami"))
+    {
+      /* Could be E1 or T1 */
+      s->config.encoding = 1;
+    }
+  else
+    return E_BADVALUE;
   return E_SUCCESS;
 }
 
+static FB_STATUS
+parse_crc4 (T_PARSE * p, T_TOKEN * t)
+{
+  T_SPAN *s = parse_span_of (p);
 
-/** @brief Recursively free a linked list of tokens
- *
- * @param token pointed to a list of tokens to be free'd
- */
-void
-cleanupToken (T_TOKEN * token)
+  if (s == NULL)
+    return E_SYSTEM;
+  s->config.CRCMF = 1;
+  return E_SUCCESS;
+}
+
+static FB_STATUS
+parse_j1 (T_PARSE * p, T_TOKEN * t)
 {
-  free (token);
-  token = NULL;
+  T_SPAN *s = parse_span_of (p);
+
+  if (s == NULL)
+    return E_SYSTEM;
+  s->config.J1Mode = 1;
+  s->config.E1Mode = 0;
+  return E_SUCCESS;
 }
 
-/**
- *
- * lexParser calls yylex over and over until end of file is
- * reached. Each yylex call has (f)lex parse the next line in the
- * configuration file and return a TOK_* response if applicable.
- *
- * Parsed tokens are added to the linked list of tokens (token_list).
- *
- * @return 0 on success
- */
-int
-lexParser (void)
+static FB_STATUS
+parse_rbs (T_PARSE * p, T_TOKEN * t)
 {
-  int ret;
-  T_TOKEN *current = NULL;
+  T_SPAN *s = parse_span_of (p);
 
-  current = malloc (sizeof (T_TOKEN));
-  if (current == NULL)
+  if (s == NULL)
+    return E_SYSTEM;
+  DBG (printf ("RBS on span %d\n", s->num));
+  s->config.rbs_en = 1;
+  return E_SUCCESS;
+}
+
+static FB_STATUS
+parse_loopback (T_PARSE * p, T_TOKEN * t)
+{
+  T_SPAN *s = parse_span_of (p);
+
+  if (s == NULL)
+    return E_SYSTEM;
+  DBG (printf ("LOOPBACK on span %d\n", s->num));
+  s->config.rlb = 1;
+  return E_SUCCESS;
+}
+
+/* slave has always been ignored outside of a span */
+static FB_STATUS
+parse_slave (T_PARSE * p, T_TOKEN * t)
+{
+  T_SPAN *s;
+
+  if (p->ctx->state != STATE_SPAN)
     {
-      perror ("malloc");
-      return -1;
+      fprintf (stderr, "Ignoring slave outside of a span on line %d.\n",
+	       t->lineno);
+      return E_SUCCESS;
+    }
+
+  s = parse_span_of (p);
+  if (s == NULL)
+    return E_SYSTEM;
+  DBG (printf ("SLAVE on span %d\n", s->num));
+  s->slave = true;
+  return E_SUCCESS;
+}
+
+static FB_STATUS
+parse_shorthaul (T_PARSE * p, T_TOKEN * t)
+{
+  T_SPAN *s = parse_span_of (p);
+
+  if (s == NULL)
+    return E_SYSTEM;
+
+  if (s->longhaul)
+    {
+      fprintf (stderr, "Shorthaul specified but longhaul already "
+	       "specified for this span.\n");
+      return E_BADVALUE;
     }
+  if (t->ival < 0 || t->ival >= MAX_SHORTLBO)
+    return E_BADVALUE;
+
+  s->shorthaul = true;
+  s->config.LBO = shortlbo[t->ival] & 0xF;
+  return E_SUCCESS;
+}
 
-  if (dlist_ins_next (token_list, NULL, current) < 0)
+static FB_STATUS
+parse_longhaul (T_PARSE * p, T_TOKEN * t)
+{
+  T_SPAN *s = parse_span_of (p);
+
+  if (s == NULL)
+    return E_SYSTEM;
+
+  if (s->shorthaul)
     {
-      fprintf (stderr, "Failed to insert token into linked list.\n");
-      return -1;
+      fprintf (stderr, "Longhaul specified but shorthaul already "
+	       "specified for this span.\n");
+      return E_BADVALUE;
     }
+  DBG (printf ("Adaptive equalizer on span %d\n", s->num));
+  DBG (printf ("Longhaul value: %d\n", t->ival));
+  if (t->ival < 0 || t->ival >= MAX_LONGLBO)
+    return E_BADVALUE;
+
+  s->longhaul = true;
+  s->config.LBO = longlbo[t->ival] & 0xF;
+  s->config.EQ = true;
+  return E_SUCCESS;
+}
 
-  do
+static FB_STATUS
+parse_dejitter (T_PARSE * p, T_TOKEN * t)
+{
+  T_SPAN *s = parse_span_of (p);
+
+  if (s == NULL)
+    return E_SYSTEM;
+  DBG (printf ("DEJITTER on span %d\n", s->num));
+  s->dejitter = true;
+  return E_SUCCESS;
+}
+
+static FB_STATUS
+parse_begin_key (T_PARSE * p, T_TOKEN * t)
+{
+  p->key = -1;
+  return E_SUCCESS;
+}
+
+static FB_STATUS
+parse_slot_id (T_PARSE * p, T_TOKEN * t)
+{
+  p->key = strtol (t->sval, NULL, 16);
+  DBG (printf ("Slot ID: %i\n", p->key));
+  if (p->key < 0 || p->key >= MAX_KEYS)
     {
-      T_TOKEN *nextToken = NULL;
-      ret = yylex ();
+      p->key = -1;
+      return E_BADVALUE;
+    }
+  return E_SUCCESS;
+}
+
+static FB_STATUS
+parse_customer_key (T_PARSE * p, T_TOKEN * t)
+{
+  /* The slot must come first */
+  if (p->key < 0)
+    return E_BADSTATE;
+  parse_huge_hexnumber (t->sval, CUSTOMER_KEY_SZ,
+			p->ctx->all_keys[p->key].customer_key);
+  return E_SUCCESS;
+}
+
+static FB_STATUS
+parse_end_key (T_PARSE * p, T_TOKEN * t)
+{
+  if (p->key < 0)
+    return E_BADSTATE;
+  p->ctx->valid_keys[p->key] = 1;
+  return E_SUCCESS;
+}
+
+/** Where each token type is allowed and what it does. A token type
+ * without a handler is never valid. */
+static const T_PARSE_RULE parse_rules[TOK_COUNT] = {
+  [TOK_GLOBALS] = {"[globals]", PARSE_IN (STATE_NONE), parse_globals},
+  [TOK_DEVICE] = {"[device]", PARSE_ANY, parse_section},
+  [TOK_TEMPLATE] = {"[template]", PARSE_ANY, parse_section},
+  [TOK_INHERIT] = {"inherit", PARSE_IN (STATE_GLOBAL), parse_inherit},
+
+  [TOK_PORT] = {"port", PARSE_IN (STATE_GLOBAL), parse_port},
+  [TOK_PRIO] = {"priorities", PARSE_IN (STATE_GLOBAL), parse_priorities},
+  [TOK_WPLLOFF] = {"wplloff", PARSE_IN (STATE_GLOBAL), parse_wplloff},
+  [TOK_FB_CONFIG] = {"fb", PARSE_IN (STATE_GLOBAL), parse_fonebridge},
+  [TOK_SERVER_CONFIG] = {"server", PARSE_IN (STATE_GLOBAL), parse_server},
+
+  [TOK_ULAW] = {"dsp=ulaw", PARSE_ANY, parse_ulaw},
+  [TOK_ALAW] = {"dsp=alaw", PARSE_ANY, parse_alaw},
+  [TOK_DSP_OFF] = {"dsp=off", PARSE_ANY, parse_dsp_off},
+  [TOK_DSP_DISABLED] = {"dspdisabled", PARSE_ANY, parse_dsp_disabled},
+
+  [TOK_DSP_HEADER] = {"[dsp]", PARSE_IN (STATE_GLOBAL) | PARSE_IN (STATE_SPAN),
+		      parse_dsp_header},
+  [TOK_VOICEA] = {"voiceA", PARSE_IN (STATE_DSP), parse_chantype},
+  [TOK_VOICEB] = {"voiceB", PARSE_IN (STATE_DSP), parse_chantype},
+  [TOK_DATA] = {"data", PARSE_IN (STATE_DSP), parse_chantype},
+  [TOK_DIGIT] = {"channel", PARSE_IN (DSPSTATE_WAIT_FOR_VALUE), parse_digit},
+  [TOK_RANGE] = {"channel range", PARSE_IN (DSPSTATE_WAIT_FOR_VALUE),
+		 parse_range},
+
+  [TOK_SPAN] = {"[span]", PARSE_IN (STATE_GLOBAL) | PARSE_IN (STATE_SPAN),
+		parse_span},
+  [TOK_FRAMING] = {"framing", PARSE_IN (STATE_SPAN), parse_framing},
+  [TOK_ENCODING] = {"encoding", PARSE_IN (STATE_SPAN), parse_encoding},
+  [TOK_CRCMF] = {"crc4", PARSE_IN (STATE_SPAN), parse_crc4},
+  [TOK_J1] = {"J1", PARSE_IN (STATE_SPAN), parse_j1},
+  [TOK_RBS] = {"rbs", PARSE_IN (STATE_SPAN), parse_rbs},
+  [TOK_LOOPBACK] = {"loopback", PARSE_IN (STATE_SPAN), parse_loopback},
+  [TOK_SLAVE] = {"slave", PARSE_ANY, parse_slave},
+  [TOK_SHORTHAUL] = {"shorthaul", PARSE_IN (STATE_SPAN), parse_shorthaul},
+  [TOK_LONGHAUL] = {"longhaul", PARSE_IN (STATE_SPAN), parse_longhaul},
+  [TOK_DEJITTER] = {"dejitter", PARSE_IN (STATE_SPAN), parse_dejitter},
+
+  [TOK_BEGIN_KEY] = {"key_entry", PARSE_ANY, parse_begin_key},
+  [TOK_SLOT_ID] = {"SLOT_ID", PARSE_ANY, parse_slot_id},
+  [TOK_CUSTOMER_KEY] = {"CUSTOMER_KEY", PARSE_ANY, parse_customer_key},
+  [TOK_END_KEY] = {"end of key_entry", PARSE_ANY, parse_end_key},
+};
+
+/**
+ *
+ * Applies each token of a configuration file in turn, see
+ * treeParser(). Every token is looked up in parse_rules, which says
+ * in which parser states it may appear and which handler applies
+ * it. A token in the wrong state or rejected by its handler stops
+ * the parse with its line number.
+ *
+ * @param ctx the device context
+ * @param site the site being parsed, or NULL for a single device file
+ * @param scanner the scanner reading the file
+ * @param current the token the scanner fills in
+ * @return success/failure code
+ */
+static FB_STATUS
+treeTokens (T_CONTEXT * ctx, T_SITE * site, yyscan_t scanner,
+	    T_TOKEN * current)
+{
+  T_PARSE p = { ctx, site, -1, DSP_DATA };
+  const T_PARSE_RULE *rule;
+  FB_STATUS status;
 
-      current->ival = yylval;
-      strncpy (current->sval, yytext, S_LEN);
-      current->lineno = yylineno;
-      current->token = ret;
+  ctx->wpll = 1;		/* by default the wpll is enabled */
 
-      nextToken = malloc (sizeof (T_TOKEN));
-      if (nextToken == NULL)
+  while (lexToken (scanner, current) != TOK_LEX_EOF)
+    {
+      if (current->token < 0 || current->token >= TOK_COUNT
+	  || parse_rules[current->token].handler == NULL)
 	{
-	  perror ("malloc");
-	  return -1;
+	  fprintf (stderr, "Bad token in configuration file on line %d.\n",
+		   current->lineno);
+	  DBG (printf ("(%s) [%d]\n", current->sval, current->token));
+	  return E_BADTOKEN;
 	}
 
-      // Insert at list's tail
-      if (dlist_ins_next (token_list, dlist_tail (token_list), nextToken) < 0)
+      rule = &parse_rules[current->token];
+      if (!(rule->states & PARSE_IN (p.ctx->state)))
 	{
-	  fprintf (stderr, "Failed to insert token into linked list.\n");
-	  return -1;
+	  fprintf (stderr, "%s is out of place on line %d.\n", rule->name,
+		   current->lineno);
+	  return E_BADSTATE;
 	}
 
-      current = nextToken;
+      status = rule->handler (&p, current);
+      if (status != E_SUCCESS)
+	{
+	  fprintf (stderr, "Invalid %s on line %d.\n", rule->name,
+		   current->lineno);
+	  return status;
+	}
+    }
+  return E_SUCCESS;
+}
+
+/**
+ * treeParser reads a configuration file token by token with
+ * lexToken() and for each token it executes a specific behavior to
+ * that token type. If any behavior fails the entire routine fails,
+ * likely because some part of the configuration is invalid.
+ *
+ * Given a site, [device] and [template] headers start new sections of
+ * it, and everything ahead of the first header is parsed into ctx as
+ * the base of every section, see siteLoad().
+ *
+ * @param ctx the device context
+ * @param site the site being parsed, or NULL for a single device file
+ * @param cf the configuration file
+ * @return success/failure code
+ */
+FB_STATUS
+treeParser (T_CONTEXT * ctx, T_SITE * site, FILE * cf)
+{
+  T_TOKEN token, *current = &token;
+  yyscan_t scanner;
+  FB_STATUS status;
 
+  /* The scanner hands values back through the token */
+  if (yylex_init_extra (current, &scanner) != 0)
+    {
+      perror ("yylex_init_extra");
+      return E_SYSTEM;
     }
-  while (ret != 0);
+  /* Tell flex to look at a file instead of stdin */
+  yyset_in (cf, scanner);
 
-  return 0;
+  status = treeTokens (ctx, site, scanner, current);
+  yylex_destroy (scanner);
+  return status;
 }
 
 
@@ -859,18 +947,33 @@ detokenify_mac (uint8_t * dst, char *mac)
 
 /** @brief Configure a device after populating all configurationdata structures 
  * 
+ * The current link configuration and span priorities are taken from
+ * the snapshot read by statusSnapshot(), before anything is written.
+ * TDMoE transmission is only stopped when one of them has to change,
+ * so applying an unchanged configuration does not interrupt traffic.
+ * The remaining writes (clock select, destination MAC and jitter
+ * attenuator registers) have no readback and are rewritten with their
+ * configured values, which is hitless when they are unchanged.
+ *
+ * Only the sections in ctx->sections are applied: the clock select
+ * and destination MAC belong to SECTION_GLOBALS, the link
+ * configuration and jitter registers of a span to its
+ * SECTION_SPAN(). Whatever is written is copied into the snapshot,
+ * so it keeps matching the device for the next run.
+ *
+ * @param ctx the device context
  * @param f the libfb context for the device
  * @return success/error code
  */
 FB_STATUS
-configureFonebridge (libfb_t * f)
+configureFonebridge (T_CONTEXT * ctx, libfb_t * f)
 {
-  unsigned char prio[4];	/* set master=1 or slave=0 mode */
-  unsigned char oldprio[4];
+  unsigned char prio[IDT_LINKS];	/* set master=1 or slave=0 mode */
+  unsigned char *oldprio = ctx->snapshot->priorities;
   char dest_mac[ETHER_ADDR_LEN];
-  IDT_LINK_CONFIG current[IDT_LINKS];
+  IDT_LINK_CONFIG *current = ctx->snapshot->links;
   IDT_LINK_CONFIG new[IDT_LINKS];
-  int i, status;
+  int i, status, nspans = statusGetSpans (ctx);
   bool need_update = false;
   bool need_prio_update = false;
 
@@ -882,63 +985,46 @@ configureFonebridge (libfb_t * f)
   clkselregnew[2]=0;
   clkselregnew[3]=0;
 */
-  if (vbose > 0)
-    printf ("Detecting current foneBRIDGE link configuration\n");
-
-  status = configcheck_fb_udp (f, current);
-
-  if (status != E_SUCCESS)
+  /* The current state was read by statusSnapshot() */
+  if (ctx->snapshot->result[SNAP_LINKS] != FBLIB_ESUCCESS)
     {
       fprintf (stderr,
 	       "Unable to detect current foneBRIDGE link configuration.\n");
       return E_SYSTEM;
     }
 
-  if (smachine.iec == 0)
-    if (fb_tdmoectl (f, 0) < 0)
-      return E_FBLIB;
-
-  if (smachine.featset == FEATURE_2_0 && !priorities_valid ())
+  if (ctx->featset == FEATURE_2_0 && !priorities_valid (ctx))
     {
       fprintf (stderr,
 	       "Invalid priority settings. Only values 0 to 3 are valid, no duplicates. All zeros may be used if internal timing is desired.\n");
       return E_BADVALUE;
     }
 
-//disable_wpll
-  
-  
+  /* Links the device does not have keep their current settings */
+  memcpy (prio, oldprio, sizeof (prio));
+  memcpy (new, current, sizeof (new));
 
-  if (!smachine.wpll)
-   {
-     
-     printf("WPLL Disabled\n");
-     status = custom_cmd_reply (f, DOOF_CMD_CLKSEL_PIO, 1 , (char*) &clkselregnew, 4, (char*) &clkselregold, 4);
-   }
-  else
-   {
-    printf("WPLL Enabled\n");
-    status = custom_cmd_reply (f, DOOF_CMD_CLKSEL_PIO, 2 , (char*) &clkselregnew, 4, (char*) &clkselregold, 4);		
-   }
-  for (i = 0; i < 4; i++)
+  for (i = 0; i < nspans; i++)
     {
-      T_SPAN *s = get_span (1 + i);
+      T_SPAN *s = (ctx->sections & SECTION_SPAN (1 + i))
+	? get_span (ctx, 1 + i) : NULL;
       if (s)
 	{
-	  if (smachine.featset == FEATURE_PRE_2_0)
+	  if (ctx->featset == FEATURE_PRE_2_0)
 	    {
 	      /* Default is master */
 	      prio[i] = 1;
 	      if (s->slave)
 		prio[i] = 0;
 	    }
-	  else if (smachine.featset == FEATURE_2_0)
+	  else if (ctx->featset == FEATURE_2_0
+		   && (ctx->sections & SECTION_GLOBALS))
 	    {
 	      /* If priorities_valid() succeded above then it is
 	       * permissible to merely copy the priorities from the
 	       * state machine
 	       */
-	      prio[i] = smachine.priorities[i];
+	      prio[i] = ctx->priorities[i];
 	    }
 	  /* If J1 mode was selected, ensure E1Mode is off */
 	  if (s->config.J1Mode)
@@ -959,59 +1045,70 @@ configureFonebridge (libfb_t * f)
 	  memcpy ((void *) &new[i], (void *) &s->config,
 		  sizeof (IDT_LINK_CONFIG));
 	}
-      else
-	{
-	  memcpy ((void *) &new[i], (void *) &current[i],
-		  sizeof (IDT_LINK_CONFIG));
-	}
     }
 
-  if (!need_update)
+  status = ctx->snapshot->result[SNAP_PRIORITIES];
+  if (status != E_SUCCESS)
     {
-      /* 
-       * Actually we are getting the current values of the priorities
-       * here, not setting them. 
-       */
-      status = custom_cmd_reply (f, DOOF_CMD_SET_PRIORITY, 0,
-				 (char *) prio, 4, (char *) oldprio, 4);
-      if (status != E_SUCCESS)
-	{
-	  PRINT_MAPPED_ERROR_IF_FAIL (status);
-	  fprintf (stderr,
-		   "fonulator: Priority Control Error (Couldn't get current priorities)\n");
-	  return E_SYSTEM;
-	}
+      PRINT_MAPPED_ERROR_IF_FAIL (status);
+      fprintf (stderr,
+	       "fonulator: Priority Control Error (Couldn't get current priorities)\n");
+      return E_SYSTEM;
+    }
 
-      for (i = 0; i < 4; i++)
-	{
-	  if (oldprio[i] != prio[i])
-	    need_prio_update = true;
-	  if (vbose >= 2)
-	    printf ("Span %d: Old priority %d, new priority %d\n", i,
-		    oldprio[i], prio[i]);
-	}
+  for (i = 0; i < nspans; i++)
+    {
+      if (oldprio[i] != prio[i])
+	need_prio_update = true;
+      if (vbose >= 2)
+	printf ("Span %d: Old priority %d, new priority %d\n", i,
+		oldprio[i], prio[i]);
     }
 
-  if (!smachine.iec)
+  if (need_update || need_prio_update)
+    {
+      if (stopTDMoE (ctx, f) < 0)
+	return E_FBLIB;
+    }
+  else if (vbose > 0)
+    printf ("Link configuration and priorities unchanged\n");
+
+//disable_wpll
+  
+  
+
+  if ((ctx->sections & SECTION_GLOBALS) && !ctx->wpll)
+   {
+     
+     printf("WPLL Disabled\n");
+     status = fbt_custom_cmd_reply (f, DOOF_CMD_CLKSEL_PIO, 1 , (char*) &clkselregnew, 4, (char*) &clkselregold, 4);
+   }
+  else if (ctx->sections & SECTION_GLOBALS)
+   {
+    printf("WPLL Enabled\n");
+    status = fbt_custom_cmd_reply (f, DOOF_CMD_CLKSEL_PIO, 2 , (char*) &clkselregnew, 4, (char*) &clkselregold, 4);		
+   }
+
+  if (!ctx->iec && (ctx->sections & SECTION_GLOBALS))
     {
       /* IEC does not need these operations */
-      status = detokenify_mac ((unsigned char *) dest_mac, smachine.server);
+      status = detokenify_mac ((unsigned char *) dest_mac, ctx->server);
       if (status != E_SUCCESS)
 	{
 	  fprintf (stderr, "TDMoE Destination MAC Invalid\n");
 	  return E_SYSTEM;
 	}
 
-      if (smachine.port == 0)
+      if (ctx->port == 0)
 	{
 	  if (vbose > 0)
 	    printf ("No port setting found, using default port '1'.\n");
-	  smachine.port = 1;
+	  ctx->port = 1;
 	}
 
       status =
-	custom_cmd (f, DOOF_CMD_TDMOE_DSTMAC, (smachine.port - 1), dest_mac,
-		    6);
+	fbt_custom_cmd (f, DOOF_CMD_TDMOE_DSTMAC, (ctx->port - 1), dest_mac,
+			6);
 
       DBG (printf ("TDMoE Set Destination MAC returned: 0x%02X\n", status));
 
@@ -1027,47 +1124,54 @@ configureFonebridge (libfb_t * f)
       if (vbose > 0)
 	printf ("Updating foneBRIDGE link configuration\n");
 
-      status = config_fb_udp_linkconfig (f, new);
+      status = fbt_config_fb_udp_linkconfig (f, new);
       if (status != E_SUCCESS)
 	{
 	  /* libfb currently prints to the user, ugh! */
 	  return status;
 	}
+      memcpy (current, new, sizeof (new));
     }
 
   if (need_update || need_prio_update)
     {
-      char reply[4];
+      char reply[IDT_LINKS];
 
       status =
-	custom_cmd_reply (f, DOOF_CMD_SET_PRIORITY, 0xf, (char *) prio, 4,
-			  (char *) reply, 4);
+	fbt_custom_cmd_reply (f, DOOF_CMD_SET_PRIORITY, 0xf, (char *) prio,
+			      IDT_LINKS, (char *) reply, IDT_LINKS);
       if (status != E_SUCCESS)
 	{
 	  PRINT_MAPPED_ERROR_IF_FAIL (status);
 	  fprintf (stderr, "fonulator: Priority Control Error\n");
 	}
+      else
+	memcpy (oldprio, prio, sizeof (prio));
     }
 
-  for (i = 0; i < 4; i++)
+  for (i = 0; i < nspans; i++)
     {
-      T_SPAN *s = get_span (1 + i);
+      T_SPAN *s = (ctx->sections & SECTION_SPAN (1 + i))
+	? get_span (ctx, 1 + i) : NULL;
       if (s)
 	{
 	  /* 0x8 represents dejitter ON, 0x0 is dejitter OFF */
 	  uint8_t regvalue = s->dejitter ? 0x8 : 0x0;
-	  if (writeidt (f, i, 0x21, regvalue) != FBLIB_ESUCCESS)
+	  if (fbt_writeidt (f, i, 0x21, regvalue) != FBLIB_ESUCCESS)
 	    fprintf (stderr,
 		     "fonulator: Write to IDT jitter register 0x21 failed!\n");
-	  if (writeidt (f, i, 0x27, regvalue) != FBLIB_ESUCCESS)
+	  if (fbt_writeidt (f, i, 0x27, regvalue) != FBLIB_ESUCCESS)
 	    fprintf (stderr,
 		     "fonulator: Write to IDT jitter register 0x27 failed!\n");
 	}
     }
 
-  if (smachine.iec == 0)
+  /* Started even if this run did not stop it, in case it was off */
+  if (ctx->iec == 0
+      && (ctx->tdmoe_stopped || (ctx->sections & SECTION_GLOBALS)))
     if (fb_tdmoectl (f, 1) < 0)
       return E_FBLIB;
+  ctx->tdmoe_stopped = false;
 
   return E_SUCCESS;
 }
@@ -1078,165 +1182,352 @@ configureFonebridge (libfb_t * f)
  * @param f the libfb context for the device
  * @return 0 on success
  *
- * This function only checks if the state is a valid one. It does not
- * check if the device is a foneBRIDGE or an inline echo
- * canceller. Enabling TDMoE on an IEC is not recommended!
+ * This function only checks if the state is a valid one. It does not
+ * check if the device is a foneBRIDGE or an inline echo
+ * canceller. Enabling TDMoE on an IEC is not recommended!
+ */
+int
+fb_tdmoectl (libfb_t * f, int state)
+{
+  int status;
+  if (state > 1 || state < 0)
+    return -1;
+
+  if (vbose > 0)
+    printf ("%s foneBRIDGE TDMoE transmission\n",
+	    state ? "Starting" : "Stopping");
+
+  status = fbt_custom_cmd (f, DOOF_CMD_TDMOE_TXCTL, state, NULL, 0);
+  DBG (printf ("TDMoE Control returned 0x%02X\n", status));
+  if (status != E_SUCCESS)
+    {
+      fprintf (stderr, "fonulator: TDMoE Control Error %d\n", status);
+      return -1;
+    }
+  return 0;
+}
+
+/** @brief Stop TDMoE transmission ahead of a change that needs it
+ *
+ * Does nothing on an IEC, or if TDMoE was already stopped during this
+ * run. configureFonebridge() starts it again.
+ *
+ * @param ctx the device context
+ * @param f the libfb context for the device
+ * @return 0 on success
+ */
+int
+stopTDMoE (T_CONTEXT * ctx, libfb_t * f)
+{
+  if (ctx->iec || ctx->tdmoe_stopped)
+    return 0;
+
+  if (fb_tdmoectl (f, 0) < 0)
+    return -1;
+
+  ctx->tdmoe_stopped = true;
+  return 0;
+}
+
+
+/**
+ *
+ * Many configuration routines expect a T_SPAN to exist for every span
+ * on the device. This function fills in any missing spans, up to the
+ * number the device reports, with copies of the highest numbered
+ * span.
+ *
+ * @param ctx the device context
+ * @return success/error code
+ */
+FB_STATUS
+completeSpans (T_CONTEXT * ctx)
+{
+  int i, nspans = statusGetSpans (ctx);
+  T_SPAN *tail = NULL;
+
+  for (i = 0; i < ctx->span_slots; i++)
+    if (ctx->spans[i] != NULL)
+      tail = ctx->spans[i];
+
+  if (tail == NULL)
+    return E_BADSTATE;
+
+  for (i = 0; i < nspans; i++)
+    {
+      T_SPAN *new;
+      if (i < ctx->span_slots && ctx->spans[i] != NULL)
+	continue;
+
+      new = span_create (ctx, i + 1);
+      if (new == NULL)
+	return E_SYSTEM;
+
+      /* Copy the tail's settings */
+      memcpy (new, tail, sizeof (T_SPAN));
+      new->num = i + 1;
+    }
+  return E_SUCCESS;
+}
+
+
+/** @brief Read a configuration file into a context
+ *
+ * The configuration file is handed to treeParser, which reads the
+ * tokens of the file and executes the desired behavior for each as it
+ * is read. Every parse has a scanner of its own, so any number of
+ * threads may load configurations at once.
+ *
+ * With cache_enabled, a cache compiled from identical file contents
+ * is used instead of parsing, and a successful parse rewrites the
+ * cache.
+ *
+ * @param ctx a context fresh from contextCreate()
+ * @param path the configuration file
+ * @return success/error code
+ */
+FB_STATUS
+loadConfig (T_CONTEXT * ctx, const char *path)
+{
+  FILE *cf;
+  int status;
+  uint64_t hash;
+  bool cache = cache_enabled;
+
+  cf = fopen (path, "r");
+  if (cf == NULL)
+    {
+      fprintf (stderr, "Error opening configuration file %s.\n", path);
+      perror ("fopen");
+      return E_SYSTEM;
+    }
+
+  if (cache && fnv1a64_file (cf, &hash) != E_SUCCESS)
+    cache = false;
+
+  if (cache)
+    {
+      status = cacheLoadConfig (ctx, path, hash);
+      if (status != E_BADINPUT)
+	{
+	  fclose (cf);
+	  return status;
+	}
+    }
+
+  status = treeParser (ctx, NULL, cf);
+  fclose (cf);
+
+  if (status != E_SUCCESS)
+    {
+      fberror ("treeParser", status);
+      return status;
+    }
+
+  if (ctx->fonebridge == NULL)
+    {
+      fprintf (stderr,
+	       "Configuration file incomplete! No foneBRIDGE IP address.\n");
+      return E_BADVALUE;
+    }
+
+  /* Failing to write the cache only costs the next run a parse */
+  if (cache)
+    cacheSaveConfig (ctx, path, hash);
+
+  return E_SUCCESS;
+}
+
+/** @brief Connect to the device of a context and read its status
+ *
+ * @param ctx a context filled in by loadConfig()
+ * @return the libfb context for the device, or NULL on failure
  */
-int
-fb_tdmoectl (libfb_t * f, int state)
+libfb_t *
+connectDevice (T_CONTEXT * ctx)
 {
-  int status;
-  if (state > 1 || state < 0)
-    return -1;
+  libfb_t *fb;
+  char errstr[LIBFB_ERRBUF_SIZE];
+  FB_STATUS status;
+
+  fb = libfb_init (NULL, LIBFB_ETHERNET_OFF, errstr);
+  if (fb == NULL)
+    {
+      fprintf (stderr, "libfb: %s\n", errstr);
+      return NULL;
+    }
+  switch (libfb_connect (fb, ctx->fonebridge, UDP_CONFIG_PORT))
+    {
+    case FBLIB_EERRNO:
+      perror ("libfb");
+      libfb_destroy (fb);
+      return NULL;
+    case FBLIB_EHERRNO:
+      herror ("libfb");
+      libfb_destroy (fb);
+      return NULL;
+    default:
+      /* get on with it! */
+      break;
+    }
+
+  /*********** Socket initialization complete ***********/
+  ctx->state = STATE_RUN;
 
   if (vbose > 0)
-    printf ("%s foneBRIDGE TDMoE transmission\n",
-	    state ? "Starting" : "Stopping");
+    printf ("Detecting foneBRIDGE\n");
 
-  status = custom_cmd (f, DOOF_CMD_TDMOE_TXCTL, state, NULL, 0);
-  DBG (printf ("TDMoE Control returned 0x%02X\n", status));
+  status = statusInitalize (ctx, fb);
   if (status != E_SUCCESS)
     {
-      fprintf (stderr, "fonulator: TDMoE Control Error %d\n", status);
-      return -1;
+      fberror ("statusInitalize", status);
+      libfb_destroy (fb);
+      return NULL;
     }
-  return 0;
-}
 
+  return fb;
+}
 
-/**
+/** @brief Reconcile a parsed configuration with the device
  *
- * Many configuration routines expect four T_SPAN's to exist (for span
- * numbers 1 to 4). This function fills in any missing spans with
- * copies of the tail span.
+ * Detects the feature set of the device, fills in any spans the
+ * configuration left out and configures the DSP if one is
+ * available. configureFonebridge() completes the job.
  *
+ * @param ctx a context connected by connectDevice()
+ * @param fb the libfb context for the device
  * @return success/error code
  */
 FB_STATUS
-completeSpans (void)
+prepareConfig (T_CONTEXT * ctx, libfb_t * fb)
 {
-  DListElmt *element = dlist_head (span_list);
-  T_SPAN *current;
-  bool missing[] = { true, true, true, true };
-  int i;
+  int nspans;
+  bool dsp_available;
+  FB_STATUS status;
 
-  if (element == NULL)
-    return E_BADSTATE;
+  ctx->featset = libfb_feature_set (status_get_dsi (ctx));
 
-  do
+  if (ctx->featset < FEATURE_PRE_2_0 || ctx->featset >= FEATURE_MAX)
     {
-      current = dlist_data (element);
-      if (current != NULL)
-	{
-	  missing[current->num - 1] = false;
-	  element = dlist_next (element);
-	}
+      fprintf (stderr,
+	       "Warning! Failed to detect feature set from hardware build number!\n");
+      return E_BADVALUE;
     }
-  while (element != NULL);
+  else if (vbose >= 2)
+    {
+      printf ("Found feature set index %d.\n", ctx->featset);
+    }
+
+  ctx->iec = statusIsIEC (ctx);
 
-  for (i = 0; i < 4; i++)
+  if (!ctx->iec && ctx->server == NULL)
     {
-      T_SPAN *new;
-      if (missing[i])
-	{
-	  new = malloc (sizeof (T_SPAN));
+      fprintf (stderr,
+	       "Configuration file incomplete! Missing destination MAC address!\n");
+      return E_BADVALUE;
+    }
 
-	  if (new == NULL)
-	    {
-	      perror ("malloc");
-	      return E_SYSTEM;
-	    }
+  nspans = statusGetSpans (ctx);
+  if (nspans > IDT_LINKS)
+    {
+      fprintf (stderr,
+	       "The device has %d spans, but only %d can be configured.\n",
+	       nspans, IDT_LINKS);
+      return E_BADVALUE;
+    }
 
-	  /* Copy the tail's settings */
-	  element = dlist_tail (span_list);
-	  current = dlist_data (element);
-	  memcpy (new, current, sizeof (T_SPAN));
-	  new->num = i + 1;
-	  dlist_ins_next (span_list, element, current);
-	}
+  if (nspans < ctx->total_spans)
+    {
+      completeSpans (ctx);
+    }
+  else if (nspans > ctx->total_spans)
+    {
+      statusDisplay (ctx);
+      printf ("However, the configuration requests %u spans.\n",
+	      ctx->total_spans);
+    }
+  else if (vbose > 0)
+    {
+      statusDisplay (ctx);
     }
-  return E_SUCCESS;
-}
 
+  dsp_available = statusHasDSP (ctx);
 
-/** @brief Recursively free a linked list of spans
- *
- * @param span pointed to a list of spans to be free'd
- */
-void
-cleanupSpan (T_SPAN * span)
-{
-  free (span);
-  span = NULL;
-}
+  printf ("DSP Status: %s\n",
+	  (!ctx->dspdisabled && dsp_available) ? "Available" : "Bypassed");
 
+  if (dsp_available && (ctx->sections & SECTION_DSP))
+    {
+      status = configureDSP (ctx, fb);
 
+      if (status != E_SUCCESS && status != E_REBOOTDSP)
+	fberror ("configureDSP", status);
 
-/** @brief free memory used by the state machine */
-void
-cleanupStateMachine (void)
-{
-  if (smachine.fonebridge)
-    free (smachine.fonebridge);
-  if (smachine.server)
-    free (smachine.server);
+      if (status != E_SUCCESS)
+	return status;
+    }
+
+  return E_SUCCESS;
 }
 
-/** clean up all data structures, freeing used memory */
-void
-cleanupAll (void)
+/** @brief Save or clear the configuration stored on the device
+ *
+ * @param fb the libfb context for the device
+ * @param clear clear the stored configuration rather than save it
+ * @return the status returned by the device
+ */
+int
+storeConfig (libfb_t * fb, bool clear)
 {
-  dlist_destroy (token_list);
-  free (token_list);
-  token_list = NULL;
-
-  dlist_destroy (span_list);
-  free (span_list);
-  span_list = NULL;
+  int status;
 
-  cleanupStateMachine ();
-  statusCleanup ();
+  printf ("%s foneBRIDGE configuration...", clear ? "Clearing" : "Saving");
+  status = fbt_custom_cmd (fb, clear ? DOOF_CMD_PCONFIG_CLEAR :
+			   DOOF_CMD_PCONFIG_STORE, 0, NULL, 0);
+  printf ("Done!\n");
+  return status;
 }
 
 
+/* bench-parser links the rest of this file under its own main() */
+#ifndef FONULATOR_NO_MAIN
 /**
  * Our entry point. The argtable library is consulted to decode the
  * user's selected options.
  *
- * yyin is set to the configuration file and lexParser is called. This
- * reads all the tokens from the configuration file. treeParser is
- * called to execute the desired behavior for each function. Depending
- * on the configuration options and the user's command line options
- * particular behaviors occur (reboot, query, etc) and/or the device
- * is configured by configureFonebridge.
+ * The configuration file is read into a fresh T_CONTEXT by
+ * loadConfig(). Depending on the configuration options and the
+ * user's command line options particular behaviors occur (reboot,
+ * query, etc) and/or the device is configured by prepareConfig() and
+ * configureFonebridge().
  */
 int
 main (int argc, char *argv[])
 {
-  int remotePort, nspans, status = 0;
-  char *remoteHost = NULL;
+  int status = 0;
 
   libfb_t *fb;
-  char errstr[LIBFB_ERRBUF_SIZE];
+  T_CONTEXT *ctx;
 
   bool exit_after_free = false;
   int  do_reboot = 0;
   bool change_ip = false;
   bool do_query = false;
   bool do_stats = false;
+  int sample_interval = 0;
   bool do_flash_upload = false;
   bool save_config = false;
   bool clear_config = false;
   bool flash_is_gpak = false;
   bool load_keys = false;
-  bool dsp_available;
+  bool do_plan = false;
+  const char *base;
+  T_FLASH_OPTS flash_opts = { 1, false, NULL };
 
-  FILE *cf;
   char *flash_filename = NULL;
   
   char *new_ip = NULL;
 
-  int i;
   int ip_sel=0;
 
   EPCS_CONFIG epcs;
@@ -1255,6 +1546,12 @@ main (int argc, char *argv[])
     arg_file0 (NULL, "upload", "<file>", "upload new firmware image");
   struct arg_lit *gpak = arg_lit0 ("g", "gpak",
 				   "specify that the uploaded firmware is a GPAK binary");
+  struct arg_int *window = arg_int0 (NULL, "window", "<n>",
+				     "flash requests kept in flight during upload (default: 1)");
+  struct arg_lit *delta = arg_lit0 (NULL, "delta",
+				    "only rewrite flash blocks that differ from the image");
+  struct arg_file *journal = arg_file0 (NULL, "journal", "<file>",
+					"record upload progress to resume an interrupted upload");
   struct arg_lit *saveconfig =
     arg_lit0 (NULL, "write-config", "write configuration to the foneBRIDGE");
   struct arg_lit *loadkeys =
@@ -1264,6 +1561,8 @@ main (int argc, char *argv[])
     arg_lit0 ("q", "query", "query foneBRIDGE to check availability");
   struct arg_lit *stats =
     arg_lit0 ("s", "stats", "query foneBRIDGE link statistics");
+  struct arg_int *sample = arg_int0 (NULL, "sample", "<secs>",
+				     "print link statistic changes every <secs> seconds until interrupted");
   struct arg_lit *version =
     arg_litn ("V", "version", 0, 2, "get version information");
   struct arg_file *file = arg_file0 (NULL, NULL, "FILE",
@@ -1271,11 +1570,35 @@ main (int argc, char *argv[])
   struct arg_str *ip = arg_str0 (NULL, "set-ip", "x.x.x.x", "set new ip");
   
   struct arg_lit *fb2 = arg_lit0 (NULL, "fb2", "specify that ip to be changed is fb2");
+  struct arg_file *fleet = arg_file0 (NULL, "fleet", "<list>",
+				      "configure every device whose config file is named in <list>");
+  struct arg_int *jobs = arg_int0 ("j", "jobs", "<n>",
+				   "devices configured at once in fleet mode (default: 8)");
+  struct arg_lit *timing = arg_lit0 (NULL, "timing",
+				     "print libfb call counts and latencies at exit");
+  struct arg_lit *plan = arg_lit0 (NULL, "plan",
+				   "print the libfb calls configuring would make, without making them");
+  struct arg_file *snapshot = arg_file0 (NULL, "snapshot", "<file>",
+					 "plan against a saved device snapshot instead of the device");
+  struct arg_file *savesnapshot = arg_file0 (NULL, "save-snapshot", "<file>",
+					     "save the state read from the device to <file>");
+  struct arg_str *discover = arg_str0 (NULL, "discover", "a.b.c.d/n",
+				      "find the devices in an address range");
+  struct arg_file *daemon = arg_file0 (NULL, "daemon", "<socket>",
+				       "stay resident, serving requests on the Unix socket <socket>");
+  struct arg_lit *cache = arg_lit0 (NULL, "cache",
+				    "reuse configurations compiled to <config>" CACHE_SUFFIX);
+  struct arg_str *device = arg_strn (NULL, "device", "<name|ip>", 0, 256,
+				     "select devices of a site config file by name or address");
+  struct arg_lit *watch = arg_lit0 (NULL, "watch",
+				    "apply the configuration again whenever the file changes");
 
   struct arg_end *end = arg_end (5);
   void *argtable[] =
-    { help, verbose, query, stats, version, saveconfig, clearconfig, flashfw,
-    gpak, /* loadkeys, */ reboot, file, ip, fb2, end
+    { help, verbose, query, stats, sample, version, saveconfig, clearconfig,
+    flashfw, gpak, window, delta, journal, /* loadkeys, */ reboot, file, ip,
+    fb2, fleet, jobs, timing, plan, snapshot, savesnapshot, daemon, discover,
+    cache, device, watch, end
   };
 
   if (arg_nullcheck (argtable) != 0)
@@ -1286,11 +1609,26 @@ main (int argc, char *argv[])
   /* Set defaults */
   saveconfig->count = clearconfig->count = loadkeys->count = reboot->count =
     verbose->count = query->count = stats->count = file->count = help->count =
-    flashfw->count = gpak->count = version->count = ip->count = fb2->count = 0;
+    flashfw->count = gpak->count = version->count = ip->count = fb2->count =
+    delta->count = journal->count = fleet->count = sample->count =
+    timing->count = plan->count = snapshot->count = savesnapshot->count =
+    daemon->count = discover->count = cache->count = device->count =
+    watch->count = 0;
   file->filename[0] = DEFAULT_CONFIG;
+  jobs->ival[0] = DEFAULT_FLEET_JOBS;
+  window->ival[0] = 1;
   /* End defaults */
   status = arg_parse (argc, argv, argtable);
 
+  /* Run as fonulatord: the daemon on its default socket */
+  base = strrchr (argv[0], '/');
+  if (status == 0 && daemon->count == 0
+      && strcmp (base ? base + 1 : argv[0], "fonulatord") == 0)
+    {
+      daemon->filename[0] = DEFAULT_DAEMON_SOCKET;
+      daemon->count = 1;
+    }
+
   if (status != 0 || help->count == 1)
     {
       if (status != 0)
@@ -1318,6 +1656,13 @@ main (int argc, char *argv[])
 	}
       exit_after_free = true;
     }
+  else if (discover->count > 0)
+    {
+      if (verbose->count > 0)
+	vbose = verbose->count;
+      status = runDiscover (discover->sval[0]);
+      exit_after_free = true;
+    }
   else if (reboot->count > 0)
     do_reboot = reboot->count;
   else if (ip->count > 0)
@@ -1338,6 +1683,8 @@ main (int argc, char *argv[])
     do_query = true;
   else if (stats->count > 0)
     do_stats = true;
+  else if (sample->count > 0)
+    sample_interval = (sample->ival[0] > 0) ? sample->ival[0] : 1;
   else if (saveconfig->count && clearconfig->count)
     {
       fprintf (stderr, "Invalid command line options. "
@@ -1366,6 +1713,10 @@ main (int argc, char *argv[])
 	  strncpy (flash_filename, flashfw->filename[0],
 		   strlen (flashfw->filename[0]) + 1);
 	  do_flash_upload = true;
+	  flash_opts.window = window->ival[0];
+	  flash_opts.delta = (delta->count > 0);
+	  if (journal->count > 0)
+	    flash_opts.journal = strdup (journal->filename[0]);
 	}
     }
   else if (gpak->count > 0)
@@ -1377,9 +1728,66 @@ main (int argc, char *argv[])
     }
 
 
+  if ((fleet->count > 0 || device->count > 1) && !exit_after_free
+      && ((fleet->count && device->count) || do_reboot || change_ip
+	  || do_flash_upload || do_query || do_stats || sample_interval
+	  || snapshot->count || savesnapshot->count))
+    {
+      fprintf (stderr, "Invalid command line options. Fleet mode cannot "
+	       "reboot, query, change IP, upload firmware or use snapshot "
+	       "files, and takes either a fleet list or devices of a site "
+	       "file.\n");
+      status = EXIT_FAILURE;
+      exit_after_free = true;
+    }
+
+  if (daemon->count > 0 && !exit_after_free
+      && (fleet->count || device->count || do_reboot || change_ip
+	  || do_flash_upload
+	  || do_query || do_stats || sample_interval || save_config
+	  || clear_config || plan->count || snapshot->count
+	  || savesnapshot->count))
+    {
+      fprintf (stderr, "Invalid command line options. "
+	       "Daemon mode takes its requests from the socket.\n");
+      status = EXIT_FAILURE;
+      exit_after_free = true;
+    }
+
+  if (watch->count > 0 && !exit_after_free
+      && (fleet->count || device->count > 1 || daemon->count || do_reboot
+	  || change_ip || do_flash_upload || do_query || do_stats
+	  || sample_interval || clear_config || plan->count || snapshot->count
+	  || savesnapshot->count))
+    {
+      fprintf (stderr, "Invalid command line options. "
+	       "Watch mode configures a single device.\n");
+      status = EXIT_FAILURE;
+      exit_after_free = true;
+    }
+
+  do_plan = (plan->count > 0);
+  if (!exit_after_free
+      && ((do_plan && (do_reboot || change_ip || do_flash_upload
+		       || do_query || do_stats || sample_interval))
+	  || (snapshot->count > 0 && (!do_plan || savesnapshot->count > 0))))
+    {
+      fprintf (stderr, "Invalid command line options. "
+	       "A plan only covers configuring the device, and a saved "
+	       "snapshot can only be planned against.\n");
+      status = EXIT_FAILURE;
+      exit_after_free = true;
+    }
+
   if (verbose->count > 0)
     vbose = verbose->count;
 
+  if (timing->count > 0 && !exit_after_free)
+    timing_enable ();
+
+  if (cache->count > 0)
+    cache_enabled = true;
+
 #if 0
   if (loadkeys->count > 0)
     load_keys = true;
@@ -1391,125 +1799,125 @@ main (int argc, char *argv[])
       exit (status);
     }
 
-  cf = fopen (file->filename[0], "r");
-
-  arg_freetable (argtable, sizeof (argtable) / sizeof (argtable[0]));
-
-  if (cf == NULL)
+  if (daemon->count > 0)
     {
-      fprintf (stderr, "Error opening configuration file.\n");
-      perror ("fopen");
-      exit (1);
+      status = runDaemon (daemon->filename[0]);
+      arg_freetable (argtable, sizeof (argtable) / sizeof (argtable[0]));
+      exit (status);
     }
 
-  /* Set up state machine data structure */
-  memset (&smachine, 0, sizeof (smachine));
-  for (i = 0; i < 4; i++)
-    smachine.priorities[i] = -1;
-
-  /* Set up linked list data structures */
-  token_list = malloc (sizeof (DList));
-  if (token_list == NULL)
+  if (fleet->count > 0)
     {
-      perror ("maloc");
-      return -1;
+      status = runFleet (fleet->filename[0], jobs->ival[0], save_config,
+			 clear_config, do_plan);
+      arg_freetable (argtable, sizeof (argtable) / sizeof (argtable[0]));
+      exit (status);
     }
 
-  span_list = malloc (sizeof (DList));
-  if (span_list == NULL)
+  if (watch->count > 0)
     {
-      perror ("maloc");
-      return -1;
+      status = runWatch (file->filename[0],
+			 device->count ? device->sval[0] : NULL, save_config);
+      arg_freetable (argtable, sizeof (argtable) / sizeof (argtable[0]));
+      exit (status);
     }
 
+  if (device->count > 1)
+    {
+      status = runSite (file->filename[0], device->sval, device->count,
+			jobs->ival[0], save_config, clear_config, do_plan);
+      arg_freetable (argtable, sizeof (argtable) / sizeof (argtable[0]));
+      exit (status);
+    }
 
-  dlist_init (token_list, (void (*)(void *)) (cleanupToken));
-  dlist_init (span_list, (void (*)(void *)) (cleanupSpan));
-
-  /* Tell flex to look at a file instead of stdin */
-  yyin = cf;
-  status = lexParser ();
-  if (status == E_SUCCESS)
+  if (device->count > 0)
     {
-      status = treeParser ();
-      if (status != E_SUCCESS)
+      ctx = siteLoadDevice (file->filename[0], device->sval[0]);
+      if (ctx == NULL)
 	{
-	  fberror ("treeParser", status);
-	  yylex_destroy ();
-	  fclose (cf);
-	  exit (status);
+	  arg_freetable (argtable, sizeof (argtable) / sizeof (argtable[0]));
+	  exit (EXIT_FAILURE);
 	}
+      status = E_SUCCESS;
     }
   else
     {
-      printf ("Error parsing configuration file.\n");
-      fberror ("lexParser", status);
-      yylex_destroy ();
-      fclose (cf);
-      exit (1);
+      ctx = contextCreate ();
+      if (ctx == NULL)
+	exit (EXIT_FAILURE);
+      status = loadConfig (ctx, file->filename[0]);
     }
+  ctx->interactive = true;
 
-  yylex_destroy ();
-  fclose (cf);
+  if (status == E_SUCCESS && snapshot->count > 0)
+    {
+      /* Offline plan: the device is never contacted */
+      status = statusLoadSnapshot (ctx, snapshot->filename[0]);
+      if (status == E_SUCCESS)
+	status = planConfig (ctx, save_config, clear_config);
+      arg_freetable (argtable, sizeof (argtable) / sizeof (argtable[0]));
+      contextDestroy (ctx);
+      exit ((status == E_SUCCESS) ? EXIT_SUCCESS : EXIT_FAILURE);
+    }
 
-  if ((remoteHost = smachine.fonebridge) == NULL)
+  if (status != E_SUCCESS)
     {
-      fprintf (stderr,
-	       "Configuration file incomplete! No foneBRIDGE IP address.\n");
-      exit (EXIT_FAILURE);
+      arg_freetable (argtable, sizeof (argtable) / sizeof (argtable[0]));
+      contextDestroy (ctx);
+      exit (status);
     }
-  remotePort = UDP_CONFIG_PORT;
-  fb = libfb_init (NULL, LIBFB_ETHERNET_OFF, errstr);
+
+  fb = connectDevice (ctx);
   if (fb == NULL)
     {
-      fprintf (stderr, "libfb: %s\n", errstr);
+      arg_freetable (argtable, sizeof (argtable) / sizeof (argtable[0]));
+      contextDestroy (ctx);
       exit (EXIT_FAILURE);
     }
-  switch (libfb_connect (fb, remoteHost, remotePort))
+
+  if (savesnapshot->count > 0)
     {
-    case FBLIB_EERRNO:
-      perror ("libfb");
-      libfb_destroy (fb);
-      exit (EXIT_FAILURE);
-      break;
-    case FBLIB_EHERRNO:
-      herror ("libfb");
-      libfb_destroy (fb);
-      exit (EXIT_FAILURE);
-      break;
-    default:
-      /* get on with it! */
-      break;
+      status = statusSaveSnapshot (ctx, savesnapshot->filename[0]);
+      if (status != E_SUCCESS || !do_plan)
+	{
+	  arg_freetable (argtable, sizeof (argtable) / sizeof (argtable[0]));
+	  libfb_destroy (fb);
+	  contextDestroy (ctx);
+	  exit ((status == E_SUCCESS) ? EXIT_SUCCESS : EXIT_FAILURE);
+	}
     }
 
-  /*********** Socket initialization complete ***********/
-  state = STATE_RUN;
-
-  if (vbose > 0)
-    printf ("Detecting foneBRIDGE\n");
+  arg_freetable (argtable, sizeof (argtable) / sizeof (argtable[0]));
 
-  status = statusInitalize (fb);
-  if (status != E_SUCCESS)
+  if (do_plan)
     {
-      fberror ("statusInitalize", status);
+      status = planConfig (ctx, save_config, clear_config);
       libfb_destroy (fb);
-      cleanupAll ();
-      exit (EXIT_FAILURE);
+      contextDestroy (ctx);
+      exit ((status == E_SUCCESS) ? EXIT_SUCCESS : EXIT_FAILURE);
     }
 
   if (do_query)
     {
-      bool success = queryFonebridge (fb);
+      bool success = queryFonebridge (ctx, fb);
       libfb_destroy (fb);
-      cleanupAll ();
+      contextDestroy (ctx);
       exit ((success) ? EXIT_SUCCESS : EXIT_FAILURE);
     }
 
   if (do_stats)
     {
-      bool success = statusRunPMON (fb);
+      bool success = statusRunPMON (ctx, fb);
+      libfb_destroy (fb);
+      contextDestroy (ctx);
+      exit ((success) ? EXIT_SUCCESS : EXIT_FAILURE);
+    }
+
+  if (sample_interval)
+    {
+      bool success = statusSamplePMON (ctx, fb, sample_interval);
       libfb_destroy (fb);
-      cleanupAll ();
+      contextDestroy (ctx);
       exit ((success) ? EXIT_SUCCESS : EXIT_FAILURE);
     }
 
@@ -1527,16 +1935,16 @@ main (int argc, char *argv[])
         }
 
       libfb_destroy (fb);
-      cleanupAll ();
+      contextDestroy (ctx);
       exit ((success) ? EXIT_SUCCESS : EXIT_FAILURE);
     }
   
   if (change_ip > 0)
     {
       bool success;
-      udp_get_static_info (fb, &dsi);      
+      fbt_udp_get_static_info (fb, &dsi);      
       epcs_info.epcs_blocks = dsi.epcs_blocks;
-      if ((udp_read_blk (fb,(epcs_info.epcs_blocks - 2) * 65536,sizeof (EPCS_CONFIG), 
+      if ((fbt_udp_read_blk (fb,(epcs_info.epcs_blocks - 2) * 65536,sizeof (EPCS_CONFIG), 
                      (uint8_t *) &epcs) < 0 ))
 	{
 	  fprintf (stderr, "Error reading configuration block!\n");
@@ -1549,12 +1957,12 @@ main (int argc, char *argv[])
       epcs.ip_address[ip_sel] = grab32(iptmp);
       epcs.crc16 =
         crc_16 ((uint8_t *) & epcs, sizeof (EPCS_CONFIG) - 2);
-      if (udp_write_to_blk (fb, 0, sizeof (EPCS_CONFIG), (uint8_t *) &epcs) < 0)
+      if (fbt_udp_write_to_blk (fb, 0, sizeof (EPCS_CONFIG), (uint8_t *) &epcs) < 0)
         {
           printf ("Error writing config data to flash\n");
           exit (EXIT_FAILURE);
         }
-      if (udp_start_blk_write (fb, epcs_info.epcs_blocks - 2))
+      if (fbt_udp_start_blk_write (fb, epcs_info.epcs_blocks - 2))
         {
           printf ("Error executing write blk command\n");
           exit (EXIT_FAILURE);
@@ -1562,7 +1970,7 @@ main (int argc, char *argv[])
       printf ("Reboot required\n");
       success = interactiveReboot (fb);          
       libfb_destroy (fb);
-      cleanupAll ();
+      contextDestroy (ctx);
       exit ((success) ? EXIT_SUCCESS : EXIT_FAILURE);
     }
           
@@ -1579,14 +1987,15 @@ main (int argc, char *argv[])
 	   *
 	   * <feature_id (4)><parm_len(4)><cust_key (32)><parameters (...)>
 	   */
-	  if (valid_keys[z])
+	  if (ctx->valid_keys[z])
 	    {
 	      FB_STATUS retval;
 
 	      printf ("Attempting programming of slot %i...", z);
 	      fflush (NULL);
 
-	      if ((retval = program_key (fb, z, &all_keys[z])) != E_SUCCESS)
+	      if ((retval =
+		   program_key (fb, z, &ctx->all_keys[z])) != E_SUCCESS)
 		success = false;
 
 	      printf ("%s\n", (retval == E_SUCCESS) ? "done." : "failed!");
@@ -1598,7 +2007,7 @@ main (int argc, char *argv[])
       else
 	fprintf (stderr, "License/Key programming failed!\n");
 
-      cleanupAll ();
+      contextDestroy (ctx);
       exit ((success) ? EXIT_SUCCESS : EXIT_FAILURE);
     }
 
@@ -1614,26 +2023,26 @@ main (int argc, char *argv[])
 	  fprintf (stderr, "Error opening %s file (%s).\n",
 		   flash_is_gpak ? "GPAK" : "firmware", flash_filename);
 	  perror ("fopen");
-	  cleanupAll ();
+	  contextDestroy (ctx);
 	  exit (EXIT_FAILURE);
 	}
 
-      if (!smachine.iec && fb_tdmoectl (fb, 0) != 0)
+      if (!ctx->iec && fb_tdmoectl (fb, 0) != 0)
 	{
 	  fprintf (stderr,
 		   "Error disabling TDMoE transmission. Flash operation cancelled.\n");
 	  fclose (bin);
-	  cleanupAll ();
+	  contextDestroy (ctx);
 	  exit (EXIT_FAILURE);
 	}
 
       /* GPAK is located at block 10, firmware is located at block 0. */
-      if ((write_file_to_flash (fb, bin, flash_is_gpak ? 10 : 0)) !=
-	  E_SUCCESS)
+      if ((write_file_to_flash (ctx, fb, bin, flash_is_gpak ? 10 : 0,
+				&flash_opts)) != E_SUCCESS)
 	{
 	  fprintf (stderr, "Flash write operation failed.\n");
 	  fclose (bin);
-	  cleanupAll ();
+	  contextDestroy (ctx);
 	  exit (EXIT_FAILURE);
 	}
 
@@ -1647,87 +2056,30 @@ main (int argc, char *argv[])
 	      fprintf (stderr,
 		       "Unable to get length information about GPAK binary!\n");
 	      fclose (bin);
-	      cleanupAll ();
+	      contextDestroy (ctx);
 	      exit (EXIT_FAILURE);
 	    }
 
-	  flash_set_gpaklen (fb, filestat.st_size);
+	  flash_set_gpaklen (ctx, fb, filestat.st_size);
 	}
       printf ("Flash verification successful. Reboot required.\n");
 
       bool success = interactiveReboot (fb);
 
-      cleanupAll ();
+      contextDestroy (ctx);
       exit ((success) ? EXIT_SUCCESS : EXIT_FAILURE);
     }
 
 
-  smachine.featset = libfb_feature_set (status_get_dsi ());
-
-  if (smachine.featset < FEATURE_PRE_2_0 || smachine.featset >= FEATURE_MAX)
-    {
-      fprintf (stderr,
-	       "Warning! Failed to detect feature set from hardware build number!\n");
-      cleanupAll ();
-      exit (EXIT_FAILURE);
-    }
-  else if (vbose >= 2)
-    {
-      printf ("Found feature set index %d.\n", smachine.featset);
-    }
-
-  smachine.iec = statusIsIEC ();
-
-  if (!smachine.iec && smachine.server == NULL)
+  status = prepareConfig (ctx, fb);
+  if (status != E_SUCCESS)
     {
-      fprintf (stderr,
-	       "Configuration file incomplete! Missing destination MAC address!\n");
       libfb_destroy (fb);
-      cleanupAll ();
-      exit (EXIT_FAILURE);
-    }
-
-  nspans = statusGetSpans ();
-  if (nspans < smachine.total_spans)
-    {
-      completeSpans ();
-    }
-  else if (nspans > smachine.total_spans)
-    {
-      statusDisplay ();
-      printf ("However, the configuration requests %u spans.\n",
-	      smachine.total_spans);
-    }
-  else if (vbose > 0)
-    {
-      statusDisplay ();
+      contextDestroy (ctx);
+      exit (status);
     }
 
-  dsp_available = statusHasDSP ();
-
-  printf ("DSP Status: %s\n",
-	  (!smachine.dspdisabled
-	   && dsp_available) ? "Available" : "Bypassed");
-
-  if (dsp_available)
-    {
-      if (smachine.iec == 0)
-	fb_tdmoectl (fb, 0);
-
-      //Disable TDMoE generation before DSP config
-      status = configureDSP (fb, span_list);
-
-      if (status != E_SUCCESS && status != E_REBOOTDSP)
-	fberror ("configureDSP", status);
-
-      if (status != E_SUCCESS)
-	{
-	  libfb_destroy (fb);
-	  cleanupAll ();
-	  exit (status);
-	}
-    }
-  status = configureFonebridge (fb);
+  status = configureFonebridge (ctx, fb);
   if (status != E_SUCCESS)
     {
       fberror ("configureFonebridge", status);
@@ -1738,28 +2090,15 @@ main (int argc, char *argv[])
       printf ("foneBRIDGE reconfigured!\n");
       status = EXIT_SUCCESS;
     }
-  // Remove these for commit
-#define DOOF_CMD_PCONFIG_STORE 39	/* Execute a store p_config command */
-#define DOOF_CMD_PCONFIG_CLEAR 40	/* Execute a clear on the p_config
-					   structure */
-  if (clear_config)
-    {
-      printf ("Clearing foneBRIDGE configuration...");
-      status = custom_cmd (fb, DOOF_CMD_PCONFIG_CLEAR, 0, NULL, 0);
-      printf ("Done!\n");
-    }
-  else if (save_config)
-    {
-      printf ("Saving foneBRIDGE configuration...");
-      status = custom_cmd (fb, DOOF_CMD_PCONFIG_STORE, 0, NULL, 0);
-      printf ("Done!\n");
-    }
+  if (clear_config || save_config)
+    status = storeConfig (fb, clear_config);
 
   libfb_destroy (fb);
-  cleanupAll ();
+  contextDestroy (ctx);
 
   exit (status);
 }
+#endif
 
 
 /** @brief Ask the user to confirm a reboot of the foneBRIDGE.
@@ -1783,7 +2122,7 @@ interactiveReboot (libfb_t * f)
     {
       printf ("Resetting foneBRIDGE in 10 seconds...\n");
       sleep (10);
-      custom_cmd (f, DOOF_CMD_RESET, 0, NULL, 0);
+      fbt_custom_cmd (f, DOOF_CMD_RESET, 0, NULL, 0);
       return true;
     }
   else
@@ -1798,34 +2137,35 @@ simpleReboot (libfb_t * f)
 {
       printf ("Resetting foneBRIDGE in 10 seconds...\n");
       sleep (10);
-      custom_cmd (f, DOOF_CMD_RESET, 0, NULL, 0);
+      fbt_custom_cmd (f, DOOF_CMD_RESET, 0, NULL, 0);
       return true;	
 }
 
 /** @brief Determine if the priority settings are permitted
  *
+ * @param ctx the device context
  * @return true if valid
  */
 static bool
-priorities_valid ()
+priorities_valid (T_CONTEXT * ctx)
 {
-  int i;
+  int i, nspans = statusGetSpans (ctx);
 
-  bool prio[4];
-  bool zero[4];
+  bool prio[IDT_LINKS];
+  bool zero[IDT_LINKS];
   unsigned int zerocheck = 0;
 
   memset (prio, false, sizeof (prio));
   memset (zero, false, sizeof (zero));
 
-  for (i = 0; i < 4; i++)
+  for (i = 0; i < nspans; i++)
     {
       /* The priority of the inspected span */
-      int cur_prio = smachine.priorities[i];
+      int cur_prio = ctx->priorities[i];
       if (cur_prio == -1)
-	smachine.priorities[i] = i;
+	ctx->priorities[i] = i;
 
-      if (cur_prio >= 0 && cur_prio < 4)
+      if (cur_prio >= 0 && cur_prio < nspans)
 	{
 	  /* We are a valid priority number. */
 	  if (prio[cur_prio] && cur_prio != 0)
@@ -1848,7 +2188,7 @@ priorities_valid ()
 	}
     }
 
-  if (zerocheck > 1 && zerocheck != 4)
+  if (zerocheck > 1 && zerocheck != nspans)
     return false;
 
   return true;
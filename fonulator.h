@@ -51,6 +51,13 @@
 #include "error.h"
 #include "status.h"
 #include "dsp.h"
+#include "site.h"
+#include "doof.h"
+#include "fbpool.h"
+#include "hash.h"
+#include "cache.h"
+#include "plan.h"
+#include "timing.h"
 
 
 #ifdef HAVE_STDIO_H
@@ -62,16 +69,56 @@
 # define ETHER_ADDR_LEN 6
 #endif
 
-T_SPAN *get_span (int num);
-bool queryFonebridge (libfb_t * f);
+T_SPAN *get_span (T_CONTEXT * ctx, int num);
+T_SPAN *get_first_span (T_CONTEXT * ctx);
+bool queryFonebridge (T_CONTEXT * ctx, libfb_t * f);
 int fb_tdmoectl (libfb_t * f, int state);
+int stopTDMoE (T_CONTEXT * ctx, libfb_t * f);
 bool interactiveReboot (libfb_t * f);
 bool simpleReboot (libfb_t * f);
+FB_STATUS treeParser (T_CONTEXT * ctx, T_SITE * site, FILE * cf);
+FB_STATUS loadConfig (T_CONTEXT * ctx, const char *path);
+libfb_t *connectDevice (T_CONTEXT * ctx);
+FB_STATUS prepareConfig (T_CONTEXT * ctx, libfb_t * fb);
+FB_STATUS configureFonebridge (T_CONTEXT * ctx, libfb_t * f);
+int storeConfig (libfb_t * fb, bool clear);
+
+/* context.c */
+T_CONTEXT *contextCreate (void);
+T_CONTEXT *contextClone (T_CONTEXT * src);
+void contextDestroy (T_CONTEXT * ctx);
+unsigned int contextDiff (T_CONTEXT * old, T_CONTEXT * new);
+
+/* daemon.c */
+int runDaemon (const char *path);
+
+/* watch.c */
+int runWatch (const char *path, const char *key, bool save_config);
+
+/* discover.c */
+int runDiscover (const char *cidr);
+
+/* fleet.c */
+int runFleet (const char *list, int jobs, bool save_config,
+	      bool clear_config, bool plan);
+int runSite (const char *path, const char **keys, int nkeys, int jobs,
+	     bool save_config, bool clear_config, bool plan);
 
 /* keys.c */
 FB_STATUS program_key (libfb_t * fb, int slotID, KEY_ENTRY * theKey);
 
 /* flash.c */
-FB_STATUS write_file_to_flash (libfb_t * f, FILE * bin, int blk);
-FB_STATUS flash_set_gpaklen (libfb_t * f, size_t bytes);
+
+/** Options controlling write_file_to_flash() */
+typedef struct
+{
+  int window;			/**< Requests kept in flight */
+  bool delta;			/**< Only rewrite blocks that differ */
+  const char *journal;		/**< Progress journal file, or NULL */
+}
+T_FLASH_OPTS;
+
+FB_STATUS write_file_to_flash (T_CONTEXT * ctx, libfb_t * f, FILE * bin,
+			       int blk, T_FLASH_OPTS * opts);
+FB_STATUS flash_set_gpaklen (T_CONTEXT * ctx, libfb_t * f, size_t bytes);
 void show_warning ();
@@ -0,0 +1,63 @@
+/*
+   fonulator 3 - foneBRIDGE configuration daemon
+   (C) 2005-2007 Redfone Communications, LLC.
+   www.red-fone.com
+
+   Content Hashing
+*/
+/** @file
+ *
+ * 64 bit FNV-1a hash implementation
+ */
+#include "fonulator.h"
+
+/** FNV-1a 64 bit prime */
+#define FNV1A64_PRIME 0x100000001b3ULL
+
+/** @brief Continue a 64 bit FNV-1a hash over a buffer
+ *
+ * @param data the bytes to hash
+ * @param len the number of bytes
+ * @param hash FNV1A64_INIT, or the result of a previous call
+ * @return the updated hash
+ */
+uint64_t
+fnv1a64 (const void *data, size_t len, uint64_t hash)
+{
+  const uint8_t *p = data;
+
+  while (len--)
+    {
+      hash ^= *p++;
+      hash *= FNV1A64_PRIME;
+    }
+  return hash;
+}
+
+/** @brief Hash the entire contents of a file
+ *
+ * The file is rewound before and after hashing.
+ *
+ * @param fp the file, opened for reading
+ * @param hash storage for the result
+ * @return success/error code
+ */
+FB_STATUS
+fnv1a64_file (FILE * fp, uint64_t * hash)
+{
+  uint8_t buffer[4096];
+  size_t n;
+
+  *hash = FNV1A64_INIT;
+  rewind (fp);
+  while ((n = fread (buffer, 1, sizeof (buffer), fp)) > 0)
+    *hash = fnv1a64 (buffer, n, *hash);
+
+  if (ferror (fp))
+    {
+      perror ("fread");
+      return E_SYSTEM;
+    }
+  rewind (fp);
+  return E_SUCCESS;
+}
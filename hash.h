@@ -0,0 +1,22 @@
+/*
+   fonulator 3 - foneBRIDGE configuration daemon
+   (C) 2005-2007 Redfone Communications, LLC.
+   www.red-fone.com
+
+   Content Hashing
+*/
+/** @file
+ *
+ * 64 bit FNV-1a hashing, used to recognise file contents that have
+ * been seen before.
+ */
+#ifndef HASH_H
+#define HASH_H
+
+/** Initial value for fnv1a64() */
+#define FNV1A64_INIT 0xcbf29ce484222325ULL
+
+uint64_t fnv1a64 (const void *data, size_t len, uint64_t hash);
+FB_STATUS fnv1a64_file (FILE * fp, uint64_t * hash);
+
+#endif
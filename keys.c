@@ -32,7 +32,7 @@ program_key (libfb_t * fb, int slotID, KEY_ENTRY * theKey)
 {
   fblib_err ret;
 
-  ret = custom_cmd (fb, DOOF_CMD_KEY_WRITE, slotID, (char *)theKey->customer_key, CUSTOMER_KEY_SZ);
+  ret = fbt_custom_cmd (fb, DOOF_CMD_KEY_WRITE, slotID, (char *)theKey->customer_key, CUSTOMER_KEY_SZ);
 
   DBG (libfb_fprint_key (stderr, theKey));
 
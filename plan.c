@@ -0,0 +1,182 @@
+/*
+   fonulator 3 - foneBRIDGE configuration daemon
+   (C) 2005-2007 Redfone Communications, LLC.
+   www.red-fone.com
+
+   Configuration Plans
+*/
+/** @file
+ *
+ * While a plan is being recorded on a thread, plan_record() is
+ * installed as the fbt_*() shim of that thread, so every libfb call
+ * the thread makes is noted, reported as successful and never made.
+ * prepareConfig() and configureFonebridge() make all of their
+ * decisions against the device snapshot, so running them this way
+ * yields the ordered libfb calls a real run would make, without any
+ * network I/O.
+ *
+ * A plan names the libfb function of each call, and the DOOF command
+ * of custom commands. How libfb frames the calls on the wire is its
+ * own business, so a plan does not claim to show the datagrams.
+ */
+#include "fonulator.h"
+
+#if defined(STDC_HEADERS) || defined(HAVE_STDLIB_H)
+# include <stdlib.h>
+#endif
+
+/** One libfb call of a plan */
+typedef struct
+{
+  const char *call;		/**< Name of the libfb function */
+  int cmd;			/**< DOOF command of custom commands, or -1 */
+  int param;			/**< Parameter, address, link, span or mode */
+  int len;			/**< Bytes of data handed to the call */
+}
+T_PLAN_STEP;
+
+/** The steps recorded so far on this thread */
+static __thread DList *plan_steps = NULL;
+
+/** @brief The recording shim: note one call in the plan of this thread
+ *
+ * Installed with fbt_set_shim() while a plan is recorded.
+ *
+ * @param call the name of the libfb function
+ * @param cmd the DOOF command of a custom command, otherwise -1
+ * @param param the parameter of the call
+ * @param len the bytes of data handed to the call
+ * @return FBLIB_ESUCCESS, as if the device had accepted the request
+ */
+static int
+plan_record (const char *call, int cmd, int param, int len)
+{
+  T_PLAN_STEP *step = malloc (sizeof (T_PLAN_STEP));
+
+  if (step == NULL)
+    {
+      perror ("malloc");
+      return FBLIB_EERRNO;
+    }
+
+  step->call = call;
+  step->cmd = cmd;
+  step->param = param;
+  step->len = len;
+  dlist_ins_next (plan_steps, dlist_tail (plan_steps), step);
+  return FBLIB_ESUCCESS;
+}
+
+#define PLAN_NAME(cmd) case cmd: return #cmd
+
+/** @return the name of a DOOF command, or NULL if it is not known */
+static const char *
+plan_name (int cmd)
+{
+  switch (cmd)
+    {
+      PLAN_NAME (DOOF_CMD_TDMOE_TXCTL);
+      PLAN_NAME (DOOF_CMD_TDMOE_DSTMAC);
+      PLAN_NAME (DOOF_CMD_CLKSEL_PIO);
+      PLAN_NAME (DOOF_CMD_SET_PRIORITY);
+      PLAN_NAME (DOOF_CMD_TDM_LB_SEL);
+      PLAN_NAME (DOOF_CMD_EC_SETPARM);
+      PLAN_NAME (DOOF_CMD_GET_GPAK_FLASH_PARMS);
+      PLAN_NAME (DOOF_CMD_PCONFIG_STORE);
+      PLAN_NAME (DOOF_CMD_PCONFIG_CLEAR);
+      PLAN_NAME (DOOF_CMD_RESET);
+    default:
+      return NULL;
+    }
+}
+
+/** @brief Print a recorded plan
+ *
+ * The whole plan is printed under the stdout lock, so plans printed
+ * by several fleet workers are not interleaved.
+ */
+static void
+plan_print (T_CONTEXT * ctx, DList * steps, FB_STATUS status)
+{
+  DListElmt *element;
+  int n = 0;
+
+  flockfile (stdout);
+
+  printf ("\nPlan for %s:\n", ctx->fonebridge ? ctx->fonebridge : "device");
+  if (dlist_size (steps) > 0)
+    printf ("%4s  %-24s %-30s %8s %6s\n", "#", "Call", "Command", "Param",
+	    "Data");
+
+  for (element = dlist_head (steps); element != NULL;
+       element = dlist_next (element))
+    {
+      T_PLAN_STEP *step = dlist_data (element);
+      const char *name = plan_name (step->cmd);
+      char cmd[32];
+
+      if (step->cmd < 0)
+	cmd[0] = '\0';
+      else if (name != NULL)
+	snprintf (cmd, sizeof (cmd), "%s", name);
+      else
+	snprintf (cmd, sizeof (cmd), "DOOF 0x%02X", step->cmd);
+
+      printf ("%4d  %-24s %-30s %8d %6d\n", ++n, step->call, cmd,
+	      step->param, step->len);
+    }
+
+  printf ("%d libfb calls\n", n);
+
+  if (status == E_REBOOTDSP)
+    printf ("The device must be reset after the last request; "
+	    "the rest of the configuration is applied by the next run.\n");
+  else if (status != E_SUCCESS)
+    printf ("Planning stopped by error %d.\n", status);
+
+  funlockfile (stdout);
+}
+
+/** @brief Print what configuring a device would send to it
+ *
+ * Runs prepareConfig() and configureFonebridge() against the snapshot
+ * held by the context, either read from the device by
+ * statusInitalize() or loaded by statusLoadSnapshot(), with every
+ * request recorded rather than sent. No libfb context is needed, and
+ * the device is never prompted for or rebooted.
+ *
+ * @param ctx a context with a parsed configuration and a snapshot
+ * @param save_config plan saving the configuration afterwards
+ * @param clear_config plan clearing the saved configuration
+ * @return success/error code of the planned run
+ */
+FB_STATUS
+planConfig (T_CONTEXT * ctx, bool save_config, bool clear_config)
+{
+  DList steps;
+  FB_STATUS status;
+
+  if (ctx->snapshot == NULL)
+    return E_BADINPUT;
+
+  dlist_init (&steps, free);
+  ctx->interactive = false;
+  ctx->state = STATE_RUN;
+
+  plan_steps = &steps;
+  fbt_set_shim (plan_record);
+  status = prepareConfig (ctx, NULL);
+  if (status == E_SUCCESS)
+    status = configureFonebridge (ctx, NULL);
+  /* As storeConfig() would, without claiming it was done */
+  if (status == E_SUCCESS && (save_config || clear_config))
+    plan_record ("custom_cmd", clear_config ? DOOF_CMD_PCONFIG_CLEAR :
+		 DOOF_CMD_PCONFIG_STORE, 0, 0);
+  fbt_set_shim (NULL);
+  plan_steps = NULL;
+
+  plan_print (ctx, &steps, status);
+  dlist_destroy (&steps);
+
+  return status == E_REBOOTDSP ? E_SUCCESS : status;
+}
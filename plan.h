@@ -0,0 +1,18 @@
+/*
+   fonulator 3 - foneBRIDGE configuration daemon
+   (C) 2005-2007 Redfone Communications, LLC.
+   www.red-fone.com
+
+   Configuration Plans
+*/
+/** @file
+ *
+ * Dry runs of a configuration, recording the libfb calls it would
+ * make instead of making them.
+ */
+#ifndef PLAN_H
+#define PLAN_H
+
+FB_STATUS planConfig (T_CONTEXT * ctx, bool save_config, bool clear_config);
+
+#endif
@@ -0,0 +1,373 @@
+/*
+   fonulator 3 - foneBRIDGE configuration daemon
+   (C) 2005-2007 Redfone Communications, LLC.
+   www.red-fone.com
+
+   Site Configuration Files
+*/
+/** @file
+ *
+ * A site file describes many devices in one configuration file:
+ *
+ *   [globals]                  settings shared by every section
+ *   server=00:11:22:33:44:55
+ *
+ *   [template e1-pri]          settings devices can inherit
+ *   [span1]
+ *   framing=ccs
+ *   ...
+ *
+ *   [device pop1-fb1]          one device
+ *   inherit=e1-pri
+ *   fb=192.168.1.222
+ *   [span2]
+ *   framing=cas
+ *
+ * A [device] or [template] header opens the globals of that section,
+ * exactly as [globals] does in a single device file, and its [spanN]
+ * and [dsp] blocks follow. Every section starts out with the settings
+ * made ahead of the first section. inherit= replaces everything set
+ * so far in the section by a copy of an earlier template, so it
+ * belongs right after the header; the section then overrides single
+ * settings of the spans it names, and replaces the DSP channel map if
+ * it has a [dsp] block of its own.
+ *
+ * The file is parsed once, by treeParser(), into one T_CONTEXT per
+ * section. Sections are indexed by name, and devices also by their
+ * fb= address, in an open addressing hash, so selecting a device from
+ * a file of thousands is a single lookup.
+ */
+#include "fonulator.h"
+
+#if defined(STDC_HEADERS) || defined(HAVE_STDLIB_H)
+# include <stdlib.h>
+#endif
+
+extern int vbose;
+
+/** Slots the index starts out with */
+#define SITE_INDEX_MIN 64
+
+/** @brief Free a section and its context */
+static void
+site_section_destroy (T_SITE_SECTION * sec)
+{
+  contextDestroy (sec->ctx);
+  free (sec->address);
+  free (sec->name);
+  free (sec);
+}
+
+/** @return the slot holding `key', or the empty slot it belongs in */
+static T_SITE_SLOT *
+site_slot (T_SITE * site, const char *key)
+{
+  size_t mask = site->slots - 1;
+  size_t i = fnv1a64 (key, strlen (key), FNV1A64_INIT) & mask;
+
+  while (site->index[i].key != NULL && strcmp (site->index[i].key, key) != 0)
+    i = (i + 1) & mask;
+  return &site->index[i];
+}
+
+/** @brief Double the number of slots of the index */
+static FB_STATUS
+site_grow (T_SITE * site)
+{
+  T_SITE_SLOT *old = site->index;
+  size_t n = site->slots, i;
+
+  site->slots = n ? 2 * n : SITE_INDEX_MIN;
+  site->index = calloc (site->slots, sizeof (T_SITE_SLOT));
+  if (site->index == NULL)
+    {
+      perror ("calloc");
+      site->index = old;
+      site->slots = n;
+      return E_SYSTEM;
+    }
+
+  for (i = 0; i < n; i++)
+    if (old[i].key != NULL)
+      *site_slot (site, old[i].key) = old[i];
+
+  free (old);
+  return E_SUCCESS;
+}
+
+/** @brief Add a key to the index
+ *
+ * @param site the site
+ * @param key the key, owned by the section
+ * @param sec the section it selects
+ * @return success, E_DUPLICATE if the key is taken, or error code
+ */
+static FB_STATUS
+site_index (T_SITE * site, const char *key, T_SITE_SECTION * sec)
+{
+  T_SITE_SLOT *slot;
+
+  /* Kept at most half full, so probe sequences stay short */
+  if (2 * (site->used + 1) > site->slots && site_grow (site) != E_SUCCESS)
+    return E_SYSTEM;
+
+  slot = site_slot (site, key);
+  if (slot->key != NULL)
+    return E_DUPLICATE;
+
+  slot->key = key;
+  slot->section = sec;
+  site->used++;
+  return E_SUCCESS;
+}
+
+/** @return the section indexed by `key', or NULL */
+static T_SITE_SECTION *
+site_lookup (T_SITE * site, const char *key)
+{
+  T_SITE_SLOT *slot;
+
+  if (site->slots == 0)
+    return NULL;
+  slot = site_slot (site, key);
+  return slot->key ? slot->section : NULL;
+}
+
+/** @brief Start a new section, called by treeParser()
+ *
+ * @param site the site being parsed
+ * @param device true for a [device] section, false for a [template]
+ * @param name the section name, up to an optional ']'
+ * @param lineno the line of the section header
+ * @return the context the section is parsed into, or NULL on error
+ */
+T_CONTEXT *
+siteSection (T_SITE * site, bool device, const char *name, int lineno)
+{
+  T_SITE_SECTION *sec;
+  FB_STATUS status;
+
+  sec = calloc (1, sizeof (T_SITE_SECTION));
+  if (sec == NULL || (sec->name = strndup (name, strcspn (name, "]"))) == NULL)
+    {
+      perror ("malloc");
+      free (sec);
+      return NULL;
+    }
+  sec->device = device;
+  sec->lineno = lineno;
+
+  sec->ctx = contextClone (site->defaults);
+  if (sec->ctx == NULL)
+    {
+      site_section_destroy (sec);
+      return NULL;
+    }
+  sec->ctx->state = STATE_GLOBAL;
+  sec->ctx->span = 0;
+
+  status = site_index (site, sec->name, sec);
+  if (status != E_SUCCESS)
+    {
+      if (status == E_DUPLICATE)
+	fprintf (stderr, "Section %s on line %d is already defined.\n",
+		 sec->name, lineno);
+      site_section_destroy (sec);
+      return NULL;
+    }
+
+  dlist_ins_next (&site->sections, dlist_tail (&site->sections), sec);
+  return sec->ctx;
+}
+
+/** @brief Base the current section on a template, called by
+ * treeParser() for inherit=
+ *
+ * @param site the site being parsed
+ * @param name the template to inherit
+ * @param lineno the line of the inherit= setting
+ * @return the context the section is parsed into from now on, or NULL
+ * on error
+ */
+T_CONTEXT *
+siteInherit (T_SITE * site, const char *name, int lineno)
+{
+  T_SITE_SECTION *sec, *base;
+  T_CONTEXT *ctx;
+
+  if (dlist_size (&site->sections) == 0)
+    {
+      fprintf (stderr, "inherit= on line %d is outside of a section.\n",
+	       lineno);
+      return NULL;
+    }
+  sec = dlist_data (dlist_tail (&site->sections));
+
+  base = site_lookup (site, name);
+  if (base == NULL || base->device || base == sec)
+    {
+      fprintf (stderr, "Unknown template %s on line %d.\n", name, lineno);
+      return NULL;
+    }
+
+  ctx = contextClone (base->ctx);
+  if (ctx == NULL)
+    return NULL;
+  ctx->state = STATE_GLOBAL;
+  ctx->span = 0;
+
+  contextDestroy (sec->ctx);
+  sec->ctx = ctx;
+  return ctx;
+}
+
+/** @brief Free a site and every context still in it */
+void
+siteDestroy (T_SITE * site)
+{
+  if (site == NULL)
+    return;
+  dlist_destroy (&site->sections);
+  contextDestroy (site->defaults);
+  free (site->index);
+  free (site);
+}
+
+/** @brief Parse a site file
+ *
+ * Every device must have an fb= address. Devices are indexed by it
+ * as well as by name; a device whose address another device already
+ * has can only be selected by name.
+ *
+ * @param path the site file
+ * @return the site, or NULL on error
+ */
+T_SITE *
+siteLoad (const char *path)
+{
+  DListElmt *element;
+  T_SITE *site;
+  FILE *cf;
+  FB_STATUS status;
+  int devices = 0;
+
+  cf = fopen (path, "r");
+  if (cf == NULL)
+    {
+      fprintf (stderr, "Error opening configuration file %s.\n", path);
+      perror ("fopen");
+      return NULL;
+    }
+
+  site = calloc (1, sizeof (T_SITE));
+  if (site == NULL || (site->defaults = contextCreate ()) == NULL)
+    {
+      perror ("calloc");
+      free (site);
+      fclose (cf);
+      return NULL;
+    }
+  dlist_init (&site->sections, (void (*)(void *)) (site_section_destroy));
+
+  status = treeParser (site->defaults, site, cf);
+  fclose (cf);
+  if (status != E_SUCCESS)
+    {
+      fberror ("treeParser", status);
+      siteDestroy (site);
+      return NULL;
+    }
+
+  for (element = dlist_head (&site->sections); element != NULL;
+       element = dlist_next (element))
+    {
+      T_SITE_SECTION *sec = dlist_data (element);
+
+      if (!sec->device)
+	continue;
+      devices++;
+
+      if (sec->ctx->fonebridge == NULL)
+	{
+	  fprintf (stderr, "Device %s on line %d has no foneBRIDGE IP "
+		   "address.\n", sec->name, sec->lineno);
+	  siteDestroy (site);
+	  return NULL;
+	}
+
+      sec->address = strdup (sec->ctx->fonebridge);
+      status = sec->address ? site_index (site, sec->address, sec) : E_SYSTEM;
+      if (status == E_DUPLICATE)
+	fprintf (stderr, "Device %s has the address %s of an earlier "
+		 "section and can only be selected by name.\n", sec->name,
+		 sec->address);
+      else if (status != E_SUCCESS)
+	{
+	  siteDestroy (site);
+	  return NULL;
+	}
+    }
+
+  if (devices == 0)
+    {
+      fprintf (stderr, "%s has no [device] sections.\n", path);
+      siteDestroy (site);
+      return NULL;
+    }
+
+  if (vbose > 1)
+    printf ("%s: %d devices, %d sections\n", path, devices,
+	    dlist_size (&site->sections));
+  return site;
+}
+
+/** @return the device of a site selected by name or address, or NULL */
+T_CONTEXT *
+siteFind (T_SITE * site, const char *key)
+{
+  T_SITE_SECTION *sec = site_lookup (site, key);
+  return (sec != NULL && sec->device) ? sec->ctx : NULL;
+}
+
+/** @brief Remove a device from a site
+ *
+ * @param site the site
+ * @param key the name or address of the device
+ * @return the context of the device, now owned by the caller, or NULL
+ * if there is no such device or it was already taken
+ */
+T_CONTEXT *
+siteTake (T_SITE * site, const char *key)
+{
+  T_SITE_SECTION *sec = site_lookup (site, key);
+  T_CONTEXT *ctx;
+
+  if (sec == NULL || !sec->device)
+    return NULL;
+  ctx = sec->ctx;
+  sec->ctx = NULL;
+  return ctx;
+}
+
+/** @brief Parse a site file and return one of its devices
+ *
+ * @param path the site file
+ * @param key the name or address of the device
+ * @return the context of the device, or NULL on error
+ */
+T_CONTEXT *
+siteLoadDevice (const char *path, const char *key)
+{
+  T_SITE *site = siteLoad (path);
+  T_CONTEXT *ctx;
+
+  if (site == NULL)
+    return NULL;
+
+  ctx = siteTake (site, key);
+  if (ctx == NULL)
+    fprintf (stderr, "No device %s in %s.\n", key, path);
+
+  siteDestroy (site);
+  return ctx;
+}
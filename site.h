@@ -0,0 +1,60 @@
+/*
+   fonulator 3 - foneBRIDGE configuration daemon
+   (C) 2005-2007 Redfone Communications, LLC.
+   www.red-fone.com
+
+   Site Configuration Files
+*/
+/** @file
+ *
+ * Configuration files describing many devices, in [device] sections
+ * that may inherit from [template] sections.
+ */
+#ifndef SITE_H
+#define SITE_H
+
+/** One [device] or [template] section of a site file */
+typedef struct
+{
+  char *name;			/**< Name given in the section header */
+  char *address;		/**< fb= address of a device, once indexed */
+  bool device;			/**< True for [device], false for [template] */
+  int lineno;			/**< Line of the section header */
+  T_CONTEXT *ctx;		/**< The settings of the section */
+}
+T_SITE_SECTION;
+
+/** One slot of the site index */
+typedef struct
+{
+  const char *key;		/**< Section name or device address */
+  T_SITE_SECTION *section;
+}
+T_SITE_SLOT;
+
+/** A parsed site file */
+typedef struct
+{
+  /** Settings ahead of the first section, the base of every section */
+  T_CONTEXT *defaults;
+  /** The sections, in file order */
+  DList sections;
+  /** Open addressing hash of section names and device addresses */
+  T_SITE_SLOT *index;
+  /** Number of slots in index, a power of two */
+  size_t slots;
+  /** Number of slots of index in use */
+  size_t used;
+}
+T_SITE;
+
+T_SITE *siteLoad (const char *path);
+void siteDestroy (T_SITE * site);
+T_CONTEXT *siteSection (T_SITE * site, bool device, const char *name,
+			int lineno);
+T_CONTEXT *siteInherit (T_SITE * site, const char *name, int lineno);
+T_CONTEXT *siteFind (T_SITE * site, const char *key);
+T_CONTEXT *siteTake (T_SITE * site, const char *key);
+T_CONTEXT *siteLoadDevice (const char *path, const char *key);
+
+#endif
@@ -10,7 +10,7 @@
 
 /** @file 
  *
- * Global state machine for configuration parser 
+ * Per-device state machine for configuration parser 
  */
 
 /** @enum STATE
@@ -31,14 +31,63 @@ STATE;
 
 
 
-/** @struct smachine 
+/** The maximum number of keys that we can store in flash memory */
+#define MAX_KEYS 32
+
+/** @name Configuration sections
+ *
+ * The parts of a configuration a run applies, see T_CONTEXT
+ * sections and contextDiff(). */
+/*@{*/
+#define SECTION_GLOBALS 0x1	/**< [globals] */
+#define SECTION_DSP 0x2		/**< [dsp] and companding */
+#define SECTION_KEYS 0x4	/**< Keys/licenses */
+#define SECTION_SPAN(n) (0x100U << ((n) - 1))	/**< [spanN], n from 1 */
+#define SECTION_SPANS (SECTION_SPAN (IDT_LINKS + 1) - SECTION_SPAN (1))
+#define SECTION_ALL (SECTION_GLOBALS | SECTION_DSP | SECTION_KEYS | SECTION_SPANS)
+/*@}*/
+
+/** @enum SNAP_READ
  *
- * A global structure the represents some key states
- * in the entire program. Some 'global' data is saved here while other
- * data (like individual spans) are relegated to storage in the T_SPAN
- * linked list.
+ * The reads making up a T_SNAPSHOT, issued together by
+ * statusSnapshot()
  */
-struct { 
+typedef enum
+{ SNAP_STATIC_INFO = 0, SNAP_LINKS, SNAP_PRIORITIES, SNAP_GPAK,
+  SNAP_READS
+}
+SNAP_READ;
+
+/** @struct T_SNAPSHOT
+ *
+ * The state of a device as read by statusSnapshot(). Every decision
+ * on what has to change is made against this copy, so the device is
+ * only read once per configuration run.
+ */
+typedef struct
+{
+  DOOF_STATIC_INFO dsi;		/**< Static device information */
+  IDT_LINK_CONFIG links[IDT_LINKS];	/**< Current link configuration */
+  unsigned char priorities[IDT_LINKS];	/**< Current span priorities */
+  GPAK_FLASH_PARMS gpak_flash;	/**< DSP channel configuration in flash */
+  fblib_err result[SNAP_READS];	/**< Outcome of each read */
+}
+T_SNAPSHOT;
+
+/** @struct fbcontext
+ *
+ * Everything known about one device: the state of the configuration
+ * parser, the parsed configuration and the status reported by the
+ * device itself. Nothing here is shared between devices, so several
+ * contexts can be parsed and configured in one process, or on
+ * several threads at once.
+ *
+ * Some 'global' data is saved here directly while other data (like
+ * individual spans) are relegated to storage in the T_SPAN table.
+ */
+typedef struct fbcontext
+{
+  STATE state;	/**< Parser/configuration state, see STATE */
   int span;   /** Tracks which span we're currently parsing */
 
   /* Parsed configuration */
@@ -55,6 +104,9 @@ struct {
   bool dspdisabled;		/**< True if we must not touch the DSP */
   FEATURE featset;              /**< The feature set of the device */ 
   bool wpll;                    /*wpll=0 off, wpll=1 on*/
+  bool interactive;		/**< True if the user may be prompted */
+  bool tdmoe_stopped;		/**< True once this run stopped TDMoE */
+  unsigned int sections;	/**< Sections a run applies, SECTION_ALL by default */
 
   /** @brief Span priority. 
    *
@@ -64,7 +116,27 @@ struct {
    * case of '0' set for every span which means that all spans use
    * internal timing. It is set to -1 by default which is used in
    * validation routines to substitute applicable defaults if needed.
+   * One entry per link libfb can configure, span n at index n - 1.
    */
-  unsigned int priorities[4];
+  int priorities[IDT_LINKS];
+
+  /** The spans parsed from the configuration file, indexed by span
+   * number - 1. A span not configured is NULL. */
+  T_SPAN **spans;
+  /** Number of entries in spans */
+  int span_slots;
+
+  /** An array of keys/licenses parsed for programming to the device. */
+  KEY_ENTRY all_keys[MAX_KEYS];
+  /** For each valid key, k, in all_keys valid_keys[k] is true. */
+  int valid_keys[MAX_KEYS];
+
+  /** DSP channel tables, private to dsp.c */
+  struct dspstate *dsp;
+
+  /** The state read from the device by statusSnapshot() */
+  T_SNAPSHOT *snapshot;
+  /** The DOOF_STATIC_INFO structure read from the device */
+  DOOF_STATIC_INFO *dsi;
 }
-smachine;
+T_CONTEXT;
@@ -17,26 +17,54 @@
 # include <stdlib.h>
 #endif
 
-/** @var dsi
- *
- * Pointer to the DOOF_STATIC_INFO structure from the device we are
- * configuring or querying.
- */
-DOOF_STATIC_INFO *dsi;
+#if HAVE_UNISTD_H
+#include <unistd.h>
+#endif
+
+#include <signal.h>
+#include <sys/time.h>
+#include <time.h>
 
 extern bool vbose;
 
+/** Requests kept in flight while fetching PMON registers */
+#define PMON_WINDOW 8
+/** How many times a lost PMON request is resent */
+#define PMON_RETRIES 3
+/** How many times a lost snapshot request is resent */
+#define SNAPSHOT_RETRIES 2
+/** Identifies a snapshot file written by statusSaveSnapshot() */
+#define SNAPSHOT_MAGIC "FBSNAP01"
+
+/** Header of a snapshot file */
+typedef struct
+{
+  char magic[8];		/**< SNAPSHOT_MAGIC */
+  uint32_t size;		/**< sizeof (T_SNAPSHOT) of the writer */
+}
+T_SNAPSHOT_HDR;
+
+/** One byte of a PMON register to fetch */
+typedef struct
+{
+  int span;			/**< Span index, from 0 */
+  int address;			/**< Indirect register address */
+  uint8_t *data;		/**< Where the byte is stored */
+}
+T_PMON_READ;
+
 
 /** @brief Print GPAK flash status for each DSP channel 
  * 
  * @param g the GPAK flash parameters 
+ * @param channels the number of DSP channels
  */
 void
-statusPrintGpak (GPAK_FLASH_PARMS * g)
+statusPrintGpak (GPAK_FLASH_PARMS * g, int channels)
 {
   register int i;
 
-  for (i = 0; i < 128; i++)
+  for (i = 0; i < channels; i++)
     {
       char ch;
       dsp_chantype dc = (dsp_chantype) g->dsp_chan_type[i];
@@ -68,13 +96,15 @@ statusPrintGpak (GPAK_FLASH_PARMS * g)
 
 /** @brief Query a device and display results
  *
+ * @param ctx the device context
  * @param f the libfb context for the device
  * @return true on success 
  */
 bool
-queryFonebridge (libfb_t * f)
+queryFonebridge (T_CONTEXT * ctx, libfb_t * f)
 {
   bool dsp_available;
+  DOOF_STATIC_INFO *dsi = ctx->dsi;
 
   /* Must call after statusInitalize() */
   if (dsi == NULL)
@@ -86,10 +116,10 @@ queryFonebridge (libfb_t * f)
       struct tm *time_info = malloc (sizeof (struct tm));
       time_t caltime;
 #endif
-      IDT_LINK_CONFIG current[IDT_LINKS];
+      IDT_LINK_CONFIG *current = ctx->snapshot->links;
       register int i;
 
-      if (configcheck_fb_udp (f, current) != FBLIB_ESUCCESS)
+      if (ctx->snapshot->result[SNAP_LINKS] != FBLIB_ESUCCESS)
 	return false;
 
       for (i = 0; i < dsi->spans; i++)
@@ -125,47 +155,227 @@ queryFonebridge (libfb_t * f)
       print_ip (dsi->epcs_config.ip_address[1]);
     }
 
-  dsp_available = statusHasDSP ();
+  dsp_available = statusHasDSP (ctx);
   printf ("DSP Status: %s\n",
-	  (!smachine.dspdisabled
+	  (!ctx->dspdisabled
 	   && dsp_available) ? "Available" : "Bypassed");
 
-  if (vbose > 1 && dsp_available)
+  if (vbose > 1 && dsp_available
+      && ctx->snapshot->result[SNAP_GPAK] == FBLIB_ESUCCESS)
+    statusPrintGpak (&ctx->snapshot->gpak_flash, statusGetDSPChannels (ctx));
+
+  return true;
+}
+
+
+/** @brief Pool job performing one read of a device snapshot */
+static fblib_err
+snapshot_job (libfb_t * f, int job, void *arg)
+{
+  T_SNAPSHOT *snap = arg;
+  unsigned char mask[IDT_LINKS] = { 0 };
+  fblib_err ret = FBLIB_ESUCCESS;
+
+  switch (job)
     {
-      GPAK_FLASH_PARMS *gpak = malloc (sizeof (GPAK_FLASH_PARMS));
-      if (gpak != NULL)
-	{
-	  memset (gpak, 0, sizeof (GPAK_FLASH_PARMS));
-	  if (custom_cmd_reply (f, DOOF_CMD_GET_GPAK_FLASH_PARMS, 0, NULL, 0,
-				(char *) gpak,
-				sizeof (GPAK_FLASH_PARMS)) == FBLIB_ESUCCESS)
-	    statusPrintGpak (gpak);
-	  free (gpak);
-	}
+    case SNAP_STATIC_INFO:
+      ret = fbt_udp_get_static_info (f, &snap->dsi);
+      break;
+    case SNAP_LINKS:
+      ret = fbt_configcheck_fb_udp (f, snap->links);
+      break;
+    case SNAP_PRIORITIES:
+      /* Parameter 0 sets no priorities, the reply holds the current ones */
+      ret = fbt_custom_cmd_reply (f, DOOF_CMD_SET_PRIORITY, 0, (char *) mask,
+				  IDT_LINKS, (char *) snap->priorities,
+				  IDT_LINKS);
+      break;
+    case SNAP_GPAK:
+      ret = fbt_custom_cmd_reply (f, DOOF_CMD_GET_GPAK_FLASH_PARMS, 0, NULL,
+				  0, (char *) &snap->gpak_flash,
+				  sizeof (GPAK_FLASH_PARMS));
+      break;
     }
 
-  return true;
+  snap->result[job] = ret;
+  return ret;
+}
+
+/** @brief Read the state of a device in one go
+ *
+ * The static information, link configuration, span priorities and
+ * GPAK flash parameters are requested concurrently, one per context
+ * of a pool, so the whole snapshot costs about one round trip. If no
+ * pool can be opened they are read one after another on `f'.
+ *
+ * Only the static information is required. The outcome of the other
+ * reads is left in the snapshot for the code that depends on them; a
+ * read that never completed is reported as timed out. Call again to
+ * refresh the snapshot after the device has been changed.
+ *
+ * @param ctx the device context, whose snapshot is filled in
+ * @param f the libfb context for the device
+ * @return success/error code
+ */
+FB_STATUS
+statusSnapshot (T_CONTEXT * ctx, libfb_t * f)
+{
+  T_SNAPSHOT *snap = ctx->snapshot;
+  FBPOOL *pool;
+  int job;
+
+  memset (snap, 0, sizeof (T_SNAPSHOT));
+  for (job = 0; job < SNAP_READS; job++)
+    snap->result[job] = FBLIB_ETIMEDOUT;
+
+  pool = fbpool_create (ctx->fonebridge, DOOF_UDP_PORT, SNAP_READS);
+  if (pool != NULL)
+    {
+      /* Failures are recorded per read by snapshot_job() */
+      fbpool_run (pool, SNAP_READS, snapshot_job, snap, SNAPSHOT_RETRIES,
+		  NULL);
+      fbpool_destroy (pool);
+    }
+  else
+    {
+      for (job = 0; job < SNAP_READS; job++)
+	snapshot_job (f, job, snap);
+    }
+
+  return snap->result[SNAP_STATIC_INFO] == FBLIB_ESUCCESS ?
+    E_SUCCESS : E_FBLIB;
 }
 
+/** @brief Save the snapshot of a device to a file
+ *
+ * The file holds the T_SNAPSHOT as it is laid out in memory, so it
+ * can only be loaded by a fonulator built for the same platform.
+ *
+ * @param ctx a context whose snapshot was read by statusInitalize()
+ * @param path the file to write
+ * @return success/error code
+ */
+FB_STATUS
+statusSaveSnapshot (T_CONTEXT * ctx, const char *path)
+{
+  T_SNAPSHOT_HDR hdr;
+  FILE *fp;
+  bool ok;
+
+  if (ctx->snapshot == NULL)
+    return E_BADINPUT;
+
+  fp = fopen (path, "wb");
+  if (fp == NULL)
+    {
+      fprintf (stderr, "Error opening snapshot %s.\n", path);
+      perror ("fopen");
+      return E_SYSTEM;
+    }
+
+  memcpy (hdr.magic, SNAPSHOT_MAGIC, sizeof (hdr.magic));
+  hdr.size = sizeof (T_SNAPSHOT);
+  ok = fwrite (&hdr, sizeof (hdr), 1, fp) == 1
+    && fwrite (ctx->snapshot, sizeof (T_SNAPSHOT), 1, fp) == 1;
+  if (fclose (fp) != 0)
+    ok = false;
+
+  if (!ok)
+    {
+      fprintf (stderr, "Error writing snapshot %s.\n", path);
+      return E_SYSTEM;
+    }
+  return E_SUCCESS;
+}
+
+/** @brief Load a snapshot saved by statusSaveSnapshot()
+ *
+ * Stands in for statusInitalize() when a device is not to be
+ * contacted, for example to plan a configuration offline.
+ *
+ * @param ctx the device context, whose snapshot and dsi are filled in
+ * @param path the file to read
+ * @return success/error code
+ */
+FB_STATUS
+statusLoadSnapshot (T_CONTEXT * ctx, const char *path)
+{
+  T_SNAPSHOT_HDR hdr;
+  T_SNAPSHOT *snap;
+  FILE *fp;
+
+  fp = fopen (path, "rb");
+  if (fp == NULL)
+    {
+      fprintf (stderr, "Error opening snapshot %s.\n", path);
+      perror ("fopen");
+      return E_SYSTEM;
+    }
+
+  if (fread (&hdr, sizeof (hdr), 1, fp) != 1
+      || memcmp (hdr.magic, SNAPSHOT_MAGIC, sizeof (hdr.magic)) != 0
+      || hdr.size != sizeof (T_SNAPSHOT))
+    {
+      fprintf (stderr, "%s is not a snapshot saved by this fonulator.\n",
+	       path);
+      fclose (fp);
+      return E_BADINPUT;
+    }
+
+  snap = malloc (sizeof (T_SNAPSHOT));
+  if (snap == NULL)
+    {
+      perror ("malloc");
+      fclose (fp);
+      return E_SYSTEM;
+    }
+
+  if (fread (snap, sizeof (T_SNAPSHOT), 1, fp) != 1)
+    {
+      fprintf (stderr, "Snapshot %s is truncated.\n", path);
+      free (snap);
+      fclose (fp);
+      return E_BADINPUT;
+    }
+  fclose (fp);
+
+  if (snap->result[SNAP_STATIC_INFO] != FBLIB_ESUCCESS)
+    {
+      fprintf (stderr, "Snapshot %s holds no device information.\n", path);
+      free (snap);
+      return E_BADINPUT;
+    }
+
+  statusCleanup (ctx);
+  ctx->snapshot = snap;
+  ctx->dsi = &snap->dsi;
+  return E_SUCCESS;
+}
 
 /** @brief initalized internal status data structures with current information from the device 
  * 
+ * @param ctx the device context, whose snapshot and dsi are filled in
  * @param f the libfb context for the device
  * @return success/error code
  */
 FB_STATUS
-statusInitalize (libfb_t * f)
+statusInitalize (T_CONTEXT * ctx, libfb_t * f)
 {
   fblib_err status;
 
-  dsi = malloc (sizeof (DOOF_STATIC_INFO));
-  if (dsi == NULL)
+  if (ctx->snapshot == NULL)
     {
-      perror ("malloc");
-      return E_SYSTEM;
+      ctx->snapshot = malloc (sizeof (T_SNAPSHOT));
+      if (ctx->snapshot == NULL)
+	{
+	  perror ("malloc");
+	  return E_SYSTEM;
+	}
     }
+  ctx->dsi = &ctx->snapshot->dsi;
 
-  status = udp_get_static_info (f, dsi);
+  statusSnapshot (ctx, f);
+  status = ctx->snapshot->result[SNAP_STATIC_INFO];
   if (status != E_SUCCESS)
     {
       if (status == FBLIB_ETIMEDOUT)
@@ -180,26 +390,37 @@ statusInitalize (libfb_t * f)
 
 /** @brief free resources used by status data structures */
 void
-statusCleanup (void)
+statusCleanup (T_CONTEXT * ctx)
 {
-  if (dsi)
-    free ((void *) dsi);
+  if (ctx->snapshot)
+    free ((void *) ctx->snapshot);
+  ctx->snapshot = NULL;
+  ctx->dsi = NULL;
 }
 
 
 /** @brief display minimal statistics about the device */
 void
-statusDisplay (void)
+statusDisplay (T_CONTEXT * ctx)
 {
   printf ("Found a foneBRIDGE with %i spans on %i transceivers.\n",
-	  dsi->spans, dsi->devices);
+	  ctx->dsi->spans, ctx->dsi->devices);
 }
 
 /**
  * @return true if device is an inline echo canceller (IEC)
  */
 bool
-statusIsIEC (void)
+statusIsIEC (T_CONTEXT * ctx)
+{
+  return statusDsiIsIEC (ctx->dsi);
+}
+
+/**
+ * @return true if the static information describes an IEC
+ */
+bool
+statusDsiIsIEC (DOOF_STATIC_INFO * dsi)
 {
   if (dsi->epcs_config.cfg_flags & 1)
     return true;
@@ -210,38 +431,57 @@ statusIsIEC (void)
  * @return the number of spans on the device
  */
 unsigned int
-statusGetSpans (void)
+statusGetSpans (T_CONTEXT * ctx)
 {
-  return dsi->spans;
+  return ctx->dsi->spans;
 }
 
 /**
  * @return the number of transceivers on the device
  */
 unsigned int
-statusGetTransceivers (void)
+statusGetTransceivers (T_CONTEXT * ctx)
 {
-  return dsi->devices;
+  return ctx->dsi->devices;
 }
 
 /**
  * @return true if device has a supported DSP 
  */
 bool
-statusHasDSP (void)
+statusHasDSP (T_CONTEXT * ctx)
 {
-  if (dsi->gpak_config.max_channels == 128)
-    return true;
-  return false;
+  return statusGetDSPChannels (ctx) > 0;
+}
+
+/**
+ * @return the number of DSP channels, 0 if the device has no
+ * supported DSP
+ */
+unsigned int
+statusGetDSPChannels (T_CONTEXT * ctx)
+{
+  return statusDsiDSPChannels (ctx->dsi);
+}
+
+/**
+ * @return the number of DSP channels the static information reports,
+ * 0 if the device has no supported DSP
+ */
+unsigned int
+statusDsiDSPChannels (DOOF_STATIC_INFO * dsi)
+{
+  unsigned int n = dsi->gpak_config.max_channels;
+  return DSP_SUPPORTED (n) ? n : 0;
 }
 
 /**
  * @return the DSI pointer (encapsulation)
  */
 DOOF_STATIC_INFO *
-status_get_dsi (void)
+status_get_dsi (T_CONTEXT * ctx)
 {
-  return dsi;
+  return ctx->dsi;
 }
 
 /**  @brief PMON data structure setup
@@ -315,25 +555,207 @@ pmon_destroy (libfb_PMONRegister * reg)
   reg = NULL;
 }
 
+/** @brief Pool job latching the PMON counters of span `job' */
+static fblib_err
+pmon_updat_job (libfb_t * f, int job, void *arg)
+{
+  return fbt_updat_pmon (f, job);
+}
+
+/** @brief Pool job reading one byte of a PMON register */
+static fblib_err
+pmon_read_job (libfb_t * f, int job, void *arg)
+{
+  T_PMON_READ *r = (T_PMON_READ *) arg + job;
+  return fbt_readidt_pmon (f, r->span, r->address, r->data);
+}
+
+/** @brief Run PMON jobs through a pool, or one at a time without one */
+static FB_STATUS
+pmon_run (libfb_t * f, FBPOOL * pool, int njobs, fbpool_job fn, void *arg)
+{
+  int job;
+
+  if (pool != NULL)
+    return fbpool_run (pool, njobs, fn, arg, PMON_RETRIES, NULL);
+
+  for (job = 0; job < njobs; job++)
+    if (fn (f, job, arg) != FBLIB_ESUCCESS)
+      return E_FBLIB;
+
+  return E_SUCCESS;
+}
+
+/** @brief List every register byte to read for a set of spans
+ *
+ * @param spanregs a register list per span, from statusSetupPMON()
+ * @param nspans the number of spans
+ * @param nreads set to the number of bytes listed
+ * @return the reads, or NULL if memory could not be allocated
+ */
+static T_PMON_READ *
+pmon_list_reads (DList ** spanregs, int nspans, int *nreads)
+{
+  T_PMON_READ *reads;
+  int span, n = 0;
+
+  for (span = 0; span < nspans; span++)
+    {
+      DListElmt *elmt;
+      for (elmt = dlist_head (spanregs[span]); elmt != NULL;
+	   elmt = dlist_next (elmt))
+	n += ((libfb_PMONRegister *) dlist_data (elmt))->length_bytes;
+    }
+
+  reads = calloc (n, sizeof (T_PMON_READ));
+  if (reads == NULL)
+    {
+      perror ("calloc");
+      return NULL;
+    }
+
+  n = 0;
+  for (span = 0; span < nspans; span++)
+    {
+      DListElmt *elmt;
+      for (elmt = dlist_head (spanregs[span]); elmt != NULL;
+	   elmt = dlist_next (elmt))
+	{
+	  libfb_PMONRegister *reg = dlist_data (elmt);
+	  int byte;
+	  for (byte = 0; byte < reg->length_bytes; byte++, n++)
+	    {
+	      reads[n].span = span;
+	      reads[n].address = reg->first_address + byte;
+	      reads[n].data = &reg->data[byte];
+	    }
+	}
+    }
+
+  *nreads = n;
+  return reads;
+}
+
+/** @brief Latch the counters of every span and read them all back */
+static FB_STATUS
+pmon_fetch (libfb_t * f, FBPOOL * pool, T_PMON_READ * reads, int nreads,
+	    int nspans)
+{
+  FB_STATUS status;
+
+  /* Force registers to fetch updated counters */
+  status = pmon_run (f, pool, nspans, pmon_updat_job, NULL);
+  if (status == E_SUCCESS)
+    status = pmon_run (f, pool, nreads, pmon_read_job, reads);
+  return status;
+}
+
+/** @brief Latch the counters of one span and read them back
+ *
+ * @param reads the reads of the span, from pmon_list_reads()
+ * @param nreads the number of reads
+ * @param span the span index, from 0
+ */
+static FB_STATUS
+pmon_fetch_span (libfb_t * f, FBPOOL * pool, T_PMON_READ * reads,
+		 int nreads, int span)
+{
+  if (fbt_updat_pmon (f, span) != FBLIB_ESUCCESS)
+    return E_FBLIB;
+  return pmon_run (f, pool, nreads, pmon_read_job, reads);
+}
+
+/** @brief Open the pool PMON reads are pipelined through
+ *
+ * @return the pool, or NULL to read one register byte at a time
+ */
+static FBPOOL *
+pmon_pool (T_CONTEXT * ctx)
+{
+  FBPOOL *pool = fbpool_create (ctx->fonebridge, DOOF_UDP_PORT, PMON_WINDOW);
+  if (pool == NULL && vbose > 0)
+    printf ("Unable to open %d device contexts, reading one at a time.\n",
+	    PMON_WINDOW);
+  return pool;
+}
+
+/** @brief Fetch the PMON registers of every span
+ *
+ * The counters of all spans are latched first. Every byte of every
+ * register is then read as one batch, kept PMON_WINDOW requests deep
+ * through a pool of contexts to the device. This takes a few round
+ * trips for the whole unit instead of one per byte.
+ *
+ * libfb_readidt_pmon() reads a single byte and libfb has no call for
+ * a range of registers, so the bytes of a multi-byte counter, though
+ * contiguous, still take one request each.
+ *
+ * If the batch fails and `fetched' is given, each span is fetched
+ * again on its own, so that the spans that can be read are.
+ *
+ * @param ctx the device context
+ * @param f the libfb context, used if no pool can be opened
+ * @param spanregs a register list per span, from statusSetupPMON()
+ * @param nspans the number of spans
+ * @param fetched if not NULL, set for each span to whether its
+ * registers were read
+ * @return success/error code, an error if any span was not read
+ */
+FB_STATUS
+statusFetchPMON (T_CONTEXT * ctx, libfb_t * f, DList ** spanregs, int nspans,
+		 bool * fetched)
+{
+  T_PMON_READ *reads;
+  FBPOOL *pool;
+  int nreads, span, first, n;
+  FB_STATUS status;
+
+  reads = pmon_list_reads (spanregs, nspans, &nreads);
+  if (reads == NULL)
+    return E_SYSTEM;
+
+  pool = pmon_pool (ctx);
+  status = pmon_fetch (f, pool, reads, nreads, nspans);
+
+  for (span = 0, first = 0; fetched != NULL && span < nspans; span++)
+    {
+      /* The reads are listed span by span */
+      for (n = 0; first + n < nreads && reads[first + n].span == span; n++)
+	;
+      fetched[span] = (status == E_SUCCESS
+		       || pmon_fetch_span (f, pool, reads + first, n,
+					   span) == E_SUCCESS);
+      first += n;
+    }
+
+  fbpool_destroy (pool);
+  free (reads);
+  return status;
+}
+
 /** @brief Statistics query entry point
  *
  * Self-contained routine sets up PMON data structures, queries
  * device, and prints results.
  *
- * @param the device context for which statistics are desired
+ * @param ctx the device context
+ * @param fb the libfb context for which statistics are desired
  * @return true on success
  */
 bool
-statusRunPMON (libfb_t * fb)
+statusRunPMON (T_CONTEXT * ctx, libfb_t * fb)
 {
   int i;
   IDT_LINK_CONFIG links[IDT_LINKS];
   fblib_err ret;
+  FB_STATUS fetched;
 
-  unsigned int devices = statusGetTransceivers ();
-  unsigned int spans = statusGetSpans () / devices;;
+  unsigned int devices = statusGetTransceivers (ctx);
+  unsigned int spans = statusGetSpans (ctx) / devices;;
+  bool success = true;
 
   DList **spanregs;
+  bool *fetched_span;
 
   /* spanregs is a dynamically allocated array of DLists. For example:
    *  if there are two spans there will be spanregs[0] and
@@ -341,17 +763,22 @@ statusRunPMON (libfb_t * fb)
    */
 
   spanregs = calloc (spans * devices, sizeof (DList *));
-  if (spanregs == NULL)
+  fetched_span = calloc (spans * devices, sizeof (bool));
+  if (spanregs == NULL || fetched_span == NULL)
     {
       perror ("calloc");
+      free (spanregs);
+      free (fetched_span);
       return false;
     }
 
   /* First we must get the current link configurations */
-  ret = configcheck_fb_udp (fb, links);
+  ret = fbt_configcheck_fb_udp (fb, links);
   if (ret != E_SUCCESS)
     {
       fberror ("statusRunPMON", ret);
+      free (spanregs);
+      free (fetched_span);
       return false;
     }
 
@@ -360,45 +787,62 @@ statusRunPMON (libfb_t * fb)
       spanregs[i] = statusSetupPMON (&links[i]);
     }
 
-  for (i = 0; i < devices; i++)
+  fetched = statusFetchPMON (ctx, fb, spanregs, spans * devices,
+			     fetched_span);
+  if (fetched != E_SUCCESS)
     {
-      int span;
-      /* Send UPDAT transition and then process each register */
-      for (span = 0; span < spans; span++)
+      fberror ("statusFetchPMON", fetched);
+      success = false;
+    }
+
+  for (i = 0; i < spans * devices; i++)
+    {
+      /* Print every span that could be read */
+      if (fetched_span[i])
 	{
-	  DListElmt *elmt = NULL;
-	  DList *currentregs = NULL;
-	  unsigned int span_index = (i * spans) + span;
+	  printf ("Span %d Statistics\n-----------------\n", i + 1);
+	  statusPrintRegisters (spanregs[i]);
+	  if ((i + 1) < IDT_LINKS)
+	    printf ("\n");
+	}
+      else
+	fprintf (stderr, "Unable to read the statistics of span %d.\n",
+		 i + 1);
+      dlist_destroy (spanregs[i]);
+      free (spanregs[i]);
+    }
 
-	  /* Force registers to fetch updated counter */
-	  libfb_updat_pmon (fb, span_index);
+  free (spanregs);
+  free (fetched_span);
+  return success;
+}
 
-	  /* Get the list for the current span */
-	  currentregs = spanregs[span_index];
 
-	  /* Process each register */
-	  elmt = dlist_head (currentregs);
-	  while (elmt != NULL)
-	    {
-	      int byte;
-	      libfb_PMONRegister *reg = dlist_data (elmt);
-	      for (byte = 0; byte < reg->length_bytes; byte++)
-		libfb_readidt_pmon (fb, span_index, reg->first_address + byte,
-				    &reg->data[byte]);
+/** @brief Decode the counter held in a PMON register
+ *
+ * @param reg a register filled in by statusFetchPMON()
+ * @return the counter value, length_bits wide
+ */
+unsigned int
+statusRegisterValue (libfb_PMONRegister * reg)
+{
+  int byte;
+  uint32_t data = 0;
+  uint8_t mask = 0xFF;
 
-	      elmt = dlist_next (elmt);
-	    }
+  /* Registers are 32 bits at most; sample_print_span() relies on it */
+  for (byte = 0; byte < reg->length_bytes && byte < 4; byte++)
+    {
+      if (reg->length_bytes == 1)
+	mask >>= 8 - reg->length_bits;
+      else if (reg->length_bytes == (byte + 1))
+	mask >>= 8 - (reg->length_bits - 8 * byte);
 
-	  printf ("Span %d Statistics\n-----------------\n", span_index + 1);
-	  statusPrintRegisters (currentregs);
-	  if ((span_index + 1) < IDT_LINKS)
-	    printf ("\n");
-	}
+      data |= (uint32_t) (reg->data[byte] & mask) << (8 * byte);
     }
-  return true;
+  return data;
 }
 
-
 /** @brief print a linked list of PMON registers
  * 
  * @param regs a DList of PMONRegister data
@@ -409,27 +853,207 @@ statusPrintRegisters (DList * regs)
   DListElmt *elmt = dlist_head (regs);
   while (elmt != NULL)
     {
-      int byte;
       libfb_PMONRegister *datareg = dlist_data (elmt);
 
       printf ("\t(%s) %-*s : ",
 	      datareg->name, (int) (40 - strlen (datareg->name)),
 	      datareg->longname);
 
-      uint16_t data = 0;
-      uint8_t mask = 0xFF;
-      for (byte = 0; byte < datareg->length_bytes; byte++)
+      printf ("%u\n", statusRegisterValue (datareg));
+
+
+      elmt = dlist_next (elmt);
+    }
+}
+
+
+/** Set once sampling should stop */
+static volatile sig_atomic_t sample_stop;
+
+/** @brief SIGINT/SIGTERM handler ending statusSamplePMON() */
+static void
+sample_signal (int sig)
+{
+  sample_stop = 1;
+}
+
+/** @brief Print one sample of a span
+ *
+ * The first sample of a run prints the absolute counters. Later
+ * samples print each counter's increase since the previous sample and
+ * its rate per second. Counters are length_bits wide and wrap, so the
+ * increase is taken modulo 2^length_bits.
+ *
+ * @param stamp the time of the sample
+ * @param span the span number, from 1
+ * @param regs the registers of the span
+ * @param last the previous value of each register, updated in place
+ * @param secs the time since the previous sample, or 0 for the first
+ */
+static void
+sample_print_span (const char *stamp, int span, DList * regs,
+		   unsigned int *last, double secs)
+{
+  DListElmt *elmt;
+  int r = 0;
+
+  printf ("%s span %d", stamp, span);
+  for (elmt = dlist_head (regs); elmt != NULL; elmt = dlist_next (elmt), r++)
+    {
+      libfb_PMONRegister *reg = dlist_data (elmt);
+      unsigned int value = statusRegisterValue (reg);
+
+      if (secs > 0)
+	{
+	  unsigned int wrap = (reg->length_bits >= 32) ? 0xFFFFFFFFu :
+	    (1u << reg->length_bits) - 1;
+	  unsigned int delta = (value - last[r]) & wrap;
+	  printf (" %s=+%u (%.2f/s)", reg->name, delta, delta / secs);
+	}
+      else
+	printf (" %s=%u", reg->name, value);
+
+      last[r] = value;
+    }
+  printf ("\n");
+}
+
+/** @brief Sample the PMON counters continuously
+ *
+ * The register lists of every span, the list of reads and the pool
+ * of contexts are set up once and reused for each sample. Samples are
+ * taken every `interval' seconds, measured from the start so that
+ * slow fetches do not make the schedule drift, until SIGINT or
+ * SIGTERM is received. Each sample prints one line per span.
+ *
+ * @param ctx the device context
+ * @param fb the libfb context for the device
+ * @param interval seconds between samples
+ * @return true if sampling ended without an error
+ */
+bool
+statusSamplePMON (T_CONTEXT * ctx, libfb_t * fb, int interval)
+{
+  IDT_LINK_CONFIG links[IDT_LINKS];
+  DList **spanregs;
+  unsigned int **last;
+  T_PMON_READ *reads = NULL;
+  FBPOOL *pool = NULL;
+  int i, nreads, nspans = statusGetSpans (ctx);
+  struct timeval start, prev;
+  unsigned long n;
+  bool success = true;
+
+  if (interval < 1)
+    interval = 1;
+
+  /* links[] only has room for the spans of one device */
+  if (nspans > IDT_LINKS)
+    {
+      fprintf (stderr, "Only the first %d of %d spans are sampled.\n",
+	       IDT_LINKS, nspans);
+      nspans = IDT_LINKS;
+    }
+
+  if (fbt_configcheck_fb_udp (fb, links) != FBLIB_ESUCCESS)
+    {
+      fprintf (stderr, "Unable to read the link configuration.\n");
+      return false;
+    }
+
+  spanregs = calloc (nspans, sizeof (DList *));
+  last = calloc (nspans, sizeof (unsigned int *));
+  if (spanregs == NULL || last == NULL)
+    {
+      perror ("calloc");
+      free (spanregs);
+      free (last);
+      return false;
+    }
+
+  for (i = 0; i < nspans && success; i++)
+    {
+      spanregs[i] = statusSetupPMON (&links[i]);
+      if (spanregs[i] == NULL)
+	success = false;
+      else if ((last[i] = calloc (dlist_size (spanregs[i]) + 1,
+				  sizeof (unsigned int))) == NULL)
 	{
-	  if (datareg->length_bytes == 1)
-	    mask >>= 8 - datareg->length_bits;
-	  else if (datareg->length_bytes == (byte + 1))
-	    mask >>= 8 - (datareg->length_bits - 8 * byte);
+	  perror ("calloc");
+	  success = false;
+	}
+    }
+
+  if (success && (reads = pmon_list_reads (spanregs, nspans, &nreads)) == NULL)
+    success = false;
 
-	  data |= (datareg->data[byte] & mask) << (8 * byte);
+  if (success)
+    {
+      pool = pmon_pool (ctx);
+      sample_stop = 0;
+      signal (SIGINT, sample_signal);
+      signal (SIGTERM, sample_signal);
+      gettimeofday (&start, NULL);
+    }
+
+  for (n = 0; success && !sample_stop; n++)
+    {
+      struct timeval now, due;
+      char stamp[32];
+      time_t t;
+      FB_STATUS status;
+
+      status = pmon_fetch (fb, pool, reads, nreads, nspans);
+      gettimeofday (&now, NULL);
+      if (status != E_SUCCESS)
+	{
+	  /* A signal may have cut the fetch short */
+	  if (!sample_stop)
+	    {
+	      fberror ("statusSamplePMON", status);
+	      success = false;
+	    }
+	  break;
 	}
-      printf ("%d\n", data);
 
+      t = now.tv_sec;
+      strftime (stamp, sizeof (stamp), "%Y-%m-%d %H:%M:%S", localtime (&t));
+      for (i = 0; i < nspans; i++)
+	sample_print_span (stamp, i + 1, spanregs[i], last[i],
+			   n ? (now.tv_sec - prev.tv_sec) +
+			   (now.tv_usec - prev.tv_usec) / 1e6 : 0);
+      fflush (stdout);
+      prev = now;
 
-      elmt = dlist_next (elmt);
+      /* Sleep until the next sample is due, or a signal arrives */
+      due.tv_sec = start.tv_sec + (n + 1) * interval;
+      due.tv_usec = start.tv_usec;
+      gettimeofday (&now, NULL);
+      if (timercmp (&now, &due, <))
+	{
+	  struct timespec wait;
+	  timersub (&due, &now, &now);
+	  wait.tv_sec = now.tv_sec;
+	  wait.tv_nsec = now.tv_usec * 1000;
+	  nanosleep (&wait, NULL);
+	}
+    }
+
+  signal (SIGINT, SIG_DFL);
+  signal (SIGTERM, SIG_DFL);
+
+  fbpool_destroy (pool);
+  free (reads);
+  for (i = 0; i < nspans; i++)
+    {
+      if (spanregs[i] != NULL)
+	{
+	  dlist_destroy (spanregs[i]);
+	  free (spanregs[i]);
+	}
+      free (last[i]);
     }
+  free (spanregs);
+  free (last);
+  return success;
 }
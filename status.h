@@ -9,14 +9,24 @@
    foneBRIDGE Status Definitions
 */
 
-FB_STATUS statusInitalize (libfb_t * f);
-void statusCleanup (void);
-void statusDisplay (void);
-bool statusHasDSP (void);
-bool statusIsIEC (void);
-unsigned int statusGetSpans (void);
-unsigned int statusGetTransceivers (void);
-DOOF_STATIC_INFO *status_get_dsi (void);
-bool statusRunPMON (libfb_t * fb);
+FB_STATUS statusInitalize (T_CONTEXT * ctx, libfb_t * f);
+FB_STATUS statusSnapshot (T_CONTEXT * ctx, libfb_t * f);
+FB_STATUS statusSaveSnapshot (T_CONTEXT * ctx, const char *path);
+FB_STATUS statusLoadSnapshot (T_CONTEXT * ctx, const char *path);
+void statusCleanup (T_CONTEXT * ctx);
+void statusDisplay (T_CONTEXT * ctx);
+bool statusHasDSP (T_CONTEXT * ctx);
+unsigned int statusGetDSPChannels (T_CONTEXT * ctx);
+bool statusIsIEC (T_CONTEXT * ctx);
+bool statusDsiIsIEC (DOOF_STATIC_INFO * dsi);
+unsigned int statusDsiDSPChannels (DOOF_STATIC_INFO * dsi);
+unsigned int statusGetSpans (T_CONTEXT * ctx);
+unsigned int statusGetTransceivers (T_CONTEXT * ctx);
+DOOF_STATIC_INFO *status_get_dsi (T_CONTEXT * ctx);
+bool statusRunPMON (T_CONTEXT * ctx, libfb_t * fb);
+FB_STATUS statusFetchPMON (T_CONTEXT * ctx, libfb_t * f, DList ** spanregs,
+			   int nspans, bool * fetched);
+bool statusSamplePMON (T_CONTEXT * ctx, libfb_t * fb, int interval);
+unsigned int statusRegisterValue (libfb_PMONRegister * reg);
 void statusPrintRegisters (DList * regs);
 void pmon_destroy (libfb_PMONRegister * reg);
@@ -0,0 +1,378 @@
+/*
+   fonulator 3 - foneBRIDGE configuration daemon
+   (C) 2005-2007 Redfone Communications, LLC.
+   www.red-fone.com
+
+   libfb Call Timing
+*/
+/** @file
+ *
+ * The fbt_*() wrappers through which fonulator calls libfb, and the
+ * per-command counts, errors, timeouts, retries and latency histograms
+ * they collect, printed at exit. Calls may be made from fbpool and
+ * fleet worker threads, so the statistics are kept under a mutex.
+ */
+#include "fonulator.h"
+
+#if defined(STDC_HEADERS) || defined(HAVE_STDLIB_H)
+# include <stdlib.h>
+#endif
+
+#include <pthread.h>
+
+extern int vbose;
+
+/** Histogram buckets: bucket i counts calls of 2^i to 2^(i+1) us */
+#define TIMING_BUCKETS 24
+
+/** Statistics slots: one per DOOF command for each of the two custom
+ * command calls, then one per other call */
+#define TIMING_SLOTS (2 * 256 + TIMING_KINDS - 2)
+
+/** Statistics of one command */
+typedef struct
+{
+  unsigned long calls;
+  unsigned long errors;		/**< Calls that did not succeed */
+  unsigned long timeouts;	/**< Calls that timed out */
+  unsigned long retries;	/**< Failed calls an fbpool resent */
+  double total;			/**< Seconds spent in all calls */
+  double max;			/**< Slowest call, in seconds */
+  unsigned long hist[TIMING_BUCKETS];
+}
+T_TIMING_STAT;
+
+/** True once --timing was given */
+bool timing_enabled = false;
+
+static T_TIMING_STAT timing_stats[TIMING_SLOTS];
+static pthread_mutex_t timing_lock = PTHREAD_MUTEX_INITIALIZER;
+
+/** The slot of the last call made by each thread, for timing_retry() */
+static __thread int timing_last = -1;
+
+/** The shim standing in for libfb on each thread, see fbt_set_shim() */
+static __thread fbt_shim timing_shim = NULL;
+
+static const char *timing_names[TIMING_KINDS] = {
+  "custom_cmd", "custom_cmd_reply", "udp_read_blk", "udp_write_to_blk",
+  "udp_start_blk_write", "udp_get_static_info", "configcheck_fb_udp",
+  "config_fb_udp_linkconfig", "writeidt", "libfb_readidt_pmon",
+  "libfb_updat_pmon", "ec_set_chantype"
+};
+
+/** @return the statistics slot of a call */
+static int
+timing_slot (TIMING_KIND kind, int sub)
+{
+  if (kind == TIMING_CUSTOM_CMD || kind == TIMING_CUSTOM_CMD_REPLY)
+    return kind * 256 + (sub & 0xFF);
+  return 2 * 256 + kind - 2;
+}
+
+/** @brief Start recording libfb calls and print them at exit */
+void
+timing_enable (void)
+{
+  if (timing_enabled)
+    return;
+  timing_enabled = true;
+  atexit (timing_dump);
+}
+
+/** @brief Note the time a libfb call is made at, if it is being timed */
+static void
+timing_start (struct timeval *start)
+{
+  if (timing_enabled)
+    gettimeofday (start, NULL);
+}
+
+/** @brief Record one completed libfb call
+ *
+ * @param kind the call
+ * @param sub the DOOF command for custom commands
+ * @param start when the call was made
+ * @param ret what the call returned
+ * @return ret
+ */
+static int
+timing_end (TIMING_KIND kind, int sub, struct timeval *start, int ret)
+{
+  struct timeval now;
+  double secs;
+  long usecs;
+  int bucket = 0, slot = timing_slot (kind, sub);
+  T_TIMING_STAT *t;
+
+  if (!timing_enabled)
+    return ret;
+
+  t = &timing_stats[slot];
+  gettimeofday (&now, NULL);
+  secs = (now.tv_sec - start->tv_sec) + (now.tv_usec - start->tv_usec) / 1e6;
+  for (usecs = secs * 1e6; usecs > 1 && bucket < TIMING_BUCKETS - 1;
+       usecs >>= 1)
+    bucket++;
+
+  pthread_mutex_lock (&timing_lock);
+  t->calls++;
+  if (ret != FBLIB_ESUCCESS)
+    t->errors++;
+  if (ret == FBLIB_ETIMEDOUT)
+    t->timeouts++;
+  t->total += secs;
+  if (secs > t->max)
+    t->max = secs;
+  t->hist[bucket]++;
+  pthread_mutex_unlock (&timing_lock);
+
+  timing_last = slot;
+  return ret;
+}
+
+/** @brief Note that the last call of this thread is being resent */
+void
+timing_retry (void)
+{
+  if (!timing_enabled || timing_last < 0)
+    return;
+
+  pthread_mutex_lock (&timing_lock);
+  timing_stats[timing_last].retries++;
+  pthread_mutex_unlock (&timing_lock);
+}
+
+/** @return the upper bound, in ms, of the bucket holding percentile p */
+static double
+timing_percentile (T_TIMING_STAT * t, double p)
+{
+  unsigned long seen = 0, want = t->calls * p + 0.5;
+  int i;
+
+  for (i = 0; i < TIMING_BUCKETS; i++)
+    {
+      seen += t->hist[i];
+      if (seen >= want && seen > 0)
+	break;
+    }
+  return (2L << i) / 1e3;
+}
+
+/** @brief Print the statistics of every command that was called
+ *
+ * Registered with atexit() by timing_enable(). Percentiles are the
+ * upper bound of their histogram bucket. With -vv the histograms are
+ * printed as well.
+ */
+void
+timing_dump (void)
+{
+  double grand = 0;
+  int slot, i;
+
+  pthread_mutex_lock (&timing_lock);
+
+  fprintf (stderr, "\n%-30s %6s %5s %5s %5s %9s %8s %8s %8s %8s\n",
+	   "Command", "Calls", "Err", "T/O", "Retry", "Total ms", "Avg ms",
+	   "p50 ms", "p99 ms", "Max ms");
+
+  for (slot = 0; slot < TIMING_SLOTS; slot++)
+    {
+      T_TIMING_STAT *t = &timing_stats[slot];
+      char name[40];
+
+      if (t->calls == 0)
+	continue;
+
+      if (slot < 2 * 256)
+	snprintf (name, sizeof (name), "%s 0x%02X", timing_names[slot / 256],
+		  slot % 256);
+      else
+	snprintf (name, sizeof (name), "%s", timing_names[slot - 2 * 256 + 2]);
+
+      fprintf (stderr,
+	       "%-30s %6lu %5lu %5lu %5lu %9.1f %8.2f %8.2f %8.2f %8.2f\n",
+	       name, t->calls, t->errors, t->timeouts, t->retries,
+	       t->total * 1e3, t->total * 1e3 / t->calls,
+	       timing_percentile (t, 0.5), timing_percentile (t, 0.99),
+	       t->max * 1e3);
+      grand += t->total;
+
+      if (vbose > 1)
+	{
+	  for (i = 0; i < TIMING_BUCKETS; i++)
+	    if (t->hist[i])
+	      fprintf (stderr, "%32s< %8.3f ms: %lu\n", "",
+		       (2L << i) / 1e3, t->hist[i]);
+	}
+    }
+
+  fprintf (stderr, "%-30s %30.1f\n", "Total time in libfb (ms)",
+	   grand * 1e3);
+
+  pthread_mutex_unlock (&timing_lock);
+}
+
+
+/** @brief Hand the libfb calls of this thread to a shim
+ *
+ * While a shim is installed the fbt_*() calls of the thread are
+ * passed to it in place of libfb, and are not timed.
+ *
+ * @param shim the shim, or NULL to call libfb again
+ */
+void
+fbt_set_shim (fbt_shim shim)
+{
+  timing_shim = shim;
+}
+
+/* The wrappers */
+
+int
+fbt_custom_cmd (libfb_t * f, int cmd, int param, char *data, int len)
+{
+  struct timeval start;
+
+  if (timing_shim != NULL)
+    return timing_shim ("custom_cmd", cmd, param, len);
+  timing_start (&start);
+  return timing_end (TIMING_CUSTOM_CMD, cmd, &start,
+		     custom_cmd (f, cmd, param, data, len));
+}
+
+int
+fbt_custom_cmd_reply (libfb_t * f, int cmd, int param, char *data, int len,
+		      char *reply, int reply_len)
+{
+  struct timeval start;
+
+  if (timing_shim != NULL)
+    return timing_shim ("custom_cmd_reply", cmd, param, len);
+  timing_start (&start);
+  return timing_end (TIMING_CUSTOM_CMD_REPLY, cmd, &start,
+		     custom_cmd_reply (f, cmd, param, data, len, reply,
+				       reply_len));
+}
+
+int
+fbt_udp_read_blk (libfb_t * f, uint32_t addr, uint16_t len, uint8_t * buffer)
+{
+  struct timeval start;
+
+  if (timing_shim != NULL)
+    return timing_shim ("udp_read_blk", -1, addr, len);
+  timing_start (&start);
+  return timing_end (TIMING_READ_BLK, 0, &start,
+		     udp_read_blk (f, addr, len, buffer));
+}
+
+int
+fbt_udp_write_to_blk (libfb_t * f, uint32_t offset, uint16_t len,
+		      uint8_t * data)
+{
+  struct timeval start;
+
+  if (timing_shim != NULL)
+    return timing_shim ("udp_write_to_blk", -1, offset, len);
+  timing_start (&start);
+  return timing_end (TIMING_WRITE_TO_BLK, 0, &start,
+		     udp_write_to_blk (f, offset, len, data));
+}
+
+int
+fbt_udp_start_blk_write (libfb_t * f, uint32_t blk)
+{
+  struct timeval start;
+
+  if (timing_shim != NULL)
+    return timing_shim ("udp_start_blk_write", -1, blk, 0);
+  timing_start (&start);
+  return timing_end (TIMING_START_BLK_WRITE, 0, &start,
+		     udp_start_blk_write (f, blk));
+}
+
+int
+fbt_udp_get_static_info (libfb_t * f, DOOF_STATIC_INFO * dsi)
+{
+  struct timeval start;
+
+  if (timing_shim != NULL)
+    return timing_shim ("udp_get_static_info", -1, 0, 0);
+  timing_start (&start);
+  return timing_end (TIMING_STATIC_INFO, 0, &start,
+		     udp_get_static_info (f, dsi));
+}
+
+int
+fbt_configcheck_fb_udp (libfb_t * f, IDT_LINK_CONFIG * links)
+{
+  struct timeval start;
+
+  if (timing_shim != NULL)
+    return timing_shim ("configcheck_fb_udp", -1, 0, 0);
+  timing_start (&start);
+  return timing_end (TIMING_CONFIGCHECK, 0, &start,
+		     configcheck_fb_udp (f, links));
+}
+
+int
+fbt_config_fb_udp_linkconfig (libfb_t * f, IDT_LINK_CONFIG * links)
+{
+  struct timeval start;
+
+  if (timing_shim != NULL)
+    return timing_shim ("config_fb_udp_linkconfig", -1, 0, 0);
+  timing_start (&start);
+  return timing_end (TIMING_LINKCONFIG, 0, &start,
+		     config_fb_udp_linkconfig (f, links));
+}
+
+int
+fbt_writeidt (libfb_t * f, int link, int reg, int val)
+{
+  struct timeval start;
+
+  if (timing_shim != NULL)
+    return timing_shim ("writeidt", -1, link, 0);
+  timing_start (&start);
+  return timing_end (TIMING_WRITEIDT, 0, &start,
+		     writeidt (f, link, reg, val));
+}
+
+int
+fbt_readidt_pmon (libfb_t * f, int span, int addr, uint8_t * data)
+{
+  struct timeval start;
+
+  if (timing_shim != NULL)
+    return timing_shim ("libfb_readidt_pmon", -1, span, 0);
+  timing_start (&start);
+  return timing_end (TIMING_READIDT_PMON, 0, &start,
+		     libfb_readidt_pmon (f, span, addr, data));
+}
+
+int
+fbt_updat_pmon (libfb_t * f, int span)
+{
+  struct timeval start;
+
+  if (timing_shim != NULL)
+    return timing_shim ("libfb_updat_pmon", -1, span, 0);
+  timing_start (&start);
+  return timing_end (TIMING_UPDAT_PMON, 0, &start,
+		     libfb_updat_pmon (f, span));
+}
+
+int
+fbt_ec_set_chantype (libfb_t * f, int mode, uint32_t * mask)
+{
+  struct timeval start;
+
+  if (timing_shim != NULL)
+    return timing_shim ("ec_set_chantype", -1, mode, 0);
+  timing_start (&start);
+  return timing_end (TIMING_EC_CHANTYPE, 0, &start,
+		     ec_set_chantype (f, mode, mask));
+}
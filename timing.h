@@ -0,0 +1,71 @@
+/*
+   fonulator 3 - foneBRIDGE configuration daemon
+   (C) 2005-2007 Redfone Communications, LLC.
+   www.red-fone.com
+
+   libfb Call Timing
+*/
+/** @file
+ *
+ * Latency instrumentation of the libfb calls. fonulator makes each of
+ * the libfb calls below through its fbt_*() wrapper in timing.c, which
+ * records the call when --timing is given and costs a single test
+ * otherwise. custom_cmd() and custom_cmd_reply() are further split by
+ * DOOF command.
+ *
+ * A thread may install a shim that receives its calls in place of
+ * libfb, as the planner of plan.c does to record them.
+ */
+#ifndef TIMING_H
+#define TIMING_H
+
+#include <sys/time.h>
+
+/** @enum TIMING_KIND
+ *
+ * The instrumented libfb calls
+ */
+typedef enum
+{ TIMING_CUSTOM_CMD = 0, TIMING_CUSTOM_CMD_REPLY, TIMING_READ_BLK,
+  TIMING_WRITE_TO_BLK, TIMING_START_BLK_WRITE, TIMING_STATIC_INFO,
+  TIMING_CONFIGCHECK, TIMING_LINKCONFIG, TIMING_WRITEIDT,
+  TIMING_READIDT_PMON, TIMING_UPDAT_PMON, TIMING_EC_CHANTYPE,
+  TIMING_KINDS
+}
+TIMING_KIND;
+
+/** @brief Stand-in for libfb behind the fbt_*() calls of one thread
+ *
+ * @param call the name of the libfb function called
+ * @param cmd the DOOF command of a custom command, otherwise -1
+ * @param param the command parameter, or the address, block, link,
+ *              span or mode the call is made for
+ * @param len the bytes of data handed to the call
+ * @return what the call returns
+ */
+typedef int (*fbt_shim) (const char *call, int cmd, int param, int len);
+
+extern bool timing_enabled;
+
+void timing_enable (void);
+void timing_retry (void);
+void timing_dump (void);
+void fbt_set_shim (fbt_shim shim);
+
+int fbt_custom_cmd (libfb_t * f, int cmd, int param, char *data, int len);
+int fbt_custom_cmd_reply (libfb_t * f, int cmd, int param, char *data,
+			  int len, char *reply, int reply_len);
+int fbt_udp_read_blk (libfb_t * f, uint32_t addr, uint16_t len,
+		      uint8_t * buffer);
+int fbt_udp_write_to_blk (libfb_t * f, uint32_t offset, uint16_t len,
+			  uint8_t * data);
+int fbt_udp_start_blk_write (libfb_t * f, uint32_t blk);
+int fbt_udp_get_static_info (libfb_t * f, DOOF_STATIC_INFO * dsi);
+int fbt_configcheck_fb_udp (libfb_t * f, IDT_LINK_CONFIG * links);
+int fbt_config_fb_udp_linkconfig (libfb_t * f, IDT_LINK_CONFIG * links);
+int fbt_writeidt (libfb_t * f, int link, int reg, int val);
+int fbt_readidt_pmon (libfb_t * f, int span, int addr, uint8_t * data);
+int fbt_updat_pmon (libfb_t * f, int span);
+int fbt_ec_set_chantype (libfb_t * f, int mode, uint32_t * mask);
+
+#endif
@@ -1,8634 +0,0 @@
-
-#line 3 "tokens.c"
-
-#define  YY_INT_ALIGNED short int
-
-/* A lexical scanner generated by flex */
-
-#define FLEX_SCANNER
-#define YY_FLEX_MAJOR_VERSION 2
-#define YY_FLEX_MINOR_VERSION 5
-#define YY_FLEX_SUBMINOR_VERSION 35
-#if YY_FLEX_SUBMINOR_VERSION > 0
-#define FLEX_BETA
-#endif
-
-/* First, we deal with  platform-specific or compiler-specific issues. */
-
-/* begin standard C headers. */
-#include <stdio.h>
-#include <string.h>
-#include <errno.h>
-#include <stdlib.h>
-
-/* end standard C headers. */
-
-/* flex integer type definitions */
-
-#ifndef FLEXINT_H
-#define FLEXINT_H
-
-/* C99 systems have <inttypes.h>. Non-C99 systems may or may not. */
-
-#if defined (__STDC_VERSION__) && __STDC_VERSION__ >= 199901L
-
-/* C99 says to define __STDC_LIMIT_MACROS before including stdint.h,
- * if you want the limit (max/min) macros for int types. 
- */
-#ifndef __STDC_LIMIT_MACROS
-#define __STDC_LIMIT_MACROS 1
-#endif
-
-#include <inttypes.h>
-typedef int8_t flex_int8_t;
-typedef uint8_t flex_uint8_t;
-typedef int16_t flex_int16_t;
-typedef uint16_t flex_uint16_t;
-typedef int32_t flex_int32_t;
-typedef uint32_t flex_uint32_t;
-#else
-typedef signed char flex_int8_t;
-typedef short int flex_int16_t;
-typedef int flex_int32_t;
-typedef unsigned char flex_uint8_t; 
-typedef unsigned short int flex_uint16_t;
-typedef unsigned int flex_uint32_t;
-#endif /* ! C99 */
-
-/* Limits of integral types. */
-#ifndef INT8_MIN
-#define INT8_MIN               (-128)
-#endif
-#ifndef INT16_MIN
-#define INT16_MIN              (-32767-1)
-#endif
-#ifndef INT32_MIN
-#define INT32_MIN              (-2147483647-1)
-#endif
-#ifndef INT8_MAX
-#define INT8_MAX               (127)
-#endif
-#ifndef INT16_MAX
-#define INT16_MAX              (32767)
-#endif
-#ifndef INT32_MAX
-#define INT32_MAX              (2147483647)
-#endif
-#ifndef UINT8_MAX
-#define UINT8_MAX              (255U)
-#endif
-#ifndef UINT16_MAX
-#define UINT16_MAX             (65535U)
-#endif
-#ifndef UINT32_MAX
-#define UINT32_MAX             (4294967295U)
-#endif
-
-#endif /* ! FLEXINT_H */
-
-#ifdef __cplusplus
-
-/* The "const" storage-class-modifier is valid. */
-#define YY_USE_CONST
-
-#else	/* ! __cplusplus */
-
-/* C99 requires __STDC__ to be defined as 1. */
-#if defined (__STDC__)
-
-#define YY_USE_CONST
-
-#endif	/* defined (__STDC__) */
-#endif	/* ! __cplusplus */
-
-#ifdef YY_USE_CONST
-#define yyconst const
-#else
-#define yyconst
-#endif
-
-/* Returned upon end-of-file. */
-#define YY_NULL 0
-
-/* Promotes a possibly negative, possibly signed char to an unsigned
- * integer for use as an array index.  If the signed char is negative,
- * we want to instead treat it as an 8-bit unsigned char, hence the
- * double cast.
- */
-#define YY_SC_TO_UI(c) ((unsigned int) (unsigned char) c)
-
-/* Enter a start condition.  This macro really ought to take a parameter,
- * but we do it the disgusting crufty way forced on us by the ()-less
- * definition of BEGIN.
- */
-#define BEGIN (yy_start) = 1 + 2 *
-
-/* Translate the current start state into a value that can be later handed
- * to BEGIN to return to the state.  The YYSTATE alias is for lex
- * compatibility.
- */
-#define YY_START (((yy_start) - 1) / 2)
-#define YYSTATE YY_START
-
-/* Action number for EOF rule of a given start state. */
-#define YY_STATE_EOF(state) (YY_END_OF_BUFFER + state + 1)
-
-/* Special action meaning "start processing a new file". */
-#define YY_NEW_FILE yyrestart(yyin  )
-
-#define YY_END_OF_BUFFER_CHAR 0
-
-/* Size of default input buffer. */
-#ifndef YY_BUF_SIZE
-#define YY_BUF_SIZE 16384
-#endif
-
-/* The state buf must be large enough to hold one state per character in the main buffer.
- */
-#define YY_STATE_BUF_SIZE   ((YY_BUF_SIZE + 2) * sizeof(yy_state_type))
-
-#ifndef YY_TYPEDEF_YY_BUFFER_STATE
-#define YY_TYPEDEF_YY_BUFFER_STATE
-typedef struct yy_buffer_state *YY_BUFFER_STATE;
-#endif
-
-extern int yyleng;
-
-extern FILE *yyin, *yyout;
-
-#define EOB_ACT_CONTINUE_SCAN 0
-#define EOB_ACT_END_OF_FILE 1
-#define EOB_ACT_LAST_MATCH 2
-
-    /* Note: We specifically omit the test for yy_rule_can_match_eol because it requires
-     *       access to the local variable yy_act. Since yyless() is a macro, it would break
-     *       existing scanners that call yyless() from OUTSIDE yylex. 
-     *       One obvious solution it to make yy_act a global. I tried that, and saw
-     *       a 5% performance hit in a non-yylineno scanner, because yy_act is
-     *       normally declared as a register variable-- so it is not worth it.
-     */
-    #define  YY_LESS_LINENO(n) \
-            do { \
-                int yyl;\
-                for ( yyl = n; yyl < yyleng; ++yyl )\
-                    if ( yytext[yyl] == '\n' )\
-                        --yylineno;\
-            }while(0)
-    
-/* Return all but the first "n" matched characters back to the input stream. */
-#define yyless(n) \
-	do \
-		{ \
-		/* Undo effects of setting up yytext. */ \
-        int yyless_macro_arg = (n); \
-        YY_LESS_LINENO(yyless_macro_arg);\
-		*yy_cp = (yy_hold_char); \
-		YY_RESTORE_YY_MORE_OFFSET \
-		(yy_c_buf_p) = yy_cp = yy_bp + yyless_macro_arg - YY_MORE_ADJ; \
-		YY_DO_BEFORE_ACTION; /* set up yytext again */ \
-		} \
-	while ( 0 )
-
-#define unput(c) yyunput( c, (yytext_ptr)  )
-
-#ifndef YY_TYPEDEF_YY_SIZE_T
-#define YY_TYPEDEF_YY_SIZE_T
-typedef size_t yy_size_t;
-#endif
-
-#ifndef YY_STRUCT_YY_BUFFER_STATE
-#define YY_STRUCT_YY_BUFFER_STATE
-struct yy_buffer_state
-	{
-	FILE *yy_input_file;
-
-	char *yy_ch_buf;		/* input buffer */
-	char *yy_buf_pos;		/* current position in input buffer */
-
-	/* Size of input buffer in bytes, not including room for EOB
-	 * characters.
-	 */
-	yy_size_t yy_buf_size;
-
-	/* Number of characters read into yy_ch_buf, not including EOB
-	 * characters.
-	 */
-	int yy_n_chars;
-
-	/* Whether we "own" the buffer - i.e., we know we created it,
-	 * and can realloc() it to grow it, and should free() it to
-	 * delete it.
-	 */
-	int yy_is_our_buffer;
-
-	/* Whether this is an "interactive" input source; if so, and
-	 * if we're using stdio for input, then we want to use getc()
-	 * instead of fread(), to make sure we stop fetching input after
-	 * each newline.
-	 */
-	int yy_is_interactive;
-
-	/* Whether we're considered to be at the beginning of a line.
-	 * If so, '^' rules will be active on the next match, otherwise
-	 * not.
-	 */
-	int yy_at_bol;
-
-    int yy_bs_lineno; /**< The line count. */
-    int yy_bs_column; /**< The column count. */
-    
-	/* Whether to try to fill the input buffer when we reach the
-	 * end of it.
-	 */
-	int yy_fill_buffer;
-
-	int yy_buffer_status;
-
-#define YY_BUFFER_NEW 0
-#define YY_BUFFER_NORMAL 1
-	/* When an EOF's been seen but there's still some text to process
-	 * then we mark the buffer as YY_EOF_PENDING, to indicate that we
-	 * shouldn't try reading from the input source any more.  We might
-	 * still have a bunch of tokens to match, though, because of
-	 * possible backing-up.
-	 *
-	 * When we actually see the EOF, we change the status to "new"
-	 * (via yyrestart()), so that the user can continue scanning by
-	 * just pointing yyin at a new input file.
-	 */
-#define YY_BUFFER_EOF_PENDING 2
-
-	};
-#endif /* !YY_STRUCT_YY_BUFFER_STATE */
-
-/* Stack of input buffers. */
-static size_t yy_buffer_stack_top = 0; /**< index of top of stack. */
-static size_t yy_buffer_stack_max = 0; /**< capacity of stack. */
-static YY_BUFFER_STATE * yy_buffer_stack = 0; /**< Stack as an array. */
-
-/* We provide macros for accessing buffer states in case in the
- * future we want to put the buffer states in a more general
- * "scanner state".
- *
- * Returns the top of the stack, or NULL.
- */
-#define YY_CURRENT_BUFFER ( (yy_buffer_stack) \
-                          ? (yy_buffer_stack)[(yy_buffer_stack_top)] \
-                          : NULL)
-
-/* Same as previous macro, but useful when we know that the buffer stack is not
- * NULL or when we need an lvalue. For internal use only.
- */
-#define YY_CURRENT_BUFFER_LVALUE (yy_buffer_stack)[(yy_buffer_stack_top)]
-
-/* yy_hold_char holds the character lost when yytext is formed. */
-static char yy_hold_char;
-static int yy_n_chars;		/* number of characters read into yy_ch_buf */
-int yyleng;
-
-/* Points to current character in buffer. */
-static char *yy_c_buf_p = (char *) 0;
-static int yy_init = 0;		/* whether we need to initialize */
-static int yy_start = 0;	/* start state number */
-
-/* Flag which is used to allow yywrap()'s to do buffer switches
- * instead of setting up a fresh yyin.  A bit of a hack ...
- */
-static int yy_did_buffer_switch_on_eof;
-
-void yyrestart (FILE *input_file  );
-void yy_switch_to_buffer (YY_BUFFER_STATE new_buffer  );
-YY_BUFFER_STATE yy_create_buffer (FILE *file,int size  );
-void yy_delete_buffer (YY_BUFFER_STATE b  );
-void yy_flush_buffer (YY_BUFFER_STATE b  );
-void yypush_buffer_state (YY_BUFFER_STATE new_buffer  );
-void yypop_buffer_state (void );
-
-static void yyensure_buffer_stack (void );
-static void yy_load_buffer_state (void );
-static void yy_init_buffer (YY_BUFFER_STATE b,FILE *file  );
-
-#define YY_FLUSH_BUFFER yy_flush_buffer(YY_CURRENT_BUFFER )
-
-YY_BUFFER_STATE yy_scan_buffer (char *base,yy_size_t size  );
-YY_BUFFER_STATE yy_scan_string (yyconst char *yy_str  );
-YY_BUFFER_STATE yy_scan_bytes (yyconst char *bytes,int len  );
-
-void *yyalloc (yy_size_t  );
-void *yyrealloc (void *,yy_size_t  );
-void yyfree (void *  );
-
-#define yy_new_buffer yy_create_buffer
-
-#define yy_set_interactive(is_interactive) \
-	{ \
-	if ( ! YY_CURRENT_BUFFER ){ \
-        yyensure_buffer_stack (); \
-		YY_CURRENT_BUFFER_LVALUE =    \
-            yy_create_buffer(yyin,YY_BUF_SIZE ); \
-	} \
-	YY_CURRENT_BUFFER_LVALUE->yy_is_interactive = is_interactive; \
-	}
-
-#define yy_set_bol(at_bol) \
-	{ \
-	if ( ! YY_CURRENT_BUFFER ){\
-        yyensure_buffer_stack (); \
-		YY_CURRENT_BUFFER_LVALUE =    \
-            yy_create_buffer(yyin,YY_BUF_SIZE ); \
-	} \
-	YY_CURRENT_BUFFER_LVALUE->yy_at_bol = at_bol; \
-	}
-
-#define YY_AT_BOL() (YY_CURRENT_BUFFER_LVALUE->yy_at_bol)
-
-/* Begin user sect3 */
-
-#define yywrap(n) 1
-#define YY_SKIP_YYWRAP
-
-typedef unsigned char YY_CHAR;
-
-FILE *yyin = (FILE *) 0, *yyout = (FILE *) 0;
-
-typedef int yy_state_type;
-
-extern int yylineno;
-
-int yylineno = 1;
-
-extern char *yytext;
-#define yytext_ptr yytext
-
-static yy_state_type yy_get_previous_state (void );
-static yy_state_type yy_try_NUL_trans (yy_state_type current_state  );
-static int yy_get_next_buffer (void );
-static void yy_fatal_error (yyconst char msg[]  );
-
-/* Done after the current pattern has been matched and before the
- * corresponding action - sets up yytext.
- */
-#define YY_DO_BEFORE_ACTION \
-	(yytext_ptr) = yy_bp; \
-	yyleng = (size_t) (yy_cp - yy_bp); \
-	(yy_hold_char) = *yy_cp; \
-	*yy_cp = '\0'; \
-	(yy_c_buf_p) = yy_cp;
-
-#define YY_NUM_RULES 37
-#define YY_END_OF_BUFFER 38
-/* This struct is not used in this scanner,
-   but its presence is necessary. */
-struct yy_trans_info
-	{
-	flex_int32_t yy_verify;
-	flex_int32_t yy_nxt;
-	};
-static yyconst flex_int16_t yy_accept[1676] =
-    {   0,
-        0,    0,    0,    0,   38,   36,   35,   35,   36,   36,
-        1,   36,   36,   36,   36,   36,   36,   36,   36,   36,
-       36,   36,   36,   36,   36,   36,   36,   36,   35,   36,
-       36,   36,   36,   34,    1,   36,   36,   36,   36,   36,
-       36,   36,   36,   36,   36,   36,   36,   36,   36,   36,
-       36,   35,   30,    0,    0,    0,    1,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,   35,    0,    0,    0,    0,
-        0,    1,    1,    1,    0,    0,    0,    0,    0,    0,
-
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,   15,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    1,    1,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,   29,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    8,    0,    0,    0,    0,
-
-        0,   17,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    1,    1,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,   16,   27,
-        0,    0,    0,    0,    0,    0,    7,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    1,    1,    0,    0,    0,    0,
-        0,   27,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,   19,    0,    0,    0,   24,    0,    0,    0,
-        0,    0,    1,    1,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,   12,    0,    0,    0,    0,    0,
-        0,   20,    6,    0,    0,    0,   25,   26,    0,    0,
-        0,    0,    0,    0,    1,    1,    0,    0,    0,    0,
-        0,    0,   12,    0,    0,    0,    0,    0,    0,    0,
-
-        0,    0,    0,    0,   25,   26,    0,    0,    0,    0,
-       14,    0,    0,    0,   12,   12,    0,    0,    0,    0,
-        0,    0,    0,    0,    5,    0,    3,    0,    0,    0,
-        1,    1,    0,    0,    0,    0,   12,   12,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,   23,    0,    0,    0,    0,    0,    0,   18,
-        0,    0,    0,    0,    0,    0,    0,    1,    1,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    2,    0,    0,
-
-        0,    1,    1,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,   31,    0,
-        0,    0,    0,    0,    0,    0,    0,    9,   21,    0,
-        0,    0,    0,   31,    0,    1,    1,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,   28,    0,    0,    0,    0,    0,   22,    0,
-        0,    1,    1,    0,    0,    0,    0,    0,    0,    0,
-        0,   10,    0,    0,    0,    0,    0,    0,    1,    1,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,   32,    0,    1,    1,    1,    0,    0,    0,    0,
-
-        0,    0,    0,    0,    0,    0,    0,    1,    1,    1,
-        1,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    1,    1,    1,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    1,    1,    1,    0,    0,    0,
-        0,    0,   13,    4,    0,    0,    0,    0,    0,    1,
-        1,    1,    4,    0,    0,    0,    0,   33,    0,    0,
-        0,    1,    1,    1,    1,    0,    0,    0,    0,    0,
-        0,    1,    1,    1,    1,    1,    0,    0,    0,    0,
-        0,    0,    0,    1,    1,    1,    1,    0,    0,    0,
-        0,    0,    0,    0,    1,    1,    1,    1,    0,    0,
-
-        0,    0,    0,    0,    1,    1,    1,    1,    0,    0,
-        0,    0,    0,    0,    0,    1,    1,    1,    1,    0,
-        0,   11,    0,    0,    0,    0,    1,    1,    1,    1,
-        0,    0,    0,    0,    1,    1,    1,    1,    0,    0,
-        0,    0,    1,    1,    1,    1,    0,    0,    0,    0,
-        1,    1,    1,    1,    0,    0,    0,    0,    1,    1,
-        1,    1,    0,    0,    0,    0,    1,    1,    1,    1,
-        0,    0,    0,    0,    1,    1,    1,    1,    0,    0,
-        0,    0,    1,    1,    1,    1,    0,    0,    0,    0,
-        1,    1,    1,    1,    0,    0,    0,    0,    1,    1,
-
-        1,    1,    0,    0,    0,    0,    1,    1,    1,    1,
-        0,    0,    0,    0,    1,    1,    1,    1,    0,    0,
-        0,    0,    1,    1,    1,    1,    0,    0,    0,    0,
-        1,    1,    1,    1,    0,    0,    0,    0,    1,    1,
-        1,    1,    0,    0,    0,    0,    1,    1,    1,    1,
-        0,    0,    0,    0,    1,    1,    1,    1,    0,    0,
-        0,    0,    1,    1,    1,    1,    0,    0,    0,    0,
-        1,    1,    1,    1,    0,    0,    0,    0,    1,    1,
-        1,    1,    0,    0,    0,    0,    1,    1,    1,    1,
-        0,    0,    0,    0,    1,    1,    1,    1,    0,    0,
-
-        0,    0,    1,    1,    1,    1,    0,    0,    0,    0,
-        1,    1,    1,    1,    0,    0,    0,    0,    1,    1,
-        1,    1,    0,    0,    0,    0,    1,    1,    1,    1,
-        0,    0,    0,    0,    1,    1,    1,    1,    0,    0,
-        0,    0,    1,    1,    1,    1,    0,    0,    0,    0,
-        1,    1,    1,    1,    0,    0,    0,    0,    1,    1,
-        1,    1,    0,    0,    0,    0,    1,    1,    1,    1,
-        0,    0,    0,    0,    1,    1,    1,    1,    0,    0,
-        0,    0,    1,    1,    1,    1,    0,    0,    0,    0,
-        1,    1,    1,    1,    0,    0,    0,    0,    1,    1,
-
-        1,    1,    0,    0,    0,    0,    1,    1,    1,    1,
-        0,    0,    0,    0,    1,    1,    1,    1,    0,    0,
-        0,    0,    1,    1,    1,    1,    0,    0,    0,    0,
-        1,    1,    1,    1,    0,    0,    0,    0,    1,    1,
-        1,    1,    0,    0,    0,    0,    1,    1,    1,    1,
-        0,    0,    0,    0,    1,    1,    1,    1,    0,    0,
-        0,    0,    1,    1,    1,    1,    0,    0,    0,    0,
-        1,    1,    1,    1,    0,    0,    0,    0,    1,    1,
-        1,    1,    0,    0,    0,    0,    1,    1,    1,    1,
-        0,    0,    0,    0,    1,    1,    1,    1,    0,    0,
-
-        0,    0,    1,    1,    1,    1,    0,    0,    0,    0,
-        1,    1,    1,    1,    0,    0,    0,    0,    1,    1,
-        1,    1,    0,    0,    0,    0,    1,    1,    1,    1,
-        0,    0,    0,    0,    1,    1,    1,    1,    0,    0,
-        0,    0,    1,    1,    1,    1,    0,    0,    0,    0,
-        1,    1,    1,    1,    0,    0,    0,    0,    1,    1,
-        1,    1,    0,    0,    0,    0,    1,    1,    1,    1,
-        0,    0,    0,    0,    1,    1,    1,    1,    0,    0,
-        0,    0,    1,    1,    1,    1,    0,    0,    0,    0,
-        1,    1,    1,    1,    0,    0,    0,    0,    1,    1,
-
-        1,    1,    0,    0,    0,    0,    1,    1,    1,    1,
-        0,    0,    0,    0,    1,    1,    1,    1,    0,    0,
-        0,    0,    1,    1,    1,    1,    0,    0,    0,    0,
-        1,    1,    1,    1,    0,    0,    0,    0,    1,    1,
-        1,    1,    0,    0,    0,    0,    1,    1,    1,    1,
-        0,    0,    0,    0,    1,    1,    1,    1,    0,    0,
-        0,    0,    1,    1,    1,    1,    0,    0,    0,    0,
-        1,    1,    1,    1,    0,    0,    0,    0,    1,    1,
-        1,    1,    0,    0,    0,    0,    1,    1,    1,    1,
-        0,    0,    0,    0,    1,    1,    1,    1,    0,    0,
-
-        0,    0,    1,    1,    1,    1,    0,    0,    0,    0,
-        1,    1,    1,    1,    0,    0,    0,    0,    1,    1,
-        1,    1,    0,    0,    0,    0,    1,    1,    1,    1,
-        0,    0,    0,    0,    1,    1,    1,    1,    0,    0,
-        0,    0,    1,    1,    1,    1,    0,    0,    0,    0,
-        1,    1,    1,    1,    0,    0,    0,    0,    1,    1,
-        1,    1,    0,    0,    0,    0,    1,    1,    1,    1,
-        0,    0,    0,    0,    1,    1,    1,    1,    0,    0,
-        0,    0,    1,    1,    1,    1,    0,    0,    0,    0,
-        1,    1,    1,    1,    0,    0,    0,    0,    1,    1,
-
-        1,    1,    0,    0,    0,    0,    1,    1,    1,    1,
-        0,    0,    0,    0,    1,    1,    1,    1,    0,    0,
-        0,    0,    1,    1,    1,    1,    0,    0,    0,    0,
-        1,    1,    1,    1,    0,    0,    0,    0,    1,    1,
-        1,    1,    0,    0,    0,    0,    1,    1,    1,    1,
-        0,    0,    0,    0,    1,    1,    1,    1,    0,    0,
-        0,    0,    1,    1,    1,    1,    0,    0,    0,    0,
-        1,    1,    1,    1,    0,    0,    0,    0,    1,    1,
-        1,    1,    0,    0,    0,    0,    1,    1,    1,    1,
-        0,    0,    0,    0,    1,    1,    1,    1,    0,    0,
-
-        0,    0,    1,    1,    1,    1,    0,    0,    0,    0,
-        1,    1,    1,    1,    0,    0,    0,    0,    1,    1,
-        1,    1,    0,    0,    0,    0,    1,    1,    1,    1,
-        0,    0,    0,    0,    1,    1,    1,    1,    0,    0,
-        0,    0,    1,    1,    1,    1,    0,    0,    0,    0,
-        1,    1,    1,    1,    0,    0,    0,    0,    1,    1,
-        1,    1,    0,    0,    0,    0,    1,    1,    1,    1,
-        0,    0,    0,    0,    1,    1,    1,    1,    0,    0,
-        0,    0,    1,    1,    1,    1,    0,    0,    0,    0,
-        1,    1,    1,    1,    0,    0,    0,    0,    1,    1,
-
-        1,    1,    0,    0,    0,    0,    1,    1,    1,    1,
-        0,    0,    0,    0,    1,    1,    1,    1,    0,    0,
-        0,    0,    1,    1,    1,    1,    0,    0,    0,    0,
-        1,    1,    1,    1,    0,    0,    0,    0,    1,    1,
-        1,    1,    0,    0,    0,    0,    1,    1,    1,    1,
-        0,    0,    1,    1,    1,    1,    0,    0,    1,    1,
-        0,    0,    1,    1,    0,    0,    1,    1,    0,    0,
-        1,    1,    1,    1,    0
-    } ;
-
-static yyconst flex_int32_t yy_ec[256] =
-    {   0,
-        1,    1,    1,    1,    1,    1,    1,    1,    2,    3,
-        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-        1,    4,    1,    1,    5,    1,    1,    1,    1,    1,
-        1,    1,    1,    6,    7,    8,    1,    9,   10,   11,
-       12,   13,   14,   14,   14,   15,   14,   16,   17,    1,
-       18,    1,    1,    1,   19,   20,   21,   22,   23,   24,
-       25,   26,   27,   28,   29,   30,   31,   32,   33,   34,
-       35,   36,   37,   38,   39,   40,   41,   42,   43,   44,
-       45,    1,   46,    1,   47,    1,   48,   49,   50,   51,
-
-       52,   53,   54,   55,   56,   57,   58,   59,   60,   61,
-       62,   63,   35,   64,   65,   66,   67,   68,   69,   42,
-       70,   71,   72,    1,   73,    1,    1,    1,    1,    1,
-        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-
-        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-        1,    1,    1,    1,    1
-    } ;
-
-static yyconst flex_int32_t yy_meta[74] =
-    {   0,
-        1,    1,    2,    1,    1,    1,    3,    4,    5,    5,
-        5,    5,    5,    5,    5,    3,    1,    1,    6,    6,
-        6,    6,    6,    6,    7,    7,    7,    7,    7,    7,
-        7,    7,    7,    7,    7,    7,    7,    7,    7,    7,
-        7,    7,    7,    7,    1,    1,    1,    6,    6,    6,
-        6,    6,    6,    7,    7,    7,    7,    7,    7,    7,
-        7,    7,    7,    7,    7,    7,    7,    7,    7,    7,
-        7,    1,    1
-    } ;
-
-static yyconst flex_int16_t yy_base[1707] =
-    {   0,
-        0,   58,  130,  203,  843,27370,    3,   14,   21,    0,
-        0,  274,    0,   99,  127,  104,  117,    2,  832,  114,
-        0,  121,    0,  132,  115,  115,  277,  269,  308,  371,
-      270,  325,  271,  322,  326,  434,  386,  497,  562,  494,
-      386,  438,  513,  431,  495,  547,  517,  565,  571,  566,
-      597,   35,27370,   31,  187,  235,    0,  159,  348,   40,
-        0,  350,  403,  126,    1,  297,    7,  282,  838,  306,
-      279,  297,  313,  342,  366,  308,  384,  377,  381,  402,
-      432,  429,  602,  604,  605,  642,  699,  762,  616,  635,
-      653,  639,  656,  695,  819,  882,  730,  731,  698,  771,
-
-      798,  817,  729,  850,  851,  881,  883,  889,  887,  891,
-      908,  888,  938,  928,  947,  942,  946,  949,  980,  985,
-     1043,  760, 1051, 1014, 1064,    0,  793,  446,  439,  451,
-      439,    0,  458,  801,27370,  473,  481,  459,  481,  487,
-      800,  484,  492,  489,  501,  598,  598,  625,  640, 1077,
-     1073, 1062, 1076, 1079, 1084, 1147, 1155, 1173, 1184, 1188,
-     1083, 1189, 1193, 1198, 1265, 1087, 1197, 1192, 1240, 1254,
-     1257, 1264, 1295, 1259, 1297, 1315, 1191, 1314, 1319, 1337,
-     1338,27370,  642, 1380, 1396, 1409,  799,  798,  782,  492,
-     1394,  641,  651,  741,  671,27370,  673,  681,  701,  724,
-
-      526,27370,  703,  541,  706,  710,  723,  695,  737,  727,
-     1364, 1394, 1404, 1415, 1426, 1484, 1547, 1561, 1474, 1498,
-     1479, 1501, 1502, 1558, 1565, 1481, 1630,  722,  752, 1618,
-     1623, 1620, 1483, 1606, 1629, 1661, 1668, 1678, 1686, 1557,
-     1695, 1700, 1725,  752, 1758,  732, 1782,  145,27370,27370,
-      752,  761,  769,  780,  760,  788,27370,  784,  798,  804,
-      813,  269,  797,  814,  879,  736,  894,  883,  714,  892,
-     1767, 1698, 1767, 1779, 1781, 1786, 1849, 1803, 1866, 1805,
-     1876, 1851, 1868, 1870, 1872, 1873, 1874, 1909,  907,  927,
-     1910, 1929, 1930, 1919, 1951, 1931, 1949, 1971, 1970, 1990,
-
-     1969, 2009, 2004, 2066,  919, 2051, 2080,    0,  939,  952,
-      963,  985,  989,  981,  993,  982, 1019,  693,  680, 1030,
-      662, 1022,27370,  632,  631, 1077,27370, 1076,  592, 2021,
-     2046, 2076, 2078, 2080, 2137, 2200, 2208, 2116, 2123, 2133,
-     2205, 2214, 1968, 1077, 1087, 2140, 2204, 2035, 2119, 2231,
-     2228, 2141, 2226, 2262, 2264, 2263, 2265, 2271, 1109, 2328,
-      598,    0, 1185, 1181,27370, 1182, 1102, 1234,  583, 1249,
-     1288,27370,27370, 1294,    0, 1185,27370,27370,  591, 1203,
-      590, 2268, 2298, 2340, 2328, 2331, 2403, 2337, 2411, 1261,
-     2333, 2334, 2329, 2335, 2407, 2415, 1306,  506, 2421, 2416,
-
-     2453, 2452, 2512, 2491, 2336, 2433, 2464, 2516, 2536,  478,
-    27370, 2535,  408,  538,27370,27370, 1312,  522, 2546,  521,
-      532, 1320,    0, 1318,27370,  428,27370, 2538, 2534, 2558,
-     2557, 2568, 2631, 2599, 2641, 2616, 2633, 2634, 2635, 2640,
-     1336, 2652, 2642, 2666, 2672, 2729, 1361, 2697, 2724,  466,
-      415,    0,27370, 1414, 2429, 1568, 1393, 1414,  416,27370,
-     1395,  413,  399,  411, 2734, 2754, 2764, 2765, 2772, 2766,
-     2829, 2824, 2836, 1416, 2869, 2833, 2872, 2902, 2850, 2911,
-     2914, 2908, 2907,  341,    0, 1421, 1418,  397, 1428, 1397,
-     1477, 1500,  368,  362,  342,    0,  467,27370, 2919, 2925,
-
-     2945, 2949, 2956, 3013, 1476, 2966, 3008, 3032, 3020, 1481,
-     3009, 3039, 3062, 3051, 3072, 3073, 3130, 3147,27370,  582,
-      351, 1542,  569, 1568,  350,  349,  347,27370,27370, 2615,
-        0,  346, 3126, 3030, 3063, 3096, 3153, 3178, 3185, 3152,
-     3177, 3186, 3188,  271, 3210, 3218, 3208, 3275, 3332, 1561,
-     3241,    0,27370,  314, 1564,  288,  187,  589,27370, 3242,
-     3377, 3261, 3272, 3422, 3273, 3284, 3356, 3311, 3357, 3440,
-        0,27370,  183, 2854,    0, 3402, 3499, 1587, 3465, 3544,
-     3601, 1614, 3539, 3496, 3646, 3703,  668,  176,    0, 3541,
-     3748, 3403, 1619, 3439, 3793, 1620, 3625, 3626, 3580, 3838,
-
-     1623,    0, 3399,  675, 3441, 3883, 1624, 3627, 3928, 3553,
-     1625, 3973, 4018, 3682, 3727,    0,  150,    0, 3645, 4075,
-     1633, 3700, 4120, 1657, 4165, 1673, 3772, 4210,  135, 3483,
-        0, 4255, 4300, 1675, 3790, 4345, 1688, 3817, 3862, 4390,
-     4447, 1692,27370,27370,  715, 4492, 1717, 4537, 1748, 4582,
-     4627, 1770, 3835, 3907, 3952,    0, 4672, 3925, 1771, 4717,
-     1774, 4762, 1780, 4807, 1781, 4852,    0, 4897, 1783, 4942,
-     1800, 4987, 3997, 1832, 5032, 1845, 5077, 1847,  727, 5122,
-     1878, 5167, 1915, 5212, 1937, 5257, 1964, 3999, 4054,    0,
-     5302, 1976, 5347, 1978, 5392, 2043, 5437, 2065, 5482,    0,
-
-     5527, 2066, 5572, 2067, 5617, 2096, 5662, 2125, 5707, 2128,
-       54, 5752, 2133, 5797, 2137, 5842, 2200, 5887, 2236, 4042,
-     4099,27370, 5932, 2258, 5977, 2259, 6022, 2321, 6067, 2325,
-     6112, 2328, 6157, 2429, 6202, 2437, 6247, 2448, 6292, 2449,
-     6337, 2452, 6382, 2501, 6427, 2503, 6472, 2513, 6517, 2515,
-     6562, 2535, 6607, 2592, 6652, 2629, 6697, 2643, 6742, 2647,
-     6787, 2658, 6832, 2662, 6877, 2693, 6922, 2697, 6967, 2727,
-     7012, 2728, 7057, 2733, 7102, 2757, 7147, 2758, 7192, 2759,
-     7237, 2766, 7282, 2767, 7327, 2768, 7372, 2769, 7417, 2779,
-     7462, 2793, 7507, 2836, 7552, 2853, 7597, 2866, 7642, 2916,
-
-     7687, 2924, 7732, 2929, 7777, 2935, 7822, 2941, 7867, 2946,
-     7912, 2953, 7957, 2973, 8002, 2976, 8047, 3010, 8092, 3040,
-     8137, 3051, 8182, 3057, 8227, 3059, 8272, 3063, 8317, 3069,
-     8362, 3126, 8407, 3128, 8452, 3133, 8497, 3138, 8542, 3149,
-     8587, 3187, 8632, 3228, 8677, 3232, 8722, 3233, 8767, 3235,
-     8812, 3241, 8857, 3262, 8902, 3291, 8947, 3296, 8992, 3300,
-     9037, 3335, 9082, 3336, 9127, 3399, 9172, 3415, 9217, 3416,
-     9262, 3420, 9307, 3461, 9352, 3462, 9397, 3464, 9442, 3504,
-     9487, 3505, 9532, 3538, 9577, 3540, 9622, 3541, 9667, 3560,
-     9712, 3561, 9757, 3601, 9802, 3604, 9847, 3605, 9892, 3630,
-
-     9937, 3634, 9982, 3635,10027, 3639,10072, 3640,10117, 3641,
-    10162, 3661,10207, 3666,10252, 3706,10297, 3707,10342, 3751,
-    10387, 3752,10432, 3756,10477, 3796,10522, 3797,10567, 3841,
-    10612, 3842,10657, 3878,10702, 3886,10747, 3887,10792, 3891,
-    10837, 3931,10882, 3932,10927, 3968,10972, 3970,11017, 3971,
-    11062, 3973,11107, 3974,11152, 3975,11197, 3977,11242, 4004,
-    11287, 4007,11332, 4009,11377, 4011,11422, 4013,11467, 4014,
-    11512, 4015,11557, 4033,11602, 4034,11647, 4038,11692, 4070,
-    11737, 4078,11782, 4079,11827, 4083,11872, 4114,11917, 4115,
-    11962, 4116,12007, 4123,12052, 4124,12097, 4126,12142, 4128,
-
-    12187, 4159,12232, 4160,12277, 4161,12322, 4168,12367, 4169,
-    12412, 4170,12457, 4171,12502, 4172,12547, 4173,12592, 4204,
-    12637, 4205,12682, 4206,12727, 4213,12772, 4214,12817, 4215,
-    12862, 4216,12907, 4217,12952, 4218,12997, 4249,13042, 4250,
-    13087, 4251,13132, 4258,13177, 4259,13222, 4260,13267, 4261,
-    13312, 4262,13357, 4263,13402, 4294,13447, 4295,13492, 4296,
-    13537, 4303,13582, 4304,13627, 4305,13672, 4306,13717, 4307,
-    13762, 4308,13807, 4339,13852, 4340,13897, 4341,13942, 4342,
-    13987, 4343,14032, 4345,14077, 4346,14122, 4347,14167, 4348,
-    14212, 4349,14257, 4350,14302, 4351,14347, 4352,14392, 4353,
-
-    14437, 4382,14482, 4383,14527, 4384,14572, 4385,14617, 4386,
-    14662, 4387,14707, 4396,14752, 4397,14797, 4398,14842, 4405,
-    14887, 4406,14932, 4407,14977, 4408,15022, 4409,15067, 4441,
-    15112, 4443,15157, 4450,15202, 4451,15247, 4452,15292, 4453,
-    15337, 4454,15382, 4455,15427, 4486,15472, 4487,15517, 4488,
-    15562, 4495,15607, 4496,15652, 4497,15697, 4498,15742, 4499,
-    15787, 4500,15832, 4531,15877, 4532,15922, 4533,15967, 4540,
-    16012, 4541,16057, 4542,16102, 4543,16147, 4544,16192, 4545,
-    16237, 4576,16282, 4577,16327, 4578,16372, 4585,16417, 4586,
-    16462, 4587,16507, 4588,16552, 4589,16597, 4590,16642, 4621,
-
-    16687, 4622,16732, 4623,16777, 4630,16822, 4631,16867, 4632,
-    16912, 4633,16957, 4634,17002, 4635,17047, 4666,17092, 4667,
-    17137, 4668,17182, 4675,17227, 4676,17272, 4677,17317, 4678,
-    17362, 4679,17407, 4680,17452, 4711,17497, 4713,17542, 4720,
-    17587, 4721,17632, 4722,17677, 4723,17722, 4724,17767, 4725,
-    17812, 4756,17857, 4757,17902, 4758,17947, 4765,17992, 4766,
-    18037, 4767,18082, 4768,18127, 4769,18172, 4770,18217, 4801,
-    18262, 4802,18307, 4803,18352, 4810,18397, 4811,18442, 4812,
-    18487, 4813,18532, 4814,18577, 4815,18622, 4846,18667, 4847,
-    18712, 4848,18757, 4855,18802, 4856,18847, 4857,18892, 4858,
-
-    18937, 4859,18982, 4860,19027, 4891,19072, 4892,19117, 4893,
-    19162, 4900,19207, 4901,19252, 4902,19297, 4903,19342, 4904,
-    19387, 4905,19432, 4936,19477, 4937,19522, 4938,19567, 4945,
-    19612, 4946,19657, 4947,19702, 4948,19747, 4949,19792, 4950,
-    19837, 4981,19882, 4982,19927, 4983,19972, 4990,20017, 4991,
-    20062, 4992,20107, 4993,20152, 4994,20197, 4995,20242, 5026,
-    20287, 5027,20332, 5028,20377, 5035,20422, 5036,20467, 5037,
-    20512, 5038,20557, 5039,20602, 5040,20647, 5071,20692, 5072,
-    20737, 5073,20782, 5080,20827, 5081,20872, 5082,20917, 5083,
-    20962, 5084,21007, 5085,21052, 5116,21097, 5117,21142, 5118,
-
-    21187, 5125,21232, 5126,21277, 5127,21322, 5128,21367, 5129,
-    21412, 5130,21457, 5161,21502, 5162,21547, 5163,21592, 5170,
-    21637, 5171,21682, 5172,21727, 5173,21772, 5174,21817, 5175,
-    21862, 5206,21907, 5207,21952, 5208,21997, 5215,22042, 5216,
-    22087, 5217,22132, 5218,22177, 5219,22222, 5220,22267, 5251,
-    22312, 5252,22357, 5253,22402, 5260,22447, 5261,22492, 5262,
-    22537, 5263,22582, 5264,22627, 5265,22672, 5296,22717, 5297,
-    22762, 5298,22807, 5305,22852, 5306,22897, 5307,22942, 5308,
-    22987, 5309,23032, 5310,23077, 5341,23122, 5342,23167, 5343,
-    23212, 5350,23257, 5351,23302, 5352,23347, 5353,23392, 5354,
-
-    23437, 5355,23482, 5386,23527, 5387,23572, 5388,23617, 5395,
-    23662, 5396,23707, 5397,23752, 5398,23797, 5399,23842, 5400,
-    23887, 5431,23932, 5432,23977, 5433,24022, 5440,24067, 5441,
-    24112, 5442,24157, 5443,24202, 5444,24247, 5445,24292, 5476,
-    24337, 5477,24382, 5478,24427, 5485,24472, 5486,24517, 5487,
-    24562, 5488,24607, 5489,24652, 5490,24697, 5521,24742, 5522,
-    24787, 5523,24832, 5530,24877, 5531,24922, 5532,24967, 5533,
-    25012, 5534,25057, 5535,25102, 5566,25147, 5567,25192, 5568,
-    25237, 5575,25282, 5576,25327, 5577,25372, 5578,25417, 5579,
-    25462, 5580,25507, 5611,25552, 5612,25597, 5613,25642, 5620,
-
-    25687, 5621,25732, 5622,25777, 5623,25822, 5624,25867, 5625,
-    25912, 5656,25957, 5657,26002, 5658,26047, 5665,26092, 5666,
-    26137, 5667,26182, 5668,26227, 5669,26272, 5670,26317, 5701,
-    26362, 5702,26407, 5703,26452, 5710,26497, 5711,26542, 5712,
-    26587, 5713,26632, 5714,26677, 5715,26722, 5746,26767, 5747,
-    26812, 5748,26857, 5755,26902, 5756,26947, 5757,26992, 5758,
-    27037, 5759,27082, 5760,27127, 5791,27172, 5792,   36, 5821,
-    27217, 5800,   10, 5864,27370,27270,27277,27284,27287,27293,
-    27300,27306,27307,27310,27317,27323,27325,27327,27329,27331,
-    27333,27335,27337,27339,27341,27343,27345,27347,27349,27351,
-
-    27353,27355,27357,27359,27361,27363
-    } ;
-
-static yyconst flex_int16_t yy_def[1707] =
-    {   0,
-     1676, 1675, 1677, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1678, 1675, 1679, 1679, 1679, 1679, 1679, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1680, 1680, 1680,
-     1680, 1680, 1680, 1680, 1681, 1680,   36,   36,   36,   39,
-       39, 1680, 1680, 1680, 1680, 1680, 1680, 1680, 1680, 1680,
-     1680, 1675, 1675, 1675, 1675, 1675, 1678, 1675, 1682, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1680, 1680, 1680, 1680, 1680, 1680, 1680, 1680,
-     1680, 1681, 1681, 1681, 1680, 1680, 1680, 1680, 1680, 1680,
-
-     1680, 1680, 1680, 1680, 1680, 1680, 1680, 1680, 1680, 1680,
-     1680, 1680, 1680, 1680, 1680, 1680, 1680, 1680, 1680, 1680,
-     1675, 1675, 1675, 1683, 1675, 1683, 1675, 1675, 1675, 1675,
-     1675, 1684, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,   96,
-     1680, 1680, 1680, 1681, 1681,   96, 1680,   96,  157, 1680,
-     1680, 1680, 1680, 1680, 1685, 1680, 1680, 1680, 1680, 1680,
-     1680, 1680, 1680, 1680, 1680, 1680, 1680, 1680, 1680, 1680,
-     1680, 1675, 1675, 1675, 1675, 1686, 1686, 1675, 1675, 1675,
-     1675, 1675, 1675, 1684, 1675, 1675, 1675, 1675, 1675, 1675,
-
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1680, 1680, 1680, 1681, 1681, 1680,   96,  157,  218,  218,
-     1680, 1680, 1680, 1680, 1680, 1680, 1685,  227,  227, 1680,
-     1680, 1680, 1680, 1680, 1680, 1680, 1680, 1680, 1680, 1680,
-     1680, 1680, 1680, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1680, 1680, 1680, 1681, 1681,   96, 1680,   96, 1680,
-     1680, 1680, 1680, 1680, 1680, 1680, 1680, 1680,  227,  227,
-     1680, 1680, 1680, 1680, 1680, 1680, 1680, 1680, 1680, 1680,
-
-     1680, 1680, 1680, 1680, 1675, 1675, 1675, 1687, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1680,
-     1680, 1680, 1681, 1681, 1680,   96,  157, 1680, 1680, 1680,
-     1680, 1680, 1680,  227,  227, 1680, 1680, 1680, 1680, 1680,
-     1680, 1680, 1680, 1680, 1680, 1680, 1680, 1680, 1675, 1675,
-     1675, 1688, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1689, 1675, 1675, 1675, 1675, 1675,
-     1675, 1680, 1680, 1680, 1681, 1681,   96, 1680,  157,  389,
-     1680, 1680, 1680, 1680, 1680, 1680,  227,  227, 1680, 1680,
-
-     1680, 1680,  389, 1680, 1680, 1680, 1680, 1680, 1680, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1690, 1675, 1675, 1675, 1675, 1680, 1680, 1680,
-     1681, 1681,   96, 1680, 1680, 1680, 1680, 1680, 1680, 1680,
-      227, 1680, 1680, 1680, 1680,  389,  446, 1680, 1680, 1675,
-     1675, 1691, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1680, 1680, 1680, 1681, 1681, 1680,
-      446, 1680, 1680,  227, 1680, 1680, 1680, 1680, 1680, 1680,
-     1680, 1680, 1680, 1675, 1692, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1693, 1675, 1675, 1680, 1680,
-
-     1680, 1681, 1681,  446,  504, 1680, 1680, 1680, 1680,  227,
-     1680, 1680, 1680, 1680, 1680, 1680,  504, 1680, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1694, 1675, 1680, 1680, 1680, 1681, 1681, 1680, 1680, 1680,
-     1680, 1680, 1680,  227, 1680, 1680, 1680, 1680,  504,  549,
-     1680, 1695, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1680,
-      549, 1681, 1681,  549, 1680, 1680, 1680, 1680, 1680, 1680,
-     1696, 1675, 1675, 1675, 1697, 1680,  549,  577, 1681, 1681,
-      549,  581, 1680, 1680, 1680,  581, 1675, 1675, 1698, 1680,
-      577, 1680,  591, 1681,  580,  595, 1680, 1680, 1680,  581,
-
-      600, 1699, 1675, 1675, 1680,  591,  606, 1681,  595, 1681,
-      609,  600, 1680, 1680, 1680, 1700, 1675, 1701, 1680,  606,
-      620, 1681,  609,  623,  600,  625, 1680,  625, 1675, 1675,
-     1702,  625,  620,  633, 1681,  623,  636, 1680, 1680, 1680,
-      625,  641, 1675, 1675, 1675,  641,  646,  633,  648,  580,
-      636,  651, 1680, 1680, 1680, 1703,  646, 1680,  657,  648,
-      660,  651,  662,  651,  664,  641, 1704,  657,  668,  660,
-      670,  662, 1681,  672,  664,  675,  641,  677, 1675,  668,
-      680,  670,  682,  672,  684,  675,  686, 1680, 1680, 1705,
-      680,  691,  682,  693,  684,  695,  686,  697,  677, 1706,
-
-      691,  701,  693,  703,  695,  705,  697,  707,  677,  709,
-     1675,  701,  712,  703,  714,  705,  716,  707,  718, 1680,
-     1680, 1675,  712,  723,  714,  725,  716,  727,  718,  729,
-      723,  731,  725,  733,  727,  735,  729,  737,  731,  739,
-      733,  741,  735,  743,  737,  745,  739,  747,  741,  749,
-      743,  751,  745,  753,  747,  755,  749,  757,  751,  759,
-      753,  761,  755,  763,  757,  765,  759,  767,  761,  769,
-      763,  771,  765,  773,  767,  775,  769,  777,  771,  779,
-      773,  781,  775,  783,  777,  785,  779,  787,  781,  789,
-      783,  791,  785,  793,  787,  795,  789,  797,  791,  799,
-
-      793,  801,  795,  803,  797,  805,  799,  807,  801,  809,
-      803,  811,  805,  813,  807,  815,  809,  817,  811,  819,
-      813,  821,  815,  823,  817,  825,  819,  827,  821,  829,
-      823,  831,  825,  833,  827,  835,  829,  837,  831,  839,
-      833,  841,  835,  843,  837,  845,  839,  847,  841,  849,
-      843,  851,  845,  853,  847,  855,  849,  857,  851,  859,
-      853,  861,  855,  863,  857,  865,  859,  867,  861,  869,
-      863,  871,  865,  873,  867,  875,  869,  877,  871,  879,
-      873,  881,  875,  883,  877,  885,  879,  887,  881,  889,
-      883,  891,  885,  893,  887,  895,  889,  897,  891,  899,
-
-      893,  901,  895,  903,  897,  905,  899,  907,  901,  909,
-      903,  911,  905,  913,  907,  915,  909,  917,  911,  919,
-      913,  921,  915,  923,  917,  925,  919,  927,  921,  929,
-      923,  931,  925,  933,  927,  935,  929,  937,  931,  939,
-      933,  941,  935,  943,  937,  945,  939,  947,  941,  949,
-      943,  951,  945,  953,  947,  955,  949,  957,  951,  959,
-      953,  961,  955,  963,  957,  965,  959,  967,  961,  969,
-      963,  971,  965,  973,  967,  975,  969,  977,  971,  979,
-      973,  981,  975,  983,  977,  985,  979,  987,  981,  989,
-      983,  991,  985,  993,  987,  995,  989,  997,  991,  999,
-
-      993, 1001,  995, 1003,  997, 1005,  999, 1007, 1001, 1009,
-     1003, 1011, 1005, 1013, 1007, 1015, 1009, 1017, 1011, 1019,
-     1013, 1021, 1015, 1023, 1017, 1025, 1019, 1027, 1021, 1029,
-     1023, 1031, 1025, 1033, 1027, 1035, 1029, 1037, 1031, 1039,
-     1033, 1041, 1035, 1043, 1037, 1045, 1039, 1047, 1041, 1049,
-     1043, 1051, 1045, 1053, 1047, 1055, 1049, 1057, 1051, 1059,
-     1053, 1061, 1055, 1063, 1057, 1065, 1059, 1067, 1061, 1069,
-     1063, 1071, 1065, 1073, 1067, 1075, 1069, 1077, 1071, 1079,
-     1073, 1081, 1075, 1083, 1077, 1085, 1079, 1087, 1081, 1089,
-     1083, 1091, 1085, 1093, 1087, 1095, 1089, 1097, 1091, 1099,
-
-     1093, 1101, 1095, 1103, 1097, 1105, 1099, 1107, 1101, 1109,
-     1103, 1111, 1105, 1113, 1107, 1115, 1109, 1117, 1111, 1119,
-     1113, 1121, 1115, 1123, 1117, 1125, 1119, 1127, 1121, 1129,
-     1123, 1131, 1125, 1133, 1127, 1135, 1129, 1137, 1131, 1139,
-     1133, 1141, 1135, 1143, 1137, 1145, 1139, 1147, 1141, 1149,
-     1143, 1151, 1145, 1153, 1147, 1155, 1149, 1157, 1151, 1159,
-     1153, 1161, 1155, 1163, 1157, 1165, 1159, 1167, 1161, 1169,
-     1163, 1171, 1165, 1173, 1167, 1175, 1169, 1177, 1171, 1179,
-     1173, 1181, 1175, 1183, 1177, 1185, 1179, 1187, 1181, 1189,
-     1183, 1191, 1185, 1193, 1187, 1195, 1189, 1197, 1191, 1199,
-
-     1193, 1201, 1195, 1203, 1197, 1205, 1199, 1207, 1201, 1209,
-     1203, 1211, 1205, 1213, 1207, 1215, 1209, 1217, 1211, 1219,
-     1213, 1221, 1215, 1223, 1217, 1225, 1219, 1227, 1221, 1229,
-     1223, 1231, 1225, 1233, 1227, 1235, 1229, 1237, 1231, 1239,
-     1233, 1241, 1235, 1243, 1237, 1245, 1239, 1247, 1241, 1249,
-     1243, 1251, 1245, 1253, 1247, 1255, 1249, 1257, 1251, 1259,
-     1253, 1261, 1255, 1263, 1257, 1265, 1259, 1267, 1261, 1269,
-     1263, 1271, 1265, 1273, 1267, 1275, 1269, 1277, 1271, 1279,
-     1273, 1281, 1275, 1283, 1277, 1285, 1279, 1287, 1281, 1289,
-     1283, 1291, 1285, 1293, 1287, 1295, 1289, 1297, 1291, 1299,
-
-     1293, 1301, 1295, 1303, 1297, 1305, 1299, 1307, 1301, 1309,
-     1303, 1311, 1305, 1313, 1307, 1315, 1309, 1317, 1311, 1319,
-     1313, 1321, 1315, 1323, 1317, 1325, 1319, 1327, 1321, 1329,
-     1323, 1331, 1325, 1333, 1327, 1335, 1329, 1337, 1331, 1339,
-     1333, 1341, 1335, 1343, 1337, 1345, 1339, 1347, 1341, 1349,
-     1343, 1351, 1345, 1353, 1347, 1355, 1349, 1357, 1351, 1359,
-     1353, 1361, 1355, 1363, 1357, 1365, 1359, 1367, 1361, 1369,
-     1363, 1371, 1365, 1373, 1367, 1375, 1369, 1377, 1371, 1379,
-     1373, 1381, 1375, 1383, 1377, 1385, 1379, 1387, 1381, 1389,
-     1383, 1391, 1385, 1393, 1387, 1395, 1389, 1397, 1391, 1399,
-
-     1393, 1401, 1395, 1403, 1397, 1405, 1399, 1407, 1401, 1409,
-     1403, 1411, 1405, 1413, 1407, 1415, 1409, 1417, 1411, 1419,
-     1413, 1421, 1415, 1423, 1417, 1425, 1419, 1427, 1421, 1429,
-     1423, 1431, 1425, 1433, 1427, 1435, 1429, 1437, 1431, 1439,
-     1433, 1441, 1435, 1443, 1437, 1445, 1439, 1447, 1441, 1449,
-     1443, 1451, 1445, 1453, 1447, 1455, 1449, 1457, 1451, 1459,
-     1453, 1461, 1455, 1463, 1457, 1465, 1459, 1467, 1461, 1469,
-     1463, 1471, 1465, 1473, 1467, 1475, 1469, 1477, 1471, 1479,
-     1473, 1481, 1475, 1483, 1477, 1485, 1479, 1487, 1481, 1489,
-     1483, 1491, 1485, 1493, 1487, 1495, 1489, 1497, 1491, 1499,
-
-     1493, 1501, 1495, 1503, 1497, 1505, 1499, 1507, 1501, 1509,
-     1503, 1511, 1505, 1513, 1507, 1515, 1509, 1517, 1511, 1519,
-     1513, 1521, 1515, 1523, 1517, 1525, 1519, 1527, 1521, 1529,
-     1523, 1531, 1525, 1533, 1527, 1535, 1529, 1537, 1531, 1539,
-     1533, 1541, 1535, 1543, 1537, 1545, 1539, 1547, 1541, 1549,
-     1543, 1551, 1545, 1553, 1547, 1555, 1549, 1557, 1551, 1559,
-     1553, 1561, 1555, 1563, 1557, 1565, 1559, 1567, 1561, 1569,
-     1563, 1571, 1565, 1573, 1567, 1575, 1569, 1577, 1571, 1579,
-     1573, 1581, 1575, 1583, 1577, 1585, 1579, 1587, 1581, 1589,
-     1583, 1591, 1585, 1593, 1587, 1595, 1589, 1597, 1591, 1599,
-
-     1593, 1601, 1595, 1603, 1597, 1605, 1599, 1607, 1601, 1609,
-     1603, 1611, 1605, 1613, 1607, 1615, 1609, 1617, 1611, 1619,
-     1613, 1621, 1615, 1623, 1617, 1625, 1619, 1627, 1621, 1629,
-     1623, 1631, 1625, 1633, 1627, 1635, 1629, 1637, 1631, 1639,
-     1633, 1641, 1635, 1643, 1637, 1645, 1639, 1647, 1641, 1649,
-     1643, 1651, 1647, 1653, 1649, 1655, 1651, 1657, 1653, 1659,
-     1657, 1661, 1659, 1663, 1661, 1665, 1663, 1667, 1645, 1645,
-     1667, 1671, 1655, 1655,    0, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-
-     1675, 1675, 1675, 1675, 1675, 1675
-    } ;
-
-static yyconst flex_int16_t yy_nxt[27444] =
-    {   0,
-     1675,    7,    8,    7,   52,   52,   52, 1675,    9,    9,
-        9,    9,    9,    9,    9,   52,   52,   52,   71,   74,
-      127,  131,   56,   53,   68,  133,  673,   54,   10,   55,
-       55,   55,   55,   55,   55,   55,   52,   52,   52,  121,
-      121,  121,  121,  121,  121,  121,  126,   71,   74,  127,
-      131,   56,  658,   68,  133,  126,  722,   10,    6,    7,
-        8,    7,   11,    6,    6,    6,   12,   12,   12,   12,
-       12,   12,   12,    6,    6,    6,   13,   13,   14,   15,
-       16,   17,    6,    6,   18,   19,   10,   20,   21,    6,
-        6,   22,    6,   23,   24,    6,    6,   25,   26,    6,
-
-        6,    6,   27,    6,    6,   13,   13,   14,   15,   16,
-       17,    6,    6,   18,   19,   10,   20,   21,    6,    6,
-       22,   23,   24,    6,    6,   25,   26,    6,    6,    6,
-        6,   29,    8,   29,   61,   65,   66,  643,   30,   30,
-       30,   30,   30,   30,   30,   62,   70,   78,   79,   63,
-       31,  308,   67,   72,   75,  630,   73,   76,   32,  130,
-      308,   77,   61,   64,   65,   66,   33,  123,  123,  123,
-      123,  123,  123,  123,   62,   70,   78,   79,   63,   31,
-       67,  603,   72,   75,   73,  572,   76,   32,  130,   53,
-       77,   64,  574,   54,   33,   55,   55,   55,   55,   55,
-
-       55,   55,   34,   28,   29,    8,   29,   35,   28,   28,
-       28,   36,   36,   36,   36,   36,   36,   36,   28,   28,
-       28,   37,   37,   38,   39,   40,   41,   28,   28,   42,
-       43,   32,   44,   45,   28,   28,   46,   28,   47,   48,
-       28,   28,   49,   50,   28,   28,   28,   51,   28,   28,
-       37,   37,   38,   39,   40,   41,   28,   28,   42,   43,
-       32,   44,   45,   28,   28,   46,   47,   48,   28,   28,
-       49,   50,   28,   28,   28,   34,   53,  122,  319,  319,
-       54,   58,   59,   59,   59,   59,   59,   59,   59,   84,
-       84,   84,   60,   60,   60,   60,   60,   60,   80,  573,
-
-       91,   81,  134,  126,  122,   85,   85,   85,   89,   86,
-       52,   86,  126,   82,  132,  138,  572,  465,   84,   84,
-       84,   60,   60,   60,   60,   60,   60,   80,   84,   91,
-       81,  134,  139,   85,   85,   85,   89,  136,  137,  140,
-      143,   82,   84,  138,   85,   84,   93,   90,  559,  528,
-       53,  528,  528,  553,  124,   58,  126,   84,   85,  530,
-      139,   85,   94,  126,  529,  126,  136,  137,  140,  143,
-      528,   84,   85,   53,   84,   93,   90,   87,  141,   88,
-       88,   88,   88,   88,   88,   88,   85,  128, 1675,   85,
-       94,   84,   83,   83,   97,   97,   97,   97,   97,   97,
-
-       97,  142,  144,  145,   97,  104,  141,   85,   97,  126,
-      146,  523,  519,  498,  452,  128,  497,  411,  126,  496,
-       84,  105,   85,  452,  494,  494,  494,  494,  496,  142,
-      129,  144,  145,   97,  104,   85,   53,   97,  147,  146,
-       87,   95,   96,   96,   96,   96,   96,   96,   96,  105,
-       85,   84,   97,   97,   98,   97,   97,   97,   84,  129,
-      106,  148,  149,  108,  189,  190,  147,   85,  191,  484,
-       85,  193,  192,  464,   85,  532,  532,  532,  532,  532,
-       84,   97,   97,   98,   97,   97,   97,   84,  195,  106,
-      148,  149,  108,  189,  190,   85,  199,  197,   85, 1675,
-
-      193,  192,   85,   83,   83,   97,   97,   97,   97,   97,
-       97,   97,   97,  109,  198,   84,   97,  195,  200,  201,
-      450,  206,  107,  203,  199,  103,  197,  204,  205,  251,
-       85,   85,   99,   84,  460,   89,  112,   84,  459,  455,
-      453,   97,  109,  198,   84,   97,  200,  450,  201,   85,
-      206,  203,  274,   85,  103,  204,  205,  251,   85,   85,
-       99,  263,   84,   89, 1675,  112,   84,   84,   83,   83,
-       97,   97,   97,   97,   97,   97,   97,   85,  265,  110,
-      100,   85,  111,   85,  101,   84,   84,  113,  552,  263,
-      114,   84,  427,  425,  115,  575,   84,  552,  102,  117,
-
-      419,   85,   85,  116,  575,  306,  265,   85,  110,  100,
-      111,   85,  555,  101,   84,   84,  113,   84,  118,  114,
-       84,  119,   84,  115,   84,   84,  102,  207,  117,   85,
-       85,  208,  116,  120,   91,   85,   84,  381,   85,  555,
-       85,   85,   89,   86,   52,   86,   84,  118,  378,  377,
-      119,   84,  151,   84,   84,   84,  207,  209,  210,   93,
-      208,  120,   84,   91,  244,   84,   85,  255,   85,   85,
-       89,   85,  256,   84,  602,   94,   93,  152,   85,  375,
-      151,  618,  373,  602,   84,  153,  209,  210,   93,   85,
-      618,   84,   94,  244,  154,  372,  255,  258,  259,   85,
-
-      260,  256,   84,   94,  152,   93,   85,  150,  150,  150,
-      150,  150,  150,  150,  153,   93,  327,   85,  160,   84,
-       94,  656,  154,  261,  155,  264,  258,  259,  266,  260,
-      656,   94,  267,  690,   85,   85,  159,  159,  323,  184,
-      269,  262,  690,  257,   93,  159,  159,  160,   84,  164,
-       84,   84,  261,  155,  264,  268,  270,  266,  271,   94,
-      289,  267,   85,   85,   53,   85,   85,   85,   87,   89,
-       88,   88,   88,   88,   88,   88,   88,  159,  164,   84,
-       84,  290,   84,  305,  268,  270,  159,  271,  289,  309,
-      310,   84,  311,   85,   85,   85,  313,   89,   85,  250,
-
-      249, 1675,  202,  196,  159,  188,  183,   85,  161,  312,
-      290,   84,  305,  159,  314,  315,  316,  309,   84,  310,
-       84,  311,  317,  320,  313,  162,   85,  156,  156,  156,
-      156,  156,  156,  156,   85,   85,  161,   84,  312,   84,
-      135,   69, 1675,  314,  315,  316,   91,   84,  318,  321,
-      163,  317,  320,   85,  162,   85,  159, 1675, 1675, 1675,
-     1675, 1675,   85, 1675, 1675,  159,   84,  165,   84,  166,
-       84,   84, 1675, 1675, 1675,   91,  318,  321, 1675,  163,
-     1675,   85, 1675,   85,   53,  135,   85,   85,  157,   95,
-      158,  158,  158,  158,  158,  158,  158,  159,  166,   84,
-
-       84,  167,   84,   84,  322, 1675,  326,   84,   84,   84,
-      328,   84,  324,  325,   85,   85, 1675,   85,   85,   85,
-      168,  169, 1675,  170,  173,   85,  171,   85,   84, 1675,
-      167,   84,   84,  322,  172,  326,   84,   84,   84,  328,
-       84,  324,  325,  344,   85,   85,   85,   85,   84,  168,
-      169,  170,  173,   85,  171,   85,  359,   84,   84,  345,
-      175,  363,   84,  172,   85,  176,   84,   84,  177,   84,
-      364,  344,   85,  174,   85,  178, 1675,   84,   85,  153,
-     1675, 1675,   85,   85,  359,  179,  365,   84,  345,  175,
-      363,   84,   85, 1675,  176,   84,   84,  177,   84,  364,
-
-       84,  174,   85,  366,  178,   84,   85,  367,  153,  180,
-       85,   85,  368,  179,   91,  365,   85,  369,  181, 1675,
-      370,   85,  186,  186,  186,  186,  186,  186,  186,   84,
-     1675, 1675,  366, 1675,   84, 1675,  367, 1675,  180,  371,
-      376,  368, 1675,   91,   85,  182,  369,  181,  370,   85,
-     1675,  121,  121,  121,  121,  121,  121,  121,  184,  185,
-      185,  185,  185,  185,  185,  185,   53,  374,  371,  376,
-       54,   58,   55,   55,   55,   55,   55,   55,   55,  182,
-     1675, 1675,   84,   83,   83,  150,  150,  150,  150,  150,
-      150,  150,   83,   84, 1675,  374,   84, 1675,   85,   93,
-
-      379,  222,   91,   84,   93,  380,  290,   84,  212,   85,
-      211,   84,   85,  213,  397,  214,  215,  230, 1675,   85,
-       94,  417,   84,   85,  398,   84,   85, 1675,   93,  379,
-      222,   91,   84,   93,  380,  290,   84,   85,  211, 1675,
-       85,  213,  397,  214,  410,  215,  230,   85,   94, 1675,
-      417,   85,  398,   83,  216,  217,  217,  217,  217,  217,
-      217,  217,   83,  218,  218,  218,  218,  218,  218,  218,
-     1675, 1675,  410,  219,  219,  220,  219,  219,  219,   87,
-     1675,   88,   88,   88,   88,   88,   88,   88,   83, 1675,
-     1675,   85,  219,  219,  219,  219,  219,  219,  219,  196,
-
-      221, 1675,  219,  219,  220,  219,  219,  219,   84,   84,
-      224,  239,   84,   84,  225,  223,  231,   84,   84,   85,
-      414,  415,  416,  424,   85,   85,   89,   85,   85,   85,
-      226, 1675, 1675,   85,   85,   89,   89,   84,   84,  426,
-      239,   84,   84,  225,  223,  231,   84,   84,  414,  415,
-      416,  424,   85,   85,   89,   85,   85,   85,  418,  226,
-       84,   85,   85,   89,   89,   83,   83,  426,   83,   83,
-       83,   83, 1675,  232,   84, 1675,   85,   84,  420,   84,
-       83,   83,   83,   91,   84,  228, 1675,  418, 1675,   84,
-       85,  233, 1675,   85,  234,   85,  235,  202,  236,   89,
-
-       85,  229,  232,   84,   85, 1675,   84,  420,   84,   83,
-       83,   83,   91,   84,  228,   84,  421,   84,   85,  233,
-      422,   85,  234,   85,   91,  235,  236,   89,   85,  229,
-     1675,   85,  237,   85,   84,   84,   83,   83,  441,   84,
-     1675,  454,  461,  240,   84,  421,   84,  463,   91,  422,
-       85,   85,  241,   91,  238,   85,  243,   84,   84,   85,
-      237,   85, 1675,   84,   84, 1675,  474,  441,   84,  242,
-      454,  461,  240,   85,   85, 1675,  463,   91,   85,   85,
-     1675,  241,  238,   85,   84,  243,   84,   84,  245,  245,
-      245,  245,  245,  245,  245,  474,  272, 1675,  242,   89,
-
-       85,   85,   85,  184,  246,  246,  246,  246,  246,  246,
-      246,  182,  252,   84,   84, 1675,  273,  247,  247,  247,
-      247,  247,  247,  247,   84,  272,  253,   89,   85,  492,
-       85,  495,  254,  525, 1675,   93,  486,  493,  510, 1675,
-       85,  252,  521,   84,  155,  273,   93, 1675,  522,  524,
-      274,   94,  275,   84, 1675,  253, 1675,  492,   85,  495,
-      254,  525,   94,  276,   93,  486,  493,  510,   85, 1675,
-     1675,  521, 1675,  155, 1675,   93, 1675,  522,  524,   94,
-      275,  249,  280,  280,  280,  280,  280,  280,  280, 1675,
-       94,  276,  277,  277,  277,  277,  277,  277,  277,   84,
-
-     1675,   84,  288,   84,   84,  294,  280,  280,  280,  280,
-      280,  280,  280,  526,   89,   85,  544,   85,  282,   85,
-       85,   84,   84,  527, 1675, 1675, 1675, 1675,   84, 1675,
-       84,  288,   84,   84,  294, 1675,   89,   85,   85,  283,
-     1675,  526,   89,   85,  544,   85, 1675,   85,   85, 1675,
-       84,   84,  527,   83,  216,  278,  278,  278,  278,  278,
-      278,  278,   83,  182,   89,   85,   85,  283,  554,  279,
-      279,  279,  279,  279,  279,  279,  284,   84,   84,  280,
-      280,  281,  280,  280,  280,   84,  490,  556,  491,  301,
-      285,  287, 1675,   85,   85, 1675,  286,  554, 1675,   89,
-
-      573,   85, 1675, 1675, 1675,  284,   84,   84,  280,  280,
-      281,  280,  280,  280,   84,  490,  556,  491,  301,  285,
-      287,   85,   85,  295,  286,   89,   84,   89,  573,   85,
-       83,   83,  257,   83,   83,   83,   83, 1675,   84,  293,
-       84, 1675,   85,   84,  291,   83,   83,   83,  292,   84,
-      228, 1675,   89,   89,   85,   84,   85,   89,  154,   85,
-     1675,   89,   89,  154,  296,   85,  229,   84,  293,   84,
-       85,   89,   84,  291,   83,   83,   83,  292,   84,  228,
-       89,   84,   85,  297,   85,   89,  154,   85,   84,   89,
-       89,  154,  296,   85,  229,  154, 1675,   85,   84,   89,
-
-      299,   83,   83, 1675,   85,  298,   84, 1675,  300, 1675,
-       84,   89,  297,   89,   85,   84, 1675,   84,   84,  303,
-       84, 1675,   85,  154,   89,   85,  154,   84,  330,  299,
-       89,   85,   85,  298,   85,   84,   85,  300, 1675,   89,
-      302,   89,   85, 1675,   84,   84, 1675,   84,  303,   84,
-       85, 1675,   89, 1675,  154,   89,  304,  330,   89,   85,
-     1675,   85,   85, 1675,   85,  306,  307,  307,  307,  307,
-      307,  307,  307, 1675,   84,  329,  329,  329,  329,  329,
-      329,  329, 1675,   89,  182,  304,   89,   84,  308,   85,
-      121,  121,  121,  121,  121,  121,  121,  308,  331,   84,
-
-     1675,   93, 1675,   85, 1675,  332,   93, 1675,  154,   89,
-      216,  337,   89,  333,   89,   85,   84,   94,  154,  154,
-      337,   89,   94,   84, 1675,   84, 1675,  331,   84, 1675,
-       93,   85,  334, 1675,  332,   93,  154,   89,   89,   85,
-       89,   85,  333,   85, 1675,   94,  154,  154, 1675,   89,
-       94, 1675,   84, 1675,   84,   83,  335,  336,  336,  336,
-      336,  336,  336,  336,   83, 1675,   89,   85,  182,   85,
-      154,   84,  337,   83,  150,  150,  150,  150,  150,  150,
-      150,  337,  337,  154, 1675,   89, 1675,   85,   84, 1675,
-       84,  337,   84,   84,   84,  340,   84, 1675,  154,  339,
-
-       84, 1675,  341, 1675,   85,  338,   85, 1675,   85,   85,
-      342,  154,   85,   89,   89,   85,   89,   84, 1675,   84,
-     1675,   84,   84,   84,  340,   84, 1675, 1675,  339,   84,
-       84,  341,   85,  338,   85,  343,   85,   85,  342,   84,
-       85,  346,   89, 1675,   89,   85,   85,  347,  348,   84,
-       84,   84, 1675,   89,  349,   85, 1675,  351,   84,   84,
-      350,  350, 1675, 1675,  343,   85,   85,   85,   84,   84,
-      346,   84,  323,   85,   85,  154,  347,  348,   84,   84,
-       84,   89,  349,   85,  352,   85,  351,   85,   84,   84,
-       84,   84,  356,   85,   85,   85,  353, 1675,   84,  396,
-
-       84, 1675,  154,  154,   85,   85,   85,   85,  354,  355,
-       84,  327,  352,   85,   89,   85,   89,   84,   84,   84,
-       84,  356,  357, 1675,   84,  353,   85, 1675,  396,   84,
-      154, 1675,   85,   85,   85,   85, 1675,  354,  355,   84,
-       85,   84,   89,  382,   89,   85, 1675, 1675, 1675, 1675,
-     1675,  357, 1675,   84,   85,  401, 1675,   85,   84,  360,
-      360,  360,  360,  360,  360,  360,   84, 1675,   85, 1675,
-       84,   85,  382,   85,  358,  358,  358,  358,  358,  358,
-      358,  154,   85,  383,  401,   85,   84,  306,  361,  361,
-      361,  361,  361,  361,  361,   84,   84,  384,   93,   85,
-
-       93, 1675,   85,  154,   89,   89,  386, 1675,  385,  154,
-       85,  383,   85, 1675,   94,   84,   94, 1675, 1675, 1675,
-     1675,  372, 1675, 1675, 1675,   84,  384,   93, 1675,   93,
-       85,  154,   89,   89,  154,  386,   84,  385,  391,   84,
-       85,  392,   94,   84,   94,  387,  387,  387,  387,  387,
-      387,  387,   85,   84, 1675,   85,  393,   84,  403,   85,
-       84,   84,  154,  154,  399,   84,   89,  391,   84,   85,
-      392,   89,   84,   85, 1675,   89,   85,   85, 1675, 1675,
-       85, 1675,   84,   85, 1675,  393,   84,   85, 1675,   84,
-       84,  154, 1675,  399,   89, 1675, 1675,   85, 1675,   89,
-
-     1675,   85, 1675,   89,   85,   85,   83,  335,  388,  388,
-      388,  388,  388,  388,  388,   83,  389,  389,  389,  389,
-      389,  389,  389,  394,   84,   84,  389,  389,  390,  389,
-      389,  389,  395,  373,   84, 1675, 1675, 1675,  154, 1675,
-       85,   85,  400,   91,  404, 1675,   84, 1675,   84, 1675,
-       85,   84,  394,   84,   84,  389,  389,  390,  389,  389,
-      389,  395,   85,   84,   85,  402,  154,   85,   85,   85,
-      400, 1675,   91,  404,  154,   84, 1675,   84,   85,  405,
-       84,  406,   84,   84,   84,   84,  407, 1675,   84, 1675,
-       85,   84,   85,  402,  408,   85,   89,   89,   85,   85,
-
-       85,   85,  154,  428,   85, 1675, 1675,   85, 1675, 1675,
-     1675,   84,   84,   84,   84,  407,  409,   84,   84, 1675,
-       84, 1675, 1675,  408,   89,   89,   85,   85,   85,   85,
-      411,  428,   85,  429,   85,   85,  412,  412,  412,  412,
-      412,  412,  412,  430,  335, 1675, 1675,   84,   93,   84,
-      431,   93,  432,   84,   84,   84,   84,   84, 1675,  154,
-       84,  429,   85,  154,   94,   85,   89,   94,  436,   85,
-       85,   85,   85,   85,  437,  438,   85,   93,   84,  431,
-       93,  432,   84,   84,   84,   84,   84,  154, 1675,   84,
-     1675,  154,   94,   85,   89,   94,  436,   85,   85,   85,
-
-       85,   85,  437,  438,   85,  411, 1675, 1675, 1675,   83,
-       83,  433,  433,  433,  433,  433,  433,  433,   83,  434,
-      434,  434,  434,  434,  434,  434,  439,   84, 1675,  434,
-      434,  435,  434,  434,  434,   84,   84, 1675,  442,  440,
-     1675,   84, 1675,   85, 1675,  443, 1675,  487,  488, 1675,
-     1675,   85,   85,   84,  489,  439,   84,   85,  434,  434,
-      435,  434,  434,  434,   84,   84,  425,   89,  440,   85,
-       84,   85,   84,   84,  443,  154,  487,  488,  445,   85,
-       85,  444,   84,  489,   84,   85,  154,   89,   85,   85,
-       89,   89, 1675, 1675, 1675,   89, 1675,   85, 1675, 1675,
-
-       85,   84,   84,  154, 1675, 1675, 1675,  445, 1675, 1675,
-      444,   84, 1675,   84,  154,   89,   85,   85,   89,   89,
-      446,  446,  446,  446,  446,  446,  446,   85,   85,  448,
-      446,  446,  447,  446,  446,  446,   84,  411,  427,  154,
-       84,  154, 1675,  451,  451,  451,  451,  451,  451,  451,
-     1675,   89,  449,   89,   84,   85,   84,  448,   84,  446,
-      446,  447,  446,  446,  446,   84,  456,  154,  457,  154,
-       85,  469,   85,  154,   85,  467,  466,   93,   84,   89,
-      449,   89,  458,   84,  465,   84, 1675,   84,   93, 1675,
-     1675, 1675,  468,   94,   85,  456, 1675,  457,   85, 1675,
-
-       85,  154,   85,  466,   94,  471,   93,   84, 1675, 1675,
-      458, 1675, 1675, 1675,  471, 1675, 1675,   93,  453,   84,
-      468,   94,   85,  557,  557,  557,  557,  557,  557,  557,
-      154, 1675,   94,  411, 1675,   85,   84,   83,   83,  470,
-      470,  470,  470,  470,  470,  470,   83,  471,   84, 1675,
-     1675, 1675,   85,   84,   84,   84,  471,  473,  154,  478,
-       84,   84,   84,   85,  472,   84, 1675,   89,  460,   85,
-       85,   85,  475, 1675,  476, 1675,   85,   85,   85,   89,
-       85,   89,   84,   84,   84,  154,   84, 1675,  477,   84,
-       84,   84,   84,  472,  479,   89,  154,   85,   85,   85,
-
-       89,  475,   85,  476,   85,   85,   85,   89,   85,   89,
-     1675, 1675, 1675,  154, 1675,   84,  477,   84, 1675, 1675,
-     1675,   84, 1675,  479,  154, 1675,  482, 1675,   89, 1675,
-       85,   89, 1675,   85, 1675,  154,   85,  480,  480,  480,
-      480,  480,  480,  480,   84, 1675,   84,  480,  480,  481,
-      480,  480,  480,   91,   84,  482, 1675,  500, 1675,   89,
-       85,   85,  499,  154, 1675,  154,   89,  501,  411,  483,
-       85,   89, 1675,   84,   84, 1675,  480,  480,  481,  480,
-      480,  480,   91,   84,   84,   93,   84, 1675,   85,  503,
-       85,  499,   93,  154,   89,  154,  154,   89,   85,   89,
-
-       85,   94,   85,   84,   89,  154,  154,   89,   94, 1675,
-     1675,  502, 1675,   84,   93,   84, 1675,   89,   85, 1675,
-     1675,   93, 1675,  154,  154,   89, 1675, 1675,   85,   94,
-       85,  154,   89,  154,  154,   89,   94,  504,  504,  504,
-      504,  504,  504,  504,   84,   89,  506,  504,  504,  505,
-      504,  504,  504,   84,  507,  508,   84, 1675, 1675,  154,
-       85,  509,  588,  588,  588,  588,  588,  588,  588,  513,
-       84, 1675,   85,   84,  154,  506,  504,  504,  505,  504,
-      504,  504,   84,  507,  508,   84,  516,  511,   85,  512,
-      509,   89,   84, 1675, 1675,  514, 1675,  513, 1675,   84,
-
-       85,   91,  154, 1675,   89,   85, 1675,   89,   85,  498,
-      515,  515,  515,  515,  516, 1675,  511,  517,  512,   89,
-      517,   84,   84, 1675,  514,  518,  517,   84,   84,  517,
-       91,   84,   89,   85,   84,   89,   85, 1675,   85,   84,
-     1675,  533, 1675,   85,   85,   84, 1675,   85, 1675, 1675,
-       85,   84,   89,  535,  154,   85,   84,   84, 1675,  537,
-       84,   85,  154,   84, 1675,   84,   85,   89,   84,   93,
-      533,   85,   85,   89,   84,   85,   93,  536,   85,  154,
-       89,   85,  154,   85,  154,   94,   84,  540, 1675,   85,
-      154,   89,   94, 1675,   84,   89,  534, 1675,   93, 1675,
-
-     1675,   89,   85, 1675, 1675,   93,  536,  154, 1675,   85,
-     1675,   89,  154,   94,  154,   84,  540, 1675, 1675,   89,
-       94,  538,  538,  538,  538,  538,  538,  538,   84,   84,
-       85,  538,  538,  539,  538,  538,  538, 1675,  541,   89,
-       84,  543,  154, 1675,   85,  545,  542, 1675,  154, 1675,
-       84, 1675,   84,  528, 1675, 1675,   85,   84,   84,   84,
-      538,  538,  539,  538,  538,  538,   85,  541,   85,   84,
-      543,   84,   85,  545,  529,  546,  154,   89,   89,   84,
-     1675,   84,   84,   84,   85,  547, 1675,   85,   84,   89,
-      548,   91,   84,   84,   85,  154,   85,  154,   85,   85,
-
-       84,   89,   91,  546,  561,   89,   89,   89,   85,   85,
-     1675,   84,   84, 1675,  547,   85,   93,   89,  562, 1675,
-       91,   84,   84,  154, 1675,  154,   85,   85, 1675,   89,
-     1675,   91,   94, 1675, 1675,   89,   85,   85,  549,  549,
-      549,  549,  549,  549,  549,   93,   84,  562,  549,  549,
-      550,  549,  549,  549,  553,  551,  551,  551,  551,  551,
-       94,  563,   85, 1675,  154, 1675,  154,   84,  560, 1675,
-     1675,   89,   84,   93, 1675,   84,   89,  549,  549,  550,
-      549,  549,  549,   85,  564, 1675, 1675,  154,   85,   94,
-       85,  564,  154,  564,  154,  560,   84,   84,   84,   89,
-
-      564,   84,   93,  565,   89,   84,   84,  567,   84, 1675,
-      528,   85,  528,   85,   85,  154,   85,   94, 1675, 1675,
-      528,   85,   85,   89,   85,  154,   84,   84,   84,  566,
-       84, 1675,  565, 1675,   84,   84,  567,   84,   84,   91,
-     1675,   85,   85,  559,   85,  576,   85,   91, 1675,   85,
-       85,   89,   85,  154,   85, 1675,  566,   84, 1675,   84,
-     1675,   84,   84, 1675, 1675, 1675,   89,   84,   91, 1675,
-       89,  154,   85,  154,   85,  572,   91,   85,   85,   89,
-     1675,   93,   85,  568,  568,  568,  568,  568,  568,  568,
-       84,   84,   93,   84,   89,   84, 1675,   94,   89,  154,
-
-       89,  154, 1675,  579,   84,   85,   85,   89,   94,   85,
-       93,   85, 1675,  580, 1675, 1675,  585, 1675, 1675, 1675,
-      583,   93,   84, 1675,   84,   94, 1675, 1675,   89,  154,
-      579,   84, 1675,   84,  154, 1675,   94,   85,   89,   85,
-      569,  569,  569,  569,  569,  569,  569,   85,  583, 1675,
-      569,  569,  570,  569,  569,  569, 1675,  154, 1675, 1675,
-       84, 1675,  154,  586, 1675, 1675,   89,  584, 1675, 1675,
-     1675, 1675,  586,   89,  154,   85,   84,   84, 1675,  569,
-      569,  570,  569,  569,  569,  577,  577,  577,  577,  577,
-      577,  577,   85,   85, 1675,  577,  577,  578,  577,  577,
-
-      577,   89,  154, 1675, 1675,   84,   84,  617,  617,  617,
-      617,  617,  617,  617, 1675, 1675, 1675, 1675, 1675,  590,
-       85,   85,   84,   84,  577,  577,  578,  577,  577,  577,
-      581,  581,  581,  581,  581,  581,  581,  154,   85,   85,
-      581,  581,  582,  581,  581,  581,  586, 1675, 1675,  619,
-     1675,   84,   84,   89,   89,  586,  608, 1675,  154,   93,
-       84,   84, 1675, 1675, 1675,  154,   85,   85,  594,  581,
-      581,  582,  581,  581,  581,   94,   85,   85,   89, 1675,
-     1675,   89,   89, 1675, 1675,   93,  154, 1675,   93,   84,
-       84,  644,  644,  644,  644,  644,  644,  644,  572,  154,
-
-       89,   94,   89,   94,   85,   85,   89,  591,  591,  591,
-      591,  591,  591,  591,   93,  592,   84,  591,  591,  593,
-      591,  591,  591, 1675, 1675, 1675, 1675,  154,   89,   94,
-       89, 1675,   85, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675,  572,  154,  154,  605,   84,  591,  591,  593,  591,
-      591,  591,  595,  595,  595,  595,  595,  595,  595,   84,
-       85,   84,  595,  595,  596,  595,  595,  595,   91, 1675,
-      154,  154, 1675,   93, 1675,   85,   89,   85,   89,  154,
-       94, 1675, 1675, 1675, 1675,  613, 1675, 1675,   84,   94,
-       84,  595,  595,  596,  595,  595,  595,   91,  154,   89,
-
-       84, 1675,   93,   85,   89,   85,   89,  154,   94,  597,
-      597,  597,  597,  597,  597,  597,   85,   94, 1675,  597,
-      597,  598,  597,  597,  597, 1675,  154,   89, 1675,   84,
-      622,  612,  612, 1675, 1675, 1675, 1675, 1675, 1675,   89,
-      612,  612,  154,  154,   85,   84,   84,   93,  597,  597,
-      598,  597,  597,  597,  599,  599,  599,  599,  599,  599,
-      599,   85,   85,   94,   89,   84,   84,   89,   89, 1675,
-      154,  154,   89,  154,   84,   84,   93,  154,   89,   89,
-     1675,   85,   85, 1675, 1675, 1675,  632, 1675,  628,   85,
-       85,   94,   89, 1675,   84,   84,   89,  628, 1675,  154,
-
-       89,  154,   84, 1675,  154,  154,   89,   89,  635,   85,
-       85,  600,  600,  600,  600,  600,  600,  600,   85, 1675,
-       93,  600,  600,  601,  600,  600,  600,  154, 1675, 1675,
-     1675,   84,  154,  628, 1675, 1675,   94, 1675, 1675, 1675,
-     1675, 1675,  628, 1675,   89,   89,   85,   84, 1675,   93,
-      600,  600,  601,  600,  600,  600,  606,  606,  606,  606,
-      606,  606,  606,   85,   94,   89,  606,  606,  607,  606,
-      606,  606,   89,   89, 1675, 1675,   84,  640, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,  154,
-      154,   85,   84,   89,   89,  606,  606,  607,  606,  606,
-
-      606,  609,  609,  609,  609,  609,  609,  609,   85,  610,
-       93,  609,  609,  611,  609,  609,  609,  154,  154,  643,
-     1675,   84,   89, 1675, 1675, 1675,   94, 1675, 1675, 1675,
-     1675,  650, 1675, 1675,   89,  154,   85,   84, 1675,   93,
-      609,  609,  611,  609,  609,  609,  614,  614,  614,  614,
-      614,  614,  614,   85,   94,   84,  614,  614,  615,  614,
-      614,  614,   89,  154,  643, 1675,   84, 1675, 1675, 1675,
-     1675,   85, 1675, 1675, 1675, 1675, 1675, 1675, 1675,  154,
-       89,   85,   84, 1675,   84,  614,  614,  615,  614,  614,
-      614,  620,  620,  620,  620,  620,  620,  620,   85,   85,
-
-       89,  620,  620,  621,  620,  620,  620,  154,   89, 1675,
-     1675,   84, 1675,  666, 1675, 1675,   89, 1675, 1675, 1675,
-     1675, 1675,  666, 1675,  154,  154,   85,   84,   89,   89,
-      620,  620,  621,  620,  620,  620,  623,  623,  623,  623,
-      623,  623,  623,   85,   89,   84,  623,  623,  624,  623,
-      623,  623,  154,  154, 1675, 1675,   84,   89,  666, 1675,
-     1675,   85, 1675, 1675, 1675, 1675, 1675,  666, 1675,   89,
-      154,   85,   84, 1675,   84,  623,  623,  624,  623,  623,
-      623,  625,  625,  625,  625,  625,  625,  625,   85,   85,
-       89,  625,  625,  626,  625,  625,  625,   89,  154, 1675,
-
-     1675,   84, 1675, 1675, 1675,  699,  154, 1675,   89,   89,
-     1675,  154,  154,   89,  699,   89,   85,   93,   89,   84,
-      625,  625,  626,  625,  625,  625,  627,  627,  627,  627,
-      627,  627,  627,   94,  154,   85,   89,   89,   84,  154,
-      154,   89,  154,   89,  722,  154,   93,   89,   84,   89,
-     1675,  154,  154,   89,   85, 1675, 1675, 1675, 1675, 1675,
-      699,   94,   84,   85, 1675, 1675, 1675,   84, 1675,  699,
-      154,   89,  154,  154,   84,   89,  154,   89,   85,  154,
-      154,   89,   85,  633,  633,  633,  633,  633,  633,  633,
-       85,   84,   89,  633,  633,  634,  633,  633,  633,   89,
-
-      154,  722, 1675,   84,  154, 1675,   85, 1675,   89, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675,   89,  154,   85,   84,
-       89,  154,  633,  633,  634,  633,  633,  633,  636,  636,
-      636,  636,  636,  636,  636,   85,   89,   89,  636,  636,
-      637,  636,  636,  636,   89,  154, 1675, 1675,   84,  154,
-     1675, 1675,   89,   89,  154, 1675, 1675, 1675, 1675, 1675,
-     1675,  154,   89,   85,   89,   89,  154,  636,  636,  637,
-      636,  636,  636,  638,  638,  638,  638,  638,  638,  638,
-       89,   89,  154,  638,  638,  639,  638,  638,  638,  154,
-       89, 1675,   89, 1675,  154, 1675, 1675,  154,   89,   89,
-
-     1675, 1675, 1675, 1675, 1675, 1675,  154,  154,   89,   89,
-      154,  154,  638,  638,  639,  638,  638,  638,  641,  641,
-      641,  641,  641,  641,  641,  154,   89,   89,  641,  641,
-      642,  641,  641,  641,  154,  154,   89,   89,  154,  154,
-     1675, 1675,   89,   89,  154, 1675, 1675, 1675, 1675, 1675,
-     1675,  154,   89,   89,  154,  154,   89,  641,  641,  642,
-      641,  641,  641,  646,  646,  646,  646,  646,  646,  646,
-       89,   89,  154,  646,  646,  647,  646,  646,  646,  154,
-       89,   89,  154,  154,   89, 1675, 1675,   89,  154,  154,
-     1675, 1675, 1675, 1675, 1675, 1675,   89,   89,  154,  154,
-
-       89,   89,  646,  646,  647,  646,  646,  646,  648,  648,
-      648,  648,  648,  648,  648,   89,  154,  154,  648,  648,
-      649,  648,  648,  648,   89,   89,  154,  154,   89,   89,
-     1675, 1675,  154,  154,   89, 1675, 1675, 1675, 1675, 1675,
-     1675,   89,  154,  154,   89,   89,  154,  648,  648,  649,
-      648,  648,  648,  651,  651,  651,  651,  651,  651,  651,
-      154,  154,   89,  651,  651,  652,  651,  651,  651,   89,
-      154,  154,   89,   89,  154, 1675, 1675,  154,   89,   89,
-      154,  154, 1675,   89,   89,  154,  154,   89,   89,  154,
-      154,   89,  651,  651,  652,  651,  651,  651,  653,  653,
-
-      653,  653,  653,  653,  653,  154,   89,   89,  154,  154,
-       84,   89,   89,  154,  154,   89,   89,  154,  154,   89,
-       89,  154,  154,   89,   89,  154,   85, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675,  154,   89,   89, 1675, 1675,   84,
-     1675, 1675, 1675,  154,  154,   89,   89,  154,   89,  154,
-      154,   89,   89,  154,   85,  654,  654,  654,  654,  654,
-      654,  654,  154,   89,   89,  654,  654,  655,  654,  654,
-      654,  154,  154,   89,   89,  154, 1675, 1675, 1675,  154,
-     1675,   89, 1675, 1675, 1675, 1675, 1675, 1675,   89,  154,
-      154,   89,   89,  154,  654,  654,  655,  654,  654,  654,
-
-      657,  657,  657,  657,  657,  657,  657,  154,  658,   89,
-      657,  657,  659,  657,  657,  657,   89,  154,  154,   89,
-       89,  154, 1675, 1675,  154,   89,   89, 1675, 1675, 1675,
-     1675, 1675, 1675,  154,  154,   89,   89,  154,  154,  657,
-      657,  659,  657,  657,  657,  660,  660,  660,  660,  660,
-      660,  660,  154,   89,   89,  660,  660,  661,  660,  660,
-      660,  154,  154,   89,   89,  154,  154, 1675, 1675,   89,
-       89,  154, 1675, 1675, 1675, 1675, 1675, 1675,  154,   89,
-       89,  154,  154,   89,  660,  660,  661,  660,  660,  660,
-      662,  662,  662,  662,  662,  662,  662,   89,   89,  154,
-
-      662,  662,  663,  662,  662,  662,  154,   89,   89,  154,
-      154,   89, 1675, 1675,   89,  154,  154, 1675, 1675, 1675,
-     1675, 1675, 1675,   89,   89,  154,  154,   89,   89,  662,
-      662,  663,  662,  662,  662,  664,  664,  664,  664,  664,
-      664,  664,   89,  154,  154,  664,  664,  665,  664,  664,
-      664,   89,   89,  154,  154,   89,   89, 1675, 1675,  154,
-      154,   89, 1675, 1675, 1675, 1675, 1675, 1675,   89,  154,
-      154,   89,   89,  154,  664,  664,  665,  664,  664,  664,
-      668,  668,  668,  668,  668,  668,  668,  154,  154,   89,
-      668,  668,  669,  668,  668,  668,   89,  154,  154,   89,
-
-       89,  154, 1675, 1675,  154,   89,   89, 1675, 1675, 1675,
-     1675, 1675, 1675,  154,  154,   89,   89,  154,  154,  668,
-      668,  669,  668,  668,  668,  670,  670,  670,  670,  670,
-      670,  670,  154,   89,   89,  670,  670,  671,  670,  670,
-      670,  154,  154,   89,   89,  154,  154, 1675, 1675,   89,
-     1675,   89, 1675, 1675, 1675, 1675, 1675, 1675,  154,  154,
-       89,   89,  154,  154,  670,  670,  671,  670,  670,  670,
-      672,  672,  672,  672,  672,  672,  672,   89,  673,   89,
-      672,  672,  674,  672,  672,  672,  154,  154,   89,   89,
-      154,  154, 1675, 1675,   89,   89,  154, 1675, 1675, 1675,
-
-     1675, 1675, 1675,  154,   89,   89,  154,  154,   89,  672,
-      672,  674,  672,  672,  672,  675,  675,  675,  675,  675,
-      675,  675,   89,   89,  154,  675,  675,  676,  675,  675,
-      675,  154,   89,   89,  154,  154,   89, 1675, 1675,   89,
-      154,  154, 1675, 1675, 1675, 1675, 1675, 1675,   89,   89,
-      154,  154,   89,   89,  675,  675,  676,  675,  675,  675,
-      677,  677,  677,  677,  677,  677,  677,   89,  154,  154,
-      677,  677,  678,  677,  677,  677,   89,   89,  154,  154,
-       89,   89, 1675, 1675,  154,  154,   89, 1675, 1675, 1675,
-     1675, 1675, 1675,   89,  154,  154,   89,   89,  154,  677,
-
-      677,  678,  677,  677,  677,  680,  680,  680,  680,  680,
-      680,  680,  154,  154,   89,  680,  680,  681,  680,  680,
-      680,   89,  154,  154,   89,   89,  154, 1675, 1675,  154,
-       89,   89, 1675, 1675, 1675, 1675, 1675, 1675,  154,  154,
-       89,   89,  154,  154,  680,  680,  681,  680,  680,  680,
-      682,  682,  682,  682,  682,  682,  682,  154,   89,   89,
-      682,  682,  683,  682,  682,  682,  154,  154,   89,   89,
-      154,  154, 1675, 1675,   89,   89,  154, 1675, 1675, 1675,
-     1675, 1675, 1675,  154,   89,   89,  154,  154,   89,  682,
-      682,  683,  682,  682,  682,  684,  684,  684,  684,  684,
-
-      684,  684,   89,   89,  154,  684,  684,  685,  684,  684,
-      684,  154,   89,   89,  154,  154,   89, 1675, 1675,   89,
-      154,  154, 1675, 1675, 1675, 1675, 1675, 1675,   89,   89,
-      154,  154,   89,   89,  684,  684,  685,  684,  684,  684,
-      686,  686,  686,  686,  686,  686,  686,   89,  154,  154,
-      686,  686,  687,  686,  686,  686,   89,   89,  154,  154,
-       89,   89, 1675, 1675,  154,  154,   89, 1675, 1675, 1675,
-     1675, 1675, 1675,   89,  154,  154,   89,   89,  154,  686,
-      686,  687,  686,  686,  686,  688,  688,  688,  688,  688,
-      688,  688,  154,  154,   89,  688,  688,  689,  688,  688,
-
-      688,   89,  154,  154,   89,   89,  154, 1675, 1675,  154,
-       89,   89, 1675, 1675, 1675, 1675, 1675, 1675,  154,  154,
-       89,   89,  154,  154,  688,  688,  689,  688,  688,  688,
-      691,  691,  691,  691,  691,  691,  691,  154,   89,   89,
-      691,  691,  692,  691,  691,  691,  154,  154,   89,   89,
-      154,  154, 1675, 1675,   89,   89,  154, 1675, 1675, 1675,
-     1675, 1675, 1675,  154,   89,   89,  154,  154,   89,  691,
-      691,  692,  691,  691,  691,  693,  693,  693,  693,  693,
-      693,  693,   89,   89,  154,  693,  693,  694,  693,  693,
-      693,  154,   89,   89,  154,  154,   89, 1675, 1675,   89,
-
-      154,  154, 1675, 1675, 1675, 1675, 1675, 1675,   89,   89,
-      154,  154,   89,   89,  693,  693,  694,  693,  693,  693,
-      695,  695,  695,  695,  695,  695,  695,   89,  154,  154,
-      695,  695,  696,  695,  695,  695,   89,   89,  154,  154,
-       89,   89, 1675, 1675,  154,  154,   89, 1675, 1675, 1675,
-     1675, 1675, 1675,   89,  154,  154,   89,   89,  154,  695,
-      695,  696,  695,  695,  695,  697,  697,  697,  697,  697,
-      697,  697,  154,  154,   89,  697,  697,  698,  697,  697,
-      697,   89,  154,  154,   89,   89,  154, 1675, 1675,  154,
-       89,   89, 1675, 1675, 1675, 1675, 1675, 1675,  154,  154,
-
-       89,   89,  154,  154,  697,  697,  698,  697,  697,  697,
-      701,  701,  701,  701,  701,  701,  701,  154,   89,   89,
-      701,  701,  702,  701,  701,  701,  154,  154,   89,   89,
-      154,  154, 1675, 1675,   89,   89,  154, 1675, 1675, 1675,
-     1675, 1675, 1675,  154,   89,   89,  154,  154,   89,  701,
-      701,  702,  701,  701,  701,  703,  703,  703,  703,  703,
-      703,  703,   89,   89,  154,  703,  703,  704,  703,  703,
-      703,  154,   89,   89,  154,  154,   89, 1675, 1675,   89,
-      154,  154, 1675, 1675, 1675, 1675, 1675, 1675,   89,   89,
-      154,  154,   89,   89,  703,  703,  704,  703,  703,  703,
-
-      705,  705,  705,  705,  705,  705,  705,   89,  154,  154,
-      705,  705,  706,  705,  705,  705,   89,   89,  154,  154,
-       89,   89, 1675, 1675,  154,  154,   89, 1675, 1675, 1675,
-     1675, 1675, 1675,   89,  154,  154,   89,   89,  154,  705,
-      705,  706,  705,  705,  705,  707,  707,  707,  707,  707,
-      707,  707,  154,  154,   89,  707,  707,  708,  707,  707,
-      707,   89,  154,  154,   89,   89,  154, 1675, 1675,  154,
-       89,   89, 1675, 1675, 1675, 1675, 1675, 1675,  154,  154,
-       89,   89,  154,  154,  707,  707,  708,  707,  707,  707,
-      709,  709,  709,  709,  709,  709,  709,  154,   89,   89,
-
-      709,  709,  710,  709,  709,  709,  154,  154,   89,   89,
-      154,  154, 1675, 1675,   89,   89,  154, 1675, 1675, 1675,
-     1675, 1675, 1675,  154,   89,   89,  154,  154,   89,  709,
-      709,  710,  709,  709,  709,  712,  712,  712,  712,  712,
-      712,  712,   89,   89,  154,  712,  712,  713,  712,  712,
-      712,  154,   89,   89,  154,  154,   89, 1675, 1675,   89,
-      154,  154, 1675, 1675, 1675, 1675, 1675, 1675,   89,   89,
-      154,  154,   89,   89,  712,  712,  713,  712,  712,  712,
-      714,  714,  714,  714,  714,  714,  714,   89,  154,  154,
-      714,  714,  715,  714,  714,  714,   89,   89,  154,  154,
-
-       89,   89, 1675, 1675,  154,  154,   89, 1675, 1675, 1675,
-     1675, 1675, 1675,   89,  154,  154,   89,   89,  154,  714,
-      714,  715,  714,  714,  714,  716,  716,  716,  716,  716,
-      716,  716,  154,  154,   89,  716,  716,  717,  716,  716,
-      716,   89,  154,  154,   89,   89,  154, 1675, 1675,  154,
-       89,   89, 1675, 1675, 1675, 1675, 1675, 1675,  154,  154,
-       89,   89,  154,  154,  716,  716,  717,  716,  716,  716,
-      718,  718,  718,  718,  718,  718,  718,  154,   89,   89,
-      718,  718,  719,  718,  718,  718,  154,  154,   89,   89,
-      154,  154, 1675, 1675,   89,   89,  154, 1675, 1675, 1675,
-
-     1675, 1675, 1675,  154,   89,   89,  154,  154,   89,  718,
-      718,  719,  718,  718,  718,  720,  720,  720,  720,  720,
-      720,  720,   89,   89,  154,  720,  720,  721,  720,  720,
-      720,  154,   89,   89,  154,  154,   89, 1675, 1675,   89,
-      154,  154, 1675, 1675, 1675, 1675, 1675, 1675,   89,   89,
-      154,  154,   89,   89,  720,  720,  721,  720,  720,  720,
-      723,  723,  723,  723,  723,  723,  723,   89,  154,  154,
-      723,  723,  724,  723,  723,  723,   89,   89,  154,  154,
-       89,   89, 1675, 1675,  154,  154,   89, 1675, 1675, 1675,
-     1675, 1675, 1675,  154,  154,   89,  154,   89,  154,  723,
-
-      723,  724,  723,  723,  723,  725,  725,  725,  725,  725,
-      725,  725,  154,  154,   89,  725,  725,  726,  725,  725,
-      725,  154,  154,   89,  154,   89,  154, 1675, 1675,   89,
-      154, 1675, 1675, 1675, 1675, 1675, 1675,  658,  154, 1675,
-     1675, 1675, 1675, 1675,  725,  725,  726,  725,  725,  725,
-      727,  727,  727,  727,  727,  727,  727,   89,  154,   89,
-      727,  727,  728,  727,  727,  727,  154, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-      673, 1675, 1675, 1675, 1675, 1675, 1675,   89, 1675,  727,
-      727,  728,  727,  727,  727,  729,  729,  729,  729,  729,
-
-      729,  729,  154, 1675, 1675,  729,  729,  730,  729,  729,
-      729, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-      154, 1675, 1675, 1675,  729,  729,  730,  729,  729,  729,
-      731,  731,  731,  731,  731,  731,  731, 1675, 1675, 1675,
-      731,  731,  732,  731,  731,  731, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,  731,
-      731,  732,  731,  731,  731,  733,  733,  733,  733,  733,
-      733,  733, 1675, 1675, 1675,  733,  733,  734,  733,  733,
-
-      733, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675,  733,  733,  734,  733,  733,  733,
-      735,  735,  735,  735,  735,  735,  735, 1675, 1675, 1675,
-      735,  735,  736,  735,  735,  735, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,  735,
-      735,  736,  735,  735,  735,  737,  737,  737,  737,  737,
-      737,  737, 1675, 1675, 1675,  737,  737,  738,  737,  737,
-      737, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675,  737,  737,  738,  737,  737,  737,
-      739,  739,  739,  739,  739,  739,  739, 1675, 1675, 1675,
-      739,  739,  740,  739,  739,  739, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,  739,
-      739,  740,  739,  739,  739,  741,  741,  741,  741,  741,
-      741,  741, 1675, 1675, 1675,  741,  741,  742,  741,  741,
-      741, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-
-     1675, 1675, 1675, 1675,  741,  741,  742,  741,  741,  741,
-      743,  743,  743,  743,  743,  743,  743, 1675, 1675, 1675,
-      743,  743,  744,  743,  743,  743, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,  743,
-      743,  744,  743,  743,  743,  745,  745,  745,  745,  745,
-      745,  745, 1675, 1675, 1675,  745,  745,  746,  745,  745,
-      745, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675,  745,  745,  746,  745,  745,  745,
-
-      747,  747,  747,  747,  747,  747,  747, 1675, 1675, 1675,
-      747,  747,  748,  747,  747,  747, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,  747,
-      747,  748,  747,  747,  747,  749,  749,  749,  749,  749,
-      749,  749, 1675, 1675, 1675,  749,  749,  750,  749,  749,
-      749, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675,  749,  749,  750,  749,  749,  749,
-      751,  751,  751,  751,  751,  751,  751, 1675, 1675, 1675,
-
-      751,  751,  752,  751,  751,  751, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,  751,
-      751,  752,  751,  751,  751,  753,  753,  753,  753,  753,
-      753,  753, 1675, 1675, 1675,  753,  753,  754,  753,  753,
-      753, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675,  753,  753,  754,  753,  753,  753,
-      755,  755,  755,  755,  755,  755,  755, 1675, 1675, 1675,
-      755,  755,  756,  755,  755,  755, 1675, 1675, 1675, 1675,
-
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,  755,
-      755,  756,  755,  755,  755,  757,  757,  757,  757,  757,
-      757,  757, 1675, 1675, 1675,  757,  757,  758,  757,  757,
-      757, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675,  757,  757,  758,  757,  757,  757,
-      759,  759,  759,  759,  759,  759,  759, 1675, 1675, 1675,
-      759,  759,  760,  759,  759,  759, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,  759,
-      759,  760,  759,  759,  759,  761,  761,  761,  761,  761,
-      761,  761, 1675, 1675, 1675,  761,  761,  762,  761,  761,
-      761, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675,  761,  761,  762,  761,  761,  761,
-      763,  763,  763,  763,  763,  763,  763, 1675, 1675, 1675,
-      763,  763,  764,  763,  763,  763, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,  763,
-
-      763,  764,  763,  763,  763,  765,  765,  765,  765,  765,
-      765,  765, 1675, 1675, 1675,  765,  765,  766,  765,  765,
-      765, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675,  765,  765,  766,  765,  765,  765,
-      767,  767,  767,  767,  767,  767,  767, 1675, 1675, 1675,
-      767,  767,  768,  767,  767,  767, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,  767,
-      767,  768,  767,  767,  767,  769,  769,  769,  769,  769,
-
-      769,  769, 1675, 1675, 1675,  769,  769,  770,  769,  769,
-      769, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675,  769,  769,  770,  769,  769,  769,
-      771,  771,  771,  771,  771,  771,  771, 1675, 1675, 1675,
-      771,  771,  772,  771,  771,  771, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,  771,
-      771,  772,  771,  771,  771,  773,  773,  773,  773,  773,
-      773,  773, 1675, 1675, 1675,  773,  773,  774,  773,  773,
-
-      773, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675,  773,  773,  774,  773,  773,  773,
-      775,  775,  775,  775,  775,  775,  775, 1675, 1675, 1675,
-      775,  775,  776,  775,  775,  775, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,  775,
-      775,  776,  775,  775,  775,  777,  777,  777,  777,  777,
-      777,  777, 1675, 1675, 1675,  777,  777,  778,  777,  777,
-      777, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675,  777,  777,  778,  777,  777,  777,
-      779,  779,  779,  779,  779,  779,  779, 1675, 1675, 1675,
-      779,  779,  780,  779,  779,  779, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,  779,
-      779,  780,  779,  779,  779,  781,  781,  781,  781,  781,
-      781,  781, 1675, 1675, 1675,  781,  781,  782,  781,  781,
-      781, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-
-     1675, 1675, 1675, 1675,  781,  781,  782,  781,  781,  781,
-      783,  783,  783,  783,  783,  783,  783, 1675, 1675, 1675,
-      783,  783,  784,  783,  783,  783, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,  783,
-      783,  784,  783,  783,  783,  785,  785,  785,  785,  785,
-      785,  785, 1675, 1675, 1675,  785,  785,  786,  785,  785,
-      785, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675,  785,  785,  786,  785,  785,  785,
-
-      787,  787,  787,  787,  787,  787,  787, 1675, 1675, 1675,
-      787,  787,  788,  787,  787,  787, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,  787,
-      787,  788,  787,  787,  787,  789,  789,  789,  789,  789,
-      789,  789, 1675, 1675, 1675,  789,  789,  790,  789,  789,
-      789, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675,  789,  789,  790,  789,  789,  789,
-      791,  791,  791,  791,  791,  791,  791, 1675, 1675, 1675,
-
-      791,  791,  792,  791,  791,  791, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,  791,
-      791,  792,  791,  791,  791,  793,  793,  793,  793,  793,
-      793,  793, 1675, 1675, 1675,  793,  793,  794,  793,  793,
-      793, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675,  793,  793,  794,  793,  793,  793,
-      795,  795,  795,  795,  795,  795,  795, 1675, 1675, 1675,
-      795,  795,  796,  795,  795,  795, 1675, 1675, 1675, 1675,
-
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,  795,
-      795,  796,  795,  795,  795,  797,  797,  797,  797,  797,
-      797,  797, 1675, 1675, 1675,  797,  797,  798,  797,  797,
-      797, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675,  797,  797,  798,  797,  797,  797,
-      799,  799,  799,  799,  799,  799,  799, 1675, 1675, 1675,
-      799,  799,  800,  799,  799,  799, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,  799,
-      799,  800,  799,  799,  799,  801,  801,  801,  801,  801,
-      801,  801, 1675, 1675, 1675,  801,  801,  802,  801,  801,
-      801, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675,  801,  801,  802,  801,  801,  801,
-      803,  803,  803,  803,  803,  803,  803, 1675, 1675, 1675,
-      803,  803,  804,  803,  803,  803, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,  803,
-
-      803,  804,  803,  803,  803,  805,  805,  805,  805,  805,
-      805,  805, 1675, 1675, 1675,  805,  805,  806,  805,  805,
-      805, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675,  805,  805,  806,  805,  805,  805,
-      807,  807,  807,  807,  807,  807,  807, 1675, 1675, 1675,
-      807,  807,  808,  807,  807,  807, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,  807,
-      807,  808,  807,  807,  807,  809,  809,  809,  809,  809,
-
-      809,  809, 1675, 1675, 1675,  809,  809,  810,  809,  809,
-      809, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675,  809,  809,  810,  809,  809,  809,
-      811,  811,  811,  811,  811,  811,  811, 1675, 1675, 1675,
-      811,  811,  812,  811,  811,  811, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,  811,
-      811,  812,  811,  811,  811,  813,  813,  813,  813,  813,
-      813,  813, 1675, 1675, 1675,  813,  813,  814,  813,  813,
-
-      813, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675,  813,  813,  814,  813,  813,  813,
-      815,  815,  815,  815,  815,  815,  815, 1675, 1675, 1675,
-      815,  815,  816,  815,  815,  815, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,  815,
-      815,  816,  815,  815,  815,  817,  817,  817,  817,  817,
-      817,  817, 1675, 1675, 1675,  817,  817,  818,  817,  817,
-      817, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675,  817,  817,  818,  817,  817,  817,
-      819,  819,  819,  819,  819,  819,  819, 1675, 1675, 1675,
-      819,  819,  820,  819,  819,  819, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,  819,
-      819,  820,  819,  819,  819,  821,  821,  821,  821,  821,
-      821,  821, 1675, 1675, 1675,  821,  821,  822,  821,  821,
-      821, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-
-     1675, 1675, 1675, 1675,  821,  821,  822,  821,  821,  821,
-      823,  823,  823,  823,  823,  823,  823, 1675, 1675, 1675,
-      823,  823,  824,  823,  823,  823, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,  823,
-      823,  824,  823,  823,  823,  825,  825,  825,  825,  825,
-      825,  825, 1675, 1675, 1675,  825,  825,  826,  825,  825,
-      825, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675,  825,  825,  826,  825,  825,  825,
-
-      827,  827,  827,  827,  827,  827,  827, 1675, 1675, 1675,
-      827,  827,  828,  827,  827,  827, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,  827,
-      827,  828,  827,  827,  827,  829,  829,  829,  829,  829,
-      829,  829, 1675, 1675, 1675,  829,  829,  830,  829,  829,
-      829, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675,  829,  829,  830,  829,  829,  829,
-      831,  831,  831,  831,  831,  831,  831, 1675, 1675, 1675,
-
-      831,  831,  832,  831,  831,  831, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,  831,
-      831,  832,  831,  831,  831,  833,  833,  833,  833,  833,
-      833,  833, 1675, 1675, 1675,  833,  833,  834,  833,  833,
-      833, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675,  833,  833,  834,  833,  833,  833,
-      835,  835,  835,  835,  835,  835,  835, 1675, 1675, 1675,
-      835,  835,  836,  835,  835,  835, 1675, 1675, 1675, 1675,
-
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,  835,
-      835,  836,  835,  835,  835,  837,  837,  837,  837,  837,
-      837,  837, 1675, 1675, 1675,  837,  837,  838,  837,  837,
-      837, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675,  837,  837,  838,  837,  837,  837,
-      839,  839,  839,  839,  839,  839,  839, 1675, 1675, 1675,
-      839,  839,  840,  839,  839,  839, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,  839,
-      839,  840,  839,  839,  839,  841,  841,  841,  841,  841,
-      841,  841, 1675, 1675, 1675,  841,  841,  842,  841,  841,
-      841, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675,  841,  841,  842,  841,  841,  841,
-      843,  843,  843,  843,  843,  843,  843, 1675, 1675, 1675,
-      843,  843,  844,  843,  843,  843, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,  843,
-
-      843,  844,  843,  843,  843,  845,  845,  845,  845,  845,
-      845,  845, 1675, 1675, 1675,  845,  845,  846,  845,  845,
-      845, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675,  845,  845,  846,  845,  845,  845,
-      847,  847,  847,  847,  847,  847,  847, 1675, 1675, 1675,
-      847,  847,  848,  847,  847,  847, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,  847,
-      847,  848,  847,  847,  847,  849,  849,  849,  849,  849,
-
-      849,  849, 1675, 1675, 1675,  849,  849,  850,  849,  849,
-      849, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675,  849,  849,  850,  849,  849,  849,
-      851,  851,  851,  851,  851,  851,  851, 1675, 1675, 1675,
-      851,  851,  852,  851,  851,  851, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,  851,
-      851,  852,  851,  851,  851,  853,  853,  853,  853,  853,
-      853,  853, 1675, 1675, 1675,  853,  853,  854,  853,  853,
-
-      853, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675,  853,  853,  854,  853,  853,  853,
-      855,  855,  855,  855,  855,  855,  855, 1675, 1675, 1675,
-      855,  855,  856,  855,  855,  855, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,  855,
-      855,  856,  855,  855,  855,  857,  857,  857,  857,  857,
-      857,  857, 1675, 1675, 1675,  857,  857,  858,  857,  857,
-      857, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675,  857,  857,  858,  857,  857,  857,
-      859,  859,  859,  859,  859,  859,  859, 1675, 1675, 1675,
-      859,  859,  860,  859,  859,  859, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,  859,
-      859,  860,  859,  859,  859,  861,  861,  861,  861,  861,
-      861,  861, 1675, 1675, 1675,  861,  861,  862,  861,  861,
-      861, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-
-     1675, 1675, 1675, 1675,  861,  861,  862,  861,  861,  861,
-      863,  863,  863,  863,  863,  863,  863, 1675, 1675, 1675,
-      863,  863,  864,  863,  863,  863, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,  863,
-      863,  864,  863,  863,  863,  865,  865,  865,  865,  865,
-      865,  865, 1675, 1675, 1675,  865,  865,  866,  865,  865,
-      865, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675,  865,  865,  866,  865,  865,  865,
-
-      867,  867,  867,  867,  867,  867,  867, 1675, 1675, 1675,
-      867,  867,  868,  867,  867,  867, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,  867,
-      867,  868,  867,  867,  867,  869,  869,  869,  869,  869,
-      869,  869, 1675, 1675, 1675,  869,  869,  870,  869,  869,
-      869, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675,  869,  869,  870,  869,  869,  869,
-      871,  871,  871,  871,  871,  871,  871, 1675, 1675, 1675,
-
-      871,  871,  872,  871,  871,  871, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,  871,
-      871,  872,  871,  871,  871,  873,  873,  873,  873,  873,
-      873,  873, 1675, 1675, 1675,  873,  873,  874,  873,  873,
-      873, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675,  873,  873,  874,  873,  873,  873,
-      875,  875,  875,  875,  875,  875,  875, 1675, 1675, 1675,
-      875,  875,  876,  875,  875,  875, 1675, 1675, 1675, 1675,
-
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,  875,
-      875,  876,  875,  875,  875,  877,  877,  877,  877,  877,
-      877,  877, 1675, 1675, 1675,  877,  877,  878,  877,  877,
-      877, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675,  877,  877,  878,  877,  877,  877,
-      879,  879,  879,  879,  879,  879,  879, 1675, 1675, 1675,
-      879,  879,  880,  879,  879,  879, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,  879,
-      879,  880,  879,  879,  879,  881,  881,  881,  881,  881,
-      881,  881, 1675, 1675, 1675,  881,  881,  882,  881,  881,
-      881, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675,  881,  881,  882,  881,  881,  881,
-      883,  883,  883,  883,  883,  883,  883, 1675, 1675, 1675,
-      883,  883,  884,  883,  883,  883, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,  883,
-
-      883,  884,  883,  883,  883,  885,  885,  885,  885,  885,
-      885,  885, 1675, 1675, 1675,  885,  885,  886,  885,  885,
-      885, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675,  885,  885,  886,  885,  885,  885,
-      887,  887,  887,  887,  887,  887,  887, 1675, 1675, 1675,
-      887,  887,  888,  887,  887,  887, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,  887,
-      887,  888,  887,  887,  887,  889,  889,  889,  889,  889,
-
-      889,  889, 1675, 1675, 1675,  889,  889,  890,  889,  889,
-      889, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675,  889,  889,  890,  889,  889,  889,
-      891,  891,  891,  891,  891,  891,  891, 1675, 1675, 1675,
-      891,  891,  892,  891,  891,  891, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,  891,
-      891,  892,  891,  891,  891,  893,  893,  893,  893,  893,
-      893,  893, 1675, 1675, 1675,  893,  893,  894,  893,  893,
-
-      893, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675,  893,  893,  894,  893,  893,  893,
-      895,  895,  895,  895,  895,  895,  895, 1675, 1675, 1675,
-      895,  895,  896,  895,  895,  895, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,  895,
-      895,  896,  895,  895,  895,  897,  897,  897,  897,  897,
-      897,  897, 1675, 1675, 1675,  897,  897,  898,  897,  897,
-      897, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675,  897,  897,  898,  897,  897,  897,
-      899,  899,  899,  899,  899,  899,  899, 1675, 1675, 1675,
-      899,  899,  900,  899,  899,  899, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,  899,
-      899,  900,  899,  899,  899,  901,  901,  901,  901,  901,
-      901,  901, 1675, 1675, 1675,  901,  901,  902,  901,  901,
-      901, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-
-     1675, 1675, 1675, 1675,  901,  901,  902,  901,  901,  901,
-      903,  903,  903,  903,  903,  903,  903, 1675, 1675, 1675,
-      903,  903,  904,  903,  903,  903, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,  903,
-      903,  904,  903,  903,  903,  905,  905,  905,  905,  905,
-      905,  905, 1675, 1675, 1675,  905,  905,  906,  905,  905,
-      905, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675,  905,  905,  906,  905,  905,  905,
-
-      907,  907,  907,  907,  907,  907,  907, 1675, 1675, 1675,
-      907,  907,  908,  907,  907,  907, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,  907,
-      907,  908,  907,  907,  907,  909,  909,  909,  909,  909,
-      909,  909, 1675, 1675, 1675,  909,  909,  910,  909,  909,
-      909, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675,  909,  909,  910,  909,  909,  909,
-      911,  911,  911,  911,  911,  911,  911, 1675, 1675, 1675,
-
-      911,  911,  912,  911,  911,  911, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,  911,
-      911,  912,  911,  911,  911,  913,  913,  913,  913,  913,
-      913,  913, 1675, 1675, 1675,  913,  913,  914,  913,  913,
-      913, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675,  913,  913,  914,  913,  913,  913,
-      915,  915,  915,  915,  915,  915,  915, 1675, 1675, 1675,
-      915,  915,  916,  915,  915,  915, 1675, 1675, 1675, 1675,
-
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,  915,
-      915,  916,  915,  915,  915,  917,  917,  917,  917,  917,
-      917,  917, 1675, 1675, 1675,  917,  917,  918,  917,  917,
-      917, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675,  917,  917,  918,  917,  917,  917,
-      919,  919,  919,  919,  919,  919,  919, 1675, 1675, 1675,
-      919,  919,  920,  919,  919,  919, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,  919,
-      919,  920,  919,  919,  919,  921,  921,  921,  921,  921,
-      921,  921, 1675, 1675, 1675,  921,  921,  922,  921,  921,
-      921, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675,  921,  921,  922,  921,  921,  921,
-      923,  923,  923,  923,  923,  923,  923, 1675, 1675, 1675,
-      923,  923,  924,  923,  923,  923, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,  923,
-
-      923,  924,  923,  923,  923,  925,  925,  925,  925,  925,
-      925,  925, 1675, 1675, 1675,  925,  925,  926,  925,  925,
-      925, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675,  925,  925,  926,  925,  925,  925,
-      927,  927,  927,  927,  927,  927,  927, 1675, 1675, 1675,
-      927,  927,  928,  927,  927,  927, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,  927,
-      927,  928,  927,  927,  927,  929,  929,  929,  929,  929,
-
-      929,  929, 1675, 1675, 1675,  929,  929,  930,  929,  929,
-      929, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675,  929,  929,  930,  929,  929,  929,
-      931,  931,  931,  931,  931,  931,  931, 1675, 1675, 1675,
-      931,  931,  932,  931,  931,  931, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,  931,
-      931,  932,  931,  931,  931,  933,  933,  933,  933,  933,
-      933,  933, 1675, 1675, 1675,  933,  933,  934,  933,  933,
-
-      933, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675,  933,  933,  934,  933,  933,  933,
-      935,  935,  935,  935,  935,  935,  935, 1675, 1675, 1675,
-      935,  935,  936,  935,  935,  935, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,  935,
-      935,  936,  935,  935,  935,  937,  937,  937,  937,  937,
-      937,  937, 1675, 1675, 1675,  937,  937,  938,  937,  937,
-      937, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675,  937,  937,  938,  937,  937,  937,
-      939,  939,  939,  939,  939,  939,  939, 1675, 1675, 1675,
-      939,  939,  940,  939,  939,  939, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,  939,
-      939,  940,  939,  939,  939,  941,  941,  941,  941,  941,
-      941,  941, 1675, 1675, 1675,  941,  941,  942,  941,  941,
-      941, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-
-     1675, 1675, 1675, 1675,  941,  941,  942,  941,  941,  941,
-      943,  943,  943,  943,  943,  943,  943, 1675, 1675, 1675,
-      943,  943,  944,  943,  943,  943, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,  943,
-      943,  944,  943,  943,  943,  945,  945,  945,  945,  945,
-      945,  945, 1675, 1675, 1675,  945,  945,  946,  945,  945,
-      945, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675,  945,  945,  946,  945,  945,  945,
-
-      947,  947,  947,  947,  947,  947,  947, 1675, 1675, 1675,
-      947,  947,  948,  947,  947,  947, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,  947,
-      947,  948,  947,  947,  947,  949,  949,  949,  949,  949,
-      949,  949, 1675, 1675, 1675,  949,  949,  950,  949,  949,
-      949, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675,  949,  949,  950,  949,  949,  949,
-      951,  951,  951,  951,  951,  951,  951, 1675, 1675, 1675,
-
-      951,  951,  952,  951,  951,  951, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,  951,
-      951,  952,  951,  951,  951,  953,  953,  953,  953,  953,
-      953,  953, 1675, 1675, 1675,  953,  953,  954,  953,  953,
-      953, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675,  953,  953,  954,  953,  953,  953,
-      955,  955,  955,  955,  955,  955,  955, 1675, 1675, 1675,
-      955,  955,  956,  955,  955,  955, 1675, 1675, 1675, 1675,
-
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,  955,
-      955,  956,  955,  955,  955,  957,  957,  957,  957,  957,
-      957,  957, 1675, 1675, 1675,  957,  957,  958,  957,  957,
-      957, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675,  957,  957,  958,  957,  957,  957,
-      959,  959,  959,  959,  959,  959,  959, 1675, 1675, 1675,
-      959,  959,  960,  959,  959,  959, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,  959,
-      959,  960,  959,  959,  959,  961,  961,  961,  961,  961,
-      961,  961, 1675, 1675, 1675,  961,  961,  962,  961,  961,
-      961, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675,  961,  961,  962,  961,  961,  961,
-      963,  963,  963,  963,  963,  963,  963, 1675, 1675, 1675,
-      963,  963,  964,  963,  963,  963, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,  963,
-
-      963,  964,  963,  963,  963,  965,  965,  965,  965,  965,
-      965,  965, 1675, 1675, 1675,  965,  965,  966,  965,  965,
-      965, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675,  965,  965,  966,  965,  965,  965,
-      967,  967,  967,  967,  967,  967,  967, 1675, 1675, 1675,
-      967,  967,  968,  967,  967,  967, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,  967,
-      967,  968,  967,  967,  967,  969,  969,  969,  969,  969,
-
-      969,  969, 1675, 1675, 1675,  969,  969,  970,  969,  969,
-      969, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675,  969,  969,  970,  969,  969,  969,
-      971,  971,  971,  971,  971,  971,  971, 1675, 1675, 1675,
-      971,  971,  972,  971,  971,  971, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,  971,
-      971,  972,  971,  971,  971,  973,  973,  973,  973,  973,
-      973,  973, 1675, 1675, 1675,  973,  973,  974,  973,  973,
-
-      973, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675,  973,  973,  974,  973,  973,  973,
-      975,  975,  975,  975,  975,  975,  975, 1675, 1675, 1675,
-      975,  975,  976,  975,  975,  975, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,  975,
-      975,  976,  975,  975,  975,  977,  977,  977,  977,  977,
-      977,  977, 1675, 1675, 1675,  977,  977,  978,  977,  977,
-      977, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675,  977,  977,  978,  977,  977,  977,
-      979,  979,  979,  979,  979,  979,  979, 1675, 1675, 1675,
-      979,  979,  980,  979,  979,  979, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,  979,
-      979,  980,  979,  979,  979,  981,  981,  981,  981,  981,
-      981,  981, 1675, 1675, 1675,  981,  981,  982,  981,  981,
-      981, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-
-     1675, 1675, 1675, 1675,  981,  981,  982,  981,  981,  981,
-      983,  983,  983,  983,  983,  983,  983, 1675, 1675, 1675,
-      983,  983,  984,  983,  983,  983, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,  983,
-      983,  984,  983,  983,  983,  985,  985,  985,  985,  985,
-      985,  985, 1675, 1675, 1675,  985,  985,  986,  985,  985,
-      985, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675,  985,  985,  986,  985,  985,  985,
-
-      987,  987,  987,  987,  987,  987,  987, 1675, 1675, 1675,
-      987,  987,  988,  987,  987,  987, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,  987,
-      987,  988,  987,  987,  987,  989,  989,  989,  989,  989,
-      989,  989, 1675, 1675, 1675,  989,  989,  990,  989,  989,
-      989, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675,  989,  989,  990,  989,  989,  989,
-      991,  991,  991,  991,  991,  991,  991, 1675, 1675, 1675,
-
-      991,  991,  992,  991,  991,  991, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,  991,
-      991,  992,  991,  991,  991,  993,  993,  993,  993,  993,
-      993,  993, 1675, 1675, 1675,  993,  993,  994,  993,  993,
-      993, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675,  993,  993,  994,  993,  993,  993,
-      995,  995,  995,  995,  995,  995,  995, 1675, 1675, 1675,
-      995,  995,  996,  995,  995,  995, 1675, 1675, 1675, 1675,
-
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,  995,
-      995,  996,  995,  995,  995,  997,  997,  997,  997,  997,
-      997,  997, 1675, 1675, 1675,  997,  997,  998,  997,  997,
-      997, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675,  997,  997,  998,  997,  997,  997,
-      999,  999,  999,  999,  999,  999,  999, 1675, 1675, 1675,
-      999,  999, 1000,  999,  999,  999, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,  999,
-      999, 1000,  999,  999,  999, 1001, 1001, 1001, 1001, 1001,
-     1001, 1001, 1675, 1675, 1675, 1001, 1001, 1002, 1001, 1001,
-     1001, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1001, 1001, 1002, 1001, 1001, 1001,
-     1003, 1003, 1003, 1003, 1003, 1003, 1003, 1675, 1675, 1675,
-     1003, 1003, 1004, 1003, 1003, 1003, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1003,
-
-     1003, 1004, 1003, 1003, 1003, 1005, 1005, 1005, 1005, 1005,
-     1005, 1005, 1675, 1675, 1675, 1005, 1005, 1006, 1005, 1005,
-     1005, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1005, 1005, 1006, 1005, 1005, 1005,
-     1007, 1007, 1007, 1007, 1007, 1007, 1007, 1675, 1675, 1675,
-     1007, 1007, 1008, 1007, 1007, 1007, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1007,
-     1007, 1008, 1007, 1007, 1007, 1009, 1009, 1009, 1009, 1009,
-
-     1009, 1009, 1675, 1675, 1675, 1009, 1009, 1010, 1009, 1009,
-     1009, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1009, 1009, 1010, 1009, 1009, 1009,
-     1011, 1011, 1011, 1011, 1011, 1011, 1011, 1675, 1675, 1675,
-     1011, 1011, 1012, 1011, 1011, 1011, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1011,
-     1011, 1012, 1011, 1011, 1011, 1013, 1013, 1013, 1013, 1013,
-     1013, 1013, 1675, 1675, 1675, 1013, 1013, 1014, 1013, 1013,
-
-     1013, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1013, 1013, 1014, 1013, 1013, 1013,
-     1015, 1015, 1015, 1015, 1015, 1015, 1015, 1675, 1675, 1675,
-     1015, 1015, 1016, 1015, 1015, 1015, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1015,
-     1015, 1016, 1015, 1015, 1015, 1017, 1017, 1017, 1017, 1017,
-     1017, 1017, 1675, 1675, 1675, 1017, 1017, 1018, 1017, 1017,
-     1017, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1017, 1017, 1018, 1017, 1017, 1017,
-     1019, 1019, 1019, 1019, 1019, 1019, 1019, 1675, 1675, 1675,
-     1019, 1019, 1020, 1019, 1019, 1019, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1019,
-     1019, 1020, 1019, 1019, 1019, 1021, 1021, 1021, 1021, 1021,
-     1021, 1021, 1675, 1675, 1675, 1021, 1021, 1022, 1021, 1021,
-     1021, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-
-     1675, 1675, 1675, 1675, 1021, 1021, 1022, 1021, 1021, 1021,
-     1023, 1023, 1023, 1023, 1023, 1023, 1023, 1675, 1675, 1675,
-     1023, 1023, 1024, 1023, 1023, 1023, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1023,
-     1023, 1024, 1023, 1023, 1023, 1025, 1025, 1025, 1025, 1025,
-     1025, 1025, 1675, 1675, 1675, 1025, 1025, 1026, 1025, 1025,
-     1025, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1025, 1025, 1026, 1025, 1025, 1025,
-
-     1027, 1027, 1027, 1027, 1027, 1027, 1027, 1675, 1675, 1675,
-     1027, 1027, 1028, 1027, 1027, 1027, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1027,
-     1027, 1028, 1027, 1027, 1027, 1029, 1029, 1029, 1029, 1029,
-     1029, 1029, 1675, 1675, 1675, 1029, 1029, 1030, 1029, 1029,
-     1029, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1029, 1029, 1030, 1029, 1029, 1029,
-     1031, 1031, 1031, 1031, 1031, 1031, 1031, 1675, 1675, 1675,
-
-     1031, 1031, 1032, 1031, 1031, 1031, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1031,
-     1031, 1032, 1031, 1031, 1031, 1033, 1033, 1033, 1033, 1033,
-     1033, 1033, 1675, 1675, 1675, 1033, 1033, 1034, 1033, 1033,
-     1033, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1033, 1033, 1034, 1033, 1033, 1033,
-     1035, 1035, 1035, 1035, 1035, 1035, 1035, 1675, 1675, 1675,
-     1035, 1035, 1036, 1035, 1035, 1035, 1675, 1675, 1675, 1675,
-
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1035,
-     1035, 1036, 1035, 1035, 1035, 1037, 1037, 1037, 1037, 1037,
-     1037, 1037, 1675, 1675, 1675, 1037, 1037, 1038, 1037, 1037,
-     1037, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1037, 1037, 1038, 1037, 1037, 1037,
-     1039, 1039, 1039, 1039, 1039, 1039, 1039, 1675, 1675, 1675,
-     1039, 1039, 1040, 1039, 1039, 1039, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1039,
-     1039, 1040, 1039, 1039, 1039, 1041, 1041, 1041, 1041, 1041,
-     1041, 1041, 1675, 1675, 1675, 1041, 1041, 1042, 1041, 1041,
-     1041, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1041, 1041, 1042, 1041, 1041, 1041,
-     1043, 1043, 1043, 1043, 1043, 1043, 1043, 1675, 1675, 1675,
-     1043, 1043, 1044, 1043, 1043, 1043, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1043,
-
-     1043, 1044, 1043, 1043, 1043, 1045, 1045, 1045, 1045, 1045,
-     1045, 1045, 1675, 1675, 1675, 1045, 1045, 1046, 1045, 1045,
-     1045, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1045, 1045, 1046, 1045, 1045, 1045,
-     1047, 1047, 1047, 1047, 1047, 1047, 1047, 1675, 1675, 1675,
-     1047, 1047, 1048, 1047, 1047, 1047, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1047,
-     1047, 1048, 1047, 1047, 1047, 1049, 1049, 1049, 1049, 1049,
-
-     1049, 1049, 1675, 1675, 1675, 1049, 1049, 1050, 1049, 1049,
-     1049, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1049, 1049, 1050, 1049, 1049, 1049,
-     1051, 1051, 1051, 1051, 1051, 1051, 1051, 1675, 1675, 1675,
-     1051, 1051, 1052, 1051, 1051, 1051, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1051,
-     1051, 1052, 1051, 1051, 1051, 1053, 1053, 1053, 1053, 1053,
-     1053, 1053, 1675, 1675, 1675, 1053, 1053, 1054, 1053, 1053,
-
-     1053, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1053, 1053, 1054, 1053, 1053, 1053,
-     1055, 1055, 1055, 1055, 1055, 1055, 1055, 1675, 1675, 1675,
-     1055, 1055, 1056, 1055, 1055, 1055, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1055,
-     1055, 1056, 1055, 1055, 1055, 1057, 1057, 1057, 1057, 1057,
-     1057, 1057, 1675, 1675, 1675, 1057, 1057, 1058, 1057, 1057,
-     1057, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1057, 1057, 1058, 1057, 1057, 1057,
-     1059, 1059, 1059, 1059, 1059, 1059, 1059, 1675, 1675, 1675,
-     1059, 1059, 1060, 1059, 1059, 1059, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1059,
-     1059, 1060, 1059, 1059, 1059, 1061, 1061, 1061, 1061, 1061,
-     1061, 1061, 1675, 1675, 1675, 1061, 1061, 1062, 1061, 1061,
-     1061, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-
-     1675, 1675, 1675, 1675, 1061, 1061, 1062, 1061, 1061, 1061,
-     1063, 1063, 1063, 1063, 1063, 1063, 1063, 1675, 1675, 1675,
-     1063, 1063, 1064, 1063, 1063, 1063, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1063,
-     1063, 1064, 1063, 1063, 1063, 1065, 1065, 1065, 1065, 1065,
-     1065, 1065, 1675, 1675, 1675, 1065, 1065, 1066, 1065, 1065,
-     1065, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1065, 1065, 1066, 1065, 1065, 1065,
-
-     1067, 1067, 1067, 1067, 1067, 1067, 1067, 1675, 1675, 1675,
-     1067, 1067, 1068, 1067, 1067, 1067, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1067,
-     1067, 1068, 1067, 1067, 1067, 1069, 1069, 1069, 1069, 1069,
-     1069, 1069, 1675, 1675, 1675, 1069, 1069, 1070, 1069, 1069,
-     1069, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1069, 1069, 1070, 1069, 1069, 1069,
-     1071, 1071, 1071, 1071, 1071, 1071, 1071, 1675, 1675, 1675,
-
-     1071, 1071, 1072, 1071, 1071, 1071, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1071,
-     1071, 1072, 1071, 1071, 1071, 1073, 1073, 1073, 1073, 1073,
-     1073, 1073, 1675, 1675, 1675, 1073, 1073, 1074, 1073, 1073,
-     1073, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1073, 1073, 1074, 1073, 1073, 1073,
-     1075, 1075, 1075, 1075, 1075, 1075, 1075, 1675, 1675, 1675,
-     1075, 1075, 1076, 1075, 1075, 1075, 1675, 1675, 1675, 1675,
-
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1075,
-     1075, 1076, 1075, 1075, 1075, 1077, 1077, 1077, 1077, 1077,
-     1077, 1077, 1675, 1675, 1675, 1077, 1077, 1078, 1077, 1077,
-     1077, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1077, 1077, 1078, 1077, 1077, 1077,
-     1079, 1079, 1079, 1079, 1079, 1079, 1079, 1675, 1675, 1675,
-     1079, 1079, 1080, 1079, 1079, 1079, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1079,
-     1079, 1080, 1079, 1079, 1079, 1081, 1081, 1081, 1081, 1081,
-     1081, 1081, 1675, 1675, 1675, 1081, 1081, 1082, 1081, 1081,
-     1081, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1081, 1081, 1082, 1081, 1081, 1081,
-     1083, 1083, 1083, 1083, 1083, 1083, 1083, 1675, 1675, 1675,
-     1083, 1083, 1084, 1083, 1083, 1083, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1083,
-
-     1083, 1084, 1083, 1083, 1083, 1085, 1085, 1085, 1085, 1085,
-     1085, 1085, 1675, 1675, 1675, 1085, 1085, 1086, 1085, 1085,
-     1085, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1085, 1085, 1086, 1085, 1085, 1085,
-     1087, 1087, 1087, 1087, 1087, 1087, 1087, 1675, 1675, 1675,
-     1087, 1087, 1088, 1087, 1087, 1087, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1087,
-     1087, 1088, 1087, 1087, 1087, 1089, 1089, 1089, 1089, 1089,
-
-     1089, 1089, 1675, 1675, 1675, 1089, 1089, 1090, 1089, 1089,
-     1089, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1089, 1089, 1090, 1089, 1089, 1089,
-     1091, 1091, 1091, 1091, 1091, 1091, 1091, 1675, 1675, 1675,
-     1091, 1091, 1092, 1091, 1091, 1091, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1091,
-     1091, 1092, 1091, 1091, 1091, 1093, 1093, 1093, 1093, 1093,
-     1093, 1093, 1675, 1675, 1675, 1093, 1093, 1094, 1093, 1093,
-
-     1093, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1093, 1093, 1094, 1093, 1093, 1093,
-     1095, 1095, 1095, 1095, 1095, 1095, 1095, 1675, 1675, 1675,
-     1095, 1095, 1096, 1095, 1095, 1095, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1095,
-     1095, 1096, 1095, 1095, 1095, 1097, 1097, 1097, 1097, 1097,
-     1097, 1097, 1675, 1675, 1675, 1097, 1097, 1098, 1097, 1097,
-     1097, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1097, 1097, 1098, 1097, 1097, 1097,
-     1099, 1099, 1099, 1099, 1099, 1099, 1099, 1675, 1675, 1675,
-     1099, 1099, 1100, 1099, 1099, 1099, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1099,
-     1099, 1100, 1099, 1099, 1099, 1101, 1101, 1101, 1101, 1101,
-     1101, 1101, 1675, 1675, 1675, 1101, 1101, 1102, 1101, 1101,
-     1101, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-
-     1675, 1675, 1675, 1675, 1101, 1101, 1102, 1101, 1101, 1101,
-     1103, 1103, 1103, 1103, 1103, 1103, 1103, 1675, 1675, 1675,
-     1103, 1103, 1104, 1103, 1103, 1103, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1103,
-     1103, 1104, 1103, 1103, 1103, 1105, 1105, 1105, 1105, 1105,
-     1105, 1105, 1675, 1675, 1675, 1105, 1105, 1106, 1105, 1105,
-     1105, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1105, 1105, 1106, 1105, 1105, 1105,
-
-     1107, 1107, 1107, 1107, 1107, 1107, 1107, 1675, 1675, 1675,
-     1107, 1107, 1108, 1107, 1107, 1107, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1107,
-     1107, 1108, 1107, 1107, 1107, 1109, 1109, 1109, 1109, 1109,
-     1109, 1109, 1675, 1675, 1675, 1109, 1109, 1110, 1109, 1109,
-     1109, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1109, 1109, 1110, 1109, 1109, 1109,
-     1111, 1111, 1111, 1111, 1111, 1111, 1111, 1675, 1675, 1675,
-
-     1111, 1111, 1112, 1111, 1111, 1111, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1111,
-     1111, 1112, 1111, 1111, 1111, 1113, 1113, 1113, 1113, 1113,
-     1113, 1113, 1675, 1675, 1675, 1113, 1113, 1114, 1113, 1113,
-     1113, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1113, 1113, 1114, 1113, 1113, 1113,
-     1115, 1115, 1115, 1115, 1115, 1115, 1115, 1675, 1675, 1675,
-     1115, 1115, 1116, 1115, 1115, 1115, 1675, 1675, 1675, 1675,
-
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1115,
-     1115, 1116, 1115, 1115, 1115, 1117, 1117, 1117, 1117, 1117,
-     1117, 1117, 1675, 1675, 1675, 1117, 1117, 1118, 1117, 1117,
-     1117, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1117, 1117, 1118, 1117, 1117, 1117,
-     1119, 1119, 1119, 1119, 1119, 1119, 1119, 1675, 1675, 1675,
-     1119, 1119, 1120, 1119, 1119, 1119, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1119,
-     1119, 1120, 1119, 1119, 1119, 1121, 1121, 1121, 1121, 1121,
-     1121, 1121, 1675, 1675, 1675, 1121, 1121, 1122, 1121, 1121,
-     1121, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1121, 1121, 1122, 1121, 1121, 1121,
-     1123, 1123, 1123, 1123, 1123, 1123, 1123, 1675, 1675, 1675,
-     1123, 1123, 1124, 1123, 1123, 1123, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1123,
-
-     1123, 1124, 1123, 1123, 1123, 1125, 1125, 1125, 1125, 1125,
-     1125, 1125, 1675, 1675, 1675, 1125, 1125, 1126, 1125, 1125,
-     1125, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1125, 1125, 1126, 1125, 1125, 1125,
-     1127, 1127, 1127, 1127, 1127, 1127, 1127, 1675, 1675, 1675,
-     1127, 1127, 1128, 1127, 1127, 1127, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1127,
-     1127, 1128, 1127, 1127, 1127, 1129, 1129, 1129, 1129, 1129,
-
-     1129, 1129, 1675, 1675, 1675, 1129, 1129, 1130, 1129, 1129,
-     1129, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1129, 1129, 1130, 1129, 1129, 1129,
-     1131, 1131, 1131, 1131, 1131, 1131, 1131, 1675, 1675, 1675,
-     1131, 1131, 1132, 1131, 1131, 1131, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1131,
-     1131, 1132, 1131, 1131, 1131, 1133, 1133, 1133, 1133, 1133,
-     1133, 1133, 1675, 1675, 1675, 1133, 1133, 1134, 1133, 1133,
-
-     1133, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1133, 1133, 1134, 1133, 1133, 1133,
-     1135, 1135, 1135, 1135, 1135, 1135, 1135, 1675, 1675, 1675,
-     1135, 1135, 1136, 1135, 1135, 1135, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1135,
-     1135, 1136, 1135, 1135, 1135, 1137, 1137, 1137, 1137, 1137,
-     1137, 1137, 1675, 1675, 1675, 1137, 1137, 1138, 1137, 1137,
-     1137, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1137, 1137, 1138, 1137, 1137, 1137,
-     1139, 1139, 1139, 1139, 1139, 1139, 1139, 1675, 1675, 1675,
-     1139, 1139, 1140, 1139, 1139, 1139, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1139,
-     1139, 1140, 1139, 1139, 1139, 1141, 1141, 1141, 1141, 1141,
-     1141, 1141, 1675, 1675, 1675, 1141, 1141, 1142, 1141, 1141,
-     1141, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-
-     1675, 1675, 1675, 1675, 1141, 1141, 1142, 1141, 1141, 1141,
-     1143, 1143, 1143, 1143, 1143, 1143, 1143, 1675, 1675, 1675,
-     1143, 1143, 1144, 1143, 1143, 1143, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1143,
-     1143, 1144, 1143, 1143, 1143, 1145, 1145, 1145, 1145, 1145,
-     1145, 1145, 1675, 1675, 1675, 1145, 1145, 1146, 1145, 1145,
-     1145, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1145, 1145, 1146, 1145, 1145, 1145,
-
-     1147, 1147, 1147, 1147, 1147, 1147, 1147, 1675, 1675, 1675,
-     1147, 1147, 1148, 1147, 1147, 1147, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1147,
-     1147, 1148, 1147, 1147, 1147, 1149, 1149, 1149, 1149, 1149,
-     1149, 1149, 1675, 1675, 1675, 1149, 1149, 1150, 1149, 1149,
-     1149, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1149, 1149, 1150, 1149, 1149, 1149,
-     1151, 1151, 1151, 1151, 1151, 1151, 1151, 1675, 1675, 1675,
-
-     1151, 1151, 1152, 1151, 1151, 1151, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1151,
-     1151, 1152, 1151, 1151, 1151, 1153, 1153, 1153, 1153, 1153,
-     1153, 1153, 1675, 1675, 1675, 1153, 1153, 1154, 1153, 1153,
-     1153, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1153, 1153, 1154, 1153, 1153, 1153,
-     1155, 1155, 1155, 1155, 1155, 1155, 1155, 1675, 1675, 1675,
-     1155, 1155, 1156, 1155, 1155, 1155, 1675, 1675, 1675, 1675,
-
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1155,
-     1155, 1156, 1155, 1155, 1155, 1157, 1157, 1157, 1157, 1157,
-     1157, 1157, 1675, 1675, 1675, 1157, 1157, 1158, 1157, 1157,
-     1157, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1157, 1157, 1158, 1157, 1157, 1157,
-     1159, 1159, 1159, 1159, 1159, 1159, 1159, 1675, 1675, 1675,
-     1159, 1159, 1160, 1159, 1159, 1159, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1159,
-     1159, 1160, 1159, 1159, 1159, 1161, 1161, 1161, 1161, 1161,
-     1161, 1161, 1675, 1675, 1675, 1161, 1161, 1162, 1161, 1161,
-     1161, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1161, 1161, 1162, 1161, 1161, 1161,
-     1163, 1163, 1163, 1163, 1163, 1163, 1163, 1675, 1675, 1675,
-     1163, 1163, 1164, 1163, 1163, 1163, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1163,
-
-     1163, 1164, 1163, 1163, 1163, 1165, 1165, 1165, 1165, 1165,
-     1165, 1165, 1675, 1675, 1675, 1165, 1165, 1166, 1165, 1165,
-     1165, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1165, 1165, 1166, 1165, 1165, 1165,
-     1167, 1167, 1167, 1167, 1167, 1167, 1167, 1675, 1675, 1675,
-     1167, 1167, 1168, 1167, 1167, 1167, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1167,
-     1167, 1168, 1167, 1167, 1167, 1169, 1169, 1169, 1169, 1169,
-
-     1169, 1169, 1675, 1675, 1675, 1169, 1169, 1170, 1169, 1169,
-     1169, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1169, 1169, 1170, 1169, 1169, 1169,
-     1171, 1171, 1171, 1171, 1171, 1171, 1171, 1675, 1675, 1675,
-     1171, 1171, 1172, 1171, 1171, 1171, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1171,
-     1171, 1172, 1171, 1171, 1171, 1173, 1173, 1173, 1173, 1173,
-     1173, 1173, 1675, 1675, 1675, 1173, 1173, 1174, 1173, 1173,
-
-     1173, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1173, 1173, 1174, 1173, 1173, 1173,
-     1175, 1175, 1175, 1175, 1175, 1175, 1175, 1675, 1675, 1675,
-     1175, 1175, 1176, 1175, 1175, 1175, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1175,
-     1175, 1176, 1175, 1175, 1175, 1177, 1177, 1177, 1177, 1177,
-     1177, 1177, 1675, 1675, 1675, 1177, 1177, 1178, 1177, 1177,
-     1177, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1177, 1177, 1178, 1177, 1177, 1177,
-     1179, 1179, 1179, 1179, 1179, 1179, 1179, 1675, 1675, 1675,
-     1179, 1179, 1180, 1179, 1179, 1179, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1179,
-     1179, 1180, 1179, 1179, 1179, 1181, 1181, 1181, 1181, 1181,
-     1181, 1181, 1675, 1675, 1675, 1181, 1181, 1182, 1181, 1181,
-     1181, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-
-     1675, 1675, 1675, 1675, 1181, 1181, 1182, 1181, 1181, 1181,
-     1183, 1183, 1183, 1183, 1183, 1183, 1183, 1675, 1675, 1675,
-     1183, 1183, 1184, 1183, 1183, 1183, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1183,
-     1183, 1184, 1183, 1183, 1183, 1185, 1185, 1185, 1185, 1185,
-     1185, 1185, 1675, 1675, 1675, 1185, 1185, 1186, 1185, 1185,
-     1185, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1185, 1185, 1186, 1185, 1185, 1185,
-
-     1187, 1187, 1187, 1187, 1187, 1187, 1187, 1675, 1675, 1675,
-     1187, 1187, 1188, 1187, 1187, 1187, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1187,
-     1187, 1188, 1187, 1187, 1187, 1189, 1189, 1189, 1189, 1189,
-     1189, 1189, 1675, 1675, 1675, 1189, 1189, 1190, 1189, 1189,
-     1189, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1189, 1189, 1190, 1189, 1189, 1189,
-     1191, 1191, 1191, 1191, 1191, 1191, 1191, 1675, 1675, 1675,
-
-     1191, 1191, 1192, 1191, 1191, 1191, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1191,
-     1191, 1192, 1191, 1191, 1191, 1193, 1193, 1193, 1193, 1193,
-     1193, 1193, 1675, 1675, 1675, 1193, 1193, 1194, 1193, 1193,
-     1193, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1193, 1193, 1194, 1193, 1193, 1193,
-     1195, 1195, 1195, 1195, 1195, 1195, 1195, 1675, 1675, 1675,
-     1195, 1195, 1196, 1195, 1195, 1195, 1675, 1675, 1675, 1675,
-
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1195,
-     1195, 1196, 1195, 1195, 1195, 1197, 1197, 1197, 1197, 1197,
-     1197, 1197, 1675, 1675, 1675, 1197, 1197, 1198, 1197, 1197,
-     1197, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1197, 1197, 1198, 1197, 1197, 1197,
-     1199, 1199, 1199, 1199, 1199, 1199, 1199, 1675, 1675, 1675,
-     1199, 1199, 1200, 1199, 1199, 1199, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1199,
-     1199, 1200, 1199, 1199, 1199, 1201, 1201, 1201, 1201, 1201,
-     1201, 1201, 1675, 1675, 1675, 1201, 1201, 1202, 1201, 1201,
-     1201, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1201, 1201, 1202, 1201, 1201, 1201,
-     1203, 1203, 1203, 1203, 1203, 1203, 1203, 1675, 1675, 1675,
-     1203, 1203, 1204, 1203, 1203, 1203, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1203,
-
-     1203, 1204, 1203, 1203, 1203, 1205, 1205, 1205, 1205, 1205,
-     1205, 1205, 1675, 1675, 1675, 1205, 1205, 1206, 1205, 1205,
-     1205, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1205, 1205, 1206, 1205, 1205, 1205,
-     1207, 1207, 1207, 1207, 1207, 1207, 1207, 1675, 1675, 1675,
-     1207, 1207, 1208, 1207, 1207, 1207, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1207,
-     1207, 1208, 1207, 1207, 1207, 1209, 1209, 1209, 1209, 1209,
-
-     1209, 1209, 1675, 1675, 1675, 1209, 1209, 1210, 1209, 1209,
-     1209, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1209, 1209, 1210, 1209, 1209, 1209,
-     1211, 1211, 1211, 1211, 1211, 1211, 1211, 1675, 1675, 1675,
-     1211, 1211, 1212, 1211, 1211, 1211, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1211,
-     1211, 1212, 1211, 1211, 1211, 1213, 1213, 1213, 1213, 1213,
-     1213, 1213, 1675, 1675, 1675, 1213, 1213, 1214, 1213, 1213,
-
-     1213, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1213, 1213, 1214, 1213, 1213, 1213,
-     1215, 1215, 1215, 1215, 1215, 1215, 1215, 1675, 1675, 1675,
-     1215, 1215, 1216, 1215, 1215, 1215, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1215,
-     1215, 1216, 1215, 1215, 1215, 1217, 1217, 1217, 1217, 1217,
-     1217, 1217, 1675, 1675, 1675, 1217, 1217, 1218, 1217, 1217,
-     1217, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1217, 1217, 1218, 1217, 1217, 1217,
-     1219, 1219, 1219, 1219, 1219, 1219, 1219, 1675, 1675, 1675,
-     1219, 1219, 1220, 1219, 1219, 1219, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1219,
-     1219, 1220, 1219, 1219, 1219, 1221, 1221, 1221, 1221, 1221,
-     1221, 1221, 1675, 1675, 1675, 1221, 1221, 1222, 1221, 1221,
-     1221, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-
-     1675, 1675, 1675, 1675, 1221, 1221, 1222, 1221, 1221, 1221,
-     1223, 1223, 1223, 1223, 1223, 1223, 1223, 1675, 1675, 1675,
-     1223, 1223, 1224, 1223, 1223, 1223, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1223,
-     1223, 1224, 1223, 1223, 1223, 1225, 1225, 1225, 1225, 1225,
-     1225, 1225, 1675, 1675, 1675, 1225, 1225, 1226, 1225, 1225,
-     1225, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1225, 1225, 1226, 1225, 1225, 1225,
-
-     1227, 1227, 1227, 1227, 1227, 1227, 1227, 1675, 1675, 1675,
-     1227, 1227, 1228, 1227, 1227, 1227, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1227,
-     1227, 1228, 1227, 1227, 1227, 1229, 1229, 1229, 1229, 1229,
-     1229, 1229, 1675, 1675, 1675, 1229, 1229, 1230, 1229, 1229,
-     1229, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1229, 1229, 1230, 1229, 1229, 1229,
-     1231, 1231, 1231, 1231, 1231, 1231, 1231, 1675, 1675, 1675,
-
-     1231, 1231, 1232, 1231, 1231, 1231, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1231,
-     1231, 1232, 1231, 1231, 1231, 1233, 1233, 1233, 1233, 1233,
-     1233, 1233, 1675, 1675, 1675, 1233, 1233, 1234, 1233, 1233,
-     1233, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1233, 1233, 1234, 1233, 1233, 1233,
-     1235, 1235, 1235, 1235, 1235, 1235, 1235, 1675, 1675, 1675,
-     1235, 1235, 1236, 1235, 1235, 1235, 1675, 1675, 1675, 1675,
-
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1235,
-     1235, 1236, 1235, 1235, 1235, 1237, 1237, 1237, 1237, 1237,
-     1237, 1237, 1675, 1675, 1675, 1237, 1237, 1238, 1237, 1237,
-     1237, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1237, 1237, 1238, 1237, 1237, 1237,
-     1239, 1239, 1239, 1239, 1239, 1239, 1239, 1675, 1675, 1675,
-     1239, 1239, 1240, 1239, 1239, 1239, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1239,
-     1239, 1240, 1239, 1239, 1239, 1241, 1241, 1241, 1241, 1241,
-     1241, 1241, 1675, 1675, 1675, 1241, 1241, 1242, 1241, 1241,
-     1241, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1241, 1241, 1242, 1241, 1241, 1241,
-     1243, 1243, 1243, 1243, 1243, 1243, 1243, 1675, 1675, 1675,
-     1243, 1243, 1244, 1243, 1243, 1243, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1243,
-
-     1243, 1244, 1243, 1243, 1243, 1245, 1245, 1245, 1245, 1245,
-     1245, 1245, 1675, 1675, 1675, 1245, 1245, 1246, 1245, 1245,
-     1245, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1245, 1245, 1246, 1245, 1245, 1245,
-     1247, 1247, 1247, 1247, 1247, 1247, 1247, 1675, 1675, 1675,
-     1247, 1247, 1248, 1247, 1247, 1247, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1247,
-     1247, 1248, 1247, 1247, 1247, 1249, 1249, 1249, 1249, 1249,
-
-     1249, 1249, 1675, 1675, 1675, 1249, 1249, 1250, 1249, 1249,
-     1249, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1249, 1249, 1250, 1249, 1249, 1249,
-     1251, 1251, 1251, 1251, 1251, 1251, 1251, 1675, 1675, 1675,
-     1251, 1251, 1252, 1251, 1251, 1251, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1251,
-     1251, 1252, 1251, 1251, 1251, 1253, 1253, 1253, 1253, 1253,
-     1253, 1253, 1675, 1675, 1675, 1253, 1253, 1254, 1253, 1253,
-
-     1253, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1253, 1253, 1254, 1253, 1253, 1253,
-     1255, 1255, 1255, 1255, 1255, 1255, 1255, 1675, 1675, 1675,
-     1255, 1255, 1256, 1255, 1255, 1255, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1255,
-     1255, 1256, 1255, 1255, 1255, 1257, 1257, 1257, 1257, 1257,
-     1257, 1257, 1675, 1675, 1675, 1257, 1257, 1258, 1257, 1257,
-     1257, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1257, 1257, 1258, 1257, 1257, 1257,
-     1259, 1259, 1259, 1259, 1259, 1259, 1259, 1675, 1675, 1675,
-     1259, 1259, 1260, 1259, 1259, 1259, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1259,
-     1259, 1260, 1259, 1259, 1259, 1261, 1261, 1261, 1261, 1261,
-     1261, 1261, 1675, 1675, 1675, 1261, 1261, 1262, 1261, 1261,
-     1261, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-
-     1675, 1675, 1675, 1675, 1261, 1261, 1262, 1261, 1261, 1261,
-     1263, 1263, 1263, 1263, 1263, 1263, 1263, 1675, 1675, 1675,
-     1263, 1263, 1264, 1263, 1263, 1263, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1263,
-     1263, 1264, 1263, 1263, 1263, 1265, 1265, 1265, 1265, 1265,
-     1265, 1265, 1675, 1675, 1675, 1265, 1265, 1266, 1265, 1265,
-     1265, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1265, 1265, 1266, 1265, 1265, 1265,
-
-     1267, 1267, 1267, 1267, 1267, 1267, 1267, 1675, 1675, 1675,
-     1267, 1267, 1268, 1267, 1267, 1267, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1267,
-     1267, 1268, 1267, 1267, 1267, 1269, 1269, 1269, 1269, 1269,
-     1269, 1269, 1675, 1675, 1675, 1269, 1269, 1270, 1269, 1269,
-     1269, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1269, 1269, 1270, 1269, 1269, 1269,
-     1271, 1271, 1271, 1271, 1271, 1271, 1271, 1675, 1675, 1675,
-
-     1271, 1271, 1272, 1271, 1271, 1271, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1271,
-     1271, 1272, 1271, 1271, 1271, 1273, 1273, 1273, 1273, 1273,
-     1273, 1273, 1675, 1675, 1675, 1273, 1273, 1274, 1273, 1273,
-     1273, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1273, 1273, 1274, 1273, 1273, 1273,
-     1275, 1275, 1275, 1275, 1275, 1275, 1275, 1675, 1675, 1675,
-     1275, 1275, 1276, 1275, 1275, 1275, 1675, 1675, 1675, 1675,
-
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1275,
-     1275, 1276, 1275, 1275, 1275, 1277, 1277, 1277, 1277, 1277,
-     1277, 1277, 1675, 1675, 1675, 1277, 1277, 1278, 1277, 1277,
-     1277, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1277, 1277, 1278, 1277, 1277, 1277,
-     1279, 1279, 1279, 1279, 1279, 1279, 1279, 1675, 1675, 1675,
-     1279, 1279, 1280, 1279, 1279, 1279, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1279,
-     1279, 1280, 1279, 1279, 1279, 1281, 1281, 1281, 1281, 1281,
-     1281, 1281, 1675, 1675, 1675, 1281, 1281, 1282, 1281, 1281,
-     1281, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1281, 1281, 1282, 1281, 1281, 1281,
-     1283, 1283, 1283, 1283, 1283, 1283, 1283, 1675, 1675, 1675,
-     1283, 1283, 1284, 1283, 1283, 1283, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1283,
-
-     1283, 1284, 1283, 1283, 1283, 1285, 1285, 1285, 1285, 1285,
-     1285, 1285, 1675, 1675, 1675, 1285, 1285, 1286, 1285, 1285,
-     1285, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1285, 1285, 1286, 1285, 1285, 1285,
-     1287, 1287, 1287, 1287, 1287, 1287, 1287, 1675, 1675, 1675,
-     1287, 1287, 1288, 1287, 1287, 1287, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1287,
-     1287, 1288, 1287, 1287, 1287, 1289, 1289, 1289, 1289, 1289,
-
-     1289, 1289, 1675, 1675, 1675, 1289, 1289, 1290, 1289, 1289,
-     1289, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1289, 1289, 1290, 1289, 1289, 1289,
-     1291, 1291, 1291, 1291, 1291, 1291, 1291, 1675, 1675, 1675,
-     1291, 1291, 1292, 1291, 1291, 1291, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1291,
-     1291, 1292, 1291, 1291, 1291, 1293, 1293, 1293, 1293, 1293,
-     1293, 1293, 1675, 1675, 1675, 1293, 1293, 1294, 1293, 1293,
-
-     1293, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1293, 1293, 1294, 1293, 1293, 1293,
-     1295, 1295, 1295, 1295, 1295, 1295, 1295, 1675, 1675, 1675,
-     1295, 1295, 1296, 1295, 1295, 1295, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1295,
-     1295, 1296, 1295, 1295, 1295, 1297, 1297, 1297, 1297, 1297,
-     1297, 1297, 1675, 1675, 1675, 1297, 1297, 1298, 1297, 1297,
-     1297, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1297, 1297, 1298, 1297, 1297, 1297,
-     1299, 1299, 1299, 1299, 1299, 1299, 1299, 1675, 1675, 1675,
-     1299, 1299, 1300, 1299, 1299, 1299, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1299,
-     1299, 1300, 1299, 1299, 1299, 1301, 1301, 1301, 1301, 1301,
-     1301, 1301, 1675, 1675, 1675, 1301, 1301, 1302, 1301, 1301,
-     1301, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-
-     1675, 1675, 1675, 1675, 1301, 1301, 1302, 1301, 1301, 1301,
-     1303, 1303, 1303, 1303, 1303, 1303, 1303, 1675, 1675, 1675,
-     1303, 1303, 1304, 1303, 1303, 1303, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1303,
-     1303, 1304, 1303, 1303, 1303, 1305, 1305, 1305, 1305, 1305,
-     1305, 1305, 1675, 1675, 1675, 1305, 1305, 1306, 1305, 1305,
-     1305, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1305, 1305, 1306, 1305, 1305, 1305,
-
-     1307, 1307, 1307, 1307, 1307, 1307, 1307, 1675, 1675, 1675,
-     1307, 1307, 1308, 1307, 1307, 1307, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1307,
-     1307, 1308, 1307, 1307, 1307, 1309, 1309, 1309, 1309, 1309,
-     1309, 1309, 1675, 1675, 1675, 1309, 1309, 1310, 1309, 1309,
-     1309, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1309, 1309, 1310, 1309, 1309, 1309,
-     1311, 1311, 1311, 1311, 1311, 1311, 1311, 1675, 1675, 1675,
-
-     1311, 1311, 1312, 1311, 1311, 1311, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1311,
-     1311, 1312, 1311, 1311, 1311, 1313, 1313, 1313, 1313, 1313,
-     1313, 1313, 1675, 1675, 1675, 1313, 1313, 1314, 1313, 1313,
-     1313, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1313, 1313, 1314, 1313, 1313, 1313,
-     1315, 1315, 1315, 1315, 1315, 1315, 1315, 1675, 1675, 1675,
-     1315, 1315, 1316, 1315, 1315, 1315, 1675, 1675, 1675, 1675,
-
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1315,
-     1315, 1316, 1315, 1315, 1315, 1317, 1317, 1317, 1317, 1317,
-     1317, 1317, 1675, 1675, 1675, 1317, 1317, 1318, 1317, 1317,
-     1317, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1317, 1317, 1318, 1317, 1317, 1317,
-     1319, 1319, 1319, 1319, 1319, 1319, 1319, 1675, 1675, 1675,
-     1319, 1319, 1320, 1319, 1319, 1319, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1319,
-     1319, 1320, 1319, 1319, 1319, 1321, 1321, 1321, 1321, 1321,
-     1321, 1321, 1675, 1675, 1675, 1321, 1321, 1322, 1321, 1321,
-     1321, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1321, 1321, 1322, 1321, 1321, 1321,
-     1323, 1323, 1323, 1323, 1323, 1323, 1323, 1675, 1675, 1675,
-     1323, 1323, 1324, 1323, 1323, 1323, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1323,
-
-     1323, 1324, 1323, 1323, 1323, 1325, 1325, 1325, 1325, 1325,
-     1325, 1325, 1675, 1675, 1675, 1325, 1325, 1326, 1325, 1325,
-     1325, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1325, 1325, 1326, 1325, 1325, 1325,
-     1327, 1327, 1327, 1327, 1327, 1327, 1327, 1675, 1675, 1675,
-     1327, 1327, 1328, 1327, 1327, 1327, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1327,
-     1327, 1328, 1327, 1327, 1327, 1329, 1329, 1329, 1329, 1329,
-
-     1329, 1329, 1675, 1675, 1675, 1329, 1329, 1330, 1329, 1329,
-     1329, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1329, 1329, 1330, 1329, 1329, 1329,
-     1331, 1331, 1331, 1331, 1331, 1331, 1331, 1675, 1675, 1675,
-     1331, 1331, 1332, 1331, 1331, 1331, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1331,
-     1331, 1332, 1331, 1331, 1331, 1333, 1333, 1333, 1333, 1333,
-     1333, 1333, 1675, 1675, 1675, 1333, 1333, 1334, 1333, 1333,
-
-     1333, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1333, 1333, 1334, 1333, 1333, 1333,
-     1335, 1335, 1335, 1335, 1335, 1335, 1335, 1675, 1675, 1675,
-     1335, 1335, 1336, 1335, 1335, 1335, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1335,
-     1335, 1336, 1335, 1335, 1335, 1337, 1337, 1337, 1337, 1337,
-     1337, 1337, 1675, 1675, 1675, 1337, 1337, 1338, 1337, 1337,
-     1337, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1337, 1337, 1338, 1337, 1337, 1337,
-     1339, 1339, 1339, 1339, 1339, 1339, 1339, 1675, 1675, 1675,
-     1339, 1339, 1340, 1339, 1339, 1339, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1339,
-     1339, 1340, 1339, 1339, 1339, 1341, 1341, 1341, 1341, 1341,
-     1341, 1341, 1675, 1675, 1675, 1341, 1341, 1342, 1341, 1341,
-     1341, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-
-     1675, 1675, 1675, 1675, 1341, 1341, 1342, 1341, 1341, 1341,
-     1343, 1343, 1343, 1343, 1343, 1343, 1343, 1675, 1675, 1675,
-     1343, 1343, 1344, 1343, 1343, 1343, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1343,
-     1343, 1344, 1343, 1343, 1343, 1345, 1345, 1345, 1345, 1345,
-     1345, 1345, 1675, 1675, 1675, 1345, 1345, 1346, 1345, 1345,
-     1345, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1345, 1345, 1346, 1345, 1345, 1345,
-
-     1347, 1347, 1347, 1347, 1347, 1347, 1347, 1675, 1675, 1675,
-     1347, 1347, 1348, 1347, 1347, 1347, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1347,
-     1347, 1348, 1347, 1347, 1347, 1349, 1349, 1349, 1349, 1349,
-     1349, 1349, 1675, 1675, 1675, 1349, 1349, 1350, 1349, 1349,
-     1349, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1349, 1349, 1350, 1349, 1349, 1349,
-     1351, 1351, 1351, 1351, 1351, 1351, 1351, 1675, 1675, 1675,
-
-     1351, 1351, 1352, 1351, 1351, 1351, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1351,
-     1351, 1352, 1351, 1351, 1351, 1353, 1353, 1353, 1353, 1353,
-     1353, 1353, 1675, 1675, 1675, 1353, 1353, 1354, 1353, 1353,
-     1353, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1353, 1353, 1354, 1353, 1353, 1353,
-     1355, 1355, 1355, 1355, 1355, 1355, 1355, 1675, 1675, 1675,
-     1355, 1355, 1356, 1355, 1355, 1355, 1675, 1675, 1675, 1675,
-
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1355,
-     1355, 1356, 1355, 1355, 1355, 1357, 1357, 1357, 1357, 1357,
-     1357, 1357, 1675, 1675, 1675, 1357, 1357, 1358, 1357, 1357,
-     1357, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1357, 1357, 1358, 1357, 1357, 1357,
-     1359, 1359, 1359, 1359, 1359, 1359, 1359, 1675, 1675, 1675,
-     1359, 1359, 1360, 1359, 1359, 1359, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1359,
-     1359, 1360, 1359, 1359, 1359, 1361, 1361, 1361, 1361, 1361,
-     1361, 1361, 1675, 1675, 1675, 1361, 1361, 1362, 1361, 1361,
-     1361, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1361, 1361, 1362, 1361, 1361, 1361,
-     1363, 1363, 1363, 1363, 1363, 1363, 1363, 1675, 1675, 1675,
-     1363, 1363, 1364, 1363, 1363, 1363, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1363,
-
-     1363, 1364, 1363, 1363, 1363, 1365, 1365, 1365, 1365, 1365,
-     1365, 1365, 1675, 1675, 1675, 1365, 1365, 1366, 1365, 1365,
-     1365, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1365, 1365, 1366, 1365, 1365, 1365,
-     1367, 1367, 1367, 1367, 1367, 1367, 1367, 1675, 1675, 1675,
-     1367, 1367, 1368, 1367, 1367, 1367, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1367,
-     1367, 1368, 1367, 1367, 1367, 1369, 1369, 1369, 1369, 1369,
-
-     1369, 1369, 1675, 1675, 1675, 1369, 1369, 1370, 1369, 1369,
-     1369, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1369, 1369, 1370, 1369, 1369, 1369,
-     1371, 1371, 1371, 1371, 1371, 1371, 1371, 1675, 1675, 1675,
-     1371, 1371, 1372, 1371, 1371, 1371, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1371,
-     1371, 1372, 1371, 1371, 1371, 1373, 1373, 1373, 1373, 1373,
-     1373, 1373, 1675, 1675, 1675, 1373, 1373, 1374, 1373, 1373,
-
-     1373, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1373, 1373, 1374, 1373, 1373, 1373,
-     1375, 1375, 1375, 1375, 1375, 1375, 1375, 1675, 1675, 1675,
-     1375, 1375, 1376, 1375, 1375, 1375, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1375,
-     1375, 1376, 1375, 1375, 1375, 1377, 1377, 1377, 1377, 1377,
-     1377, 1377, 1675, 1675, 1675, 1377, 1377, 1378, 1377, 1377,
-     1377, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1377, 1377, 1378, 1377, 1377, 1377,
-     1379, 1379, 1379, 1379, 1379, 1379, 1379, 1675, 1675, 1675,
-     1379, 1379, 1380, 1379, 1379, 1379, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1379,
-     1379, 1380, 1379, 1379, 1379, 1381, 1381, 1381, 1381, 1381,
-     1381, 1381, 1675, 1675, 1675, 1381, 1381, 1382, 1381, 1381,
-     1381, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-
-     1675, 1675, 1675, 1675, 1381, 1381, 1382, 1381, 1381, 1381,
-     1383, 1383, 1383, 1383, 1383, 1383, 1383, 1675, 1675, 1675,
-     1383, 1383, 1384, 1383, 1383, 1383, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1383,
-     1383, 1384, 1383, 1383, 1383, 1385, 1385, 1385, 1385, 1385,
-     1385, 1385, 1675, 1675, 1675, 1385, 1385, 1386, 1385, 1385,
-     1385, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1385, 1385, 1386, 1385, 1385, 1385,
-
-     1387, 1387, 1387, 1387, 1387, 1387, 1387, 1675, 1675, 1675,
-     1387, 1387, 1388, 1387, 1387, 1387, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1387,
-     1387, 1388, 1387, 1387, 1387, 1389, 1389, 1389, 1389, 1389,
-     1389, 1389, 1675, 1675, 1675, 1389, 1389, 1390, 1389, 1389,
-     1389, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1389, 1389, 1390, 1389, 1389, 1389,
-     1391, 1391, 1391, 1391, 1391, 1391, 1391, 1675, 1675, 1675,
-
-     1391, 1391, 1392, 1391, 1391, 1391, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1391,
-     1391, 1392, 1391, 1391, 1391, 1393, 1393, 1393, 1393, 1393,
-     1393, 1393, 1675, 1675, 1675, 1393, 1393, 1394, 1393, 1393,
-     1393, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1393, 1393, 1394, 1393, 1393, 1393,
-     1395, 1395, 1395, 1395, 1395, 1395, 1395, 1675, 1675, 1675,
-     1395, 1395, 1396, 1395, 1395, 1395, 1675, 1675, 1675, 1675,
-
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1395,
-     1395, 1396, 1395, 1395, 1395, 1397, 1397, 1397, 1397, 1397,
-     1397, 1397, 1675, 1675, 1675, 1397, 1397, 1398, 1397, 1397,
-     1397, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1397, 1397, 1398, 1397, 1397, 1397,
-     1399, 1399, 1399, 1399, 1399, 1399, 1399, 1675, 1675, 1675,
-     1399, 1399, 1400, 1399, 1399, 1399, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1399,
-     1399, 1400, 1399, 1399, 1399, 1401, 1401, 1401, 1401, 1401,
-     1401, 1401, 1675, 1675, 1675, 1401, 1401, 1402, 1401, 1401,
-     1401, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1401, 1401, 1402, 1401, 1401, 1401,
-     1403, 1403, 1403, 1403, 1403, 1403, 1403, 1675, 1675, 1675,
-     1403, 1403, 1404, 1403, 1403, 1403, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1403,
-
-     1403, 1404, 1403, 1403, 1403, 1405, 1405, 1405, 1405, 1405,
-     1405, 1405, 1675, 1675, 1675, 1405, 1405, 1406, 1405, 1405,
-     1405, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1405, 1405, 1406, 1405, 1405, 1405,
-     1407, 1407, 1407, 1407, 1407, 1407, 1407, 1675, 1675, 1675,
-     1407, 1407, 1408, 1407, 1407, 1407, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1407,
-     1407, 1408, 1407, 1407, 1407, 1409, 1409, 1409, 1409, 1409,
-
-     1409, 1409, 1675, 1675, 1675, 1409, 1409, 1410, 1409, 1409,
-     1409, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1409, 1409, 1410, 1409, 1409, 1409,
-     1411, 1411, 1411, 1411, 1411, 1411, 1411, 1675, 1675, 1675,
-     1411, 1411, 1412, 1411, 1411, 1411, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1411,
-     1411, 1412, 1411, 1411, 1411, 1413, 1413, 1413, 1413, 1413,
-     1413, 1413, 1675, 1675, 1675, 1413, 1413, 1414, 1413, 1413,
-
-     1413, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1413, 1413, 1414, 1413, 1413, 1413,
-     1415, 1415, 1415, 1415, 1415, 1415, 1415, 1675, 1675, 1675,
-     1415, 1415, 1416, 1415, 1415, 1415, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1415,
-     1415, 1416, 1415, 1415, 1415, 1417, 1417, 1417, 1417, 1417,
-     1417, 1417, 1675, 1675, 1675, 1417, 1417, 1418, 1417, 1417,
-     1417, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1417, 1417, 1418, 1417, 1417, 1417,
-     1419, 1419, 1419, 1419, 1419, 1419, 1419, 1675, 1675, 1675,
-     1419, 1419, 1420, 1419, 1419, 1419, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1419,
-     1419, 1420, 1419, 1419, 1419, 1421, 1421, 1421, 1421, 1421,
-     1421, 1421, 1675, 1675, 1675, 1421, 1421, 1422, 1421, 1421,
-     1421, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-
-     1675, 1675, 1675, 1675, 1421, 1421, 1422, 1421, 1421, 1421,
-     1423, 1423, 1423, 1423, 1423, 1423, 1423, 1675, 1675, 1675,
-     1423, 1423, 1424, 1423, 1423, 1423, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1423,
-     1423, 1424, 1423, 1423, 1423, 1425, 1425, 1425, 1425, 1425,
-     1425, 1425, 1675, 1675, 1675, 1425, 1425, 1426, 1425, 1425,
-     1425, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1425, 1425, 1426, 1425, 1425, 1425,
-
-     1427, 1427, 1427, 1427, 1427, 1427, 1427, 1675, 1675, 1675,
-     1427, 1427, 1428, 1427, 1427, 1427, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1427,
-     1427, 1428, 1427, 1427, 1427, 1429, 1429, 1429, 1429, 1429,
-     1429, 1429, 1675, 1675, 1675, 1429, 1429, 1430, 1429, 1429,
-     1429, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1429, 1429, 1430, 1429, 1429, 1429,
-     1431, 1431, 1431, 1431, 1431, 1431, 1431, 1675, 1675, 1675,
-
-     1431, 1431, 1432, 1431, 1431, 1431, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1431,
-     1431, 1432, 1431, 1431, 1431, 1433, 1433, 1433, 1433, 1433,
-     1433, 1433, 1675, 1675, 1675, 1433, 1433, 1434, 1433, 1433,
-     1433, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1433, 1433, 1434, 1433, 1433, 1433,
-     1435, 1435, 1435, 1435, 1435, 1435, 1435, 1675, 1675, 1675,
-     1435, 1435, 1436, 1435, 1435, 1435, 1675, 1675, 1675, 1675,
-
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1435,
-     1435, 1436, 1435, 1435, 1435, 1437, 1437, 1437, 1437, 1437,
-     1437, 1437, 1675, 1675, 1675, 1437, 1437, 1438, 1437, 1437,
-     1437, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1437, 1437, 1438, 1437, 1437, 1437,
-     1439, 1439, 1439, 1439, 1439, 1439, 1439, 1675, 1675, 1675,
-     1439, 1439, 1440, 1439, 1439, 1439, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1439,
-     1439, 1440, 1439, 1439, 1439, 1441, 1441, 1441, 1441, 1441,
-     1441, 1441, 1675, 1675, 1675, 1441, 1441, 1442, 1441, 1441,
-     1441, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1441, 1441, 1442, 1441, 1441, 1441,
-     1443, 1443, 1443, 1443, 1443, 1443, 1443, 1675, 1675, 1675,
-     1443, 1443, 1444, 1443, 1443, 1443, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1443,
-
-     1443, 1444, 1443, 1443, 1443, 1445, 1445, 1445, 1445, 1445,
-     1445, 1445, 1675, 1675, 1675, 1445, 1445, 1446, 1445, 1445,
-     1445, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1445, 1445, 1446, 1445, 1445, 1445,
-     1447, 1447, 1447, 1447, 1447, 1447, 1447, 1675, 1675, 1675,
-     1447, 1447, 1448, 1447, 1447, 1447, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1447,
-     1447, 1448, 1447, 1447, 1447, 1449, 1449, 1449, 1449, 1449,
-
-     1449, 1449, 1675, 1675, 1675, 1449, 1449, 1450, 1449, 1449,
-     1449, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1449, 1449, 1450, 1449, 1449, 1449,
-     1451, 1451, 1451, 1451, 1451, 1451, 1451, 1675, 1675, 1675,
-     1451, 1451, 1452, 1451, 1451, 1451, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1451,
-     1451, 1452, 1451, 1451, 1451, 1453, 1453, 1453, 1453, 1453,
-     1453, 1453, 1675, 1675, 1675, 1453, 1453, 1454, 1453, 1453,
-
-     1453, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1453, 1453, 1454, 1453, 1453, 1453,
-     1455, 1455, 1455, 1455, 1455, 1455, 1455, 1675, 1675, 1675,
-     1455, 1455, 1456, 1455, 1455, 1455, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1455,
-     1455, 1456, 1455, 1455, 1455, 1457, 1457, 1457, 1457, 1457,
-     1457, 1457, 1675, 1675, 1675, 1457, 1457, 1458, 1457, 1457,
-     1457, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1457, 1457, 1458, 1457, 1457, 1457,
-     1459, 1459, 1459, 1459, 1459, 1459, 1459, 1675, 1675, 1675,
-     1459, 1459, 1460, 1459, 1459, 1459, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1459,
-     1459, 1460, 1459, 1459, 1459, 1461, 1461, 1461, 1461, 1461,
-     1461, 1461, 1675, 1675, 1675, 1461, 1461, 1462, 1461, 1461,
-     1461, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-
-     1675, 1675, 1675, 1675, 1461, 1461, 1462, 1461, 1461, 1461,
-     1463, 1463, 1463, 1463, 1463, 1463, 1463, 1675, 1675, 1675,
-     1463, 1463, 1464, 1463, 1463, 1463, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1463,
-     1463, 1464, 1463, 1463, 1463, 1465, 1465, 1465, 1465, 1465,
-     1465, 1465, 1675, 1675, 1675, 1465, 1465, 1466, 1465, 1465,
-     1465, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1465, 1465, 1466, 1465, 1465, 1465,
-
-     1467, 1467, 1467, 1467, 1467, 1467, 1467, 1675, 1675, 1675,
-     1467, 1467, 1468, 1467, 1467, 1467, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1467,
-     1467, 1468, 1467, 1467, 1467, 1469, 1469, 1469, 1469, 1469,
-     1469, 1469, 1675, 1675, 1675, 1469, 1469, 1470, 1469, 1469,
-     1469, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1469, 1469, 1470, 1469, 1469, 1469,
-     1471, 1471, 1471, 1471, 1471, 1471, 1471, 1675, 1675, 1675,
-
-     1471, 1471, 1472, 1471, 1471, 1471, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1471,
-     1471, 1472, 1471, 1471, 1471, 1473, 1473, 1473, 1473, 1473,
-     1473, 1473, 1675, 1675, 1675, 1473, 1473, 1474, 1473, 1473,
-     1473, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1473, 1473, 1474, 1473, 1473, 1473,
-     1475, 1475, 1475, 1475, 1475, 1475, 1475, 1675, 1675, 1675,
-     1475, 1475, 1476, 1475, 1475, 1475, 1675, 1675, 1675, 1675,
-
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1475,
-     1475, 1476, 1475, 1475, 1475, 1477, 1477, 1477, 1477, 1477,
-     1477, 1477, 1675, 1675, 1675, 1477, 1477, 1478, 1477, 1477,
-     1477, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1477, 1477, 1478, 1477, 1477, 1477,
-     1479, 1479, 1479, 1479, 1479, 1479, 1479, 1675, 1675, 1675,
-     1479, 1479, 1480, 1479, 1479, 1479, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1479,
-     1479, 1480, 1479, 1479, 1479, 1481, 1481, 1481, 1481, 1481,
-     1481, 1481, 1675, 1675, 1675, 1481, 1481, 1482, 1481, 1481,
-     1481, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1481, 1481, 1482, 1481, 1481, 1481,
-     1483, 1483, 1483, 1483, 1483, 1483, 1483, 1675, 1675, 1675,
-     1483, 1483, 1484, 1483, 1483, 1483, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1483,
-
-     1483, 1484, 1483, 1483, 1483, 1485, 1485, 1485, 1485, 1485,
-     1485, 1485, 1675, 1675, 1675, 1485, 1485, 1486, 1485, 1485,
-     1485, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1485, 1485, 1486, 1485, 1485, 1485,
-     1487, 1487, 1487, 1487, 1487, 1487, 1487, 1675, 1675, 1675,
-     1487, 1487, 1488, 1487, 1487, 1487, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1487,
-     1487, 1488, 1487, 1487, 1487, 1489, 1489, 1489, 1489, 1489,
-
-     1489, 1489, 1675, 1675, 1675, 1489, 1489, 1490, 1489, 1489,
-     1489, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1489, 1489, 1490, 1489, 1489, 1489,
-     1491, 1491, 1491, 1491, 1491, 1491, 1491, 1675, 1675, 1675,
-     1491, 1491, 1492, 1491, 1491, 1491, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1491,
-     1491, 1492, 1491, 1491, 1491, 1493, 1493, 1493, 1493, 1493,
-     1493, 1493, 1675, 1675, 1675, 1493, 1493, 1494, 1493, 1493,
-
-     1493, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1493, 1493, 1494, 1493, 1493, 1493,
-     1495, 1495, 1495, 1495, 1495, 1495, 1495, 1675, 1675, 1675,
-     1495, 1495, 1496, 1495, 1495, 1495, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1495,
-     1495, 1496, 1495, 1495, 1495, 1497, 1497, 1497, 1497, 1497,
-     1497, 1497, 1675, 1675, 1675, 1497, 1497, 1498, 1497, 1497,
-     1497, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1497, 1497, 1498, 1497, 1497, 1497,
-     1499, 1499, 1499, 1499, 1499, 1499, 1499, 1675, 1675, 1675,
-     1499, 1499, 1500, 1499, 1499, 1499, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1499,
-     1499, 1500, 1499, 1499, 1499, 1501, 1501, 1501, 1501, 1501,
-     1501, 1501, 1675, 1675, 1675, 1501, 1501, 1502, 1501, 1501,
-     1501, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-
-     1675, 1675, 1675, 1675, 1501, 1501, 1502, 1501, 1501, 1501,
-     1503, 1503, 1503, 1503, 1503, 1503, 1503, 1675, 1675, 1675,
-     1503, 1503, 1504, 1503, 1503, 1503, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1503,
-     1503, 1504, 1503, 1503, 1503, 1505, 1505, 1505, 1505, 1505,
-     1505, 1505, 1675, 1675, 1675, 1505, 1505, 1506, 1505, 1505,
-     1505, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1505, 1505, 1506, 1505, 1505, 1505,
-
-     1507, 1507, 1507, 1507, 1507, 1507, 1507, 1675, 1675, 1675,
-     1507, 1507, 1508, 1507, 1507, 1507, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1507,
-     1507, 1508, 1507, 1507, 1507, 1509, 1509, 1509, 1509, 1509,
-     1509, 1509, 1675, 1675, 1675, 1509, 1509, 1510, 1509, 1509,
-     1509, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1509, 1509, 1510, 1509, 1509, 1509,
-     1511, 1511, 1511, 1511, 1511, 1511, 1511, 1675, 1675, 1675,
-
-     1511, 1511, 1512, 1511, 1511, 1511, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1511,
-     1511, 1512, 1511, 1511, 1511, 1513, 1513, 1513, 1513, 1513,
-     1513, 1513, 1675, 1675, 1675, 1513, 1513, 1514, 1513, 1513,
-     1513, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1513, 1513, 1514, 1513, 1513, 1513,
-     1515, 1515, 1515, 1515, 1515, 1515, 1515, 1675, 1675, 1675,
-     1515, 1515, 1516, 1515, 1515, 1515, 1675, 1675, 1675, 1675,
-
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1515,
-     1515, 1516, 1515, 1515, 1515, 1517, 1517, 1517, 1517, 1517,
-     1517, 1517, 1675, 1675, 1675, 1517, 1517, 1518, 1517, 1517,
-     1517, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1517, 1517, 1518, 1517, 1517, 1517,
-     1519, 1519, 1519, 1519, 1519, 1519, 1519, 1675, 1675, 1675,
-     1519, 1519, 1520, 1519, 1519, 1519, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1519,
-     1519, 1520, 1519, 1519, 1519, 1521, 1521, 1521, 1521, 1521,
-     1521, 1521, 1675, 1675, 1675, 1521, 1521, 1522, 1521, 1521,
-     1521, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1521, 1521, 1522, 1521, 1521, 1521,
-     1523, 1523, 1523, 1523, 1523, 1523, 1523, 1675, 1675, 1675,
-     1523, 1523, 1524, 1523, 1523, 1523, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1523,
-
-     1523, 1524, 1523, 1523, 1523, 1525, 1525, 1525, 1525, 1525,
-     1525, 1525, 1675, 1675, 1675, 1525, 1525, 1526, 1525, 1525,
-     1525, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1525, 1525, 1526, 1525, 1525, 1525,
-     1527, 1527, 1527, 1527, 1527, 1527, 1527, 1675, 1675, 1675,
-     1527, 1527, 1528, 1527, 1527, 1527, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1527,
-     1527, 1528, 1527, 1527, 1527, 1529, 1529, 1529, 1529, 1529,
-
-     1529, 1529, 1675, 1675, 1675, 1529, 1529, 1530, 1529, 1529,
-     1529, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1529, 1529, 1530, 1529, 1529, 1529,
-     1531, 1531, 1531, 1531, 1531, 1531, 1531, 1675, 1675, 1675,
-     1531, 1531, 1532, 1531, 1531, 1531, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1531,
-     1531, 1532, 1531, 1531, 1531, 1533, 1533, 1533, 1533, 1533,
-     1533, 1533, 1675, 1675, 1675, 1533, 1533, 1534, 1533, 1533,
-
-     1533, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1533, 1533, 1534, 1533, 1533, 1533,
-     1535, 1535, 1535, 1535, 1535, 1535, 1535, 1675, 1675, 1675,
-     1535, 1535, 1536, 1535, 1535, 1535, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1535,
-     1535, 1536, 1535, 1535, 1535, 1537, 1537, 1537, 1537, 1537,
-     1537, 1537, 1675, 1675, 1675, 1537, 1537, 1538, 1537, 1537,
-     1537, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1537, 1537, 1538, 1537, 1537, 1537,
-     1539, 1539, 1539, 1539, 1539, 1539, 1539, 1675, 1675, 1675,
-     1539, 1539, 1540, 1539, 1539, 1539, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1539,
-     1539, 1540, 1539, 1539, 1539, 1541, 1541, 1541, 1541, 1541,
-     1541, 1541, 1675, 1675, 1675, 1541, 1541, 1542, 1541, 1541,
-     1541, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-
-     1675, 1675, 1675, 1675, 1541, 1541, 1542, 1541, 1541, 1541,
-     1543, 1543, 1543, 1543, 1543, 1543, 1543, 1675, 1675, 1675,
-     1543, 1543, 1544, 1543, 1543, 1543, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1543,
-     1543, 1544, 1543, 1543, 1543, 1545, 1545, 1545, 1545, 1545,
-     1545, 1545, 1675, 1675, 1675, 1545, 1545, 1546, 1545, 1545,
-     1545, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1545, 1545, 1546, 1545, 1545, 1545,
-
-     1547, 1547, 1547, 1547, 1547, 1547, 1547, 1675, 1675, 1675,
-     1547, 1547, 1548, 1547, 1547, 1547, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1547,
-     1547, 1548, 1547, 1547, 1547, 1549, 1549, 1549, 1549, 1549,
-     1549, 1549, 1675, 1675, 1675, 1549, 1549, 1550, 1549, 1549,
-     1549, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1549, 1549, 1550, 1549, 1549, 1549,
-     1551, 1551, 1551, 1551, 1551, 1551, 1551, 1675, 1675, 1675,
-
-     1551, 1551, 1552, 1551, 1551, 1551, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1551,
-     1551, 1552, 1551, 1551, 1551, 1553, 1553, 1553, 1553, 1553,
-     1553, 1553, 1675, 1675, 1675, 1553, 1553, 1554, 1553, 1553,
-     1553, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1553, 1553, 1554, 1553, 1553, 1553,
-     1555, 1555, 1555, 1555, 1555, 1555, 1555, 1675, 1675, 1675,
-     1555, 1555, 1556, 1555, 1555, 1555, 1675, 1675, 1675, 1675,
-
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1555,
-     1555, 1556, 1555, 1555, 1555, 1557, 1557, 1557, 1557, 1557,
-     1557, 1557, 1675, 1675, 1675, 1557, 1557, 1558, 1557, 1557,
-     1557, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1557, 1557, 1558, 1557, 1557, 1557,
-     1559, 1559, 1559, 1559, 1559, 1559, 1559, 1675, 1675, 1675,
-     1559, 1559, 1560, 1559, 1559, 1559, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1559,
-     1559, 1560, 1559, 1559, 1559, 1561, 1561, 1561, 1561, 1561,
-     1561, 1561, 1675, 1675, 1675, 1561, 1561, 1562, 1561, 1561,
-     1561, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1561, 1561, 1562, 1561, 1561, 1561,
-     1563, 1563, 1563, 1563, 1563, 1563, 1563, 1675, 1675, 1675,
-     1563, 1563, 1564, 1563, 1563, 1563, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1563,
-
-     1563, 1564, 1563, 1563, 1563, 1565, 1565, 1565, 1565, 1565,
-     1565, 1565, 1675, 1675, 1675, 1565, 1565, 1566, 1565, 1565,
-     1565, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1565, 1565, 1566, 1565, 1565, 1565,
-     1567, 1567, 1567, 1567, 1567, 1567, 1567, 1675, 1675, 1675,
-     1567, 1567, 1568, 1567, 1567, 1567, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1567,
-     1567, 1568, 1567, 1567, 1567, 1569, 1569, 1569, 1569, 1569,
-
-     1569, 1569, 1675, 1675, 1675, 1569, 1569, 1570, 1569, 1569,
-     1569, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1569, 1569, 1570, 1569, 1569, 1569,
-     1571, 1571, 1571, 1571, 1571, 1571, 1571, 1675, 1675, 1675,
-     1571, 1571, 1572, 1571, 1571, 1571, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1571,
-     1571, 1572, 1571, 1571, 1571, 1573, 1573, 1573, 1573, 1573,
-     1573, 1573, 1675, 1675, 1675, 1573, 1573, 1574, 1573, 1573,
-
-     1573, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1573, 1573, 1574, 1573, 1573, 1573,
-     1575, 1575, 1575, 1575, 1575, 1575, 1575, 1675, 1675, 1675,
-     1575, 1575, 1576, 1575, 1575, 1575, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1575,
-     1575, 1576, 1575, 1575, 1575, 1577, 1577, 1577, 1577, 1577,
-     1577, 1577, 1675, 1675, 1675, 1577, 1577, 1578, 1577, 1577,
-     1577, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1577, 1577, 1578, 1577, 1577, 1577,
-     1579, 1579, 1579, 1579, 1579, 1579, 1579, 1675, 1675, 1675,
-     1579, 1579, 1580, 1579, 1579, 1579, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1579,
-     1579, 1580, 1579, 1579, 1579, 1581, 1581, 1581, 1581, 1581,
-     1581, 1581, 1675, 1675, 1675, 1581, 1581, 1582, 1581, 1581,
-     1581, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-
-     1675, 1675, 1675, 1675, 1581, 1581, 1582, 1581, 1581, 1581,
-     1583, 1583, 1583, 1583, 1583, 1583, 1583, 1675, 1675, 1675,
-     1583, 1583, 1584, 1583, 1583, 1583, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1583,
-     1583, 1584, 1583, 1583, 1583, 1585, 1585, 1585, 1585, 1585,
-     1585, 1585, 1675, 1675, 1675, 1585, 1585, 1586, 1585, 1585,
-     1585, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1585, 1585, 1586, 1585, 1585, 1585,
-
-     1587, 1587, 1587, 1587, 1587, 1587, 1587, 1675, 1675, 1675,
-     1587, 1587, 1588, 1587, 1587, 1587, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1587,
-     1587, 1588, 1587, 1587, 1587, 1589, 1589, 1589, 1589, 1589,
-     1589, 1589, 1675, 1675, 1675, 1589, 1589, 1590, 1589, 1589,
-     1589, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1589, 1589, 1590, 1589, 1589, 1589,
-     1591, 1591, 1591, 1591, 1591, 1591, 1591, 1675, 1675, 1675,
-
-     1591, 1591, 1592, 1591, 1591, 1591, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1591,
-     1591, 1592, 1591, 1591, 1591, 1593, 1593, 1593, 1593, 1593,
-     1593, 1593, 1675, 1675, 1675, 1593, 1593, 1594, 1593, 1593,
-     1593, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1593, 1593, 1594, 1593, 1593, 1593,
-     1595, 1595, 1595, 1595, 1595, 1595, 1595, 1675, 1675, 1675,
-     1595, 1595, 1596, 1595, 1595, 1595, 1675, 1675, 1675, 1675,
-
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1595,
-     1595, 1596, 1595, 1595, 1595, 1597, 1597, 1597, 1597, 1597,
-     1597, 1597, 1675, 1675, 1675, 1597, 1597, 1598, 1597, 1597,
-     1597, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1597, 1597, 1598, 1597, 1597, 1597,
-     1599, 1599, 1599, 1599, 1599, 1599, 1599, 1675, 1675, 1675,
-     1599, 1599, 1600, 1599, 1599, 1599, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1599,
-     1599, 1600, 1599, 1599, 1599, 1601, 1601, 1601, 1601, 1601,
-     1601, 1601, 1675, 1675, 1675, 1601, 1601, 1602, 1601, 1601,
-     1601, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1601, 1601, 1602, 1601, 1601, 1601,
-     1603, 1603, 1603, 1603, 1603, 1603, 1603, 1675, 1675, 1675,
-     1603, 1603, 1604, 1603, 1603, 1603, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1603,
-
-     1603, 1604, 1603, 1603, 1603, 1605, 1605, 1605, 1605, 1605,
-     1605, 1605, 1675, 1675, 1675, 1605, 1605, 1606, 1605, 1605,
-     1605, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1605, 1605, 1606, 1605, 1605, 1605,
-     1607, 1607, 1607, 1607, 1607, 1607, 1607, 1675, 1675, 1675,
-     1607, 1607, 1608, 1607, 1607, 1607, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1607,
-     1607, 1608, 1607, 1607, 1607, 1609, 1609, 1609, 1609, 1609,
-
-     1609, 1609, 1675, 1675, 1675, 1609, 1609, 1610, 1609, 1609,
-     1609, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1609, 1609, 1610, 1609, 1609, 1609,
-     1611, 1611, 1611, 1611, 1611, 1611, 1611, 1675, 1675, 1675,
-     1611, 1611, 1612, 1611, 1611, 1611, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1611,
-     1611, 1612, 1611, 1611, 1611, 1613, 1613, 1613, 1613, 1613,
-     1613, 1613, 1675, 1675, 1675, 1613, 1613, 1614, 1613, 1613,
-
-     1613, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1613, 1613, 1614, 1613, 1613, 1613,
-     1615, 1615, 1615, 1615, 1615, 1615, 1615, 1675, 1675, 1675,
-     1615, 1615, 1616, 1615, 1615, 1615, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1615,
-     1615, 1616, 1615, 1615, 1615, 1617, 1617, 1617, 1617, 1617,
-     1617, 1617, 1675, 1675, 1675, 1617, 1617, 1618, 1617, 1617,
-     1617, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1617, 1617, 1618, 1617, 1617, 1617,
-     1619, 1619, 1619, 1619, 1619, 1619, 1619, 1675, 1675, 1675,
-     1619, 1619, 1620, 1619, 1619, 1619, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1619,
-     1619, 1620, 1619, 1619, 1619, 1621, 1621, 1621, 1621, 1621,
-     1621, 1621, 1675, 1675, 1675, 1621, 1621, 1622, 1621, 1621,
-     1621, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-
-     1675, 1675, 1675, 1675, 1621, 1621, 1622, 1621, 1621, 1621,
-     1623, 1623, 1623, 1623, 1623, 1623, 1623, 1675, 1675, 1675,
-     1623, 1623, 1624, 1623, 1623, 1623, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1623,
-     1623, 1624, 1623, 1623, 1623, 1625, 1625, 1625, 1625, 1625,
-     1625, 1625, 1675, 1675, 1675, 1625, 1625, 1626, 1625, 1625,
-     1625, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1625, 1625, 1626, 1625, 1625, 1625,
-
-     1627, 1627, 1627, 1627, 1627, 1627, 1627, 1675, 1675, 1675,
-     1627, 1627, 1628, 1627, 1627, 1627, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1627,
-     1627, 1628, 1627, 1627, 1627, 1629, 1629, 1629, 1629, 1629,
-     1629, 1629, 1675, 1675, 1675, 1629, 1629, 1630, 1629, 1629,
-     1629, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1629, 1629, 1630, 1629, 1629, 1629,
-     1631, 1631, 1631, 1631, 1631, 1631, 1631, 1675, 1675, 1675,
-
-     1631, 1631, 1632, 1631, 1631, 1631, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1631,
-     1631, 1632, 1631, 1631, 1631, 1633, 1633, 1633, 1633, 1633,
-     1633, 1633, 1675, 1675, 1675, 1633, 1633, 1634, 1633, 1633,
-     1633, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1633, 1633, 1634, 1633, 1633, 1633,
-     1635, 1635, 1635, 1635, 1635, 1635, 1635, 1675, 1675, 1675,
-     1635, 1635, 1636, 1635, 1635, 1635, 1675, 1675, 1675, 1675,
-
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1635,
-     1635, 1636, 1635, 1635, 1635, 1637, 1637, 1637, 1637, 1637,
-     1637, 1637, 1675, 1675, 1675, 1637, 1637, 1638, 1637, 1637,
-     1637, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1637, 1637, 1638, 1637, 1637, 1637,
-     1639, 1639, 1639, 1639, 1639, 1639, 1639, 1675, 1675, 1675,
-     1639, 1639, 1640, 1639, 1639, 1639, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1639,
-     1639, 1640, 1639, 1639, 1639, 1641, 1641, 1641, 1641, 1641,
-     1641, 1641, 1675, 1675, 1675, 1641, 1641, 1642, 1641, 1641,
-     1641, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1641, 1641, 1642, 1641, 1641, 1641,
-     1643, 1643, 1643, 1643, 1643, 1643, 1643, 1675, 1675, 1675,
-     1643, 1643, 1644, 1643, 1643, 1643, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1643,
-
-     1643, 1644, 1643, 1643, 1643, 1645, 1645, 1645, 1645, 1645,
-     1645, 1645, 1675, 1675, 1675, 1645, 1645, 1646, 1645, 1645,
-     1645, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1645, 1645, 1646, 1645, 1645, 1645,
-     1647, 1647, 1647, 1647, 1647, 1647, 1647, 1675, 1675, 1675,
-     1647, 1647, 1648, 1647, 1647, 1647, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1647,
-     1647, 1648, 1647, 1647, 1647, 1649, 1649, 1649, 1649, 1649,
-
-     1649, 1649, 1675, 1675, 1675, 1649, 1649, 1650, 1649, 1649,
-     1649, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1649, 1649, 1650, 1649, 1649, 1649,
-     1651, 1651, 1651, 1651, 1651, 1651, 1651, 1675, 1675, 1675,
-     1651, 1651, 1652, 1651, 1651, 1651, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1651,
-     1651, 1652, 1651, 1651, 1651,   83,   83,   83,   83,   83,
-       83,   83, 1675, 1675, 1675,   83,   83,   84,   83,   83,
-
-       83, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675,   83,   83,   84,   83,   83,   83,
-     1653, 1653, 1653, 1653, 1653, 1653, 1653, 1675, 1675, 1675,
-     1653, 1653, 1654, 1653, 1653, 1653, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1653,
-     1653, 1654, 1653, 1653, 1653, 1655, 1655, 1655, 1655, 1655,
-     1655, 1655, 1675, 1675, 1675, 1655, 1655, 1656, 1655, 1655,
-     1655, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1655, 1655, 1656, 1655, 1655, 1655,
-     1657, 1657, 1657, 1657, 1657, 1657, 1657, 1675, 1675, 1675,
-     1657, 1657, 1658, 1657, 1657, 1657, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1657,
-     1657, 1658, 1657, 1657, 1657, 1659, 1659, 1659, 1659, 1659,
-     1659, 1659, 1675, 1675, 1675, 1659, 1659, 1660, 1659, 1659,
-     1659, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-
-     1675, 1675, 1675, 1675, 1659, 1659, 1660, 1659, 1659, 1659,
-       92,   92,   92,   92,   92,   92,   92, 1675, 1675, 1675,
-       92,   92,   93,   92,   92,   92, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,   92,
-       92,   93,   92,   92,   92, 1661, 1661, 1661, 1661, 1661,
-     1661, 1661, 1675, 1675, 1675, 1661, 1661, 1662, 1661, 1661,
-     1661, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1661, 1661, 1662, 1661, 1661, 1661,
-
-     1663, 1663, 1663, 1663, 1663, 1663, 1663, 1675, 1675, 1675,
-     1663, 1663, 1664, 1663, 1663, 1663, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1663,
-     1663, 1664, 1663, 1663, 1663, 1665, 1665, 1665, 1665, 1665,
-     1665, 1665, 1675, 1675, 1675, 1665, 1665, 1666, 1665, 1665,
-     1665, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1665, 1665, 1666, 1665, 1665, 1665,
-     1667, 1667, 1667, 1667, 1667, 1667, 1667, 1675, 1675, 1675,
-
-     1667, 1667, 1668, 1667, 1667, 1667, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1667,
-     1667, 1668, 1667, 1667, 1667, 1669, 1669, 1669, 1669, 1669,
-     1669, 1669, 1675, 1675, 1675, 1669, 1669, 1670, 1669, 1669,
-     1669, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1669, 1669, 1670, 1669, 1669, 1669,
-     1671, 1671, 1671, 1671, 1671, 1671, 1671, 1675, 1675, 1675,
-     1671, 1671, 1672, 1671, 1671, 1671, 1675, 1675, 1675, 1675,
-
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1671,
-     1671, 1672, 1671, 1671, 1671, 1673, 1673, 1673, 1673, 1673,
-     1673, 1673, 1675, 1675, 1675, 1673, 1673, 1674, 1673, 1673,
-     1673, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1673, 1673, 1674, 1673, 1673, 1673,
-        6,    6,    6,    6,    6,    6,    6,   28,   28,   28,
-       28,   28,   28,   28,   57, 1675,   57,   57,   57,   57,
-       57,   60,   60,   83, 1675,   83,   83,   83,   83,   83,
-
-       92, 1675,   92,   92,   92,   92,   92,  125,  125,  125,
-      125,  187,  187,  194,  194,  194,  194,  227, 1675,  227,
-      227,  227,  227,  227,  248, 1675, 1675,  248,  248,  362,
-      362,  413,  413,  423,  423,  462,  462,  485,  485,  520,
-      520,  531,  531,  558,  558,  571,  571,  587,  587,  589,
-      589,  604,  604,  616,  616,  629,  629,  631,  631,  645,
-      645,  667,  667,  679,  679,  700,  700,  711,  711,    5,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675
-    } ;
-
-static yyconst flex_int16_t yy_chk[27444] =
-    {   0,
-        0,    1,    1,    1,    7,    7,    7,    0,    1,    1,
-        1,    1,    1,    1,    1,    8,    8,    8,   21,   23,
-       61,   65,   10,    9,   18,   67, 1673,    9,    1,    9,
-        9,    9,    9,    9,    9,    9,   52,   52,   52,   54,
-       54,   54,   54,   54,   54,   54,   60,   21,   23,   61,
-       65,   10, 1669,   18,   67,   60,  711,    1,    2,    2,
-        2,    2,    2,    2,    2,    2,    2,    2,    2,    2,
-        2,    2,    2,    2,    2,    2,    2,    2,    2,    2,
-        2,    2,    2,    2,    2,    2,    2,    2,    2,    2,
-        2,    2,    2,    2,    2,    2,    2,    2,    2,    2,
-
-        2,    2,    2,    2,    2,    2,    2,    2,    2,    2,
-        2,    2,    2,    2,    2,    2,    2,    2,    2,    2,
-        2,    2,    2,    2,    2,    2,    2,    2,    2,    2,
-        2,    3,    3,    3,   14,   16,   17,  629,    3,    3,
-        3,    3,    3,    3,    3,   15,   20,   25,   26,   15,
-        3,  248,   17,   22,   24,  617,   22,   24,    3,   64,
-      248,   24,   14,   15,   16,   17,    3,   58,   58,   58,
-       58,   58,   58,   58,   15,   20,   25,   26,   15,    3,
-       17,  588,   22,   24,   22,  573,   24,    3,   64,   55,
-       24,   15,  557,   55,    3,   55,   55,   55,   55,   55,
-
-       55,   55,    3,    4,    4,    4,    4,    4,    4,    4,
-        4,    4,    4,    4,    4,    4,    4,    4,    4,    4,
-        4,    4,    4,    4,    4,    4,    4,    4,    4,    4,
-        4,    4,    4,    4,    4,    4,    4,    4,    4,    4,
-        4,    4,    4,    4,    4,    4,    4,    4,    4,    4,
-        4,    4,    4,    4,    4,    4,    4,    4,    4,    4,
-        4,    4,    4,    4,    4,    4,    4,    4,    4,    4,
-        4,    4,    4,    4,    4,    4,   12,   56,  262,  262,
-       12,   12,   12,   12,   12,   12,   12,   12,   12,   28,
-       31,   33,   12,   12,   12,   12,   12,   12,   27,  556,
-
-       33,   27,   68,   66,   56,   28,   31,   33,   31,   29,
-       29,   29,   66,   27,   66,   71,  554,  544,   28,   31,
-       33,   12,   12,   12,   12,   12,   12,   27,   29,   33,
-       27,   68,   72,   28,   31,   33,   31,   70,   70,   73,
-       76,   27,   34,   71,   29,   32,   35,   32,  532,  527,
-       59,  526,  525,  521,   59,   59,   62,   29,   34,  495,
-       72,   32,   35,   59,  494,   62,   70,   70,   73,   76,
-      493,   34,   29,   30,   32,   35,   32,   30,   74,   30,
-       30,   30,   30,   30,   30,   30,   34,   62,   37,   32,
-       35,   30,   37,   37,   37,   37,   37,   37,   37,   37,
-
-       37,   75,   77,   78,   41,   41,   74,   30,   41,   63,
-       79,  488,  484,  464,  413,   62,  463,  451,   63,  462,
-       30,   41,   41,  413,  459,  459,  459,  459,  462,   75,
-       63,   77,   78,   41,   41,   30,   36,   41,   80,   79,
-       36,   36,   36,   36,   36,   36,   36,   36,   36,   41,
-       41,   44,   36,   36,   36,   36,   36,   36,   42,   63,
-       42,   81,   82,   44,  128,  129,   80,   44,  130,  450,
-       36,  131,  130,  426,   42,  497,  497,  497,  497,  497,
-       44,   36,   36,   36,   36,   36,   36,   42,  133,   42,
-       81,   82,   44,  128,  129,   44,  138,  136,   36,   38,
-
-      131,  130,   42,   38,   38,   38,   38,   38,   38,   38,
-       38,   38,   40,   45,  137,   45,   40,  133,  139,  140,
-      410,  145,   43,  142,  138,   40,  136,  143,  144,  190,
-       40,   45,   38,   43,  421,   38,   47,   47,  420,  418,
-      414,   40,   45,  137,   45,   40,  139,  410,  140,   43,
-      145,  142,  398,   47,   40,  143,  144,  190,   40,   45,
-       38,  201,   43,   38,   39,   47,   47,   46,   39,   39,
-       39,   39,   39,   39,   39,   39,   39,   43,  204,   46,
-       39,   47,   46,   46,   39,   48,   50,   48,  520,  201,
-       48,   49,  381,  379,   48,  558,   46,  520,   39,   50,
-
-      369,   48,   50,   49,  558,  361,  204,   49,   46,   39,
-       46,   46,  523,   39,   48,   50,   48,   51,   51,   48,
-       49,   51,   83,   48,   84,   85,   39,  146,   50,   48,
-       50,  147,   49,   51,   85,   49,   89,  329,   83,  523,
-       84,   85,   84,   86,   86,   86,   51,   51,  325,  324,
-       51,   83,   89,   84,   85,   90,  146,  148,  149,   92,
-      147,   51,   86,   85,  183,   89,   83,  192,   84,   85,
-       84,   90,  193,   91,  587,   92,   93,   90,   86,  321,
-       89,  604,  319,  587,   90,   91,  148,  149,   92,   91,
-      604,   86,   93,  183,   93,  318,  192,  195,  197,   90,
-
-      198,  193,   91,   92,   90,   93,   86,   87,   87,   87,
-       87,   87,   87,   87,   91,   94,  269,   91,   99,   87,
-       93,  645,   93,  199,   94,  203,  195,  197,  205,  198,
-      645,   94,  206,  679,   99,   87,   97,   98,  266,  246,
-      208,  200,  679,  194,   94,   97,   98,   99,   87,  103,
-       97,   98,  199,   94,  203,  207,  209,  205,  210,   94,
-      228,  206,   99,   87,   88,  103,   97,   98,   88,   98,
-       88,   88,   88,   88,   88,   88,   88,  100,  103,   97,
-       98,  229,   88,  244,  207,  209,  100,  210,  228,  251,
-      252,  100,  253,  103,   97,   98,  255,   98,   88,  189,
-
-      188,  187,  141,  134,  101,  127,  122,  100,  100,  254,
-      229,   88,  244,  101,  256,  258,  259,  251,  101,  252,
-      100,  253,  260,  263,  255,  101,   88,   95,   95,   95,
-       95,   95,   95,   95,  101,  100,  100,  102,  254,   95,
-       69,   19,    5,  256,  258,  259,  102,  101,  261,  264,
-      102,  260,  263,  102,  101,   95,  104,    0,    0,    0,
-        0,    0,  101,    0,    0,  104,  102,  104,   95,  105,
-      104,  105,    0,    0,    0,  102,  261,  264,    0,  102,
-        0,  102,    0,   95,   96,  107,  104,  105,   96,   96,
-       96,   96,   96,   96,   96,   96,   96,   96,  105,  104,
-
-      105,  106,   96,  107,  265,    0,  268,  109,  112,  108,
-      270,  110,  267,  267,  104,  105,    0,  106,   96,  107,
-      108,  108,    0,  109,  112,  108,  110,  110,  111,    0,
-      106,   96,  107,  265,  111,  268,  109,  112,  108,  270,
-      110,  267,  267,  289,  111,  106,   96,  107,  114,  108,
-      108,  109,  112,  108,  110,  110,  305,  111,  113,  290,
-      114,  309,  116,  111,  114,  115,  117,  115,  116,  118,
-      310,  289,  111,  113,  113,  117,    0,  114,  116,  115,
-        0,    0,  117,  115,  305,  118,  311,  113,  290,  114,
-      309,  116,  114,    0,  115,  117,  115,  116,  118,  310,
-
-      119,  113,  113,  312,  117,  120,  116,  313,  115,  119,
-      117,  115,  314,  118,  120,  311,  119,  315,  120,    0,
-      316,  120,  124,  124,  124,  124,  124,  124,  124,  119,
-        0,    0,  312,    0,  120,    0,  313,    0,  119,  317,
-      322,  314,    0,  120,  119,  121,  315,  120,  316,  120,
-        0,  121,  121,  121,  121,  121,  121,  121,  123,  123,
-      123,  123,  123,  123,  123,  123,  125,  320,  317,  322,
-      125,  125,  125,  125,  125,  125,  125,  125,  125,  150,
-        0,    0,  152,  150,  150,  150,  150,  150,  150,  150,
-      150,  150,  150,  151,    0,  320,  153,    0,  152,  154,
-
-      326,  161,  151,  161,  155,  328,  344,  166,  152,  151,
-      151,  152,  153,  153,  344,  154,  155,  166,    0,  161,
-      155,  367,  151,  166,  345,  153,  152,    0,  154,  326,
-      161,  151,  161,  155,  328,  344,  166,  151,  151,    0,
-      153,  153,  344,  154,  359,  155,  166,  161,  155,  156,
-      367,  166,  345,  156,  156,  156,  156,  156,  156,  156,
-      156,  156,  156,  157,  157,  157,  157,  157,  157,  157,
-        0,    0,  359,  157,  157,  157,  157,  157,  157,  158,
-        0,  158,  158,  158,  158,  158,  158,  158,  158,    0,
-        0,  157,  159,  159,  159,  159,  159,  159,  159,  167,
-
-      160,    0,  157,  157,  157,  157,  157,  157,  160,  162,
-      163,  177,  168,  163,  163,  162,  168,  167,  164,  157,
-      363,  364,  366,  376,  160,  162,  160,  177,  168,  163,
-      164,    0,    0,  167,  164,  167,  164,  160,  162,  380,
-      177,  168,  163,  163,  162,  168,  167,  164,  363,  364,
-      366,  376,  160,  162,  160,  177,  168,  163,  368,  164,
-      169,  167,  164,  167,  164,  165,  165,  380,  165,  165,
-      165,  165,    0,  169,  170,    0,  169,  171,  370,  174,
-      165,  165,  165,  170,  172,  165,    0,  368,    0,  169,
-      170,  170,    0,  171,  171,  174,  172,  173,  174,  390,
-
-      172,  165,  169,  170,  169,    0,  171,  370,  174,  165,
-      165,  165,  170,  172,  165,  173,  371,  175,  170,  170,
-      374,  171,  171,  174,  173,  172,  174,  390,  172,  165,
-        0,  173,  175,  175,  178,  176,  165,  165,  397,  179,
-        0,  417,  422,  178,  173,  371,  175,  424,  179,  374,
-      178,  176,  179,  173,  176,  179,  181,  180,  181,  173,
-      175,  175,    0,  178,  176,    0,  441,  397,  179,  180,
-      417,  422,  178,  180,  181,    0,  424,  179,  178,  176,
-        0,  179,  176,  179,  211,  181,  180,  181,  184,  184,
-      184,  184,  184,  184,  184,  441,  211,    0,  180,  447,
-
-      211,  180,  181,  185,  185,  185,  185,  185,  185,  185,
-      185,  186,  191,  211,  212,    0,  212,  186,  186,  186,
-      186,  186,  186,  186,  213,  211,  191,  447,  211,  457,
-      212,  461,  191,  490,    0,  214,  454,  458,  474,    0,
-      213,  191,  486,  212,  214,  212,  215,    0,  487,  489,
-      213,  214,  214,  213,    0,  191,    0,  457,  212,  461,
-      191,  490,  215,  215,  214,  454,  458,  474,  213,    0,
-        0,  486,    0,  214,    0,  215,  219,  487,  489,  214,
-      214,  221,  219,  219,  219,  219,  219,  219,  219,    0,
-      215,  215,  216,  216,  216,  216,  216,  216,  216,  221,
-
-      220,  226,  226,  233,  216,  233,  220,  220,  220,  220,
-      220,  220,  220,  491,  505,  221,  510,  226,  222,  233,
-      216,  222,  223,  492,    0,    0,    0,    0,  221,    0,
-      226,  226,  233,  216,  233,    0,  220,  222,  223,  223,
-        0,  491,  505,  221,  510,  226,    0,  233,  216,  217,
-      222,  223,  492,  217,  217,  217,  217,  217,  217,  217,
-      217,  217,  217,  218,  220,  222,  223,  223,  522,  218,
-      218,  218,  218,  218,  218,  218,  224,  240,  224,  218,
-      218,  218,  218,  218,  218,  225,  456,  524,  456,  240,
-      224,  225,    0,  240,  224,    0,  224,  522,    0,  550,
-
-      555,  225,    0,    0,    0,  224,  240,  224,  218,  218,
-      218,  218,  218,  218,  225,  456,  524,  456,  240,  224,
-      225,  240,  224,  234,  224,  578,  234,  550,  555,  225,
-      227,  227,  227,  227,  227,  227,  227,    0,  230,  232,
-      232,    0,  234,  231,  230,  227,  227,  227,  231,  235,
-      227,    0,  582,  578,  230,  234,  232,  593,  596,  231,
-        0,  601,  607,  611,  235,  235,  227,  230,  232,  232,
-      234,  621,  231,  230,  227,  227,  227,  231,  235,  227,
-      582,  236,  230,  236,  232,  593,  596,  231,  237,  601,
-      607,  611,  235,  235,  227,  624,    0,  236,  238,  621,
-
-      238,  227,  227,    0,  237,  237,  239,    0,  239,    0,
-      236,  626,  236,  634,  238,  241,    0,  237,  272,  242,
-      242,    0,  239,  624,  239,  236,  637,  238,  272,  238,
-      642,  241,  237,  237,  272,  239,  242,  239,    0,  626,
-      241,  634,  238,    0,  241,  243,    0,  272,  242,  242,
-      239,    0,  239,    0,  637,  647,  243,  272,  642,  241,
-        0,  243,  272,    0,  242,  245,  245,  245,  245,  245,
-      245,  245,  245,    0,  243,  271,  271,  271,  271,  271,
-      271,  271,    0,  647,  247,  243,  649,  273,  247,  243,
-      247,  247,  247,  247,  247,  247,  247,  247,  273,  274,
-
-        0,  275,    0,  273,    0,  274,  276,    0,  652,  659,
-      278,  280,  661,  275,  649,  274,  273,  275,  663,  665,
-      280,  669,  276,  278,    0,  280,    0,  273,  274,    0,
-      275,  273,  276,    0,  274,  276,  652,  659,  671,  278,
-      661,  280,  275,  274,    0,  275,  663,  665,    0,  669,
-      276,  277,  278,    0,  280,  277,  277,  277,  277,  277,
-      277,  277,  277,  277,  277,    0,  671,  278,  279,  280,
-      674,  282,  279,  279,  279,  279,  279,  279,  279,  279,
-      279,  279,  281,  676,    0,  678,    0,  282,  283,    0,
-      284,  281,  285,  286,  287,  285,  281,    0,  674,  284,
-
-      282,    0,  286,    0,  283,  283,  284,    0,  285,  286,
-      287,  676,  281,  678,  281,  282,  681,  283,    0,  284,
-        0,  285,  286,  287,  285,  281,    0,    0,  284,  288,
-      291,  286,  283,  283,  284,  288,  285,  286,  287,  294,
-      281,  291,  281,    0,  681,  288,  291,  292,  293,  292,
-      293,  296,    0,  683,  294,  294,    0,  296,  288,  291,
-      295,  295,    0,    0,  288,  292,  293,  296,  294,  297,
-      291,  295,  299,  288,  291,  685,  292,  293,  292,  293,
-      296,  683,  294,  294,  297,  297,  296,  295,  343,  301,
-      299,  298,  301,  292,  293,  296,  298,    0,  297,  343,
-
-      295,    0,  687,  685,  343,  301,  299,  298,  300,  300,
-      300,  302,  297,  297,  692,  295,  694,  343,  301,  299,
-      298,  301,  303,    0,  303,  298,  300,    0,  343,  302,
-      687,    0,  343,  301,  299,  298,    0,  300,  300,  300,
-      303,  330,  692,  330,  694,  302,    0,    0,    0,    0,
-        0,  303,    0,  303,  300,  348,    0,  330,  302,  306,
-      306,  306,  306,  306,  306,  306,  331,    0,  303,    0,
-      330,  348,  330,  302,  304,  304,  304,  304,  304,  304,
-      304,  696,  331,  331,  348,  330,  304,  307,  307,  307,
-      307,  307,  307,  307,  307,  331,  332,  332,  333,  348,
-
-      334,    0,  304,  698,  702,  704,  334,    0,  333,  696,
-      331,  331,  332,    0,  333,  304,  334,    0,    0,    0,
-        0,  349,    0,    0,    0,  332,  332,  333,    0,  334,
-      304,  698,  702,  704,  706,  334,  338,  333,  338,  349,
-      332,  339,  333,  339,  334,  335,  335,  335,  335,  335,
-      335,  335,  338,  340,    0,  349,  340,  335,  352,  339,
-      346,  352,  706,  708,  346,  338,  710,  338,  349,  340,
-      339,  713,  339,  335,    0,  715,  346,  352,    0,    0,
-      338,    0,  340,  349,    0,  340,  335,  339,    0,  346,
-      352,  708,    0,  346,  710,    0,    0,  340,    0,  713,
-
-        0,  335,  336,  715,  346,  352,  336,  336,  336,  336,
-      336,  336,  336,  336,  336,  336,  337,  337,  337,  337,
-      337,  337,  337,  341,  347,  341,  337,  337,  337,  337,
-      337,  337,  342,  350,  342,    0,    0,    0,  717,    0,
-      347,  341,  347,  342,  353,    0,  353,    0,  351,    0,
-      342,  350,  341,  347,  341,  337,  337,  337,  337,  337,
-      337,  342,  353,  342,  351,  351,  717,  350,  347,  341,
-      347,    0,  342,  353,  719,  353,    0,  351,  342,  354,
-      350,  355,  354,  356,  355,  357,  356,    0,  382,    0,
-      353,  358,  351,  351,  357,  350,  724,  726,  354,  356,
-
-      355,  357,  719,  382,  382,    0,    0,  358,    0,    0,
-        0,  354,  356,  355,  357,  356,  358,  382,  383,    0,
-      358,    0,    0,  357,  724,  726,  354,  356,  355,  357,
-      360,  382,  382,  383,  383,  358,  360,  360,  360,  360,
-      360,  360,  360,  384,  388,    0,    0,  383,  385,  393,
-      385,  386,  386,  391,  392,  394,  405,  388,    0,  728,
-      384,  383,  383,  730,  385,  393,  732,  386,  391,  391,
-      392,  394,  405,  388,  392,  394,  384,  385,  393,  385,
-      386,  386,  391,  392,  394,  405,  388,  728,    0,  384,
-        0,  730,  385,  393,  732,  386,  391,  391,  392,  394,
-
-      405,  388,  392,  394,  384,  387,    0,    0,    0,  387,
-      387,  387,  387,  387,  387,  387,  387,  387,  387,  389,
-      389,  389,  389,  389,  389,  389,  395,  395,    0,  389,
-      389,  389,  389,  389,  389,  396,  400,    0,  399,  396,
-        0,  399,    0,  395,    0,  400,    0,  455,  455,    0,
-        0,  396,  400,  406,  455,  395,  395,  399,  389,  389,
-      389,  389,  389,  389,  396,  400,  407,  734,  396,  406,
-      399,  395,  402,  401,  400,  736,  455,  455,  402,  396,
-      400,  401,  406,  455,  407,  399,  738,  740,  402,  401,
-      742,  401,    0,    0,    0,  734,    0,  406,    0,    0,
-
-      407,  402,  401,  736,    0,    0,    0,  402,    0,    0,
-      401,  404,    0,  407,  738,  740,  402,  401,  742,  401,
-      403,  403,  403,  403,  403,  403,  403,  404,  407,  404,
-      403,  403,  403,  403,  403,  403,  408,  412,  409,  744,
-      404,  746,    0,  412,  412,  412,  412,  412,  412,  412,
-        0,  748,  408,  750,  429,  404,  409,  404,  428,  403,
-      403,  403,  403,  403,  403,  408,  419,  744,  419,  746,
-      429,  432,  409,  752,  428,  430,  429,  431,  430,  748,
-      408,  750,  419,  429,  428,  409,    0,  428,  432,    0,
-        0,    0,  431,  431,  430,  419,    0,  419,  429,    0,
-
-      409,  752,  428,  429,  432,  434,  431,  430,    0,    0,
-      419,    0,    0,    0,  434,    0,    0,  432,  436,  434,
-      431,  431,  430,  530,  530,  530,  530,  530,  530,  530,
-      754,    0,  432,  433,    0,  434,  436,  433,  433,  433,
-      433,  433,  433,  433,  433,  433,  433,  435,  434,    0,
-        0,    0,  436,  437,  438,  439,  435,  440,  754,  443,
-      440,  435,  443,  434,  439,  436,    0,  756,  444,  437,
-      438,  439,  442,    0,  442,    0,  440,  435,  443,  435,
-      436,  758,  437,  438,  439,  760,  444,    0,  442,  440,
-      435,  443,  445,  439,  445,  756,  762,  437,  438,  439,
-
-      764,  442,  444,  442,  440,  435,  443,  435,  445,  758,
-        0,    0,    0,  760,    0,  444,  442,  448,    0,    0,
-        0,  445,    0,  445,  762,    0,  448,    0,  764,    0,
-      444,  766,    0,  448,    0,  768,  445,  446,  446,  446,
-      446,  446,  446,  446,  449,    0,  448,  446,  446,  446,
-      446,  446,  446,  449,  465,  448,    0,  466,    0,  766,
-      449,  448,  465,  768,    0,  770,  772,  467,  470,  449,
-      465,  774,    0,  449,  466,    0,  446,  446,  446,  446,
-      446,  446,  449,  465,  467,  468,  470,    0,  449,  469,
-      466,  465,  469,  770,  772,  776,  778,  780,  465,  774,
-
-      467,  468,  470,  466,  782,  784,  786,  788,  469,    0,
-        0,  468,    0,  467,  468,  470,    0,  790,  466,    0,
-        0,  469,    0,  776,  778,  780,    0,    0,  467,  468,
-      470,  792,  782,  784,  786,  788,  469,  471,  471,  471,
-      471,  471,  471,  471,  472,  790,  472,  471,  471,  471,
-      471,  471,  471,  476,  473,  473,  473,    0,    0,  792,
-      472,  473,  574,  574,  574,  574,  574,  574,  574,  476,
-      479,    0,  473,  472,  794,  472,  471,  471,  471,  471,
-      471,  471,  476,  473,  473,  473,  479,  475,  472,  475,
-      473,  796,  477,    0,    0,  477,    0,  476,    0,  479,
-
-      473,  477,  794,    0,  798,  475,    0,  475,  477,  483,
-      478,  478,  478,  478,  479,    0,  475,  480,  475,  796,
-      481,  477,  478,    0,  477,  482,  480,  483,  482,  481,
-      477,  480,  798,  475,  481,  475,  477,    0,  478,  499,
-        0,  499,    0,  483,  482,  500,    0,  480,    0,    0,
-      481,  478,  481,  501,  800,  499,  483,  482,    0,  503,
-      480,  500,  802,  481,    0,  501,  478,  804,  499,  502,
-      499,  483,  482,  806,  500,  480,  503,  502,  481,  808,
-      481,  501,  800,  499,  810,  502,  506,  506,    0,  500,
-      802,  812,  503,    0,  501,  804,  500,    0,  502,    0,
-
-        0,  806,  506,    0,    0,  503,  502,  808,    0,  501,
-        0,  814,  810,  502,  816,  506,  506,    0,    0,  812,
-      503,  504,  504,  504,  504,  504,  504,  504,  507,  511,
-      506,  504,  504,  504,  504,  504,  504,    0,  507,  814,
-      509,  509,  816,    0,  507,  511,  508,    0,  818,    0,
-      534,    0,  508,  514,    0,    0,  509,  507,  511,  512,
-      504,  504,  504,  504,  504,  504,  534,  507,  508,  509,
-      509,  514,  507,  511,  515,  512,  818,  512,  820,  534,
-        0,  508,  513,  535,  509,  513,    0,  514,  512,  822,
-      516,  513,  515,  516,  534,  824,  508,  826,  513,  535,
-
-      514,  828,  516,  512,  535,  512,  820,  830,  515,  516,
-        0,  513,  535,    0,  513,  514,  536,  822,  536,    0,
-      513,  515,  516,  824,    0,  826,  513,  535,    0,  828,
-        0,  516,  536,    0,    0,  830,  515,  516,  517,  517,
-      517,  517,  517,  517,  517,  536,  533,  536,  517,  517,
-      517,  517,  517,  517,  540,  518,  518,  518,  518,  518,
-      536,  537,  533,    0,  832,    0,  834,  518,  533,    0,
-        0,  836,  540,  537,    0,  533,  838,  517,  517,  517,
-      517,  517,  517,  518,  538,    0,    0,  840,  540,  537,
-      533,  539,  832,  538,  834,  533,  518,  541,  538,  836,
-
-      539,  540,  537,  541,  838,  539,  542,  543,  543,    0,
-      547,  518,  545,  541,  538,  840,  540,  537,    0,    0,
-      546,  539,  542,  539,  543,  842,  541,  538,  547,  542,
-      545,    0,  541,    0,  539,  542,  543,  543,  546,  545,
-        0,  541,  538,  551,  547,  560,  545,  546,    0,  539,
-      542,  539,  543,  842,  546,    0,  542,  547,    0,  545,
-        0,  551,  560,    0,    0,    0,  844,  546,  545,    0,
-      846,  848,  547,  850,  545,  565,  546,  551,  560,  852,
-        0,  562,  546,  548,  548,  548,  548,  548,  548,  548,
-      551,  560,  563,  565,  844,  548,    0,  562,  846,  848,
-
-      854,  850,    0,  562,  566,  551,  560,  852,  563,  565,
-      562,  548,    0,  563,    0,    0,  568,    0,    0,    0,
-      566,  563,  565,    0,  548,  562,    0,    0,  854,  856,
-      562,  568,    0,  566,  858,    0,  563,  565,  860,  548,
-      549,  549,  549,  549,  549,  549,  549,  568,  566,    0,
-      549,  549,  549,  549,  549,  549,    0,  856,    0,    0,
-      568,    0,  858,  569,    0,    0,  860,  567,    0,    0,
-        0,    0,  569,  862,  864,  568,  567,  569,    0,  549,
-      549,  549,  549,  549,  549,  561,  561,  561,  561,  561,
-      561,  561,  567,  569,    0,  561,  561,  561,  561,  561,
-
-      561,  862,  864,    0,    0,  567,  569,  603,  603,  603,
-      603,  603,  603,  603,    0,    0,    0,    0,    0,  576,
-      567,  569,  576,  592,  561,  561,  561,  561,  561,  561,
-      564,  564,  564,  564,  564,  564,  564,  866,  576,  592,
-      564,  564,  564,  564,  564,  564,  570,    0,    0,  605,
-        0,  576,  592,  868,  870,  570,  594,    0,  872,  594,
-      570,  605,    0,    0,    0,  866,  576,  592,  579,  564,
-      564,  564,  564,  564,  564,  594,  570,  605,  570,    0,
-        0,  868,  870,    0,    0,  579,  872,    0,  594,  570,
-      605,  630,  630,  630,  630,  630,  630,  630,  584,  874,
-
-      876,  579,  878,  594,  570,  605,  570,  577,  577,  577,
-      577,  577,  577,  577,  579,  577,  584,  577,  577,  577,
-      577,  577,  577,    0,    0,    0,    0,  874,  876,  579,
-      878,    0,  584,    0,    0,    0,    0,    0,    0,    0,
-        0,  583,  880,  882,  590,  584,  577,  577,  577,  577,
-      577,  577,  580,  580,  580,  580,  580,  580,  580,  583,
-      584,  590,  580,  580,  580,  580,  580,  580,  583,    0,
-      880,  882,    0,  610,    0,  583,  884,  590,  886,  888,
-      580,    0,    0,    0,    0,  599,    0,    0,  583,  610,
-      590,  580,  580,  580,  580,  580,  580,  583,  890,  892,
-
-      599,    0,  610,  583,  884,  590,  886,  888,  580,  581,
-      581,  581,  581,  581,  581,  581,  599,  610,    0,  581,
-      581,  581,  581,  581,  581,    0,  890,  892,    0,  599,
-      608,  597,  598,    0,    0,    0,    0,    0,    0,  894,
-      597,  598,  896,  898,  599,  597,  598,  608,  581,  581,
-      581,  581,  581,  581,  585,  585,  585,  585,  585,  585,
-      585,  597,  598,  608,  598,  619,  585,  894,  900,    0,
-      896,  898,  902,  904,  597,  598,  608,  906,  908,  910,
-        0,  619,  585,    0,    0,    0,  619,    0,  614,  597,
-      598,  608,  598,    0,  619,  585,  900,  614,    0,  912,
-
-      902,  904,  614,    0,  914,  906,  908,  910,  622,  619,
-      585,  586,  586,  586,  586,  586,  586,  586,  614,    0,
-      622,  586,  586,  586,  586,  586,  586,  912,    0,    0,
-        0,  614,  914,  615,    0,    0,  622,    0,    0,    0,
-        0,    0,  615,    0,  916,  918,  614,  615,    0,  622,
-      586,  586,  586,  586,  586,  586,  591,  591,  591,  591,
-      591,  591,  591,  615,  622,  615,  591,  591,  591,  591,
-      591,  591,  916,  918,    0,    0,  615,  627,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,  920,
-      922,  615,  627,  615,  924,  591,  591,  591,  591,  591,
-
-      591,  595,  595,  595,  595,  595,  595,  595,  627,  595,
-      635,  595,  595,  595,  595,  595,  595,  920,  922,  638,
-        0,  627,  924,    0,    0,    0,  635,    0,    0,    0,
-        0,  635,    0,    0,  926,  928,  627,  638,    0,  635,
-      595,  595,  595,  595,  595,  595,  600,  600,  600,  600,
-      600,  600,  600,  638,  635,  653,  600,  600,  600,  600,
-      600,  600,  926,  928,  639,    0,  638,    0,    0,    0,
-        0,  653,    0,    0,    0,    0,    0,    0,    0,  930,
-      932,  638,  639,    0,  653,  600,  600,  600,  600,  600,
-      600,  606,  606,  606,  606,  606,  606,  606,  639,  653,
-
-      639,  606,  606,  606,  606,  606,  606,  930,  932,    0,
-        0,  639,    0,  654,    0,    0,  934,    0,    0,    0,
-        0,    0,  654,    0,  936,  938,  639,  654,  639,  940,
-      606,  606,  606,  606,  606,  606,  609,  609,  609,  609,
-      609,  609,  609,  654,  934,  658,  609,  609,  609,  609,
-      609,  609,  936,  938,    0,    0,  654,  940,  655,    0,
-        0,  658,    0,    0,    0,    0,    0,  655,    0,  942,
-      944,  654,  655,    0,  658,  609,  609,  609,  609,  609,
-      609,  612,  612,  612,  612,  612,  612,  612,  655,  658,
-      655,  612,  612,  612,  612,  612,  612,  942,  944,    0,
-
-        0,  655,    0,    0,    0,  688,  946,    0,  948,  950,
-        0,  952,  954,  956,  688,  958,  655,  673,  655,  688,
-      612,  612,  612,  612,  612,  612,  613,  613,  613,  613,
-      613,  613,  613,  673,  946,  688,  948,  950,  613,  952,
-      954,  956,  960,  958,  720,  962,  673,  964,  688,  966,
-        0,  968,  970,  972,  613,    0,    0,    0,    0,    0,
-      689,  673,  720,  688,    0,    0,    0,  613,    0,  689,
-      960,  974,  976,  962,  689,  964,  978,  966,  720,  968,
-      970,  972,  613,  620,  620,  620,  620,  620,  620,  620,
-      689,  720,  689,  620,  620,  620,  620,  620,  620,  974,
-
-      976,  721,    0,  689,  978,    0,  720,    0,  980,    0,
-        0,    0,    0,    0,    0,    0,  982,  984,  689,  721,
-      689,  986,  620,  620,  620,  620,  620,  620,  623,  623,
-      623,  623,  623,  623,  623,  721,  980,  721,  623,  623,
-      623,  623,  623,  623,  982,  984,    0,    0,  721,  986,
-        0,    0,  988,  990,  992,    0,    0,    0,    0,    0,
-        0,  994,  996,  721,  998,  721, 1000,  623,  623,  623,
-      623,  623,  623,  625,  625,  625,  625,  625,  625,  625,
-      988,  990,  992,  625,  625,  625,  625,  625,  625,  994,
-      996,    0,  998,    0, 1000,    0,    0, 1002, 1004, 1006,
-
-        0,    0,    0,    0,    0,    0, 1008, 1010, 1012, 1014,
-     1016, 1018,  625,  625,  625,  625,  625,  625,  628,  628,
-      628,  628,  628,  628,  628, 1002, 1004, 1006,  628,  628,
-      628,  628,  628,  628, 1008, 1010, 1012, 1014, 1016, 1018,
-        0,    0, 1020, 1022, 1024,    0,    0,    0,    0,    0,
-        0, 1026, 1028, 1030, 1032, 1034, 1036,  628,  628,  628,
-      628,  628,  628,  632,  632,  632,  632,  632,  632,  632,
-     1020, 1022, 1024,  632,  632,  632,  632,  632,  632, 1026,
-     1028, 1030, 1032, 1034, 1036,    0,    0, 1038, 1040, 1042,
-        0,    0,    0,    0,    0,    0, 1044, 1046, 1048, 1050,
-
-     1052, 1054,  632,  632,  632,  632,  632,  632,  633,  633,
-      633,  633,  633,  633,  633, 1038, 1040, 1042,  633,  633,
-      633,  633,  633,  633, 1044, 1046, 1048, 1050, 1052, 1054,
-        0,    0, 1056, 1058, 1060,    0,    0,    0,    0,    0,
-        0, 1062, 1064, 1066, 1068, 1070, 1072,  633,  633,  633,
-      633,  633,  633,  636,  636,  636,  636,  636,  636,  636,
-     1056, 1058, 1060,  636,  636,  636,  636,  636,  636, 1062,
-     1064, 1066, 1068, 1070, 1072,    0,    0, 1074, 1076, 1078,
-     1080, 1082,    0, 1084, 1086, 1088, 1090, 1092, 1094, 1096,
-     1098, 1100,  636,  636,  636,  636,  636,  636,  640,  640,
-
-      640,  640,  640,  640,  640, 1074, 1076, 1078, 1080, 1082,
-      640, 1084, 1086, 1088, 1090, 1092, 1094, 1096, 1098, 1100,
-     1102, 1104, 1106, 1108, 1110, 1112,  640,    0,    0,    0,
-        0,    0,    0,    0, 1114, 1116, 1118,    0,    0,  640,
-        0,    0,    0, 1120, 1122, 1124, 1126, 1128, 1102, 1104,
-     1106, 1108, 1110, 1112,  640,  641,  641,  641,  641,  641,
-      641,  641, 1114, 1116, 1118,  641,  641,  641,  641,  641,
-      641, 1120, 1122, 1124, 1126, 1128,    0,    0,    0, 1130,
-        0, 1132,    0,    0,    0,    0,    0,    0, 1134, 1136,
-     1138, 1140, 1142, 1144,  641,  641,  641,  641,  641,  641,
-
-      646,  646,  646,  646,  646,  646,  646, 1130,  646, 1132,
-      646,  646,  646,  646,  646,  646, 1134, 1136, 1138, 1140,
-     1142, 1144,    0,    0, 1146, 1148, 1150,    0,    0,    0,
-        0,    0,    0, 1152, 1154, 1156, 1158, 1160, 1162,  646,
-      646,  646,  646,  646,  646,  648,  648,  648,  648,  648,
-      648,  648, 1146, 1148, 1150,  648,  648,  648,  648,  648,
-      648, 1152, 1154, 1156, 1158, 1160, 1162,    0,    0, 1164,
-     1166, 1168,    0,    0,    0,    0,    0,    0, 1170, 1172,
-     1174, 1176, 1178, 1180,  648,  648,  648,  648,  648,  648,
-      650,  650,  650,  650,  650,  650,  650, 1164, 1166, 1168,
-
-      650,  650,  650,  650,  650,  650, 1170, 1172, 1174, 1176,
-     1178, 1180,    0,    0, 1182, 1184, 1186,    0,    0,    0,
-        0,    0,    0, 1188, 1190, 1192, 1194, 1196, 1198,  650,
-      650,  650,  650,  650,  650,  651,  651,  651,  651,  651,
-      651,  651, 1182, 1184, 1186,  651,  651,  651,  651,  651,
-      651, 1188, 1190, 1192, 1194, 1196, 1198,    0,    0, 1200,
-     1202, 1204,    0,    0,    0,    0,    0,    0, 1206, 1208,
-     1210, 1212, 1214, 1216,  651,  651,  651,  651,  651,  651,
-      657,  657,  657,  657,  657,  657,  657, 1200, 1202, 1204,
-      657,  657,  657,  657,  657,  657, 1206, 1208, 1210, 1212,
-
-     1214, 1216,    0,    0, 1218, 1220, 1222,    0,    0,    0,
-        0,    0,    0, 1224, 1226, 1228, 1230, 1232, 1234,  657,
-      657,  657,  657,  657,  657,  660,  660,  660,  660,  660,
-      660,  660, 1218, 1220, 1222,  660,  660,  660,  660,  660,
-      660, 1224, 1226, 1228, 1230, 1232, 1234,    0,    0, 1236,
-        0, 1238,    0,    0,    0,    0,    0,    0, 1240, 1242,
-     1244, 1246, 1248, 1250,  660,  660,  660,  660,  660,  660,
-      662,  662,  662,  662,  662,  662,  662, 1236,  662, 1238,
-      662,  662,  662,  662,  662,  662, 1240, 1242, 1244, 1246,
-     1248, 1250,    0,    0, 1252, 1254, 1256,    0,    0,    0,
-
-        0,    0,    0, 1258, 1260, 1262, 1264, 1266, 1268,  662,
-      662,  662,  662,  662,  662,  664,  664,  664,  664,  664,
-      664,  664, 1252, 1254, 1256,  664,  664,  664,  664,  664,
-      664, 1258, 1260, 1262, 1264, 1266, 1268,    0,    0, 1270,
-     1272, 1274,    0,    0,    0,    0,    0,    0, 1276, 1278,
-     1280, 1282, 1284, 1286,  664,  664,  664,  664,  664,  664,
-      666,  666,  666,  666,  666,  666,  666, 1270, 1272, 1274,
-      666,  666,  666,  666,  666,  666, 1276, 1278, 1280, 1282,
-     1284, 1286,    0,    0, 1288, 1290, 1292,    0,    0,    0,
-        0,    0,    0, 1294, 1296, 1298, 1300, 1302, 1304,  666,
-
-      666,  666,  666,  666,  666,  668,  668,  668,  668,  668,
-      668,  668, 1288, 1290, 1292,  668,  668,  668,  668,  668,
-      668, 1294, 1296, 1298, 1300, 1302, 1304,    0,    0, 1306,
-     1308, 1310,    0,    0,    0,    0,    0,    0, 1312, 1314,
-     1316, 1318, 1320, 1322,  668,  668,  668,  668,  668,  668,
-      670,  670,  670,  670,  670,  670,  670, 1306, 1308, 1310,
-      670,  670,  670,  670,  670,  670, 1312, 1314, 1316, 1318,
-     1320, 1322,    0,    0, 1324, 1326, 1328,    0,    0,    0,
-        0,    0,    0, 1330, 1332, 1334, 1336, 1338, 1340,  670,
-      670,  670,  670,  670,  670,  672,  672,  672,  672,  672,
-
-      672,  672, 1324, 1326, 1328,  672,  672,  672,  672,  672,
-      672, 1330, 1332, 1334, 1336, 1338, 1340,    0,    0, 1342,
-     1344, 1346,    0,    0,    0,    0,    0,    0, 1348, 1350,
-     1352, 1354, 1356, 1358,  672,  672,  672,  672,  672,  672,
-      675,  675,  675,  675,  675,  675,  675, 1342, 1344, 1346,
-      675,  675,  675,  675,  675,  675, 1348, 1350, 1352, 1354,
-     1356, 1358,    0,    0, 1360, 1362, 1364,    0,    0,    0,
-        0,    0,    0, 1366, 1368, 1370, 1372, 1374, 1376,  675,
-      675,  675,  675,  675,  675,  677,  677,  677,  677,  677,
-      677,  677, 1360, 1362, 1364,  677,  677,  677,  677,  677,
-
-      677, 1366, 1368, 1370, 1372, 1374, 1376,    0,    0, 1378,
-     1380, 1382,    0,    0,    0,    0,    0,    0, 1384, 1386,
-     1388, 1390, 1392, 1394,  677,  677,  677,  677,  677,  677,
-      680,  680,  680,  680,  680,  680,  680, 1378, 1380, 1382,
-      680,  680,  680,  680,  680,  680, 1384, 1386, 1388, 1390,
-     1392, 1394,    0,    0, 1396, 1398, 1400,    0,    0,    0,
-        0,    0,    0, 1402, 1404, 1406, 1408, 1410, 1412,  680,
-      680,  680,  680,  680,  680,  682,  682,  682,  682,  682,
-      682,  682, 1396, 1398, 1400,  682,  682,  682,  682,  682,
-      682, 1402, 1404, 1406, 1408, 1410, 1412,    0,    0, 1414,
-
-     1416, 1418,    0,    0,    0,    0,    0,    0, 1420, 1422,
-     1424, 1426, 1428, 1430,  682,  682,  682,  682,  682,  682,
-      684,  684,  684,  684,  684,  684,  684, 1414, 1416, 1418,
-      684,  684,  684,  684,  684,  684, 1420, 1422, 1424, 1426,
-     1428, 1430,    0,    0, 1432, 1434, 1436,    0,    0,    0,
-        0,    0,    0, 1438, 1440, 1442, 1444, 1446, 1448,  684,
-      684,  684,  684,  684,  684,  686,  686,  686,  686,  686,
-      686,  686, 1432, 1434, 1436,  686,  686,  686,  686,  686,
-      686, 1438, 1440, 1442, 1444, 1446, 1448,    0,    0, 1450,
-     1452, 1454,    0,    0,    0,    0,    0,    0, 1456, 1458,
-
-     1460, 1462, 1464, 1466,  686,  686,  686,  686,  686,  686,
-      691,  691,  691,  691,  691,  691,  691, 1450, 1452, 1454,
-      691,  691,  691,  691,  691,  691, 1456, 1458, 1460, 1462,
-     1464, 1466,    0,    0, 1468, 1470, 1472,    0,    0,    0,
-        0,    0,    0, 1474, 1476, 1478, 1480, 1482, 1484,  691,
-      691,  691,  691,  691,  691,  693,  693,  693,  693,  693,
-      693,  693, 1468, 1470, 1472,  693,  693,  693,  693,  693,
-      693, 1474, 1476, 1478, 1480, 1482, 1484,    0,    0, 1486,
-     1488, 1490,    0,    0,    0,    0,    0,    0, 1492, 1494,
-     1496, 1498, 1500, 1502,  693,  693,  693,  693,  693,  693,
-
-      695,  695,  695,  695,  695,  695,  695, 1486, 1488, 1490,
-      695,  695,  695,  695,  695,  695, 1492, 1494, 1496, 1498,
-     1500, 1502,    0,    0, 1504, 1506, 1508,    0,    0,    0,
-        0,    0,    0, 1510, 1512, 1514, 1516, 1518, 1520,  695,
-      695,  695,  695,  695,  695,  697,  697,  697,  697,  697,
-      697,  697, 1504, 1506, 1508,  697,  697,  697,  697,  697,
-      697, 1510, 1512, 1514, 1516, 1518, 1520,    0,    0, 1522,
-     1524, 1526,    0,    0,    0,    0,    0,    0, 1528, 1530,
-     1532, 1534, 1536, 1538,  697,  697,  697,  697,  697,  697,
-      699,  699,  699,  699,  699,  699,  699, 1522, 1524, 1526,
-
-      699,  699,  699,  699,  699,  699, 1528, 1530, 1532, 1534,
-     1536, 1538,    0,    0, 1540, 1542, 1544,    0,    0,    0,
-        0,    0,    0, 1546, 1548, 1550, 1552, 1554, 1556,  699,
-      699,  699,  699,  699,  699,  701,  701,  701,  701,  701,
-      701,  701, 1540, 1542, 1544,  701,  701,  701,  701,  701,
-      701, 1546, 1548, 1550, 1552, 1554, 1556,    0,    0, 1558,
-     1560, 1562,    0,    0,    0,    0,    0,    0, 1564, 1566,
-     1568, 1570, 1572, 1574,  701,  701,  701,  701,  701,  701,
-      703,  703,  703,  703,  703,  703,  703, 1558, 1560, 1562,
-      703,  703,  703,  703,  703,  703, 1564, 1566, 1568, 1570,
-
-     1572, 1574,    0,    0, 1576, 1578, 1580,    0,    0,    0,
-        0,    0,    0, 1582, 1584, 1586, 1588, 1590, 1592,  703,
-      703,  703,  703,  703,  703,  705,  705,  705,  705,  705,
-      705,  705, 1576, 1578, 1580,  705,  705,  705,  705,  705,
-      705, 1582, 1584, 1586, 1588, 1590, 1592,    0,    0, 1594,
-     1596, 1598,    0,    0,    0,    0,    0,    0, 1600, 1602,
-     1604, 1606, 1608, 1610,  705,  705,  705,  705,  705,  705,
-      707,  707,  707,  707,  707,  707,  707, 1594, 1596, 1598,
-      707,  707,  707,  707,  707,  707, 1600, 1602, 1604, 1606,
-     1608, 1610,    0,    0, 1612, 1614, 1616,    0,    0,    0,
-
-        0,    0,    0, 1618, 1620, 1622, 1624, 1626, 1628,  707,
-      707,  707,  707,  707,  707,  709,  709,  709,  709,  709,
-      709,  709, 1612, 1614, 1616,  709,  709,  709,  709,  709,
-      709, 1618, 1620, 1622, 1624, 1626, 1628,    0,    0, 1630,
-     1632, 1634,    0,    0,    0,    0,    0,    0, 1636, 1638,
-     1640, 1642, 1644, 1646,  709,  709,  709,  709,  709,  709,
-      712,  712,  712,  712,  712,  712,  712, 1630, 1632, 1634,
-      712,  712,  712,  712,  712,  712, 1636, 1638, 1640, 1642,
-     1644, 1646,    0,    0, 1648, 1650, 1652,    0,    0,    0,
-        0,    0,    0, 1654, 1656, 1658, 1660, 1662, 1664,  712,
-
-      712,  712,  712,  712,  712,  714,  714,  714,  714,  714,
-      714,  714, 1648, 1650, 1652,  714,  714,  714,  714,  714,
-      714, 1654, 1656, 1658, 1660, 1662, 1664,    0,    0, 1666,
-     1668,    0,    0,    0,    0,    0,    0, 1670, 1672,    0,
-        0,    0,    0,    0,  714,  714,  714,  714,  714,  714,
-      716,  716,  716,  716,  716,  716,  716, 1666, 1668, 1670,
-      716,  716,  716,  716,  716,  716, 1672,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-     1674,    0,    0,    0,    0,    0,    0, 1670,    0,  716,
-      716,  716,  716,  716,  716,  718,  718,  718,  718,  718,
-
-      718,  718, 1674,    0,    0,  718,  718,  718,  718,  718,
-      718,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-     1674,    0,    0,    0,  718,  718,  718,  718,  718,  718,
-      723,  723,  723,  723,  723,  723,  723,    0,    0,    0,
-      723,  723,  723,  723,  723,  723,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,  723,
-      723,  723,  723,  723,  723,  725,  725,  725,  725,  725,
-      725,  725,    0,    0,    0,  725,  725,  725,  725,  725,
-
-      725,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,  725,  725,  725,  725,  725,  725,
-      727,  727,  727,  727,  727,  727,  727,    0,    0,    0,
-      727,  727,  727,  727,  727,  727,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,  727,
-      727,  727,  727,  727,  727,  729,  729,  729,  729,  729,
-      729,  729,    0,    0,    0,  729,  729,  729,  729,  729,
-      729,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,  729,  729,  729,  729,  729,  729,
-      731,  731,  731,  731,  731,  731,  731,    0,    0,    0,
-      731,  731,  731,  731,  731,  731,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,  731,
-      731,  731,  731,  731,  731,  733,  733,  733,  733,  733,
-      733,  733,    0,    0,    0,  733,  733,  733,  733,  733,
-      733,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-
-        0,    0,    0,    0,  733,  733,  733,  733,  733,  733,
-      735,  735,  735,  735,  735,  735,  735,    0,    0,    0,
-      735,  735,  735,  735,  735,  735,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,  735,
-      735,  735,  735,  735,  735,  737,  737,  737,  737,  737,
-      737,  737,    0,    0,    0,  737,  737,  737,  737,  737,
-      737,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,  737,  737,  737,  737,  737,  737,
-
-      739,  739,  739,  739,  739,  739,  739,    0,    0,    0,
-      739,  739,  739,  739,  739,  739,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,  739,
-      739,  739,  739,  739,  739,  741,  741,  741,  741,  741,
-      741,  741,    0,    0,    0,  741,  741,  741,  741,  741,
-      741,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,  741,  741,  741,  741,  741,  741,
-      743,  743,  743,  743,  743,  743,  743,    0,    0,    0,
-
-      743,  743,  743,  743,  743,  743,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,  743,
-      743,  743,  743,  743,  743,  745,  745,  745,  745,  745,
-      745,  745,    0,    0,    0,  745,  745,  745,  745,  745,
-      745,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,  745,  745,  745,  745,  745,  745,
-      747,  747,  747,  747,  747,  747,  747,    0,    0,    0,
-      747,  747,  747,  747,  747,  747,    0,    0,    0,    0,
-
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,  747,
-      747,  747,  747,  747,  747,  749,  749,  749,  749,  749,
-      749,  749,    0,    0,    0,  749,  749,  749,  749,  749,
-      749,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,  749,  749,  749,  749,  749,  749,
-      751,  751,  751,  751,  751,  751,  751,    0,    0,    0,
-      751,  751,  751,  751,  751,  751,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-
-        0,    0,    0,    0,    0,    0,    0,    0,    0,  751,
-      751,  751,  751,  751,  751,  753,  753,  753,  753,  753,
-      753,  753,    0,    0,    0,  753,  753,  753,  753,  753,
-      753,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,  753,  753,  753,  753,  753,  753,
-      755,  755,  755,  755,  755,  755,  755,    0,    0,    0,
-      755,  755,  755,  755,  755,  755,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,  755,
-
-      755,  755,  755,  755,  755,  757,  757,  757,  757,  757,
-      757,  757,    0,    0,    0,  757,  757,  757,  757,  757,
-      757,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,  757,  757,  757,  757,  757,  757,
-      759,  759,  759,  759,  759,  759,  759,    0,    0,    0,
-      759,  759,  759,  759,  759,  759,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,  759,
-      759,  759,  759,  759,  759,  761,  761,  761,  761,  761,
-
-      761,  761,    0,    0,    0,  761,  761,  761,  761,  761,
-      761,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,  761,  761,  761,  761,  761,  761,
-      763,  763,  763,  763,  763,  763,  763,    0,    0,    0,
-      763,  763,  763,  763,  763,  763,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,  763,
-      763,  763,  763,  763,  763,  765,  765,  765,  765,  765,
-      765,  765,    0,    0,    0,  765,  765,  765,  765,  765,
-
-      765,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,  765,  765,  765,  765,  765,  765,
-      767,  767,  767,  767,  767,  767,  767,    0,    0,    0,
-      767,  767,  767,  767,  767,  767,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,  767,
-      767,  767,  767,  767,  767,  769,  769,  769,  769,  769,
-      769,  769,    0,    0,    0,  769,  769,  769,  769,  769,
-      769,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,  769,  769,  769,  769,  769,  769,
-      771,  771,  771,  771,  771,  771,  771,    0,    0,    0,
-      771,  771,  771,  771,  771,  771,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,  771,
-      771,  771,  771,  771,  771,  773,  773,  773,  773,  773,
-      773,  773,    0,    0,    0,  773,  773,  773,  773,  773,
-      773,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-
-        0,    0,    0,    0,  773,  773,  773,  773,  773,  773,
-      775,  775,  775,  775,  775,  775,  775,    0,    0,    0,
-      775,  775,  775,  775,  775,  775,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,  775,
-      775,  775,  775,  775,  775,  777,  777,  777,  777,  777,
-      777,  777,    0,    0,    0,  777,  777,  777,  777,  777,
-      777,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,  777,  777,  777,  777,  777,  777,
-
-      779,  779,  779,  779,  779,  779,  779,    0,    0,    0,
-      779,  779,  779,  779,  779,  779,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,  779,
-      779,  779,  779,  779,  779,  781,  781,  781,  781,  781,
-      781,  781,    0,    0,    0,  781,  781,  781,  781,  781,
-      781,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,  781,  781,  781,  781,  781,  781,
-      783,  783,  783,  783,  783,  783,  783,    0,    0,    0,
-
-      783,  783,  783,  783,  783,  783,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,  783,
-      783,  783,  783,  783,  783,  785,  785,  785,  785,  785,
-      785,  785,    0,    0,    0,  785,  785,  785,  785,  785,
-      785,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,  785,  785,  785,  785,  785,  785,
-      787,  787,  787,  787,  787,  787,  787,    0,    0,    0,
-      787,  787,  787,  787,  787,  787,    0,    0,    0,    0,
-
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,  787,
-      787,  787,  787,  787,  787,  789,  789,  789,  789,  789,
-      789,  789,    0,    0,    0,  789,  789,  789,  789,  789,
-      789,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,  789,  789,  789,  789,  789,  789,
-      791,  791,  791,  791,  791,  791,  791,    0,    0,    0,
-      791,  791,  791,  791,  791,  791,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-
-        0,    0,    0,    0,    0,    0,    0,    0,    0,  791,
-      791,  791,  791,  791,  791,  793,  793,  793,  793,  793,
-      793,  793,    0,    0,    0,  793,  793,  793,  793,  793,
-      793,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,  793,  793,  793,  793,  793,  793,
-      795,  795,  795,  795,  795,  795,  795,    0,    0,    0,
-      795,  795,  795,  795,  795,  795,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,  795,
-
-      795,  795,  795,  795,  795,  797,  797,  797,  797,  797,
-      797,  797,    0,    0,    0,  797,  797,  797,  797,  797,
-      797,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,  797,  797,  797,  797,  797,  797,
-      799,  799,  799,  799,  799,  799,  799,    0,    0,    0,
-      799,  799,  799,  799,  799,  799,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,  799,
-      799,  799,  799,  799,  799,  801,  801,  801,  801,  801,
-
-      801,  801,    0,    0,    0,  801,  801,  801,  801,  801,
-      801,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,  801,  801,  801,  801,  801,  801,
-      803,  803,  803,  803,  803,  803,  803,    0,    0,    0,
-      803,  803,  803,  803,  803,  803,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,  803,
-      803,  803,  803,  803,  803,  805,  805,  805,  805,  805,
-      805,  805,    0,    0,    0,  805,  805,  805,  805,  805,
-
-      805,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,  805,  805,  805,  805,  805,  805,
-      807,  807,  807,  807,  807,  807,  807,    0,    0,    0,
-      807,  807,  807,  807,  807,  807,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,  807,
-      807,  807,  807,  807,  807,  809,  809,  809,  809,  809,
-      809,  809,    0,    0,    0,  809,  809,  809,  809,  809,
-      809,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,  809,  809,  809,  809,  809,  809,
-      811,  811,  811,  811,  811,  811,  811,    0,    0,    0,
-      811,  811,  811,  811,  811,  811,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,  811,
-      811,  811,  811,  811,  811,  813,  813,  813,  813,  813,
-      813,  813,    0,    0,    0,  813,  813,  813,  813,  813,
-      813,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-
-        0,    0,    0,    0,  813,  813,  813,  813,  813,  813,
-      815,  815,  815,  815,  815,  815,  815,    0,    0,    0,
-      815,  815,  815,  815,  815,  815,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,  815,
-      815,  815,  815,  815,  815,  817,  817,  817,  817,  817,
-      817,  817,    0,    0,    0,  817,  817,  817,  817,  817,
-      817,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,  817,  817,  817,  817,  817,  817,
-
-      819,  819,  819,  819,  819,  819,  819,    0,    0,    0,
-      819,  819,  819,  819,  819,  819,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,  819,
-      819,  819,  819,  819,  819,  821,  821,  821,  821,  821,
-      821,  821,    0,    0,    0,  821,  821,  821,  821,  821,
-      821,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,  821,  821,  821,  821,  821,  821,
-      823,  823,  823,  823,  823,  823,  823,    0,    0,    0,
-
-      823,  823,  823,  823,  823,  823,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,  823,
-      823,  823,  823,  823,  823,  825,  825,  825,  825,  825,
-      825,  825,    0,    0,    0,  825,  825,  825,  825,  825,
-      825,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,  825,  825,  825,  825,  825,  825,
-      827,  827,  827,  827,  827,  827,  827,    0,    0,    0,
-      827,  827,  827,  827,  827,  827,    0,    0,    0,    0,
-
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,  827,
-      827,  827,  827,  827,  827,  829,  829,  829,  829,  829,
-      829,  829,    0,    0,    0,  829,  829,  829,  829,  829,
-      829,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,  829,  829,  829,  829,  829,  829,
-      831,  831,  831,  831,  831,  831,  831,    0,    0,    0,
-      831,  831,  831,  831,  831,  831,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-
-        0,    0,    0,    0,    0,    0,    0,    0,    0,  831,
-      831,  831,  831,  831,  831,  833,  833,  833,  833,  833,
-      833,  833,    0,    0,    0,  833,  833,  833,  833,  833,
-      833,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,  833,  833,  833,  833,  833,  833,
-      835,  835,  835,  835,  835,  835,  835,    0,    0,    0,
-      835,  835,  835,  835,  835,  835,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,  835,
-
-      835,  835,  835,  835,  835,  837,  837,  837,  837,  837,
-      837,  837,    0,    0,    0,  837,  837,  837,  837,  837,
-      837,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,  837,  837,  837,  837,  837,  837,
-      839,  839,  839,  839,  839,  839,  839,    0,    0,    0,
-      839,  839,  839,  839,  839,  839,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,  839,
-      839,  839,  839,  839,  839,  841,  841,  841,  841,  841,
-
-      841,  841,    0,    0,    0,  841,  841,  841,  841,  841,
-      841,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,  841,  841,  841,  841,  841,  841,
-      843,  843,  843,  843,  843,  843,  843,    0,    0,    0,
-      843,  843,  843,  843,  843,  843,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,  843,
-      843,  843,  843,  843,  843,  845,  845,  845,  845,  845,
-      845,  845,    0,    0,    0,  845,  845,  845,  845,  845,
-
-      845,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,  845,  845,  845,  845,  845,  845,
-      847,  847,  847,  847,  847,  847,  847,    0,    0,    0,
-      847,  847,  847,  847,  847,  847,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,  847,
-      847,  847,  847,  847,  847,  849,  849,  849,  849,  849,
-      849,  849,    0,    0,    0,  849,  849,  849,  849,  849,
-      849,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,  849,  849,  849,  849,  849,  849,
-      851,  851,  851,  851,  851,  851,  851,    0,    0,    0,
-      851,  851,  851,  851,  851,  851,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,  851,
-      851,  851,  851,  851,  851,  853,  853,  853,  853,  853,
-      853,  853,    0,    0,    0,  853,  853,  853,  853,  853,
-      853,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-
-        0,    0,    0,    0,  853,  853,  853,  853,  853,  853,
-      855,  855,  855,  855,  855,  855,  855,    0,    0,    0,
-      855,  855,  855,  855,  855,  855,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,  855,
-      855,  855,  855,  855,  855,  857,  857,  857,  857,  857,
-      857,  857,    0,    0,    0,  857,  857,  857,  857,  857,
-      857,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,  857,  857,  857,  857,  857,  857,
-
-      859,  859,  859,  859,  859,  859,  859,    0,    0,    0,
-      859,  859,  859,  859,  859,  859,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,  859,
-      859,  859,  859,  859,  859,  861,  861,  861,  861,  861,
-      861,  861,    0,    0,    0,  861,  861,  861,  861,  861,
-      861,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,  861,  861,  861,  861,  861,  861,
-      863,  863,  863,  863,  863,  863,  863,    0,    0,    0,
-
-      863,  863,  863,  863,  863,  863,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,  863,
-      863,  863,  863,  863,  863,  865,  865,  865,  865,  865,
-      865,  865,    0,    0,    0,  865,  865,  865,  865,  865,
-      865,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,  865,  865,  865,  865,  865,  865,
-      867,  867,  867,  867,  867,  867,  867,    0,    0,    0,
-      867,  867,  867,  867,  867,  867,    0,    0,    0,    0,
-
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,  867,
-      867,  867,  867,  867,  867,  869,  869,  869,  869,  869,
-      869,  869,    0,    0,    0,  869,  869,  869,  869,  869,
-      869,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,  869,  869,  869,  869,  869,  869,
-      871,  871,  871,  871,  871,  871,  871,    0,    0,    0,
-      871,  871,  871,  871,  871,  871,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-
-        0,    0,    0,    0,    0,    0,    0,    0,    0,  871,
-      871,  871,  871,  871,  871,  873,  873,  873,  873,  873,
-      873,  873,    0,    0,    0,  873,  873,  873,  873,  873,
-      873,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,  873,  873,  873,  873,  873,  873,
-      875,  875,  875,  875,  875,  875,  875,    0,    0,    0,
-      875,  875,  875,  875,  875,  875,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,  875,
-
-      875,  875,  875,  875,  875,  877,  877,  877,  877,  877,
-      877,  877,    0,    0,    0,  877,  877,  877,  877,  877,
-      877,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,  877,  877,  877,  877,  877,  877,
-      879,  879,  879,  879,  879,  879,  879,    0,    0,    0,
-      879,  879,  879,  879,  879,  879,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,  879,
-      879,  879,  879,  879,  879,  881,  881,  881,  881,  881,
-
-      881,  881,    0,    0,    0,  881,  881,  881,  881,  881,
-      881,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,  881,  881,  881,  881,  881,  881,
-      883,  883,  883,  883,  883,  883,  883,    0,    0,    0,
-      883,  883,  883,  883,  883,  883,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,  883,
-      883,  883,  883,  883,  883,  885,  885,  885,  885,  885,
-      885,  885,    0,    0,    0,  885,  885,  885,  885,  885,
-
-      885,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,  885,  885,  885,  885,  885,  885,
-      887,  887,  887,  887,  887,  887,  887,    0,    0,    0,
-      887,  887,  887,  887,  887,  887,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,  887,
-      887,  887,  887,  887,  887,  889,  889,  889,  889,  889,
-      889,  889,    0,    0,    0,  889,  889,  889,  889,  889,
-      889,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,  889,  889,  889,  889,  889,  889,
-      891,  891,  891,  891,  891,  891,  891,    0,    0,    0,
-      891,  891,  891,  891,  891,  891,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,  891,
-      891,  891,  891,  891,  891,  893,  893,  893,  893,  893,
-      893,  893,    0,    0,    0,  893,  893,  893,  893,  893,
-      893,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-
-        0,    0,    0,    0,  893,  893,  893,  893,  893,  893,
-      895,  895,  895,  895,  895,  895,  895,    0,    0,    0,
-      895,  895,  895,  895,  895,  895,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,  895,
-      895,  895,  895,  895,  895,  897,  897,  897,  897,  897,
-      897,  897,    0,    0,    0,  897,  897,  897,  897,  897,
-      897,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,  897,  897,  897,  897,  897,  897,
-
-      899,  899,  899,  899,  899,  899,  899,    0,    0,    0,
-      899,  899,  899,  899,  899,  899,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,  899,
-      899,  899,  899,  899,  899,  901,  901,  901,  901,  901,
-      901,  901,    0,    0,    0,  901,  901,  901,  901,  901,
-      901,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,  901,  901,  901,  901,  901,  901,
-      903,  903,  903,  903,  903,  903,  903,    0,    0,    0,
-
-      903,  903,  903,  903,  903,  903,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,  903,
-      903,  903,  903,  903,  903,  905,  905,  905,  905,  905,
-      905,  905,    0,    0,    0,  905,  905,  905,  905,  905,
-      905,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,  905,  905,  905,  905,  905,  905,
-      907,  907,  907,  907,  907,  907,  907,    0,    0,    0,
-      907,  907,  907,  907,  907,  907,    0,    0,    0,    0,
-
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,  907,
-      907,  907,  907,  907,  907,  909,  909,  909,  909,  909,
-      909,  909,    0,    0,    0,  909,  909,  909,  909,  909,
-      909,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,  909,  909,  909,  909,  909,  909,
-      911,  911,  911,  911,  911,  911,  911,    0,    0,    0,
-      911,  911,  911,  911,  911,  911,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-
-        0,    0,    0,    0,    0,    0,    0,    0,    0,  911,
-      911,  911,  911,  911,  911,  913,  913,  913,  913,  913,
-      913,  913,    0,    0,    0,  913,  913,  913,  913,  913,
-      913,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,  913,  913,  913,  913,  913,  913,
-      915,  915,  915,  915,  915,  915,  915,    0,    0,    0,
-      915,  915,  915,  915,  915,  915,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,  915,
-
-      915,  915,  915,  915,  915,  917,  917,  917,  917,  917,
-      917,  917,    0,    0,    0,  917,  917,  917,  917,  917,
-      917,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,  917,  917,  917,  917,  917,  917,
-      919,  919,  919,  919,  919,  919,  919,    0,    0,    0,
-      919,  919,  919,  919,  919,  919,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,  919,
-      919,  919,  919,  919,  919,  921,  921,  921,  921,  921,
-
-      921,  921,    0,    0,    0,  921,  921,  921,  921,  921,
-      921,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,  921,  921,  921,  921,  921,  921,
-      923,  923,  923,  923,  923,  923,  923,    0,    0,    0,
-      923,  923,  923,  923,  923,  923,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,  923,
-      923,  923,  923,  923,  923,  925,  925,  925,  925,  925,
-      925,  925,    0,    0,    0,  925,  925,  925,  925,  925,
-
-      925,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,  925,  925,  925,  925,  925,  925,
-      927,  927,  927,  927,  927,  927,  927,    0,    0,    0,
-      927,  927,  927,  927,  927,  927,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,  927,
-      927,  927,  927,  927,  927,  929,  929,  929,  929,  929,
-      929,  929,    0,    0,    0,  929,  929,  929,  929,  929,
-      929,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,  929,  929,  929,  929,  929,  929,
-      931,  931,  931,  931,  931,  931,  931,    0,    0,    0,
-      931,  931,  931,  931,  931,  931,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,  931,
-      931,  931,  931,  931,  931,  933,  933,  933,  933,  933,
-      933,  933,    0,    0,    0,  933,  933,  933,  933,  933,
-      933,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-
-        0,    0,    0,    0,  933,  933,  933,  933,  933,  933,
-      935,  935,  935,  935,  935,  935,  935,    0,    0,    0,
-      935,  935,  935,  935,  935,  935,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,  935,
-      935,  935,  935,  935,  935,  937,  937,  937,  937,  937,
-      937,  937,    0,    0,    0,  937,  937,  937,  937,  937,
-      937,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,  937,  937,  937,  937,  937,  937,
-
-      939,  939,  939,  939,  939,  939,  939,    0,    0,    0,
-      939,  939,  939,  939,  939,  939,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,  939,
-      939,  939,  939,  939,  939,  941,  941,  941,  941,  941,
-      941,  941,    0,    0,    0,  941,  941,  941,  941,  941,
-      941,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,  941,  941,  941,  941,  941,  941,
-      943,  943,  943,  943,  943,  943,  943,    0,    0,    0,
-
-      943,  943,  943,  943,  943,  943,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,  943,
-      943,  943,  943,  943,  943,  945,  945,  945,  945,  945,
-      945,  945,    0,    0,    0,  945,  945,  945,  945,  945,
-      945,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,  945,  945,  945,  945,  945,  945,
-      947,  947,  947,  947,  947,  947,  947,    0,    0,    0,
-      947,  947,  947,  947,  947,  947,    0,    0,    0,    0,
-
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,  947,
-      947,  947,  947,  947,  947,  949,  949,  949,  949,  949,
-      949,  949,    0,    0,    0,  949,  949,  949,  949,  949,
-      949,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,  949,  949,  949,  949,  949,  949,
-      951,  951,  951,  951,  951,  951,  951,    0,    0,    0,
-      951,  951,  951,  951,  951,  951,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-
-        0,    0,    0,    0,    0,    0,    0,    0,    0,  951,
-      951,  951,  951,  951,  951,  953,  953,  953,  953,  953,
-      953,  953,    0,    0,    0,  953,  953,  953,  953,  953,
-      953,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,  953,  953,  953,  953,  953,  953,
-      955,  955,  955,  955,  955,  955,  955,    0,    0,    0,
-      955,  955,  955,  955,  955,  955,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,  955,
-
-      955,  955,  955,  955,  955,  957,  957,  957,  957,  957,
-      957,  957,    0,    0,    0,  957,  957,  957,  957,  957,
-      957,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,  957,  957,  957,  957,  957,  957,
-      959,  959,  959,  959,  959,  959,  959,    0,    0,    0,
-      959,  959,  959,  959,  959,  959,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,  959,
-      959,  959,  959,  959,  959,  961,  961,  961,  961,  961,
-
-      961,  961,    0,    0,    0,  961,  961,  961,  961,  961,
-      961,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,  961,  961,  961,  961,  961,  961,
-      963,  963,  963,  963,  963,  963,  963,    0,    0,    0,
-      963,  963,  963,  963,  963,  963,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,  963,
-      963,  963,  963,  963,  963,  965,  965,  965,  965,  965,
-      965,  965,    0,    0,    0,  965,  965,  965,  965,  965,
-
-      965,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,  965,  965,  965,  965,  965,  965,
-      967,  967,  967,  967,  967,  967,  967,    0,    0,    0,
-      967,  967,  967,  967,  967,  967,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,  967,
-      967,  967,  967,  967,  967,  969,  969,  969,  969,  969,
-      969,  969,    0,    0,    0,  969,  969,  969,  969,  969,
-      969,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,  969,  969,  969,  969,  969,  969,
-      971,  971,  971,  971,  971,  971,  971,    0,    0,    0,
-      971,  971,  971,  971,  971,  971,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,  971,
-      971,  971,  971,  971,  971,  973,  973,  973,  973,  973,
-      973,  973,    0,    0,    0,  973,  973,  973,  973,  973,
-      973,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-
-        0,    0,    0,    0,  973,  973,  973,  973,  973,  973,
-      975,  975,  975,  975,  975,  975,  975,    0,    0,    0,
-      975,  975,  975,  975,  975,  975,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,  975,
-      975,  975,  975,  975,  975,  977,  977,  977,  977,  977,
-      977,  977,    0,    0,    0,  977,  977,  977,  977,  977,
-      977,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,  977,  977,  977,  977,  977,  977,
-
-      979,  979,  979,  979,  979,  979,  979,    0,    0,    0,
-      979,  979,  979,  979,  979,  979,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,  979,
-      979,  979,  979,  979,  979,  981,  981,  981,  981,  981,
-      981,  981,    0,    0,    0,  981,  981,  981,  981,  981,
-      981,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,  981,  981,  981,  981,  981,  981,
-      983,  983,  983,  983,  983,  983,  983,    0,    0,    0,
-
-      983,  983,  983,  983,  983,  983,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,  983,
-      983,  983,  983,  983,  983,  985,  985,  985,  985,  985,
-      985,  985,    0,    0,    0,  985,  985,  985,  985,  985,
-      985,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,  985,  985,  985,  985,  985,  985,
-      987,  987,  987,  987,  987,  987,  987,    0,    0,    0,
-      987,  987,  987,  987,  987,  987,    0,    0,    0,    0,
-
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,  987,
-      987,  987,  987,  987,  987,  989,  989,  989,  989,  989,
-      989,  989,    0,    0,    0,  989,  989,  989,  989,  989,
-      989,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,  989,  989,  989,  989,  989,  989,
-      991,  991,  991,  991,  991,  991,  991,    0,    0,    0,
-      991,  991,  991,  991,  991,  991,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-
-        0,    0,    0,    0,    0,    0,    0,    0,    0,  991,
-      991,  991,  991,  991,  991,  993,  993,  993,  993,  993,
-      993,  993,    0,    0,    0,  993,  993,  993,  993,  993,
-      993,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,  993,  993,  993,  993,  993,  993,
-      995,  995,  995,  995,  995,  995,  995,    0,    0,    0,
-      995,  995,  995,  995,  995,  995,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,  995,
-
-      995,  995,  995,  995,  995,  997,  997,  997,  997,  997,
-      997,  997,    0,    0,    0,  997,  997,  997,  997,  997,
-      997,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,  997,  997,  997,  997,  997,  997,
-      999,  999,  999,  999,  999,  999,  999,    0,    0,    0,
-      999,  999,  999,  999,  999,  999,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,  999,
-      999,  999,  999,  999,  999, 1001, 1001, 1001, 1001, 1001,
-
-     1001, 1001,    0,    0,    0, 1001, 1001, 1001, 1001, 1001,
-     1001,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0, 1001, 1001, 1001, 1001, 1001, 1001,
-     1003, 1003, 1003, 1003, 1003, 1003, 1003,    0,    0,    0,
-     1003, 1003, 1003, 1003, 1003, 1003,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0, 1003,
-     1003, 1003, 1003, 1003, 1003, 1005, 1005, 1005, 1005, 1005,
-     1005, 1005,    0,    0,    0, 1005, 1005, 1005, 1005, 1005,
-
-     1005,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0, 1005, 1005, 1005, 1005, 1005, 1005,
-     1007, 1007, 1007, 1007, 1007, 1007, 1007,    0,    0,    0,
-     1007, 1007, 1007, 1007, 1007, 1007,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0, 1007,
-     1007, 1007, 1007, 1007, 1007, 1009, 1009, 1009, 1009, 1009,
-     1009, 1009,    0,    0,    0, 1009, 1009, 1009, 1009, 1009,
-     1009,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0, 1009, 1009, 1009, 1009, 1009, 1009,
-     1011, 1011, 1011, 1011, 1011, 1011, 1011,    0,    0,    0,
-     1011, 1011, 1011, 1011, 1011, 1011,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0, 1011,
-     1011, 1011, 1011, 1011, 1011, 1013, 1013, 1013, 1013, 1013,
-     1013, 1013,    0,    0,    0, 1013, 1013, 1013, 1013, 1013,
-     1013,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-
-        0,    0,    0,    0, 1013, 1013, 1013, 1013, 1013, 1013,
-     1015, 1015, 1015, 1015, 1015, 1015, 1015,    0,    0,    0,
-     1015, 1015, 1015, 1015, 1015, 1015,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0, 1015,
-     1015, 1015, 1015, 1015, 1015, 1017, 1017, 1017, 1017, 1017,
-     1017, 1017,    0,    0,    0, 1017, 1017, 1017, 1017, 1017,
-     1017,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0, 1017, 1017, 1017, 1017, 1017, 1017,
-
-     1019, 1019, 1019, 1019, 1019, 1019, 1019,    0,    0,    0,
-     1019, 1019, 1019, 1019, 1019, 1019,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0, 1019,
-     1019, 1019, 1019, 1019, 1019, 1021, 1021, 1021, 1021, 1021,
-     1021, 1021,    0,    0,    0, 1021, 1021, 1021, 1021, 1021,
-     1021,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0, 1021, 1021, 1021, 1021, 1021, 1021,
-     1023, 1023, 1023, 1023, 1023, 1023, 1023,    0,    0,    0,
-
-     1023, 1023, 1023, 1023, 1023, 1023,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0, 1023,
-     1023, 1023, 1023, 1023, 1023, 1025, 1025, 1025, 1025, 1025,
-     1025, 1025,    0,    0,    0, 1025, 1025, 1025, 1025, 1025,
-     1025,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0, 1025, 1025, 1025, 1025, 1025, 1025,
-     1027, 1027, 1027, 1027, 1027, 1027, 1027,    0,    0,    0,
-     1027, 1027, 1027, 1027, 1027, 1027,    0,    0,    0,    0,
-
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0, 1027,
-     1027, 1027, 1027, 1027, 1027, 1029, 1029, 1029, 1029, 1029,
-     1029, 1029,    0,    0,    0, 1029, 1029, 1029, 1029, 1029,
-     1029,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0, 1029, 1029, 1029, 1029, 1029, 1029,
-     1031, 1031, 1031, 1031, 1031, 1031, 1031,    0,    0,    0,
-     1031, 1031, 1031, 1031, 1031, 1031,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-
-        0,    0,    0,    0,    0,    0,    0,    0,    0, 1031,
-     1031, 1031, 1031, 1031, 1031, 1033, 1033, 1033, 1033, 1033,
-     1033, 1033,    0,    0,    0, 1033, 1033, 1033, 1033, 1033,
-     1033,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0, 1033, 1033, 1033, 1033, 1033, 1033,
-     1035, 1035, 1035, 1035, 1035, 1035, 1035,    0,    0,    0,
-     1035, 1035, 1035, 1035, 1035, 1035,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0, 1035,
-
-     1035, 1035, 1035, 1035, 1035, 1037, 1037, 1037, 1037, 1037,
-     1037, 1037,    0,    0,    0, 1037, 1037, 1037, 1037, 1037,
-     1037,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0, 1037, 1037, 1037, 1037, 1037, 1037,
-     1039, 1039, 1039, 1039, 1039, 1039, 1039,    0,    0,    0,
-     1039, 1039, 1039, 1039, 1039, 1039,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0, 1039,
-     1039, 1039, 1039, 1039, 1039, 1041, 1041, 1041, 1041, 1041,
-
-     1041, 1041,    0,    0,    0, 1041, 1041, 1041, 1041, 1041,
-     1041,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0, 1041, 1041, 1041, 1041, 1041, 1041,
-     1043, 1043, 1043, 1043, 1043, 1043, 1043,    0,    0,    0,
-     1043, 1043, 1043, 1043, 1043, 1043,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0, 1043,
-     1043, 1043, 1043, 1043, 1043, 1045, 1045, 1045, 1045, 1045,
-     1045, 1045,    0,    0,    0, 1045, 1045, 1045, 1045, 1045,
-
-     1045,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0, 1045, 1045, 1045, 1045, 1045, 1045,
-     1047, 1047, 1047, 1047, 1047, 1047, 1047,    0,    0,    0,
-     1047, 1047, 1047, 1047, 1047, 1047,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0, 1047,
-     1047, 1047, 1047, 1047, 1047, 1049, 1049, 1049, 1049, 1049,
-     1049, 1049,    0,    0,    0, 1049, 1049, 1049, 1049, 1049,
-     1049,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0, 1049, 1049, 1049, 1049, 1049, 1049,
-     1051, 1051, 1051, 1051, 1051, 1051, 1051,    0,    0,    0,
-     1051, 1051, 1051, 1051, 1051, 1051,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0, 1051,
-     1051, 1051, 1051, 1051, 1051, 1053, 1053, 1053, 1053, 1053,
-     1053, 1053,    0,    0,    0, 1053, 1053, 1053, 1053, 1053,
-     1053,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-
-        0,    0,    0,    0, 1053, 1053, 1053, 1053, 1053, 1053,
-     1055, 1055, 1055, 1055, 1055, 1055, 1055,    0,    0,    0,
-     1055, 1055, 1055, 1055, 1055, 1055,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0, 1055,
-     1055, 1055, 1055, 1055, 1055, 1057, 1057, 1057, 1057, 1057,
-     1057, 1057,    0,    0,    0, 1057, 1057, 1057, 1057, 1057,
-     1057,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0, 1057, 1057, 1057, 1057, 1057, 1057,
-
-     1059, 1059, 1059, 1059, 1059, 1059, 1059,    0,    0,    0,
-     1059, 1059, 1059, 1059, 1059, 1059,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0, 1059,
-     1059, 1059, 1059, 1059, 1059, 1061, 1061, 1061, 1061, 1061,
-     1061, 1061,    0,    0,    0, 1061, 1061, 1061, 1061, 1061,
-     1061,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0, 1061, 1061, 1061, 1061, 1061, 1061,
-     1063, 1063, 1063, 1063, 1063, 1063, 1063,    0,    0,    0,
-
-     1063, 1063, 1063, 1063, 1063, 1063,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0, 1063,
-     1063, 1063, 1063, 1063, 1063, 1065, 1065, 1065, 1065, 1065,
-     1065, 1065,    0,    0,    0, 1065, 1065, 1065, 1065, 1065,
-     1065,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0, 1065, 1065, 1065, 1065, 1065, 1065,
-     1067, 1067, 1067, 1067, 1067, 1067, 1067,    0,    0,    0,
-     1067, 1067, 1067, 1067, 1067, 1067,    0,    0,    0,    0,
-
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0, 1067,
-     1067, 1067, 1067, 1067, 1067, 1069, 1069, 1069, 1069, 1069,
-     1069, 1069,    0,    0,    0, 1069, 1069, 1069, 1069, 1069,
-     1069,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0, 1069, 1069, 1069, 1069, 1069, 1069,
-     1071, 1071, 1071, 1071, 1071, 1071, 1071,    0,    0,    0,
-     1071, 1071, 1071, 1071, 1071, 1071,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-
-        0,    0,    0,    0,    0,    0,    0,    0,    0, 1071,
-     1071, 1071, 1071, 1071, 1071, 1073, 1073, 1073, 1073, 1073,
-     1073, 1073,    0,    0,    0, 1073, 1073, 1073, 1073, 1073,
-     1073,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0, 1073, 1073, 1073, 1073, 1073, 1073,
-     1075, 1075, 1075, 1075, 1075, 1075, 1075,    0,    0,    0,
-     1075, 1075, 1075, 1075, 1075, 1075,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0, 1075,
-
-     1075, 1075, 1075, 1075, 1075, 1077, 1077, 1077, 1077, 1077,
-     1077, 1077,    0,    0,    0, 1077, 1077, 1077, 1077, 1077,
-     1077,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0, 1077, 1077, 1077, 1077, 1077, 1077,
-     1079, 1079, 1079, 1079, 1079, 1079, 1079,    0,    0,    0,
-     1079, 1079, 1079, 1079, 1079, 1079,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0, 1079,
-     1079, 1079, 1079, 1079, 1079, 1081, 1081, 1081, 1081, 1081,
-
-     1081, 1081,    0,    0,    0, 1081, 1081, 1081, 1081, 1081,
-     1081,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0, 1081, 1081, 1081, 1081, 1081, 1081,
-     1083, 1083, 1083, 1083, 1083, 1083, 1083,    0,    0,    0,
-     1083, 1083, 1083, 1083, 1083, 1083,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0, 1083,
-     1083, 1083, 1083, 1083, 1083, 1085, 1085, 1085, 1085, 1085,
-     1085, 1085,    0,    0,    0, 1085, 1085, 1085, 1085, 1085,
-
-     1085,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0, 1085, 1085, 1085, 1085, 1085, 1085,
-     1087, 1087, 1087, 1087, 1087, 1087, 1087,    0,    0,    0,
-     1087, 1087, 1087, 1087, 1087, 1087,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0, 1087,
-     1087, 1087, 1087, 1087, 1087, 1089, 1089, 1089, 1089, 1089,
-     1089, 1089,    0,    0,    0, 1089, 1089, 1089, 1089, 1089,
-     1089,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0, 1089, 1089, 1089, 1089, 1089, 1089,
-     1091, 1091, 1091, 1091, 1091, 1091, 1091,    0,    0,    0,
-     1091, 1091, 1091, 1091, 1091, 1091,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0, 1091,
-     1091, 1091, 1091, 1091, 1091, 1093, 1093, 1093, 1093, 1093,
-     1093, 1093,    0,    0,    0, 1093, 1093, 1093, 1093, 1093,
-     1093,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-
-        0,    0,    0,    0, 1093, 1093, 1093, 1093, 1093, 1093,
-     1095, 1095, 1095, 1095, 1095, 1095, 1095,    0,    0,    0,
-     1095, 1095, 1095, 1095, 1095, 1095,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0, 1095,
-     1095, 1095, 1095, 1095, 1095, 1097, 1097, 1097, 1097, 1097,
-     1097, 1097,    0,    0,    0, 1097, 1097, 1097, 1097, 1097,
-     1097,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0, 1097, 1097, 1097, 1097, 1097, 1097,
-
-     1099, 1099, 1099, 1099, 1099, 1099, 1099,    0,    0,    0,
-     1099, 1099, 1099, 1099, 1099, 1099,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0, 1099,
-     1099, 1099, 1099, 1099, 1099, 1101, 1101, 1101, 1101, 1101,
-     1101, 1101,    0,    0,    0, 1101, 1101, 1101, 1101, 1101,
-     1101,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0, 1101, 1101, 1101, 1101, 1101, 1101,
-     1103, 1103, 1103, 1103, 1103, 1103, 1103,    0,    0,    0,
-
-     1103, 1103, 1103, 1103, 1103, 1103,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0, 1103,
-     1103, 1103, 1103, 1103, 1103, 1105, 1105, 1105, 1105, 1105,
-     1105, 1105,    0,    0,    0, 1105, 1105, 1105, 1105, 1105,
-     1105,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0, 1105, 1105, 1105, 1105, 1105, 1105,
-     1107, 1107, 1107, 1107, 1107, 1107, 1107,    0,    0,    0,
-     1107, 1107, 1107, 1107, 1107, 1107,    0,    0,    0,    0,
-
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0, 1107,
-     1107, 1107, 1107, 1107, 1107, 1109, 1109, 1109, 1109, 1109,
-     1109, 1109,    0,    0,    0, 1109, 1109, 1109, 1109, 1109,
-     1109,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0, 1109, 1109, 1109, 1109, 1109, 1109,
-     1111, 1111, 1111, 1111, 1111, 1111, 1111,    0,    0,    0,
-     1111, 1111, 1111, 1111, 1111, 1111,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-
-        0,    0,    0,    0,    0,    0,    0,    0,    0, 1111,
-     1111, 1111, 1111, 1111, 1111, 1113, 1113, 1113, 1113, 1113,
-     1113, 1113,    0,    0,    0, 1113, 1113, 1113, 1113, 1113,
-     1113,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0, 1113, 1113, 1113, 1113, 1113, 1113,
-     1115, 1115, 1115, 1115, 1115, 1115, 1115,    0,    0,    0,
-     1115, 1115, 1115, 1115, 1115, 1115,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0, 1115,
-
-     1115, 1115, 1115, 1115, 1115, 1117, 1117, 1117, 1117, 1117,
-     1117, 1117,    0,    0,    0, 1117, 1117, 1117, 1117, 1117,
-     1117,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0, 1117, 1117, 1117, 1117, 1117, 1117,
-     1119, 1119, 1119, 1119, 1119, 1119, 1119,    0,    0,    0,
-     1119, 1119, 1119, 1119, 1119, 1119,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0, 1119,
-     1119, 1119, 1119, 1119, 1119, 1121, 1121, 1121, 1121, 1121,
-
-     1121, 1121,    0,    0,    0, 1121, 1121, 1121, 1121, 1121,
-     1121,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0, 1121, 1121, 1121, 1121, 1121, 1121,
-     1123, 1123, 1123, 1123, 1123, 1123, 1123,    0,    0,    0,
-     1123, 1123, 1123, 1123, 1123, 1123,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0, 1123,
-     1123, 1123, 1123, 1123, 1123, 1125, 1125, 1125, 1125, 1125,
-     1125, 1125,    0,    0,    0, 1125, 1125, 1125, 1125, 1125,
-
-     1125,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0, 1125, 1125, 1125, 1125, 1125, 1125,
-     1127, 1127, 1127, 1127, 1127, 1127, 1127,    0,    0,    0,
-     1127, 1127, 1127, 1127, 1127, 1127,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0, 1127,
-     1127, 1127, 1127, 1127, 1127, 1129, 1129, 1129, 1129, 1129,
-     1129, 1129,    0,    0,    0, 1129, 1129, 1129, 1129, 1129,
-     1129,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0, 1129, 1129, 1129, 1129, 1129, 1129,
-     1131, 1131, 1131, 1131, 1131, 1131, 1131,    0,    0,    0,
-     1131, 1131, 1131, 1131, 1131, 1131,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0, 1131,
-     1131, 1131, 1131, 1131, 1131, 1133, 1133, 1133, 1133, 1133,
-     1133, 1133,    0,    0,    0, 1133, 1133, 1133, 1133, 1133,
-     1133,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-
-        0,    0,    0,    0, 1133, 1133, 1133, 1133, 1133, 1133,
-     1135, 1135, 1135, 1135, 1135, 1135, 1135,    0,    0,    0,
-     1135, 1135, 1135, 1135, 1135, 1135,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0, 1135,
-     1135, 1135, 1135, 1135, 1135, 1137, 1137, 1137, 1137, 1137,
-     1137, 1137,    0,    0,    0, 1137, 1137, 1137, 1137, 1137,
-     1137,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0, 1137, 1137, 1137, 1137, 1137, 1137,
-
-     1139, 1139, 1139, 1139, 1139, 1139, 1139,    0,    0,    0,
-     1139, 1139, 1139, 1139, 1139, 1139,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0, 1139,
-     1139, 1139, 1139, 1139, 1139, 1141, 1141, 1141, 1141, 1141,
-     1141, 1141,    0,    0,    0, 1141, 1141, 1141, 1141, 1141,
-     1141,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0, 1141, 1141, 1141, 1141, 1141, 1141,
-     1143, 1143, 1143, 1143, 1143, 1143, 1143,    0,    0,    0,
-
-     1143, 1143, 1143, 1143, 1143, 1143,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0, 1143,
-     1143, 1143, 1143, 1143, 1143, 1145, 1145, 1145, 1145, 1145,
-     1145, 1145,    0,    0,    0, 1145, 1145, 1145, 1145, 1145,
-     1145,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0, 1145, 1145, 1145, 1145, 1145, 1145,
-     1147, 1147, 1147, 1147, 1147, 1147, 1147,    0,    0,    0,
-     1147, 1147, 1147, 1147, 1147, 1147,    0,    0,    0,    0,
-
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0, 1147,
-     1147, 1147, 1147, 1147, 1147, 1149, 1149, 1149, 1149, 1149,
-     1149, 1149,    0,    0,    0, 1149, 1149, 1149, 1149, 1149,
-     1149,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0, 1149, 1149, 1149, 1149, 1149, 1149,
-     1151, 1151, 1151, 1151, 1151, 1151, 1151,    0,    0,    0,
-     1151, 1151, 1151, 1151, 1151, 1151,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-
-        0,    0,    0,    0,    0,    0,    0,    0,    0, 1151,
-     1151, 1151, 1151, 1151, 1151, 1153, 1153, 1153, 1153, 1153,
-     1153, 1153,    0,    0,    0, 1153, 1153, 1153, 1153, 1153,
-     1153,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0, 1153, 1153, 1153, 1153, 1153, 1153,
-     1155, 1155, 1155, 1155, 1155, 1155, 1155,    0,    0,    0,
-     1155, 1155, 1155, 1155, 1155, 1155,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0, 1155,
-
-     1155, 1155, 1155, 1155, 1155, 1157, 1157, 1157, 1157, 1157,
-     1157, 1157,    0,    0,    0, 1157, 1157, 1157, 1157, 1157,
-     1157,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0, 1157, 1157, 1157, 1157, 1157, 1157,
-     1159, 1159, 1159, 1159, 1159, 1159, 1159,    0,    0,    0,
-     1159, 1159, 1159, 1159, 1159, 1159,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0, 1159,
-     1159, 1159, 1159, 1159, 1159, 1161, 1161, 1161, 1161, 1161,
-
-     1161, 1161,    0,    0,    0, 1161, 1161, 1161, 1161, 1161,
-     1161,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0, 1161, 1161, 1161, 1161, 1161, 1161,
-     1163, 1163, 1163, 1163, 1163, 1163, 1163,    0,    0,    0,
-     1163, 1163, 1163, 1163, 1163, 1163,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0, 1163,
-     1163, 1163, 1163, 1163, 1163, 1165, 1165, 1165, 1165, 1165,
-     1165, 1165,    0,    0,    0, 1165, 1165, 1165, 1165, 1165,
-
-     1165,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0, 1165, 1165, 1165, 1165, 1165, 1165,
-     1167, 1167, 1167, 1167, 1167, 1167, 1167,    0,    0,    0,
-     1167, 1167, 1167, 1167, 1167, 1167,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0, 1167,
-     1167, 1167, 1167, 1167, 1167, 1169, 1169, 1169, 1169, 1169,
-     1169, 1169,    0,    0,    0, 1169, 1169, 1169, 1169, 1169,
-     1169,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0, 1169, 1169, 1169, 1169, 1169, 1169,
-     1171, 1171, 1171, 1171, 1171, 1171, 1171,    0,    0,    0,
-     1171, 1171, 1171, 1171, 1171, 1171,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0, 1171,
-     1171, 1171, 1171, 1171, 1171, 1173, 1173, 1173, 1173, 1173,
-     1173, 1173,    0,    0,    0, 1173, 1173, 1173, 1173, 1173,
-     1173,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-
-        0,    0,    0,    0, 1173, 1173, 1173, 1173, 1173, 1173,
-     1175, 1175, 1175, 1175, 1175, 1175, 1175,    0,    0,    0,
-     1175, 1175, 1175, 1175, 1175, 1175,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0, 1175,
-     1175, 1175, 1175, 1175, 1175, 1177, 1177, 1177, 1177, 1177,
-     1177, 1177,    0,    0,    0, 1177, 1177, 1177, 1177, 1177,
-     1177,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0, 1177, 1177, 1177, 1177, 1177, 1177,
-
-     1179, 1179, 1179, 1179, 1179, 1179, 1179,    0,    0,    0,
-     1179, 1179, 1179, 1179, 1179, 1179,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0, 1179,
-     1179, 1179, 1179, 1179, 1179, 1181, 1181, 1181, 1181, 1181,
-     1181, 1181,    0,    0,    0, 1181, 1181, 1181, 1181, 1181,
-     1181,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0, 1181, 1181, 1181, 1181, 1181, 1181,
-     1183, 1183, 1183, 1183, 1183, 1183, 1183,    0,    0,    0,
-
-     1183, 1183, 1183, 1183, 1183, 1183,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0, 1183,
-     1183, 1183, 1183, 1183, 1183, 1185, 1185, 1185, 1185, 1185,
-     1185, 1185,    0,    0,    0, 1185, 1185, 1185, 1185, 1185,
-     1185,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0, 1185, 1185, 1185, 1185, 1185, 1185,
-     1187, 1187, 1187, 1187, 1187, 1187, 1187,    0,    0,    0,
-     1187, 1187, 1187, 1187, 1187, 1187,    0,    0,    0,    0,
-
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0, 1187,
-     1187, 1187, 1187, 1187, 1187, 1189, 1189, 1189, 1189, 1189,
-     1189, 1189,    0,    0,    0, 1189, 1189, 1189, 1189, 1189,
-     1189,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0, 1189, 1189, 1189, 1189, 1189, 1189,
-     1191, 1191, 1191, 1191, 1191, 1191, 1191,    0,    0,    0,
-     1191, 1191, 1191, 1191, 1191, 1191,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-
-        0,    0,    0,    0,    0,    0,    0,    0,    0, 1191,
-     1191, 1191, 1191, 1191, 1191, 1193, 1193, 1193, 1193, 1193,
-     1193, 1193,    0,    0,    0, 1193, 1193, 1193, 1193, 1193,
-     1193,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0, 1193, 1193, 1193, 1193, 1193, 1193,
-     1195, 1195, 1195, 1195, 1195, 1195, 1195,    0,    0,    0,
-     1195, 1195, 1195, 1195, 1195, 1195,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0, 1195,
-
-     1195, 1195, 1195, 1195, 1195, 1197, 1197, 1197, 1197, 1197,
-     1197, 1197,    0,    0,    0, 1197, 1197, 1197, 1197, 1197,
-     1197,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0, 1197, 1197, 1197, 1197, 1197, 1197,
-     1199, 1199, 1199, 1199, 1199, 1199, 1199,    0,    0,    0,
-     1199, 1199, 1199, 1199, 1199, 1199,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0, 1199,
-     1199, 1199, 1199, 1199, 1199, 1201, 1201, 1201, 1201, 1201,
-
-     1201, 1201,    0,    0,    0, 1201, 1201, 1201, 1201, 1201,
-     1201,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0, 1201, 1201, 1201, 1201, 1201, 1201,
-     1203, 1203, 1203, 1203, 1203, 1203, 1203,    0,    0,    0,
-     1203, 1203, 1203, 1203, 1203, 1203,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0, 1203,
-     1203, 1203, 1203, 1203, 1203, 1205, 1205, 1205, 1205, 1205,
-     1205, 1205,    0,    0,    0, 1205, 1205, 1205, 1205, 1205,
-
-     1205,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0, 1205, 1205, 1205, 1205, 1205, 1205,
-     1207, 1207, 1207, 1207, 1207, 1207, 1207,    0,    0,    0,
-     1207, 1207, 1207, 1207, 1207, 1207,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0, 1207,
-     1207, 1207, 1207, 1207, 1207, 1209, 1209, 1209, 1209, 1209,
-     1209, 1209,    0,    0,    0, 1209, 1209, 1209, 1209, 1209,
-     1209,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0, 1209, 1209, 1209, 1209, 1209, 1209,
-     1211, 1211, 1211, 1211, 1211, 1211, 1211,    0,    0,    0,
-     1211, 1211, 1211, 1211, 1211, 1211,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0, 1211,
-     1211, 1211, 1211, 1211, 1211, 1213, 1213, 1213, 1213, 1213,
-     1213, 1213,    0,    0,    0, 1213, 1213, 1213, 1213, 1213,
-     1213,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-
-        0,    0,    0,    0, 1213, 1213, 1213, 1213, 1213, 1213,
-     1215, 1215, 1215, 1215, 1215, 1215, 1215,    0,    0,    0,
-     1215, 1215, 1215, 1215, 1215, 1215,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0, 1215,
-     1215, 1215, 1215, 1215, 1215, 1217, 1217, 1217, 1217, 1217,
-     1217, 1217,    0,    0,    0, 1217, 1217, 1217, 1217, 1217,
-     1217,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0, 1217, 1217, 1217, 1217, 1217, 1217,
-
-     1219, 1219, 1219, 1219, 1219, 1219, 1219,    0,    0,    0,
-     1219, 1219, 1219, 1219, 1219, 1219,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0, 1219,
-     1219, 1219, 1219, 1219, 1219, 1221, 1221, 1221, 1221, 1221,
-     1221, 1221,    0,    0,    0, 1221, 1221, 1221, 1221, 1221,
-     1221,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0, 1221, 1221, 1221, 1221, 1221, 1221,
-     1223, 1223, 1223, 1223, 1223, 1223, 1223,    0,    0,    0,
-
-     1223, 1223, 1223, 1223, 1223, 1223,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0, 1223,
-     1223, 1223, 1223, 1223, 1223, 1225, 1225, 1225, 1225, 1225,
-     1225, 1225,    0,    0,    0, 1225, 1225, 1225, 1225, 1225,
-     1225,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0, 1225, 1225, 1225, 1225, 1225, 1225,
-     1227, 1227, 1227, 1227, 1227, 1227, 1227,    0,    0,    0,
-     1227, 1227, 1227, 1227, 1227, 1227,    0,    0,    0,    0,
-
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0, 1227,
-     1227, 1227, 1227, 1227, 1227, 1229, 1229, 1229, 1229, 1229,
-     1229, 1229,    0,    0,    0, 1229, 1229, 1229, 1229, 1229,
-     1229,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0, 1229, 1229, 1229, 1229, 1229, 1229,
-     1231, 1231, 1231, 1231, 1231, 1231, 1231,    0,    0,    0,
-     1231, 1231, 1231, 1231, 1231, 1231,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-
-        0,    0,    0,    0,    0,    0,    0,    0,    0, 1231,
-     1231, 1231, 1231, 1231, 1231, 1233, 1233, 1233, 1233, 1233,
-     1233, 1233,    0,    0,    0, 1233, 1233, 1233, 1233, 1233,
-     1233,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0, 1233, 1233, 1233, 1233, 1233, 1233,
-     1235, 1235, 1235, 1235, 1235, 1235, 1235,    0,    0,    0,
-     1235, 1235, 1235, 1235, 1235, 1235,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0, 1235,
-
-     1235, 1235, 1235, 1235, 1235, 1237, 1237, 1237, 1237, 1237,
-     1237, 1237,    0,    0,    0, 1237, 1237, 1237, 1237, 1237,
-     1237,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0, 1237, 1237, 1237, 1237, 1237, 1237,
-     1239, 1239, 1239, 1239, 1239, 1239, 1239,    0,    0,    0,
-     1239, 1239, 1239, 1239, 1239, 1239,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0, 1239,
-     1239, 1239, 1239, 1239, 1239, 1241, 1241, 1241, 1241, 1241,
-
-     1241, 1241,    0,    0,    0, 1241, 1241, 1241, 1241, 1241,
-     1241,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0, 1241, 1241, 1241, 1241, 1241, 1241,
-     1243, 1243, 1243, 1243, 1243, 1243, 1243,    0,    0,    0,
-     1243, 1243, 1243, 1243, 1243, 1243,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0, 1243,
-     1243, 1243, 1243, 1243, 1243, 1245, 1245, 1245, 1245, 1245,
-     1245, 1245,    0,    0,    0, 1245, 1245, 1245, 1245, 1245,
-
-     1245,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0, 1245, 1245, 1245, 1245, 1245, 1245,
-     1247, 1247, 1247, 1247, 1247, 1247, 1247,    0,    0,    0,
-     1247, 1247, 1247, 1247, 1247, 1247,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0, 1247,
-     1247, 1247, 1247, 1247, 1247, 1249, 1249, 1249, 1249, 1249,
-     1249, 1249,    0,    0,    0, 1249, 1249, 1249, 1249, 1249,
-     1249,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0, 1249, 1249, 1249, 1249, 1249, 1249,
-     1251, 1251, 1251, 1251, 1251, 1251, 1251,    0,    0,    0,
-     1251, 1251, 1251, 1251, 1251, 1251,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0, 1251,
-     1251, 1251, 1251, 1251, 1251, 1253, 1253, 1253, 1253, 1253,
-     1253, 1253,    0,    0,    0, 1253, 1253, 1253, 1253, 1253,
-     1253,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-
-        0,    0,    0,    0, 1253, 1253, 1253, 1253, 1253, 1253,
-     1255, 1255, 1255, 1255, 1255, 1255, 1255,    0,    0,    0,
-     1255, 1255, 1255, 1255, 1255, 1255,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0, 1255,
-     1255, 1255, 1255, 1255, 1255, 1257, 1257, 1257, 1257, 1257,
-     1257, 1257,    0,    0,    0, 1257, 1257, 1257, 1257, 1257,
-     1257,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0, 1257, 1257, 1257, 1257, 1257, 1257,
-
-     1259, 1259, 1259, 1259, 1259, 1259, 1259,    0,    0,    0,
-     1259, 1259, 1259, 1259, 1259, 1259,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0, 1259,
-     1259, 1259, 1259, 1259, 1259, 1261, 1261, 1261, 1261, 1261,
-     1261, 1261,    0,    0,    0, 1261, 1261, 1261, 1261, 1261,
-     1261,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0, 1261, 1261, 1261, 1261, 1261, 1261,
-     1263, 1263, 1263, 1263, 1263, 1263, 1263,    0,    0,    0,
-
-     1263, 1263, 1263, 1263, 1263, 1263,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0, 1263,
-     1263, 1263, 1263, 1263, 1263, 1265, 1265, 1265, 1265, 1265,
-     1265, 1265,    0,    0,    0, 1265, 1265, 1265, 1265, 1265,
-     1265,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0, 1265, 1265, 1265, 1265, 1265, 1265,
-     1267, 1267, 1267, 1267, 1267, 1267, 1267,    0,    0,    0,
-     1267, 1267, 1267, 1267, 1267, 1267,    0,    0,    0,    0,
-
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0, 1267,
-     1267, 1267, 1267, 1267, 1267, 1269, 1269, 1269, 1269, 1269,
-     1269, 1269,    0,    0,    0, 1269, 1269, 1269, 1269, 1269,
-     1269,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0, 1269, 1269, 1269, 1269, 1269, 1269,
-     1271, 1271, 1271, 1271, 1271, 1271, 1271,    0,    0,    0,
-     1271, 1271, 1271, 1271, 1271, 1271,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-
-        0,    0,    0,    0,    0,    0,    0,    0,    0, 1271,
-     1271, 1271, 1271, 1271, 1271, 1273, 1273, 1273, 1273, 1273,
-     1273, 1273,    0,    0,    0, 1273, 1273, 1273, 1273, 1273,
-     1273,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0, 1273, 1273, 1273, 1273, 1273, 1273,
-     1275, 1275, 1275, 1275, 1275, 1275, 1275,    0,    0,    0,
-     1275, 1275, 1275, 1275, 1275, 1275,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0, 1275,
-
-     1275, 1275, 1275, 1275, 1275, 1277, 1277, 1277, 1277, 1277,
-     1277, 1277,    0,    0,    0, 1277, 1277, 1277, 1277, 1277,
-     1277,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0, 1277, 1277, 1277, 1277, 1277, 1277,
-     1279, 1279, 1279, 1279, 1279, 1279, 1279,    0,    0,    0,
-     1279, 1279, 1279, 1279, 1279, 1279,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0, 1279,
-     1279, 1279, 1279, 1279, 1279, 1281, 1281, 1281, 1281, 1281,
-
-     1281, 1281,    0,    0,    0, 1281, 1281, 1281, 1281, 1281,
-     1281,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0, 1281, 1281, 1281, 1281, 1281, 1281,
-     1283, 1283, 1283, 1283, 1283, 1283, 1283,    0,    0,    0,
-     1283, 1283, 1283, 1283, 1283, 1283,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0, 1283,
-     1283, 1283, 1283, 1283, 1283, 1285, 1285, 1285, 1285, 1285,
-     1285, 1285,    0,    0,    0, 1285, 1285, 1285, 1285, 1285,
-
-     1285,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0, 1285, 1285, 1285, 1285, 1285, 1285,
-     1287, 1287, 1287, 1287, 1287, 1287, 1287,    0,    0,    0,
-     1287, 1287, 1287, 1287, 1287, 1287,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0, 1287,
-     1287, 1287, 1287, 1287, 1287, 1289, 1289, 1289, 1289, 1289,
-     1289, 1289,    0,    0,    0, 1289, 1289, 1289, 1289, 1289,
-     1289,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0, 1289, 1289, 1289, 1289, 1289, 1289,
-     1291, 1291, 1291, 1291, 1291, 1291, 1291,    0,    0,    0,
-     1291, 1291, 1291, 1291, 1291, 1291,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0, 1291,
-     1291, 1291, 1291, 1291, 1291, 1293, 1293, 1293, 1293, 1293,
-     1293, 1293,    0,    0,    0, 1293, 1293, 1293, 1293, 1293,
-     1293,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-
-        0,    0,    0,    0, 1293, 1293, 1293, 1293, 1293, 1293,
-     1295, 1295, 1295, 1295, 1295, 1295, 1295,    0,    0,    0,
-     1295, 1295, 1295, 1295, 1295, 1295,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0, 1295,
-     1295, 1295, 1295, 1295, 1295, 1297, 1297, 1297, 1297, 1297,
-     1297, 1297,    0,    0,    0, 1297, 1297, 1297, 1297, 1297,
-     1297,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0, 1297, 1297, 1297, 1297, 1297, 1297,
-
-     1299, 1299, 1299, 1299, 1299, 1299, 1299,    0,    0,    0,
-     1299, 1299, 1299, 1299, 1299, 1299,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0, 1299,
-     1299, 1299, 1299, 1299, 1299, 1301, 1301, 1301, 1301, 1301,
-     1301, 1301,    0,    0,    0, 1301, 1301, 1301, 1301, 1301,
-     1301,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0, 1301, 1301, 1301, 1301, 1301, 1301,
-     1303, 1303, 1303, 1303, 1303, 1303, 1303,    0,    0,    0,
-
-     1303, 1303, 1303, 1303, 1303, 1303,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0, 1303,
-     1303, 1303, 1303, 1303, 1303, 1305, 1305, 1305, 1305, 1305,
-     1305, 1305,    0,    0,    0, 1305, 1305, 1305, 1305, 1305,
-     1305,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0, 1305, 1305, 1305, 1305, 1305, 1305,
-     1307, 1307, 1307, 1307, 1307, 1307, 1307,    0,    0,    0,
-     1307, 1307, 1307, 1307, 1307, 1307,    0,    0,    0,    0,
-
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0, 1307,
-     1307, 1307, 1307, 1307, 1307, 1309, 1309, 1309, 1309, 1309,
-     1309, 1309,    0,    0,    0, 1309, 1309, 1309, 1309, 1309,
-     1309,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0, 1309, 1309, 1309, 1309, 1309, 1309,
-     1311, 1311, 1311, 1311, 1311, 1311, 1311,    0,    0,    0,
-     1311, 1311, 1311, 1311, 1311, 1311,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-
-        0,    0,    0,    0,    0,    0,    0,    0,    0, 1311,
-     1311, 1311, 1311, 1311, 1311, 1313, 1313, 1313, 1313, 1313,
-     1313, 1313,    0,    0,    0, 1313, 1313, 1313, 1313, 1313,
-     1313,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0, 1313, 1313, 1313, 1313, 1313, 1313,
-     1315, 1315, 1315, 1315, 1315, 1315, 1315,    0,    0,    0,
-     1315, 1315, 1315, 1315, 1315, 1315,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0, 1315,
-
-     1315, 1315, 1315, 1315, 1315, 1317, 1317, 1317, 1317, 1317,
-     1317, 1317,    0,    0,    0, 1317, 1317, 1317, 1317, 1317,
-     1317,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0, 1317, 1317, 1317, 1317, 1317, 1317,
-     1319, 1319, 1319, 1319, 1319, 1319, 1319,    0,    0,    0,
-     1319, 1319, 1319, 1319, 1319, 1319,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0, 1319,
-     1319, 1319, 1319, 1319, 1319, 1321, 1321, 1321, 1321, 1321,
-
-     1321, 1321,    0,    0,    0, 1321, 1321, 1321, 1321, 1321,
-     1321,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0, 1321, 1321, 1321, 1321, 1321, 1321,
-     1323, 1323, 1323, 1323, 1323, 1323, 1323,    0,    0,    0,
-     1323, 1323, 1323, 1323, 1323, 1323,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0, 1323,
-     1323, 1323, 1323, 1323, 1323, 1325, 1325, 1325, 1325, 1325,
-     1325, 1325,    0,    0,    0, 1325, 1325, 1325, 1325, 1325,
-
-     1325,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0, 1325, 1325, 1325, 1325, 1325, 1325,
-     1327, 1327, 1327, 1327, 1327, 1327, 1327,    0,    0,    0,
-     1327, 1327, 1327, 1327, 1327, 1327,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0, 1327,
-     1327, 1327, 1327, 1327, 1327, 1329, 1329, 1329, 1329, 1329,
-     1329, 1329,    0,    0,    0, 1329, 1329, 1329, 1329, 1329,
-     1329,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0, 1329, 1329, 1329, 1329, 1329, 1329,
-     1331, 1331, 1331, 1331, 1331, 1331, 1331,    0,    0,    0,
-     1331, 1331, 1331, 1331, 1331, 1331,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0, 1331,
-     1331, 1331, 1331, 1331, 1331, 1333, 1333, 1333, 1333, 1333,
-     1333, 1333,    0,    0,    0, 1333, 1333, 1333, 1333, 1333,
-     1333,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-
-        0,    0,    0,    0, 1333, 1333, 1333, 1333, 1333, 1333,
-     1335, 1335, 1335, 1335, 1335, 1335, 1335,    0,    0,    0,
-     1335, 1335, 1335, 1335, 1335, 1335,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0, 1335,
-     1335, 1335, 1335, 1335, 1335, 1337, 1337, 1337, 1337, 1337,
-     1337, 1337,    0,    0,    0, 1337, 1337, 1337, 1337, 1337,
-     1337,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0, 1337, 1337, 1337, 1337, 1337, 1337,
-
-     1339, 1339, 1339, 1339, 1339, 1339, 1339,    0,    0,    0,
-     1339, 1339, 1339, 1339, 1339, 1339,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0, 1339,
-     1339, 1339, 1339, 1339, 1339, 1341, 1341, 1341, 1341, 1341,
-     1341, 1341,    0,    0,    0, 1341, 1341, 1341, 1341, 1341,
-     1341,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0, 1341, 1341, 1341, 1341, 1341, 1341,
-     1343, 1343, 1343, 1343, 1343, 1343, 1343,    0,    0,    0,
-
-     1343, 1343, 1343, 1343, 1343, 1343,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0, 1343,
-     1343, 1343, 1343, 1343, 1343, 1345, 1345, 1345, 1345, 1345,
-     1345, 1345,    0,    0,    0, 1345, 1345, 1345, 1345, 1345,
-     1345,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0, 1345, 1345, 1345, 1345, 1345, 1345,
-     1347, 1347, 1347, 1347, 1347, 1347, 1347,    0,    0,    0,
-     1347, 1347, 1347, 1347, 1347, 1347,    0,    0,    0,    0,
-
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0, 1347,
-     1347, 1347, 1347, 1347, 1347, 1349, 1349, 1349, 1349, 1349,
-     1349, 1349,    0,    0,    0, 1349, 1349, 1349, 1349, 1349,
-     1349,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0, 1349, 1349, 1349, 1349, 1349, 1349,
-     1351, 1351, 1351, 1351, 1351, 1351, 1351,    0,    0,    0,
-     1351, 1351, 1351, 1351, 1351, 1351,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-
-        0,    0,    0,    0,    0,    0,    0,    0,    0, 1351,
-     1351, 1351, 1351, 1351, 1351, 1353, 1353, 1353, 1353, 1353,
-     1353, 1353,    0,    0,    0, 1353, 1353, 1353, 1353, 1353,
-     1353,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0, 1353, 1353, 1353, 1353, 1353, 1353,
-     1355, 1355, 1355, 1355, 1355, 1355, 1355,    0,    0,    0,
-     1355, 1355, 1355, 1355, 1355, 1355,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0, 1355,
-
-     1355, 1355, 1355, 1355, 1355, 1357, 1357, 1357, 1357, 1357,
-     1357, 1357,    0,    0,    0, 1357, 1357, 1357, 1357, 1357,
-     1357,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0, 1357, 1357, 1357, 1357, 1357, 1357,
-     1359, 1359, 1359, 1359, 1359, 1359, 1359,    0,    0,    0,
-     1359, 1359, 1359, 1359, 1359, 1359,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0, 1359,
-     1359, 1359, 1359, 1359, 1359, 1361, 1361, 1361, 1361, 1361,
-
-     1361, 1361,    0,    0,    0, 1361, 1361, 1361, 1361, 1361,
-     1361,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0, 1361, 1361, 1361, 1361, 1361, 1361,
-     1363, 1363, 1363, 1363, 1363, 1363, 1363,    0,    0,    0,
-     1363, 1363, 1363, 1363, 1363, 1363,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0, 1363,
-     1363, 1363, 1363, 1363, 1363, 1365, 1365, 1365, 1365, 1365,
-     1365, 1365,    0,    0,    0, 1365, 1365, 1365, 1365, 1365,
-
-     1365,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0, 1365, 1365, 1365, 1365, 1365, 1365,
-     1367, 1367, 1367, 1367, 1367, 1367, 1367,    0,    0,    0,
-     1367, 1367, 1367, 1367, 1367, 1367,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0, 1367,
-     1367, 1367, 1367, 1367, 1367, 1369, 1369, 1369, 1369, 1369,
-     1369, 1369,    0,    0,    0, 1369, 1369, 1369, 1369, 1369,
-     1369,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0, 1369, 1369, 1369, 1369, 1369, 1369,
-     1371, 1371, 1371, 1371, 1371, 1371, 1371,    0,    0,    0,
-     1371, 1371, 1371, 1371, 1371, 1371,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0, 1371,
-     1371, 1371, 1371, 1371, 1371, 1373, 1373, 1373, 1373, 1373,
-     1373, 1373,    0,    0,    0, 1373, 1373, 1373, 1373, 1373,
-     1373,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-
-        0,    0,    0,    0, 1373, 1373, 1373, 1373, 1373, 1373,
-     1375, 1375, 1375, 1375, 1375, 1375, 1375,    0,    0,    0,
-     1375, 1375, 1375, 1375, 1375, 1375,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0, 1375,
-     1375, 1375, 1375, 1375, 1375, 1377, 1377, 1377, 1377, 1377,
-     1377, 1377,    0,    0,    0, 1377, 1377, 1377, 1377, 1377,
-     1377,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0, 1377, 1377, 1377, 1377, 1377, 1377,
-
-     1379, 1379, 1379, 1379, 1379, 1379, 1379,    0,    0,    0,
-     1379, 1379, 1379, 1379, 1379, 1379,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0, 1379,
-     1379, 1379, 1379, 1379, 1379, 1381, 1381, 1381, 1381, 1381,
-     1381, 1381,    0,    0,    0, 1381, 1381, 1381, 1381, 1381,
-     1381,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0, 1381, 1381, 1381, 1381, 1381, 1381,
-     1383, 1383, 1383, 1383, 1383, 1383, 1383,    0,    0,    0,
-
-     1383, 1383, 1383, 1383, 1383, 1383,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0, 1383,
-     1383, 1383, 1383, 1383, 1383, 1385, 1385, 1385, 1385, 1385,
-     1385, 1385,    0,    0,    0, 1385, 1385, 1385, 1385, 1385,
-     1385,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0, 1385, 1385, 1385, 1385, 1385, 1385,
-     1387, 1387, 1387, 1387, 1387, 1387, 1387,    0,    0,    0,
-     1387, 1387, 1387, 1387, 1387, 1387,    0,    0,    0,    0,
-
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0, 1387,
-     1387, 1387, 1387, 1387, 1387, 1389, 1389, 1389, 1389, 1389,
-     1389, 1389,    0,    0,    0, 1389, 1389, 1389, 1389, 1389,
-     1389,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0, 1389, 1389, 1389, 1389, 1389, 1389,
-     1391, 1391, 1391, 1391, 1391, 1391, 1391,    0,    0,    0,
-     1391, 1391, 1391, 1391, 1391, 1391,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-
-        0,    0,    0,    0,    0,    0,    0,    0,    0, 1391,
-     1391, 1391, 1391, 1391, 1391, 1393, 1393, 1393, 1393, 1393,
-     1393, 1393,    0,    0,    0, 1393, 1393, 1393, 1393, 1393,
-     1393,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0, 1393, 1393, 1393, 1393, 1393, 1393,
-     1395, 1395, 1395, 1395, 1395, 1395, 1395,    0,    0,    0,
-     1395, 1395, 1395, 1395, 1395, 1395,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0, 1395,
-
-     1395, 1395, 1395, 1395, 1395, 1397, 1397, 1397, 1397, 1397,
-     1397, 1397,    0,    0,    0, 1397, 1397, 1397, 1397, 1397,
-     1397,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0, 1397, 1397, 1397, 1397, 1397, 1397,
-     1399, 1399, 1399, 1399, 1399, 1399, 1399,    0,    0,    0,
-     1399, 1399, 1399, 1399, 1399, 1399,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0, 1399,
-     1399, 1399, 1399, 1399, 1399, 1401, 1401, 1401, 1401, 1401,
-
-     1401, 1401,    0,    0,    0, 1401, 1401, 1401, 1401, 1401,
-     1401,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0, 1401, 1401, 1401, 1401, 1401, 1401,
-     1403, 1403, 1403, 1403, 1403, 1403, 1403,    0,    0,    0,
-     1403, 1403, 1403, 1403, 1403, 1403,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0, 1403,
-     1403, 1403, 1403, 1403, 1403, 1405, 1405, 1405, 1405, 1405,
-     1405, 1405,    0,    0,    0, 1405, 1405, 1405, 1405, 1405,
-
-     1405,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0, 1405, 1405, 1405, 1405, 1405, 1405,
-     1407, 1407, 1407, 1407, 1407, 1407, 1407,    0,    0,    0,
-     1407, 1407, 1407, 1407, 1407, 1407,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0, 1407,
-     1407, 1407, 1407, 1407, 1407, 1409, 1409, 1409, 1409, 1409,
-     1409, 1409,    0,    0,    0, 1409, 1409, 1409, 1409, 1409,
-     1409,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0, 1409, 1409, 1409, 1409, 1409, 1409,
-     1411, 1411, 1411, 1411, 1411, 1411, 1411,    0,    0,    0,
-     1411, 1411, 1411, 1411, 1411, 1411,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0, 1411,
-     1411, 1411, 1411, 1411, 1411, 1413, 1413, 1413, 1413, 1413,
-     1413, 1413,    0,    0,    0, 1413, 1413, 1413, 1413, 1413,
-     1413,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-
-        0,    0,    0,    0, 1413, 1413, 1413, 1413, 1413, 1413,
-     1415, 1415, 1415, 1415, 1415, 1415, 1415,    0,    0,    0,
-     1415, 1415, 1415, 1415, 1415, 1415,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0, 1415,
-     1415, 1415, 1415, 1415, 1415, 1417, 1417, 1417, 1417, 1417,
-     1417, 1417,    0,    0,    0, 1417, 1417, 1417, 1417, 1417,
-     1417,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0, 1417, 1417, 1417, 1417, 1417, 1417,
-
-     1419, 1419, 1419, 1419, 1419, 1419, 1419,    0,    0,    0,
-     1419, 1419, 1419, 1419, 1419, 1419,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0, 1419,
-     1419, 1419, 1419, 1419, 1419, 1421, 1421, 1421, 1421, 1421,
-     1421, 1421,    0,    0,    0, 1421, 1421, 1421, 1421, 1421,
-     1421,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0, 1421, 1421, 1421, 1421, 1421, 1421,
-     1423, 1423, 1423, 1423, 1423, 1423, 1423,    0,    0,    0,
-
-     1423, 1423, 1423, 1423, 1423, 1423,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0, 1423,
-     1423, 1423, 1423, 1423, 1423, 1425, 1425, 1425, 1425, 1425,
-     1425, 1425,    0,    0,    0, 1425, 1425, 1425, 1425, 1425,
-     1425,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0, 1425, 1425, 1425, 1425, 1425, 1425,
-     1427, 1427, 1427, 1427, 1427, 1427, 1427,    0,    0,    0,
-     1427, 1427, 1427, 1427, 1427, 1427,    0,    0,    0,    0,
-
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0, 1427,
-     1427, 1427, 1427, 1427, 1427, 1429, 1429, 1429, 1429, 1429,
-     1429, 1429,    0,    0,    0, 1429, 1429, 1429, 1429, 1429,
-     1429,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0, 1429, 1429, 1429, 1429, 1429, 1429,
-     1431, 1431, 1431, 1431, 1431, 1431, 1431,    0,    0,    0,
-     1431, 1431, 1431, 1431, 1431, 1431,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-
-        0,    0,    0,    0,    0,    0,    0,    0,    0, 1431,
-     1431, 1431, 1431, 1431, 1431, 1433, 1433, 1433, 1433, 1433,
-     1433, 1433,    0,    0,    0, 1433, 1433, 1433, 1433, 1433,
-     1433,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0, 1433, 1433, 1433, 1433, 1433, 1433,
-     1435, 1435, 1435, 1435, 1435, 1435, 1435,    0,    0,    0,
-     1435, 1435, 1435, 1435, 1435, 1435,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0, 1435,
-
-     1435, 1435, 1435, 1435, 1435, 1437, 1437, 1437, 1437, 1437,
-     1437, 1437,    0,    0,    0, 1437, 1437, 1437, 1437, 1437,
-     1437,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0, 1437, 1437, 1437, 1437, 1437, 1437,
-     1439, 1439, 1439, 1439, 1439, 1439, 1439,    0,    0,    0,
-     1439, 1439, 1439, 1439, 1439, 1439,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0, 1439,
-     1439, 1439, 1439, 1439, 1439, 1441, 1441, 1441, 1441, 1441,
-
-     1441, 1441,    0,    0,    0, 1441, 1441, 1441, 1441, 1441,
-     1441,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0, 1441, 1441, 1441, 1441, 1441, 1441,
-     1443, 1443, 1443, 1443, 1443, 1443, 1443,    0,    0,    0,
-     1443, 1443, 1443, 1443, 1443, 1443,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0, 1443,
-     1443, 1443, 1443, 1443, 1443, 1445, 1445, 1445, 1445, 1445,
-     1445, 1445,    0,    0,    0, 1445, 1445, 1445, 1445, 1445,
-
-     1445,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0, 1445, 1445, 1445, 1445, 1445, 1445,
-     1447, 1447, 1447, 1447, 1447, 1447, 1447,    0,    0,    0,
-     1447, 1447, 1447, 1447, 1447, 1447,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0, 1447,
-     1447, 1447, 1447, 1447, 1447, 1449, 1449, 1449, 1449, 1449,
-     1449, 1449,    0,    0,    0, 1449, 1449, 1449, 1449, 1449,
-     1449,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0, 1449, 1449, 1449, 1449, 1449, 1449,
-     1451, 1451, 1451, 1451, 1451, 1451, 1451,    0,    0,    0,
-     1451, 1451, 1451, 1451, 1451, 1451,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0, 1451,
-     1451, 1451, 1451, 1451, 1451, 1453, 1453, 1453, 1453, 1453,
-     1453, 1453,    0,    0,    0, 1453, 1453, 1453, 1453, 1453,
-     1453,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-
-        0,    0,    0,    0, 1453, 1453, 1453, 1453, 1453, 1453,
-     1455, 1455, 1455, 1455, 1455, 1455, 1455,    0,    0,    0,
-     1455, 1455, 1455, 1455, 1455, 1455,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0, 1455,
-     1455, 1455, 1455, 1455, 1455, 1457, 1457, 1457, 1457, 1457,
-     1457, 1457,    0,    0,    0, 1457, 1457, 1457, 1457, 1457,
-     1457,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0, 1457, 1457, 1457, 1457, 1457, 1457,
-
-     1459, 1459, 1459, 1459, 1459, 1459, 1459,    0,    0,    0,
-     1459, 1459, 1459, 1459, 1459, 1459,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0, 1459,
-     1459, 1459, 1459, 1459, 1459, 1461, 1461, 1461, 1461, 1461,
-     1461, 1461,    0,    0,    0, 1461, 1461, 1461, 1461, 1461,
-     1461,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0, 1461, 1461, 1461, 1461, 1461, 1461,
-     1463, 1463, 1463, 1463, 1463, 1463, 1463,    0,    0,    0,
-
-     1463, 1463, 1463, 1463, 1463, 1463,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0, 1463,
-     1463, 1463, 1463, 1463, 1463, 1465, 1465, 1465, 1465, 1465,
-     1465, 1465,    0,    0,    0, 1465, 1465, 1465, 1465, 1465,
-     1465,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0, 1465, 1465, 1465, 1465, 1465, 1465,
-     1467, 1467, 1467, 1467, 1467, 1467, 1467,    0,    0,    0,
-     1467, 1467, 1467, 1467, 1467, 1467,    0,    0,    0,    0,
-
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0, 1467,
-     1467, 1467, 1467, 1467, 1467, 1469, 1469, 1469, 1469, 1469,
-     1469, 1469,    0,    0,    0, 1469, 1469, 1469, 1469, 1469,
-     1469,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0, 1469, 1469, 1469, 1469, 1469, 1469,
-     1471, 1471, 1471, 1471, 1471, 1471, 1471,    0,    0,    0,
-     1471, 1471, 1471, 1471, 1471, 1471,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-
-        0,    0,    0,    0,    0,    0,    0,    0,    0, 1471,
-     1471, 1471, 1471, 1471, 1471, 1473, 1473, 1473, 1473, 1473,
-     1473, 1473,    0,    0,    0, 1473, 1473, 1473, 1473, 1473,
-     1473,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0, 1473, 1473, 1473, 1473, 1473, 1473,
-     1475, 1475, 1475, 1475, 1475, 1475, 1475,    0,    0,    0,
-     1475, 1475, 1475, 1475, 1475, 1475,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0, 1475,
-
-     1475, 1475, 1475, 1475, 1475, 1477, 1477, 1477, 1477, 1477,
-     1477, 1477,    0,    0,    0, 1477, 1477, 1477, 1477, 1477,
-     1477,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0, 1477, 1477, 1477, 1477, 1477, 1477,
-     1479, 1479, 1479, 1479, 1479, 1479, 1479,    0,    0,    0,
-     1479, 1479, 1479, 1479, 1479, 1479,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0, 1479,
-     1479, 1479, 1479, 1479, 1479, 1481, 1481, 1481, 1481, 1481,
-
-     1481, 1481,    0,    0,    0, 1481, 1481, 1481, 1481, 1481,
-     1481,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0, 1481, 1481, 1481, 1481, 1481, 1481,
-     1483, 1483, 1483, 1483, 1483, 1483, 1483,    0,    0,    0,
-     1483, 1483, 1483, 1483, 1483, 1483,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0, 1483,
-     1483, 1483, 1483, 1483, 1483, 1485, 1485, 1485, 1485, 1485,
-     1485, 1485,    0,    0,    0, 1485, 1485, 1485, 1485, 1485,
-
-     1485,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0, 1485, 1485, 1485, 1485, 1485, 1485,
-     1487, 1487, 1487, 1487, 1487, 1487, 1487,    0,    0,    0,
-     1487, 1487, 1487, 1487, 1487, 1487,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0, 1487,
-     1487, 1487, 1487, 1487, 1487, 1489, 1489, 1489, 1489, 1489,
-     1489, 1489,    0,    0,    0, 1489, 1489, 1489, 1489, 1489,
-     1489,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0, 1489, 1489, 1489, 1489, 1489, 1489,
-     1491, 1491, 1491, 1491, 1491, 1491, 1491,    0,    0,    0,
-     1491, 1491, 1491, 1491, 1491, 1491,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0, 1491,
-     1491, 1491, 1491, 1491, 1491, 1493, 1493, 1493, 1493, 1493,
-     1493, 1493,    0,    0,    0, 1493, 1493, 1493, 1493, 1493,
-     1493,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-
-        0,    0,    0,    0, 1493, 1493, 1493, 1493, 1493, 1493,
-     1495, 1495, 1495, 1495, 1495, 1495, 1495,    0,    0,    0,
-     1495, 1495, 1495, 1495, 1495, 1495,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0, 1495,
-     1495, 1495, 1495, 1495, 1495, 1497, 1497, 1497, 1497, 1497,
-     1497, 1497,    0,    0,    0, 1497, 1497, 1497, 1497, 1497,
-     1497,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0, 1497, 1497, 1497, 1497, 1497, 1497,
-
-     1499, 1499, 1499, 1499, 1499, 1499, 1499,    0,    0,    0,
-     1499, 1499, 1499, 1499, 1499, 1499,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0, 1499,
-     1499, 1499, 1499, 1499, 1499, 1501, 1501, 1501, 1501, 1501,
-     1501, 1501,    0,    0,    0, 1501, 1501, 1501, 1501, 1501,
-     1501,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0, 1501, 1501, 1501, 1501, 1501, 1501,
-     1503, 1503, 1503, 1503, 1503, 1503, 1503,    0,    0,    0,
-
-     1503, 1503, 1503, 1503, 1503, 1503,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0, 1503,
-     1503, 1503, 1503, 1503, 1503, 1505, 1505, 1505, 1505, 1505,
-     1505, 1505,    0,    0,    0, 1505, 1505, 1505, 1505, 1505,
-     1505,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0, 1505, 1505, 1505, 1505, 1505, 1505,
-     1507, 1507, 1507, 1507, 1507, 1507, 1507,    0,    0,    0,
-     1507, 1507, 1507, 1507, 1507, 1507,    0,    0,    0,    0,
-
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0, 1507,
-     1507, 1507, 1507, 1507, 1507, 1509, 1509, 1509, 1509, 1509,
-     1509, 1509,    0,    0,    0, 1509, 1509, 1509, 1509, 1509,
-     1509,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0, 1509, 1509, 1509, 1509, 1509, 1509,
-     1511, 1511, 1511, 1511, 1511, 1511, 1511,    0,    0,    0,
-     1511, 1511, 1511, 1511, 1511, 1511,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-
-        0,    0,    0,    0,    0,    0,    0,    0,    0, 1511,
-     1511, 1511, 1511, 1511, 1511, 1513, 1513, 1513, 1513, 1513,
-     1513, 1513,    0,    0,    0, 1513, 1513, 1513, 1513, 1513,
-     1513,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0, 1513, 1513, 1513, 1513, 1513, 1513,
-     1515, 1515, 1515, 1515, 1515, 1515, 1515,    0,    0,    0,
-     1515, 1515, 1515, 1515, 1515, 1515,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0, 1515,
-
-     1515, 1515, 1515, 1515, 1515, 1517, 1517, 1517, 1517, 1517,
-     1517, 1517,    0,    0,    0, 1517, 1517, 1517, 1517, 1517,
-     1517,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0, 1517, 1517, 1517, 1517, 1517, 1517,
-     1519, 1519, 1519, 1519, 1519, 1519, 1519,    0,    0,    0,
-     1519, 1519, 1519, 1519, 1519, 1519,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0, 1519,
-     1519, 1519, 1519, 1519, 1519, 1521, 1521, 1521, 1521, 1521,
-
-     1521, 1521,    0,    0,    0, 1521, 1521, 1521, 1521, 1521,
-     1521,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0, 1521, 1521, 1521, 1521, 1521, 1521,
-     1523, 1523, 1523, 1523, 1523, 1523, 1523,    0,    0,    0,
-     1523, 1523, 1523, 1523, 1523, 1523,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0, 1523,
-     1523, 1523, 1523, 1523, 1523, 1525, 1525, 1525, 1525, 1525,
-     1525, 1525,    0,    0,    0, 1525, 1525, 1525, 1525, 1525,
-
-     1525,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0, 1525, 1525, 1525, 1525, 1525, 1525,
-     1527, 1527, 1527, 1527, 1527, 1527, 1527,    0,    0,    0,
-     1527, 1527, 1527, 1527, 1527, 1527,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0, 1527,
-     1527, 1527, 1527, 1527, 1527, 1529, 1529, 1529, 1529, 1529,
-     1529, 1529,    0,    0,    0, 1529, 1529, 1529, 1529, 1529,
-     1529,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0, 1529, 1529, 1529, 1529, 1529, 1529,
-     1531, 1531, 1531, 1531, 1531, 1531, 1531,    0,    0,    0,
-     1531, 1531, 1531, 1531, 1531, 1531,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0, 1531,
-     1531, 1531, 1531, 1531, 1531, 1533, 1533, 1533, 1533, 1533,
-     1533, 1533,    0,    0,    0, 1533, 1533, 1533, 1533, 1533,
-     1533,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-
-        0,    0,    0,    0, 1533, 1533, 1533, 1533, 1533, 1533,
-     1535, 1535, 1535, 1535, 1535, 1535, 1535,    0,    0,    0,
-     1535, 1535, 1535, 1535, 1535, 1535,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0, 1535,
-     1535, 1535, 1535, 1535, 1535, 1537, 1537, 1537, 1537, 1537,
-     1537, 1537,    0,    0,    0, 1537, 1537, 1537, 1537, 1537,
-     1537,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0, 1537, 1537, 1537, 1537, 1537, 1537,
-
-     1539, 1539, 1539, 1539, 1539, 1539, 1539,    0,    0,    0,
-     1539, 1539, 1539, 1539, 1539, 1539,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0, 1539,
-     1539, 1539, 1539, 1539, 1539, 1541, 1541, 1541, 1541, 1541,
-     1541, 1541,    0,    0,    0, 1541, 1541, 1541, 1541, 1541,
-     1541,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0, 1541, 1541, 1541, 1541, 1541, 1541,
-     1543, 1543, 1543, 1543, 1543, 1543, 1543,    0,    0,    0,
-
-     1543, 1543, 1543, 1543, 1543, 1543,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0, 1543,
-     1543, 1543, 1543, 1543, 1543, 1545, 1545, 1545, 1545, 1545,
-     1545, 1545,    0,    0,    0, 1545, 1545, 1545, 1545, 1545,
-     1545,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0, 1545, 1545, 1545, 1545, 1545, 1545,
-     1547, 1547, 1547, 1547, 1547, 1547, 1547,    0,    0,    0,
-     1547, 1547, 1547, 1547, 1547, 1547,    0,    0,    0,    0,
-
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0, 1547,
-     1547, 1547, 1547, 1547, 1547, 1549, 1549, 1549, 1549, 1549,
-     1549, 1549,    0,    0,    0, 1549, 1549, 1549, 1549, 1549,
-     1549,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0, 1549, 1549, 1549, 1549, 1549, 1549,
-     1551, 1551, 1551, 1551, 1551, 1551, 1551,    0,    0,    0,
-     1551, 1551, 1551, 1551, 1551, 1551,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-
-        0,    0,    0,    0,    0,    0,    0,    0,    0, 1551,
-     1551, 1551, 1551, 1551, 1551, 1553, 1553, 1553, 1553, 1553,
-     1553, 1553,    0,    0,    0, 1553, 1553, 1553, 1553, 1553,
-     1553,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0, 1553, 1553, 1553, 1553, 1553, 1553,
-     1555, 1555, 1555, 1555, 1555, 1555, 1555,    0,    0,    0,
-     1555, 1555, 1555, 1555, 1555, 1555,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0, 1555,
-
-     1555, 1555, 1555, 1555, 1555, 1557, 1557, 1557, 1557, 1557,
-     1557, 1557,    0,    0,    0, 1557, 1557, 1557, 1557, 1557,
-     1557,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0, 1557, 1557, 1557, 1557, 1557, 1557,
-     1559, 1559, 1559, 1559, 1559, 1559, 1559,    0,    0,    0,
-     1559, 1559, 1559, 1559, 1559, 1559,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0, 1559,
-     1559, 1559, 1559, 1559, 1559, 1561, 1561, 1561, 1561, 1561,
-
-     1561, 1561,    0,    0,    0, 1561, 1561, 1561, 1561, 1561,
-     1561,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0, 1561, 1561, 1561, 1561, 1561, 1561,
-     1563, 1563, 1563, 1563, 1563, 1563, 1563,    0,    0,    0,
-     1563, 1563, 1563, 1563, 1563, 1563,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0, 1563,
-     1563, 1563, 1563, 1563, 1563, 1565, 1565, 1565, 1565, 1565,
-     1565, 1565,    0,    0,    0, 1565, 1565, 1565, 1565, 1565,
-
-     1565,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0, 1565, 1565, 1565, 1565, 1565, 1565,
-     1567, 1567, 1567, 1567, 1567, 1567, 1567,    0,    0,    0,
-     1567, 1567, 1567, 1567, 1567, 1567,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0, 1567,
-     1567, 1567, 1567, 1567, 1567, 1569, 1569, 1569, 1569, 1569,
-     1569, 1569,    0,    0,    0, 1569, 1569, 1569, 1569, 1569,
-     1569,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0, 1569, 1569, 1569, 1569, 1569, 1569,
-     1571, 1571, 1571, 1571, 1571, 1571, 1571,    0,    0,    0,
-     1571, 1571, 1571, 1571, 1571, 1571,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0, 1571,
-     1571, 1571, 1571, 1571, 1571, 1573, 1573, 1573, 1573, 1573,
-     1573, 1573,    0,    0,    0, 1573, 1573, 1573, 1573, 1573,
-     1573,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-
-        0,    0,    0,    0, 1573, 1573, 1573, 1573, 1573, 1573,
-     1575, 1575, 1575, 1575, 1575, 1575, 1575,    0,    0,    0,
-     1575, 1575, 1575, 1575, 1575, 1575,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0, 1575,
-     1575, 1575, 1575, 1575, 1575, 1577, 1577, 1577, 1577, 1577,
-     1577, 1577,    0,    0,    0, 1577, 1577, 1577, 1577, 1577,
-     1577,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0, 1577, 1577, 1577, 1577, 1577, 1577,
-
-     1579, 1579, 1579, 1579, 1579, 1579, 1579,    0,    0,    0,
-     1579, 1579, 1579, 1579, 1579, 1579,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0, 1579,
-     1579, 1579, 1579, 1579, 1579, 1581, 1581, 1581, 1581, 1581,
-     1581, 1581,    0,    0,    0, 1581, 1581, 1581, 1581, 1581,
-     1581,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0, 1581, 1581, 1581, 1581, 1581, 1581,
-     1583, 1583, 1583, 1583, 1583, 1583, 1583,    0,    0,    0,
-
-     1583, 1583, 1583, 1583, 1583, 1583,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0, 1583,
-     1583, 1583, 1583, 1583, 1583, 1585, 1585, 1585, 1585, 1585,
-     1585, 1585,    0,    0,    0, 1585, 1585, 1585, 1585, 1585,
-     1585,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0, 1585, 1585, 1585, 1585, 1585, 1585,
-     1587, 1587, 1587, 1587, 1587, 1587, 1587,    0,    0,    0,
-     1587, 1587, 1587, 1587, 1587, 1587,    0,    0,    0,    0,
-
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0, 1587,
-     1587, 1587, 1587, 1587, 1587, 1589, 1589, 1589, 1589, 1589,
-     1589, 1589,    0,    0,    0, 1589, 1589, 1589, 1589, 1589,
-     1589,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0, 1589, 1589, 1589, 1589, 1589, 1589,
-     1591, 1591, 1591, 1591, 1591, 1591, 1591,    0,    0,    0,
-     1591, 1591, 1591, 1591, 1591, 1591,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-
-        0,    0,    0,    0,    0,    0,    0,    0,    0, 1591,
-     1591, 1591, 1591, 1591, 1591, 1593, 1593, 1593, 1593, 1593,
-     1593, 1593,    0,    0,    0, 1593, 1593, 1593, 1593, 1593,
-     1593,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0, 1593, 1593, 1593, 1593, 1593, 1593,
-     1595, 1595, 1595, 1595, 1595, 1595, 1595,    0,    0,    0,
-     1595, 1595, 1595, 1595, 1595, 1595,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0, 1595,
-
-     1595, 1595, 1595, 1595, 1595, 1597, 1597, 1597, 1597, 1597,
-     1597, 1597,    0,    0,    0, 1597, 1597, 1597, 1597, 1597,
-     1597,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0, 1597, 1597, 1597, 1597, 1597, 1597,
-     1599, 1599, 1599, 1599, 1599, 1599, 1599,    0,    0,    0,
-     1599, 1599, 1599, 1599, 1599, 1599,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0, 1599,
-     1599, 1599, 1599, 1599, 1599, 1601, 1601, 1601, 1601, 1601,
-
-     1601, 1601,    0,    0,    0, 1601, 1601, 1601, 1601, 1601,
-     1601,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0, 1601, 1601, 1601, 1601, 1601, 1601,
-     1603, 1603, 1603, 1603, 1603, 1603, 1603,    0,    0,    0,
-     1603, 1603, 1603, 1603, 1603, 1603,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0, 1603,
-     1603, 1603, 1603, 1603, 1603, 1605, 1605, 1605, 1605, 1605,
-     1605, 1605,    0,    0,    0, 1605, 1605, 1605, 1605, 1605,
-
-     1605,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0, 1605, 1605, 1605, 1605, 1605, 1605,
-     1607, 1607, 1607, 1607, 1607, 1607, 1607,    0,    0,    0,
-     1607, 1607, 1607, 1607, 1607, 1607,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0, 1607,
-     1607, 1607, 1607, 1607, 1607, 1609, 1609, 1609, 1609, 1609,
-     1609, 1609,    0,    0,    0, 1609, 1609, 1609, 1609, 1609,
-     1609,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0, 1609, 1609, 1609, 1609, 1609, 1609,
-     1611, 1611, 1611, 1611, 1611, 1611, 1611,    0,    0,    0,
-     1611, 1611, 1611, 1611, 1611, 1611,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0, 1611,
-     1611, 1611, 1611, 1611, 1611, 1613, 1613, 1613, 1613, 1613,
-     1613, 1613,    0,    0,    0, 1613, 1613, 1613, 1613, 1613,
-     1613,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-
-        0,    0,    0,    0, 1613, 1613, 1613, 1613, 1613, 1613,
-     1615, 1615, 1615, 1615, 1615, 1615, 1615,    0,    0,    0,
-     1615, 1615, 1615, 1615, 1615, 1615,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0, 1615,
-     1615, 1615, 1615, 1615, 1615, 1617, 1617, 1617, 1617, 1617,
-     1617, 1617,    0,    0,    0, 1617, 1617, 1617, 1617, 1617,
-     1617,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0, 1617, 1617, 1617, 1617, 1617, 1617,
-
-     1619, 1619, 1619, 1619, 1619, 1619, 1619,    0,    0,    0,
-     1619, 1619, 1619, 1619, 1619, 1619,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0, 1619,
-     1619, 1619, 1619, 1619, 1619, 1621, 1621, 1621, 1621, 1621,
-     1621, 1621,    0,    0,    0, 1621, 1621, 1621, 1621, 1621,
-     1621,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0, 1621, 1621, 1621, 1621, 1621, 1621,
-     1623, 1623, 1623, 1623, 1623, 1623, 1623,    0,    0,    0,
-
-     1623, 1623, 1623, 1623, 1623, 1623,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0, 1623,
-     1623, 1623, 1623, 1623, 1623, 1625, 1625, 1625, 1625, 1625,
-     1625, 1625,    0,    0,    0, 1625, 1625, 1625, 1625, 1625,
-     1625,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0, 1625, 1625, 1625, 1625, 1625, 1625,
-     1627, 1627, 1627, 1627, 1627, 1627, 1627,    0,    0,    0,
-     1627, 1627, 1627, 1627, 1627, 1627,    0,    0,    0,    0,
-
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0, 1627,
-     1627, 1627, 1627, 1627, 1627, 1629, 1629, 1629, 1629, 1629,
-     1629, 1629,    0,    0,    0, 1629, 1629, 1629, 1629, 1629,
-     1629,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0, 1629, 1629, 1629, 1629, 1629, 1629,
-     1631, 1631, 1631, 1631, 1631, 1631, 1631,    0,    0,    0,
-     1631, 1631, 1631, 1631, 1631, 1631,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-
-        0,    0,    0,    0,    0,    0,    0,    0,    0, 1631,
-     1631, 1631, 1631, 1631, 1631, 1633, 1633, 1633, 1633, 1633,
-     1633, 1633,    0,    0,    0, 1633, 1633, 1633, 1633, 1633,
-     1633,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0, 1633, 1633, 1633, 1633, 1633, 1633,
-     1635, 1635, 1635, 1635, 1635, 1635, 1635,    0,    0,    0,
-     1635, 1635, 1635, 1635, 1635, 1635,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0, 1635,
-
-     1635, 1635, 1635, 1635, 1635, 1637, 1637, 1637, 1637, 1637,
-     1637, 1637,    0,    0,    0, 1637, 1637, 1637, 1637, 1637,
-     1637,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0, 1637, 1637, 1637, 1637, 1637, 1637,
-     1639, 1639, 1639, 1639, 1639, 1639, 1639,    0,    0,    0,
-     1639, 1639, 1639, 1639, 1639, 1639,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0, 1639,
-     1639, 1639, 1639, 1639, 1639, 1641, 1641, 1641, 1641, 1641,
-
-     1641, 1641,    0,    0,    0, 1641, 1641, 1641, 1641, 1641,
-     1641,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0, 1641, 1641, 1641, 1641, 1641, 1641,
-     1643, 1643, 1643, 1643, 1643, 1643, 1643,    0,    0,    0,
-     1643, 1643, 1643, 1643, 1643, 1643,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0, 1643,
-     1643, 1643, 1643, 1643, 1643, 1645, 1645, 1645, 1645, 1645,
-     1645, 1645,    0,    0,    0, 1645, 1645, 1645, 1645, 1645,
-
-     1645,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0, 1645, 1645, 1645, 1645, 1645, 1645,
-     1647, 1647, 1647, 1647, 1647, 1647, 1647,    0,    0,    0,
-     1647, 1647, 1647, 1647, 1647, 1647,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0, 1647,
-     1647, 1647, 1647, 1647, 1647, 1649, 1649, 1649, 1649, 1649,
-     1649, 1649,    0,    0,    0, 1649, 1649, 1649, 1649, 1649,
-     1649,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0, 1649, 1649, 1649, 1649, 1649, 1649,
-     1651, 1651, 1651, 1651, 1651, 1651, 1651,    0,    0,    0,
-     1651, 1651, 1651, 1651, 1651, 1651,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0, 1651,
-     1651, 1651, 1651, 1651, 1651, 1653, 1653, 1653, 1653, 1653,
-     1653, 1653,    0,    0,    0, 1653, 1653, 1653, 1653, 1653,
-     1653,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-
-        0,    0,    0,    0, 1653, 1653, 1653, 1653, 1653, 1653,
-     1655, 1655, 1655, 1655, 1655, 1655, 1655,    0,    0,    0,
-     1655, 1655, 1655, 1655, 1655, 1655,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0, 1655,
-     1655, 1655, 1655, 1655, 1655, 1657, 1657, 1657, 1657, 1657,
-     1657, 1657,    0,    0,    0, 1657, 1657, 1657, 1657, 1657,
-     1657,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0, 1657, 1657, 1657, 1657, 1657, 1657,
-
-     1659, 1659, 1659, 1659, 1659, 1659, 1659,    0,    0,    0,
-     1659, 1659, 1659, 1659, 1659, 1659,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0, 1659,
-     1659, 1659, 1659, 1659, 1659, 1661, 1661, 1661, 1661, 1661,
-     1661, 1661,    0,    0,    0, 1661, 1661, 1661, 1661, 1661,
-     1661,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0, 1661, 1661, 1661, 1661, 1661, 1661,
-     1663, 1663, 1663, 1663, 1663, 1663, 1663,    0,    0,    0,
-
-     1663, 1663, 1663, 1663, 1663, 1663,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0, 1663,
-     1663, 1663, 1663, 1663, 1663, 1665, 1665, 1665, 1665, 1665,
-     1665, 1665,    0,    0,    0, 1665, 1665, 1665, 1665, 1665,
-     1665,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0, 1665, 1665, 1665, 1665, 1665, 1665,
-     1667, 1667, 1667, 1667, 1667, 1667, 1667,    0,    0,    0,
-     1667, 1667, 1667, 1667, 1667, 1667,    0,    0,    0,    0,
-
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0, 1667,
-     1667, 1667, 1667, 1667, 1667, 1671, 1671, 1671, 1671, 1671,
-     1671, 1671,    0,    0,    0, 1671, 1671, 1671, 1671, 1671,
-     1671,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0, 1671, 1671, 1671, 1671, 1671, 1671,
-     1676, 1676, 1676, 1676, 1676, 1676, 1676, 1677, 1677, 1677,
-     1677, 1677, 1677, 1677, 1678,    0, 1678, 1678, 1678, 1678,
-     1678, 1679, 1679, 1680,    0, 1680, 1680, 1680, 1680, 1680,
-
-     1681,    0, 1681, 1681, 1681, 1681, 1681, 1682, 1682, 1682,
-     1682, 1683, 1683, 1684, 1684, 1684, 1684, 1685,    0, 1685,
-     1685, 1685, 1685, 1685, 1686,    0,    0, 1686, 1686, 1687,
-     1687, 1688, 1688, 1689, 1689, 1690, 1690, 1691, 1691, 1692,
-     1692, 1693, 1693, 1694, 1694, 1695, 1695, 1696, 1696, 1697,
-     1697, 1698, 1698, 1699, 1699, 1700, 1700, 1701, 1701, 1702,
-     1702, 1703, 1703, 1704, 1704, 1705, 1705, 1706, 1706, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
-     1675, 1675, 1675
-    } ;
-
-/* Table of booleans, true if rule could match eol. */
-static yyconst flex_int32_t yy_rule_can_match_eol[38] =
-    {   0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0,     };
-
-static yy_state_type yy_last_accepting_state;
-static char *yy_last_accepting_cpos;
-
-extern int yy_flex_debug;
-int yy_flex_debug = 0;
-
-/* The intent behind this definition is that it'll catch
- * any uses of REJECT which flex missed.
- */
-#define REJECT reject_used_but_not_detected
-#define yymore() yymore_used_but_not_detected
-#define YY_MORE_ADJ 0
-#define YY_RESTORE_YY_MORE_OFFSET
-char *yytext;
-#line 1 "tokens.l"
-/* Scanner */
-#line 4 "tokens.l"
-
- #include "fonulator.h"
-
-int yylval;
-
-
-#line 7079 "tokens.c"
-
-#define INITIAL 0
-#define KEY_ENTRY 1
-
-#ifndef YY_NO_UNISTD_H
-/* Special case for "unistd.h", since it is non-ANSI. We include it way
- * down here because we want the user's section 1 to have been scanned first.
- * The user has a chance to override it with an option.
- */
-#include <unistd.h>
-#endif
-
-#ifndef YY_EXTRA_TYPE
-#define YY_EXTRA_TYPE void *
-#endif
-
-static int yy_init_globals (void );
-
-/* Accessor methods to globals.
-   These are made visible to non-reentrant scanners for convenience. */
-
-int yylex_destroy (void );
-
-int yyget_debug (void );
-
-void yyset_debug (int debug_flag  );
-
-YY_EXTRA_TYPE yyget_extra (void );
-
-void yyset_extra (YY_EXTRA_TYPE user_defined  );
-
-FILE *yyget_in (void );
-
-void yyset_in  (FILE * in_str  );
-
-FILE *yyget_out (void );
-
-void yyset_out  (FILE * out_str  );
-
-int yyget_leng (void );
-
-char *yyget_text (void );
-
-int yyget_lineno (void );
-
-void yyset_lineno (int line_number  );
-
-/* Macros after this point can all be overridden by user definitions in
- * section 1.
- */
-
-#ifndef YY_SKIP_YYWRAP
-#ifdef __cplusplus
-extern "C" int yywrap (void );
-#else
-extern int yywrap (void );
-#endif
-#endif
-
-#ifndef yytext_ptr
-static void yy_flex_strncpy (char *,yyconst char *,int );
-#endif
-
-#ifdef YY_NEED_STRLEN
-static int yy_flex_strlen (yyconst char * );
-#endif
-
-#ifndef YY_NO_INPUT
-
-#ifdef __cplusplus
-static int yyinput (void );
-#else
-static int input (void );
-#endif
-
-#endif
-
-/* Amount of stuff to slurp up with each read. */
-#ifndef YY_READ_BUF_SIZE
-#define YY_READ_BUF_SIZE 8192
-#endif
-
-/* Copy whatever the last rule matched to the standard output. */
-#ifndef ECHO
-/* This used to be an fputs(), but since the string might contain NUL's,
- * we now use fwrite().
- */
-#define ECHO fwrite( yytext, yyleng, 1, yyout )
-#endif
-
-/* Gets input and stuffs it into "buf".  number of characters read, or YY_NULL,
- * is returned in "result".
- */
-#ifndef YY_INPUT
-#define YY_INPUT(buf,result,max_size) \
-	if ( YY_CURRENT_BUFFER_LVALUE->yy_is_interactive ) \
-		{ \
-		int c = '*'; \
-		int n; \
-		for ( n = 0; n < max_size && \
-			     (c = getc( yyin )) != EOF && c != '\n'; ++n ) \
-			buf[n] = (char) c; \
-		if ( c == '\n' ) \
-			buf[n++] = (char) c; \
-		if ( c == EOF && ferror( yyin ) ) \
-			YY_FATAL_ERROR( "input in flex scanner failed" ); \
-		result = n; \
-		} \
-	else \
-		{ \
-		errno=0; \
-		while ( (result = fread(buf, 1, max_size, yyin))==0 && ferror(yyin)) \
-			{ \
-			if( errno != EINTR) \
-				{ \
-				YY_FATAL_ERROR( "input in flex scanner failed" ); \
-				break; \
-				} \
-			errno=0; \
-			clearerr(yyin); \
-			} \
-		}\
-\
-
-#endif
-
-/* No semi-colon after return; correct usage is to write "yyterminate();" -
- * we don't want an extra ';' after the "return" because that will cause
- * some compilers to complain about unreachable statements.
- */
-#ifndef yyterminate
-#define yyterminate() return YY_NULL
-#endif
-
-/* Number of entries by which start-condition stack grows. */
-#ifndef YY_START_STACK_INCR
-#define YY_START_STACK_INCR 25
-#endif
-
-/* Report a fatal error. */
-#ifndef YY_FATAL_ERROR
-#define YY_FATAL_ERROR(msg) yy_fatal_error( msg )
-#endif
-
-/* end tables serialization structures and prototypes */
-
-/* Default declaration of generated scanner - a define so the user can
- * easily add parameters.
- */
-#ifndef YY_DECL
-#define YY_DECL_IS_OURS 1
-
-extern int yylex (void);
-
-#define YY_DECL int yylex (void)
-#endif /* !YY_DECL */
-
-/* Code executed at the beginning of each rule, after yytext and yyleng
- * have been set up.
- */
-#ifndef YY_USER_ACTION
-#define YY_USER_ACTION
-#endif
-
-/* Code executed at the end of each rule. */
-#ifndef YY_BREAK
-#define YY_BREAK break;
-#endif
-
-#define YY_RULE_SETUP \
-	if ( yyleng > 0 ) \
-		YY_CURRENT_BUFFER_LVALUE->yy_at_bol = \
-				(yytext[yyleng - 1] == '\n'); \
-	YY_USER_ACTION
-
-/** The main scanner function which does all the work.
- */
-YY_DECL
-{
-	register yy_state_type yy_current_state;
-	register char *yy_cp, *yy_bp;
-	register int yy_act;
-    
-#line 26 "tokens.l"
-
-
-#line 7266 "tokens.c"
-
-	if ( !(yy_init) )
-		{
-		(yy_init) = 1;
-
-#ifdef YY_USER_INIT
-		YY_USER_INIT;
-#endif
-
-		if ( ! (yy_start) )
-			(yy_start) = 1;	/* first start state */
-
-		if ( ! yyin )
-			yyin = stdin;
-
-		if ( ! yyout )
-			yyout = stdout;
-
-		if ( ! YY_CURRENT_BUFFER ) {
-			yyensure_buffer_stack ();
-			YY_CURRENT_BUFFER_LVALUE =
-				yy_create_buffer(yyin,YY_BUF_SIZE );
-		}
-
-		yy_load_buffer_state( );
-		}
-
-	while ( 1 )		/* loops until end-of-file is reached */
-		{
-		yy_cp = (yy_c_buf_p);
-
-		/* Support of yytext. */
-		*yy_cp = (yy_hold_char);
-
-		/* yy_bp points to the position in yy_ch_buf of the start of
-		 * the current run.
-		 */
-		yy_bp = yy_cp;
-
-		yy_current_state = (yy_start);
-		yy_current_state += YY_AT_BOL();
-yy_match:
-		do
-			{
-			register YY_CHAR yy_c = yy_ec[YY_SC_TO_UI(*yy_cp)];
-			if ( yy_accept[yy_current_state] )
-				{
-				(yy_last_accepting_state) = yy_current_state;
-				(yy_last_accepting_cpos) = yy_cp;
-				}
-			while ( yy_chk[yy_base[yy_current_state] + yy_c] != yy_current_state )
-				{
-				yy_current_state = (int) yy_def[yy_current_state];
-				if ( yy_current_state >= 1676 )
-					yy_c = yy_meta[(unsigned int) yy_c];
-				}
-			yy_current_state = yy_nxt[yy_base[yy_current_state] + (unsigned int) yy_c];
-			++yy_cp;
-			}
-		while ( yy_base[yy_current_state] != 27370 );
-
-yy_find_action:
-		yy_act = yy_accept[yy_current_state];
-		if ( yy_act == 0 )
-			{ /* have to back up */
-			yy_cp = (yy_last_accepting_cpos);
-			yy_current_state = (yy_last_accepting_state);
-			yy_act = yy_accept[yy_current_state];
-			}
-
-		YY_DO_BEFORE_ACTION;
-
-		if ( yy_act != YY_END_OF_BUFFER && yy_rule_can_match_eol[yy_act] )
-			{
-			int yyl;
-			for ( yyl = 0; yyl < yyleng; ++yyl )
-				if ( yytext[yyl] == '\n' )
-					   
-    yylineno++;
-;
-			}
-
-do_action:	/* This label is used only to access EOF actions. */
-
-		switch ( yy_act )
-	{ /* beginning of action switch */
-			case 0: /* must back up */
-			/* undo the effects of YY_DO_BEFORE_ACTION */
-			*yy_cp = (yy_hold_char);
-			yy_cp = (yy_last_accepting_cpos);
-			yy_current_state = (yy_last_accepting_state);
-			goto yy_find_action;
-
-case 1:
-YY_RULE_SETUP
-#line 28 "tokens.l"
-{ /* Do nothing on comment */ } 
-	YY_BREAK
-case 2:
-*yy_cp = (yy_hold_char); /* undo effects of setting up yytext */
-(yy_c_buf_p) = yy_cp -= 1;
-YY_DO_BEFORE_ACTION; /* set up yytext again */
-YY_RULE_SETUP
-#line 30 "tokens.l"
-return TOK_GLOBALS;
-	YY_BREAK
-case 3:
-*yy_cp = (yy_hold_char); /* undo effects of setting up yytext */
-(yy_c_buf_p) = yy_cp -= 1;
-YY_DO_BEFORE_ACTION; /* set up yytext again */
-YY_RULE_SETUP
-#line 32 "tokens.l"
-{ 
-			   yylval = atoi(&yytext[5]);
-			   return TOK_SPAN;
-			}
-	YY_BREAK
-case 4:
-YY_RULE_SETUP
-#line 37 "tokens.l"
-{ yytext += 11; return TOK_PRIO; }
-	YY_BREAK
-case 5:
-*yy_cp = (yy_hold_char); /* undo effects of setting up yytext */
-(yy_c_buf_p) = yy_cp -= 1;
-YY_DO_BEFORE_ACTION; /* set up yytext again */
-YY_RULE_SETUP
-#line 39 "tokens.l"
-return TOK_WPLLOFF;
-	YY_BREAK
-case 6:
-*yy_cp = (yy_hold_char); /* undo effects of setting up yytext */
-(yy_c_buf_p) = yy_cp -= 1;
-YY_DO_BEFORE_ACTION; /* set up yytext again */
-YY_RULE_SETUP
-#line 41 "tokens.l"
-{
-                          yylval = atoi(&yytext[5]);
-                          return TOK_PORT;
-                        }
-	YY_BREAK
-case 7:
-*yy_cp = (yy_hold_char); /* undo effects of setting up yytext */
-(yy_c_buf_p) = yy_cp -= 1;
-YY_DO_BEFORE_ACTION; /* set up yytext again */
-YY_RULE_SETUP
-#line 46 "tokens.l"
-{
-                          yytext += 3;
-                          return TOK_FB_CONFIG;
-			}
-	YY_BREAK
-case 8:
-*yy_cp = (yy_hold_char); /* undo effects of setting up yytext */
-(yy_c_buf_p) = yy_cp -= 1;
-YY_DO_BEFORE_ACTION; /* set up yytext again */
-YY_RULE_SETUP
-#line 51 "tokens.l"
-{ /* Do nothing, deprecated */ }
-	YY_BREAK
-case 9:
-*yy_cp = (yy_hold_char); /* undo effects of setting up yytext */
-(yy_c_buf_p) = yy_cp -= 1;
-YY_DO_BEFORE_ACTION; /* set up yytext again */
-YY_RULE_SETUP
-#line 53 "tokens.l"
-{
-                                   yytext += 8;
-                                   return TOK_FRAMING;
-                                }
-	YY_BREAK
-case 10:
-*yy_cp = (yy_hold_char); /* undo effects of setting up yytext */
-(yy_c_buf_p) = yy_cp -= 1;
-YY_DO_BEFORE_ACTION; /* set up yytext again */
-YY_RULE_SETUP
-#line 58 "tokens.l"
-{
-                                      yytext += 9;
-                                      return TOK_ENCODING;
-                                    }
-	YY_BREAK
-case 11:
-*yy_cp = (yy_hold_char); /* undo effects of setting up yytext */
-(yy_c_buf_p) = yy_cp -= 1;
-YY_DO_BEFORE_ACTION; /* set up yytext again */
-YY_RULE_SETUP
-#line 63 "tokens.l"
-{
-                          yytext += 7;
-			  return TOK_SERVER_CONFIG;
-			}
-	YY_BREAK
-case 12:
-YY_RULE_SETUP
-#line 68 "tokens.l"
-{
-                                  yytext += 4;
-                                  if (!strcmp(yytext, "ulaw"))
-				    return TOK_ULAW;
-				  else if (!strcmp(yytext, "alaw"))
-				    return TOK_ALAW;
-				  else if (!strcmp(yytext, "off"))
-				    return TOK_DSP_OFF;
-                               }
-	YY_BREAK
-case 13:
-*yy_cp = (yy_hold_char); /* undo effects of setting up yytext */
-(yy_c_buf_p) = yy_cp -= 1;
-YY_DO_BEFORE_ACTION; /* set up yytext again */
-YY_RULE_SETUP
-#line 78 "tokens.l"
-return TOK_MAC;
-	YY_BREAK
-case 14:
-*yy_cp = (yy_hold_char); /* undo effects of setting up yytext */
-(yy_c_buf_p) = yy_cp -= 1;
-YY_DO_BEFORE_ACTION; /* set up yytext again */
-YY_RULE_SETUP
-#line 79 "tokens.l"
-return TOK_IP;
-	YY_BREAK
-case 15:
-*yy_cp = (yy_hold_char); /* undo effects of setting up yytext */
-(yy_c_buf_p) = yy_cp -= 1;
-YY_DO_BEFORE_ACTION; /* set up yytext again */
-YY_RULE_SETUP
-#line 81 "tokens.l"
-return TOK_J1;
-	YY_BREAK
-case 16:
-*yy_cp = (yy_hold_char); /* undo effects of setting up yytext */
-(yy_c_buf_p) = yy_cp -= 1;
-YY_DO_BEFORE_ACTION; /* set up yytext again */
-YY_RULE_SETUP
-#line 83 "tokens.l"
-return TOK_CRCMF;
-	YY_BREAK
-case 17:
-*yy_cp = (yy_hold_char); /* undo effects of setting up yytext */
-(yy_c_buf_p) = yy_cp -= 1;
-YY_DO_BEFORE_ACTION; /* set up yytext again */
-YY_RULE_SETUP
-#line 85 "tokens.l"
-return TOK_RBS;
-	YY_BREAK
-case 18:
-*yy_cp = (yy_hold_char); /* undo effects of setting up yytext */
-(yy_c_buf_p) = yy_cp -= 1;
-YY_DO_BEFORE_ACTION; /* set up yytext again */
-YY_RULE_SETUP
-#line 87 "tokens.l"
-return TOK_LOOPBACK;
-	YY_BREAK
-case 19:
-*yy_cp = (yy_hold_char); /* undo effects of setting up yytext */
-(yy_c_buf_p) = yy_cp -= 1;
-YY_DO_BEFORE_ACTION; /* set up yytext again */
-YY_RULE_SETUP
-#line 89 "tokens.l"
-return TOK_SLAVE;
-	YY_BREAK
-case 20:
-*yy_cp = (yy_hold_char); /* undo effects of setting up yytext */
-(yy_c_buf_p) = yy_cp -= 1;
-YY_DO_BEFORE_ACTION; /* set up yytext again */
-YY_RULE_SETUP
-#line 90 "tokens.l"
-{ /* Do nothing for master, it is default */ }
-	YY_BREAK
-case 21:
-*yy_cp = (yy_hold_char); /* undo effects of setting up yytext */
-(yy_c_buf_p) = yy_cp -= 1;
-YY_DO_BEFORE_ACTION; /* set up yytext again */
-YY_RULE_SETUP
-#line 92 "tokens.l"
-{ yylval = atoi(yytext+9); return TOK_LONGHAUL; }
-	YY_BREAK
-case 22:
-*yy_cp = (yy_hold_char); /* undo effects of setting up yytext */
-(yy_c_buf_p) = yy_cp -= 1;
-YY_DO_BEFORE_ACTION; /* set up yytext again */
-YY_RULE_SETUP
-#line 94 "tokens.l"
-{ yylval = atoi(yytext+10); return TOK_SHORTHAUL; }
-	YY_BREAK
-case 23:
-*yy_cp = (yy_hold_char); /* undo effects of setting up yytext */
-(yy_c_buf_p) = yy_cp -= 1;
-YY_DO_BEFORE_ACTION; /* set up yytext again */
-YY_RULE_SETUP
-#line 96 "tokens.l"
-return TOK_DEJITTER;
-	YY_BREAK
-case 24:
-*yy_cp = (yy_hold_char); /* undo effects of setting up yytext */
-(yy_c_buf_p) = yy_cp -= 1;
-YY_DO_BEFORE_ACTION; /* set up yytext again */
-YY_RULE_SETUP
-#line 98 "tokens.l"
-return TOK_DSP_HEADER;
-	YY_BREAK
-case 25:
-YY_RULE_SETUP
-#line 99 "tokens.l"
-return TOK_VOICEA;
-	YY_BREAK
-case 26:
-YY_RULE_SETUP
-#line 100 "tokens.l"
-return TOK_VOICEB;
-	YY_BREAK
-case 27:
-YY_RULE_SETUP
-#line 101 "tokens.l"
-return TOK_DATA;
-	YY_BREAK
-case 28:
-*yy_cp = (yy_hold_char); /* undo effects of setting up yytext */
-(yy_c_buf_p) = yy_cp -= 1;
-YY_DO_BEFORE_ACTION; /* set up yytext again */
-YY_RULE_SETUP
-#line 102 "tokens.l"
-return TOK_DSP_DISABLED;
-	YY_BREAK
-case 29:
-*yy_cp = (yy_hold_char); /* undo effects of setting up yytext */
-(yy_c_buf_p) = yy_cp -= 1;
-YY_DO_BEFORE_ACTION; /* set up yytext again */
-YY_RULE_SETUP
-#line 103 "tokens.l"
-return TOK_RANGE;
-	YY_BREAK
-case 30:
-*yy_cp = (yy_hold_char); /* undo effects of setting up yytext */
-(yy_c_buf_p) = yy_cp -= 1;
-YY_DO_BEFORE_ACTION; /* set up yytext again */
-YY_RULE_SETUP
-#line 104 "tokens.l"
-{ yylval = atoi(yytext); return TOK_DIGIT; }
-	YY_BREAK
-case 31:
-YY_RULE_SETUP
-#line 105 "tokens.l"
-{ BEGIN(KEY_ENTRY); return TOK_BEGIN_KEY; }
-	YY_BREAK
-case 32:
-YY_RULE_SETUP
-#line 106 "tokens.l"
-{
-                                                  char *ptr;
-                                                  ptr = strstr(yytext, "0x");
-                                                  if (ptr != NULL)
-                                                    yytext = ptr;
-
-                                                  BEGIN(KEY_ENTRY);
-                                                  return TOK_SLOT_ID;
-                                              }
-	YY_BREAK
-case 33:
-YY_RULE_SETUP
-#line 115 "tokens.l"
-{
-                                                  char *ptr;
-                                                  ptr = strstr(yytext, "0x");
-                                                  if (ptr != NULL)
-                                                    yytext = ptr;
-
-                                                  BEGIN(KEY_ENTRY);
-                                                  return TOK_CUSTOMER_KEY;
-                                              }
-	YY_BREAK
-case 34:
-YY_RULE_SETUP
-#line 124 "tokens.l"
-{ BEGIN(INITIAL);  return TOK_END_KEY; }
-	YY_BREAK
-case 35:
-/* rule 35 can match eol */
-YY_RULE_SETUP
-#line 126 "tokens.l"
-{/* white space */}
-	YY_BREAK
-case 36:
-YY_RULE_SETUP
-#line 127 "tokens.l"
-return TOK_UNKNOWN;
-	YY_BREAK
-case 37:
-YY_RULE_SETUP
-#line 129 "tokens.l"
-ECHO;
-	YY_BREAK
-#line 7660 "tokens.c"
-case YY_STATE_EOF(INITIAL):
-case YY_STATE_EOF(KEY_ENTRY):
-	yyterminate();
-
-	case YY_END_OF_BUFFER:
-		{
-		/* Amount of text matched not including the EOB char. */
-		int yy_amount_of_matched_text = (int) (yy_cp - (yytext_ptr)) - 1;
-
-		/* Undo the effects of YY_DO_BEFORE_ACTION. */
-		*yy_cp = (yy_hold_char);
-		YY_RESTORE_YY_MORE_OFFSET
-
-		if ( YY_CURRENT_BUFFER_LVALUE->yy_buffer_status == YY_BUFFER_NEW )
-			{
-			/* We're scanning a new file or input source.  It's
-			 * possible that this happened because the user
-			 * just pointed yyin at a new source and called
-			 * yylex().  If so, then we have to assure
-			 * consistency between YY_CURRENT_BUFFER and our
-			 * globals.  Here is the right place to do so, because
-			 * this is the first action (other than possibly a
-			 * back-up) that will match for the new input source.
-			 */
-			(yy_n_chars) = YY_CURRENT_BUFFER_LVALUE->yy_n_chars;
-			YY_CURRENT_BUFFER_LVALUE->yy_input_file = yyin;
-			YY_CURRENT_BUFFER_LVALUE->yy_buffer_status = YY_BUFFER_NORMAL;
-			}
-
-		/* Note that here we test for yy_c_buf_p "<=" to the position
-		 * of the first EOB in the buffer, since yy_c_buf_p will
-		 * already have been incremented past the NUL character
-		 * (since all states make transitions on EOB to the
-		 * end-of-buffer state).  Contrast this with the test
-		 * in input().
-		 */
-		if ( (yy_c_buf_p) <= &YY_CURRENT_BUFFER_LVALUE->yy_ch_buf[(yy_n_chars)] )
-			{ /* This was really a NUL. */
-			yy_state_type yy_next_state;
-
-			(yy_c_buf_p) = (yytext_ptr) + yy_amount_of_matched_text;
-
-			yy_current_state = yy_get_previous_state(  );
-
-			/* Okay, we're now positioned to make the NUL
-			 * transition.  We couldn't have
-			 * yy_get_previous_state() go ahead and do it
-			 * for us because it doesn't know how to deal
-			 * with the possibility of jamming (and we don't
-			 * want to build jamming into it because then it
-			 * will run more slowly).
-			 */
-
-			yy_next_state = yy_try_NUL_trans( yy_current_state );
-
-			yy_bp = (yytext_ptr) + YY_MORE_ADJ;
-
-			if ( yy_next_state )
-				{
-				/* Consume the NUL. */
-				yy_cp = ++(yy_c_buf_p);
-				yy_current_state = yy_next_state;
-				goto yy_match;
-				}
-
-			else
-				{
-				yy_cp = (yy_c_buf_p);
-				goto yy_find_action;
-				}
-			}
-
-		else switch ( yy_get_next_buffer(  ) )
-			{
-			case EOB_ACT_END_OF_FILE:
-				{
-				(yy_did_buffer_switch_on_eof) = 0;
-
-				if ( yywrap( ) )
-					{
-					/* Note: because we've taken care in
-					 * yy_get_next_buffer() to have set up
-					 * yytext, we can now set up
-					 * yy_c_buf_p so that if some total
-					 * hoser (like flex itself) wants to
-					 * call the scanner after we return the
-					 * YY_NULL, it'll still work - another
-					 * YY_NULL will get returned.
-					 */
-					(yy_c_buf_p) = (yytext_ptr) + YY_MORE_ADJ;
-
-					yy_act = YY_STATE_EOF(YY_START);
-					goto do_action;
-					}
-
-				else
-					{
-					if ( ! (yy_did_buffer_switch_on_eof) )
-						YY_NEW_FILE;
-					}
-				break;
-				}
-
-			case EOB_ACT_CONTINUE_SCAN:
-				(yy_c_buf_p) =
-					(yytext_ptr) + yy_amount_of_matched_text;
-
-				yy_current_state = yy_get_previous_state(  );
-
-				yy_cp = (yy_c_buf_p);
-				yy_bp = (yytext_ptr) + YY_MORE_ADJ;
-				goto yy_match;
-
-			case EOB_ACT_LAST_MATCH:
-				(yy_c_buf_p) =
-				&YY_CURRENT_BUFFER_LVALUE->yy_ch_buf[(yy_n_chars)];
-
-				yy_current_state = yy_get_previous_state(  );
-
-				yy_cp = (yy_c_buf_p);
-				yy_bp = (yytext_ptr) + YY_MORE_ADJ;
-				goto yy_find_action;
-			}
-		break;
-		}
-
-	default:
-		YY_FATAL_ERROR(
-			"fatal flex scanner internal error--no action found" );
-	} /* end of action switch */
-		} /* end of scanning one token */
-} /* end of yylex */
-
-/* yy_get_next_buffer - try to read in a new buffer
- *
- * Returns a code representing an action:
- *	EOB_ACT_LAST_MATCH -
- *	EOB_ACT_CONTINUE_SCAN - continue scanning from current position
- *	EOB_ACT_END_OF_FILE - end of file
- */
-static int yy_get_next_buffer (void)
-{
-    	register char *dest = YY_CURRENT_BUFFER_LVALUE->yy_ch_buf;
-	register char *source = (yytext_ptr);
-	register int number_to_move, i;
-	int ret_val;
-
-	if ( (yy_c_buf_p) > &YY_CURRENT_BUFFER_LVALUE->yy_ch_buf[(yy_n_chars) + 1] )
-		YY_FATAL_ERROR(
-		"fatal flex scanner internal error--end of buffer missed" );
-
-	if ( YY_CURRENT_BUFFER_LVALUE->yy_fill_buffer == 0 )
-		{ /* Don't try to fill the buffer, so this is an EOF. */
-		if ( (yy_c_buf_p) - (yytext_ptr) - YY_MORE_ADJ == 1 )
-			{
-			/* We matched a single character, the EOB, so
-			 * treat this as a final EOF.
-			 */
-			return EOB_ACT_END_OF_FILE;
-			}
-
-		else
-			{
-			/* We matched some text prior to the EOB, first
-			 * process it.
-			 */
-			return EOB_ACT_LAST_MATCH;
-			}
-		}
-
-	/* Try to read more data. */
-
-	/* First move last chars to start of buffer. */
-	number_to_move = (int) ((yy_c_buf_p) - (yytext_ptr)) - 1;
-
-	for ( i = 0; i < number_to_move; ++i )
-		*(dest++) = *(source++);
-
-	if ( YY_CURRENT_BUFFER_LVALUE->yy_buffer_status == YY_BUFFER_EOF_PENDING )
-		/* don't do the read, it's not guaranteed to return an EOF,
-		 * just force an EOF
-		 */
-		YY_CURRENT_BUFFER_LVALUE->yy_n_chars = (yy_n_chars) = 0;
-
-	else
-		{
-			int num_to_read =
-			YY_CURRENT_BUFFER_LVALUE->yy_buf_size - number_to_move - 1;
-
-		while ( num_to_read <= 0 )
-			{ /* Not enough room in the buffer - grow it. */
-
-			/* just a shorter name for the current buffer */
-			YY_BUFFER_STATE b = YY_CURRENT_BUFFER;
-
-			int yy_c_buf_p_offset =
-				(int) ((yy_c_buf_p) - b->yy_ch_buf);
-
-			if ( b->yy_is_our_buffer )
-				{
-				int new_size = b->yy_buf_size * 2;
-
-				if ( new_size <= 0 )
-					b->yy_buf_size += b->yy_buf_size / 8;
-				else
-					b->yy_buf_size *= 2;
-
-				b->yy_ch_buf = (char *)
-					/* Include room in for 2 EOB chars. */
-					yyrealloc((void *) b->yy_ch_buf,b->yy_buf_size + 2  );
-				}
-			else
-				/* Can't grow it, we don't own it. */
-				b->yy_ch_buf = 0;
-
-			if ( ! b->yy_ch_buf )
-				YY_FATAL_ERROR(
-				"fatal error - scanner input buffer overflow" );
-
-			(yy_c_buf_p) = &b->yy_ch_buf[yy_c_buf_p_offset];
-
-			num_to_read = YY_CURRENT_BUFFER_LVALUE->yy_buf_size -
-						number_to_move - 1;
-
-			}
-
-		if ( num_to_read > YY_READ_BUF_SIZE )
-			num_to_read = YY_READ_BUF_SIZE;
-
-		/* Read in more data. */
-		YY_INPUT( (&YY_CURRENT_BUFFER_LVALUE->yy_ch_buf[number_to_move]),
-			(yy_n_chars), (size_t) num_to_read );
-
-		YY_CURRENT_BUFFER_LVALUE->yy_n_chars = (yy_n_chars);
-		}
-
-	if ( (yy_n_chars) == 0 )
-		{
-		if ( number_to_move == YY_MORE_ADJ )
-			{
-			ret_val = EOB_ACT_END_OF_FILE;
-			yyrestart(yyin  );
-			}
-
-		else
-			{
-			ret_val = EOB_ACT_LAST_MATCH;
-			YY_CURRENT_BUFFER_LVALUE->yy_buffer_status =
-				YY_BUFFER_EOF_PENDING;
-			}
-		}
-
-	else
-		ret_val = EOB_ACT_CONTINUE_SCAN;
-
-	if ((yy_size_t) ((yy_n_chars) + number_to_move) > YY_CURRENT_BUFFER_LVALUE->yy_buf_size) {
-		/* Extend the array by 50%, plus the number we really need. */
-		yy_size_t new_size = (yy_n_chars) + number_to_move + ((yy_n_chars) >> 1);
-		YY_CURRENT_BUFFER_LVALUE->yy_ch_buf = (char *) yyrealloc((void *) YY_CURRENT_BUFFER_LVALUE->yy_ch_buf,new_size  );
-		if ( ! YY_CURRENT_BUFFER_LVALUE->yy_ch_buf )
-			YY_FATAL_ERROR( "out of dynamic memory in yy_get_next_buffer()" );
-	}
-
-	(yy_n_chars) += number_to_move;
-	YY_CURRENT_BUFFER_LVALUE->yy_ch_buf[(yy_n_chars)] = YY_END_OF_BUFFER_CHAR;
-	YY_CURRENT_BUFFER_LVALUE->yy_ch_buf[(yy_n_chars) + 1] = YY_END_OF_BUFFER_CHAR;
-
-	(yytext_ptr) = &YY_CURRENT_BUFFER_LVALUE->yy_ch_buf[0];
-
-	return ret_val;
-}
-
-/* yy_get_previous_state - get the state just before the EOB char was reached */
-
-    static yy_state_type yy_get_previous_state (void)
-{
-	register yy_state_type yy_current_state;
-	register char *yy_cp;
-    
-	yy_current_state = (yy_start);
-	yy_current_state += YY_AT_BOL();
-
-	for ( yy_cp = (yytext_ptr) + YY_MORE_ADJ; yy_cp < (yy_c_buf_p); ++yy_cp )
-		{
-		register YY_CHAR yy_c = (*yy_cp ? yy_ec[YY_SC_TO_UI(*yy_cp)] : 1);
-		if ( yy_accept[yy_current_state] )
-			{
-			(yy_last_accepting_state) = yy_current_state;
-			(yy_last_accepting_cpos) = yy_cp;
-			}
-		while ( yy_chk[yy_base[yy_current_state] + yy_c] != yy_current_state )
-			{
-			yy_current_state = (int) yy_def[yy_current_state];
-			if ( yy_current_state >= 1676 )
-				yy_c = yy_meta[(unsigned int) yy_c];
-			}
-		yy_current_state = yy_nxt[yy_base[yy_current_state] + (unsigned int) yy_c];
-		}
-
-	return yy_current_state;
-}
-
-/* yy_try_NUL_trans - try to make a transition on the NUL character
- *
- * synopsis
- *	next_state = yy_try_NUL_trans( current_state );
- */
-    static yy_state_type yy_try_NUL_trans  (yy_state_type yy_current_state )
-{
-	register int yy_is_jam;
-    	register char *yy_cp = (yy_c_buf_p);
-
-	register YY_CHAR yy_c = 1;
-	if ( yy_accept[yy_current_state] )
-		{
-		(yy_last_accepting_state) = yy_current_state;
-		(yy_last_accepting_cpos) = yy_cp;
-		}
-	while ( yy_chk[yy_base[yy_current_state] + yy_c] != yy_current_state )
-		{
-		yy_current_state = (int) yy_def[yy_current_state];
-		if ( yy_current_state >= 1676 )
-			yy_c = yy_meta[(unsigned int) yy_c];
-		}
-	yy_current_state = yy_nxt[yy_base[yy_current_state] + (unsigned int) yy_c];
-	yy_is_jam = (yy_current_state == 1675);
-
-	return yy_is_jam ? 0 : yy_current_state;
-}
-
-#ifndef YY_NO_INPUT
-#ifdef __cplusplus
-    static int yyinput (void)
-#else
-    static int input  (void)
-#endif
-
-{
-	int c;
-    
-	*(yy_c_buf_p) = (yy_hold_char);
-
-	if ( *(yy_c_buf_p) == YY_END_OF_BUFFER_CHAR )
-		{
-		/* yy_c_buf_p now points to the character we want to return.
-		 * If this occurs *before* the EOB characters, then it's a
-		 * valid NUL; if not, then we've hit the end of the buffer.
-		 */
-		if ( (yy_c_buf_p) < &YY_CURRENT_BUFFER_LVALUE->yy_ch_buf[(yy_n_chars)] )
-			/* This was really a NUL. */
-			*(yy_c_buf_p) = '\0';
-
-		else
-			{ /* need more input */
-			int offset = (yy_c_buf_p) - (yytext_ptr);
-			++(yy_c_buf_p);
-
-			switch ( yy_get_next_buffer(  ) )
-				{
-				case EOB_ACT_LAST_MATCH:
-					/* This happens because yy_g_n_b()
-					 * sees that we've accumulated a
-					 * token and flags that we need to
-					 * try matching the token before
-					 * proceeding.  But for input(),
-					 * there's no matching to consider.
-					 * So convert the EOB_ACT_LAST_MATCH
-					 * to EOB_ACT_END_OF_FILE.
-					 */
-
-					/* Reset buffer status. */
-					yyrestart(yyin );
-
-					/*FALLTHROUGH*/
-
-				case EOB_ACT_END_OF_FILE:
-					{
-					if ( yywrap( ) )
-						return EOF;
-
-					if ( ! (yy_did_buffer_switch_on_eof) )
-						YY_NEW_FILE;
-#ifdef __cplusplus
-					return yyinput();
-#else
-					return input();
-#endif
-					}
-
-				case EOB_ACT_CONTINUE_SCAN:
-					(yy_c_buf_p) = (yytext_ptr) + offset;
-					break;
-				}
-			}
-		}
-
-	c = *(unsigned char *) (yy_c_buf_p);	/* cast for 8-bit char's */
-	*(yy_c_buf_p) = '\0';	/* preserve yytext */
-	(yy_hold_char) = *++(yy_c_buf_p);
-
-	YY_CURRENT_BUFFER_LVALUE->yy_at_bol = (c == '\n');
-	if ( YY_CURRENT_BUFFER_LVALUE->yy_at_bol )
-		   
-    yylineno++;
-;
-
-	return c;
-}
-#endif	/* ifndef YY_NO_INPUT */
-
-/** Immediately switch to a different input stream.
- * @param input_file A readable stream.
- * 
- * @note This function does not reset the start condition to @c INITIAL .
- */
-    void yyrestart  (FILE * input_file )
-{
-    
-	if ( ! YY_CURRENT_BUFFER ){
-        yyensure_buffer_stack ();
-		YY_CURRENT_BUFFER_LVALUE =
-            yy_create_buffer(yyin,YY_BUF_SIZE );
-	}
-
-	yy_init_buffer(YY_CURRENT_BUFFER,input_file );
-	yy_load_buffer_state( );
-}
-
-/** Switch to a different input buffer.
- * @param new_buffer The new input buffer.
- * 
- */
-    void yy_switch_to_buffer  (YY_BUFFER_STATE  new_buffer )
-{
-    
-	/* TODO. We should be able to replace this entire function body
-	 * with
-	 *		yypop_buffer_state();
-	 *		yypush_buffer_state(new_buffer);
-     */
-	yyensure_buffer_stack ();
-	if ( YY_CURRENT_BUFFER == new_buffer )
-		return;
-
-	if ( YY_CURRENT_BUFFER )
-		{
-		/* Flush out information for old buffer. */
-		*(yy_c_buf_p) = (yy_hold_char);
-		YY_CURRENT_BUFFER_LVALUE->yy_buf_pos = (yy_c_buf_p);
-		YY_CURRENT_BUFFER_LVALUE->yy_n_chars = (yy_n_chars);
-		}
-
-	YY_CURRENT_BUFFER_LVALUE = new_buffer;
-	yy_load_buffer_state( );
-
-	/* We don't actually know whether we did this switch during
-	 * EOF (yywrap()) processing, but the only time this flag
-	 * is looked at is after yywrap() is called, so it's safe
-	 * to go ahead and always set it.
-	 */
-	(yy_did_buffer_switch_on_eof) = 1;
-}
-
-static void yy_load_buffer_state  (void)
-{
-    	(yy_n_chars) = YY_CURRENT_BUFFER_LVALUE->yy_n_chars;
-	(yytext_ptr) = (yy_c_buf_p) = YY_CURRENT_BUFFER_LVALUE->yy_buf_pos;
-	yyin = YY_CURRENT_BUFFER_LVALUE->yy_input_file;
-	(yy_hold_char) = *(yy_c_buf_p);
-}
-
-/** Allocate and initialize an input buffer state.
- * @param file A readable stream.
- * @param size The character buffer size in bytes. When in doubt, use @c YY_BUF_SIZE.
- * 
- * @return the allocated buffer state.
- */
-    YY_BUFFER_STATE yy_create_buffer  (FILE * file, int  size )
-{
-	YY_BUFFER_STATE b;
-    
-	b = (YY_BUFFER_STATE) yyalloc(sizeof( struct yy_buffer_state )  );
-	if ( ! b )
-		YY_FATAL_ERROR( "out of dynamic memory in yy_create_buffer()" );
-
-	b->yy_buf_size = size;
-
-	/* yy_ch_buf has to be 2 characters longer than the size given because
-	 * we need to put in 2 end-of-buffer characters.
-	 */
-	b->yy_ch_buf = (char *) yyalloc(b->yy_buf_size + 2  );
-	if ( ! b->yy_ch_buf )
-		YY_FATAL_ERROR( "out of dynamic memory in yy_create_buffer()" );
-
-	b->yy_is_our_buffer = 1;
-
-	yy_init_buffer(b,file );
-
-	return b;
-}
-
-/** Destroy the buffer.
- * @param b a buffer created with yy_create_buffer()
- * 
- */
-    void yy_delete_buffer (YY_BUFFER_STATE  b )
-{
-    
-	if ( ! b )
-		return;
-
-	if ( b == YY_CURRENT_BUFFER ) /* Not sure if we should pop here. */
-		YY_CURRENT_BUFFER_LVALUE = (YY_BUFFER_STATE) 0;
-
-	if ( b->yy_is_our_buffer )
-		yyfree((void *) b->yy_ch_buf  );
-
-	yyfree((void *) b  );
-}
-
-#ifndef __cplusplus
-extern int isatty (int );
-#endif /* __cplusplus */
-    
-/* Initializes or reinitializes a buffer.
- * This function is sometimes called more than once on the same buffer,
- * such as during a yyrestart() or at EOF.
- */
-    static void yy_init_buffer  (YY_BUFFER_STATE  b, FILE * file )
-
-{
-	int oerrno = errno;
-    
-	yy_flush_buffer(b );
-
-	b->yy_input_file = file;
-	b->yy_fill_buffer = 1;
-
-    /* If b is the current buffer, then yy_init_buffer was _probably_
-     * called from yyrestart() or through yy_get_next_buffer.
-     * In that case, we don't want to reset the lineno or column.
-     */
-    if (b != YY_CURRENT_BUFFER){
-        b->yy_bs_lineno = 1;
-        b->yy_bs_column = 0;
-    }
-
-        b->yy_is_interactive = file ? (isatty( fileno(file) ) > 0) : 0;
-    
-	errno = oerrno;
-}
-
-/** Discard all buffered characters. On the next scan, YY_INPUT will be called.
- * @param b the buffer state to be flushed, usually @c YY_CURRENT_BUFFER.
- * 
- */
-    void yy_flush_buffer (YY_BUFFER_STATE  b )
-{
-    	if ( ! b )
-		return;
-
-	b->yy_n_chars = 0;
-
-	/* We always need two end-of-buffer characters.  The first causes
-	 * a transition to the end-of-buffer state.  The second causes
-	 * a jam in that state.
-	 */
-	b->yy_ch_buf[0] = YY_END_OF_BUFFER_CHAR;
-	b->yy_ch_buf[1] = YY_END_OF_BUFFER_CHAR;
-
-	b->yy_buf_pos = &b->yy_ch_buf[0];
-
-	b->yy_at_bol = 1;
-	b->yy_buffer_status = YY_BUFFER_NEW;
-
-	if ( b == YY_CURRENT_BUFFER )
-		yy_load_buffer_state( );
-}
-
-/** Pushes the new state onto the stack. The new state becomes
- *  the current state. This function will allocate the stack
- *  if necessary.
- *  @param new_buffer The new state.
- *  
- */
-void yypush_buffer_state (YY_BUFFER_STATE new_buffer )
-{
-    	if (new_buffer == NULL)
-		return;
-
-	yyensure_buffer_stack();
-
-	/* This block is copied from yy_switch_to_buffer. */
-	if ( YY_CURRENT_BUFFER )
-		{
-		/* Flush out information for old buffer. */
-		*(yy_c_buf_p) = (yy_hold_char);
-		YY_CURRENT_BUFFER_LVALUE->yy_buf_pos = (yy_c_buf_p);
-		YY_CURRENT_BUFFER_LVALUE->yy_n_chars = (yy_n_chars);
-		}
-
-	/* Only push if top exists. Otherwise, replace top. */
-	if (YY_CURRENT_BUFFER)
-		(yy_buffer_stack_top)++;
-	YY_CURRENT_BUFFER_LVALUE = new_buffer;
-
-	/* copied from yy_switch_to_buffer. */
-	yy_load_buffer_state( );
-	(yy_did_buffer_switch_on_eof) = 1;
-}
-
-/** Removes and deletes the top of the stack, if present.
- *  The next element becomes the new top.
- *  
- */
-void yypop_buffer_state (void)
-{
-    	if (!YY_CURRENT_BUFFER)
-		return;
-
-	yy_delete_buffer(YY_CURRENT_BUFFER );
-	YY_CURRENT_BUFFER_LVALUE = NULL;
-	if ((yy_buffer_stack_top) > 0)
-		--(yy_buffer_stack_top);
-
-	if (YY_CURRENT_BUFFER) {
-		yy_load_buffer_state( );
-		(yy_did_buffer_switch_on_eof) = 1;
-	}
-}
-
-/* Allocates the stack if it does not exist.
- *  Guarantees space for at least one push.
- */
-static void yyensure_buffer_stack (void)
-{
-	int num_to_alloc;
-    
-	if (!(yy_buffer_stack)) {
-
-		/* First allocation is just for 2 elements, since we don't know if this
-		 * scanner will even need a stack. We use 2 instead of 1 to avoid an
-		 * immediate realloc on the next call.
-         */
-		num_to_alloc = 1;
-		(yy_buffer_stack) = (struct yy_buffer_state**)yyalloc
-								(num_to_alloc * sizeof(struct yy_buffer_state*)
-								);
-		if ( ! (yy_buffer_stack) )
-			YY_FATAL_ERROR( "out of dynamic memory in yyensure_buffer_stack()" );
-								  
-		memset((yy_buffer_stack), 0, num_to_alloc * sizeof(struct yy_buffer_state*));
-				
-		(yy_buffer_stack_max) = num_to_alloc;
-		(yy_buffer_stack_top) = 0;
-		return;
-	}
-
-	if ((yy_buffer_stack_top) >= ((yy_buffer_stack_max)) - 1){
-
-		/* Increase the buffer to prepare for a possible push. */
-		int grow_size = 8 /* arbitrary grow size */;
-
-		num_to_alloc = (yy_buffer_stack_max) + grow_size;
-		(yy_buffer_stack) = (struct yy_buffer_state**)yyrealloc
-								((yy_buffer_stack),
-								num_to_alloc * sizeof(struct yy_buffer_state*)
-								);
-		if ( ! (yy_buffer_stack) )
-			YY_FATAL_ERROR( "out of dynamic memory in yyensure_buffer_stack()" );
-
-		/* zero only the new slots.*/
-		memset((yy_buffer_stack) + (yy_buffer_stack_max), 0, grow_size * sizeof(struct yy_buffer_state*));
-		(yy_buffer_stack_max) = num_to_alloc;
-	}
-}
-
-/** Setup the input buffer state to scan directly from a user-specified character buffer.
- * @param base the character buffer
- * @param size the size in bytes of the character buffer
- * 
- * @return the newly allocated buffer state object. 
- */
-YY_BUFFER_STATE yy_scan_buffer  (char * base, yy_size_t  size )
-{
-	YY_BUFFER_STATE b;
-    
-	if ( size < 2 ||
-	     base[size-2] != YY_END_OF_BUFFER_CHAR ||
-	     base[size-1] != YY_END_OF_BUFFER_CHAR )
-		/* They forgot to leave room for the EOB's. */
-		return 0;
-
-	b = (YY_BUFFER_STATE) yyalloc(sizeof( struct yy_buffer_state )  );
-	if ( ! b )
-		YY_FATAL_ERROR( "out of dynamic memory in yy_scan_buffer()" );
-
-	b->yy_buf_size = size - 2;	/* "- 2" to take care of EOB's */
-	b->yy_buf_pos = b->yy_ch_buf = base;
-	b->yy_is_our_buffer = 0;
-	b->yy_input_file = 0;
-	b->yy_n_chars = b->yy_buf_size;
-	b->yy_is_interactive = 0;
-	b->yy_at_bol = 1;
-	b->yy_fill_buffer = 0;
-	b->yy_buffer_status = YY_BUFFER_NEW;
-
-	yy_switch_to_buffer(b  );
-
-	return b;
-}
-
-/** Setup the input buffer state to scan a string. The next call to yylex() will
- * scan from a @e copy of @a str.
- * @param yystr a NUL-terminated string to scan
- * 
- * @return the newly allocated buffer state object.
- * @note If you want to scan bytes that may contain NUL values, then use
- *       yy_scan_bytes() instead.
- */
-YY_BUFFER_STATE yy_scan_string (yyconst char * yystr )
-{
-    
-	return yy_scan_bytes(yystr,strlen(yystr) );
-}
-
-/** Setup the input buffer state to scan the given bytes. The next call to yylex() will
- * scan from a @e copy of @a bytes.
- * @param bytes the byte buffer to scan
- * @param len the number of bytes in the buffer pointed to by @a bytes.
- * 
- * @return the newly allocated buffer state object.
- */
-YY_BUFFER_STATE yy_scan_bytes  (yyconst char * yybytes, int  _yybytes_len )
-{
-	YY_BUFFER_STATE b;
-	char *buf;
-	yy_size_t n;
-	int i;
-    
-	/* Get memory for full buffer, including space for trailing EOB's. */
-	n = _yybytes_len + 2;
-	buf = (char *) yyalloc(n  );
-	if ( ! buf )
-		YY_FATAL_ERROR( "out of dynamic memory in yy_scan_bytes()" );
-
-	for ( i = 0; i < _yybytes_len; ++i )
-		buf[i] = yybytes[i];
-
-	buf[_yybytes_len] = buf[_yybytes_len+1] = YY_END_OF_BUFFER_CHAR;
-
-	b = yy_scan_buffer(buf,n );
-	if ( ! b )
-		YY_FATAL_ERROR( "bad buffer in yy_scan_bytes()" );
-
-	/* It's okay to grow etc. this buffer, and we should throw it
-	 * away when we're done.
-	 */
-	b->yy_is_our_buffer = 1;
-
-	return b;
-}
-
-#ifndef YY_EXIT_FAILURE
-#define YY_EXIT_FAILURE 2
-#endif
-
-static void yy_fatal_error (yyconst char* msg )
-{
-    	(void) fprintf( stderr, "%s\n", msg );
-	exit( YY_EXIT_FAILURE );
-}
-
-/* Redefine yyless() so it works in section 3 code. */
-
-#undef yyless
-#define yyless(n) \
-	do \
-		{ \
-		/* Undo effects of setting up yytext. */ \
-        int yyless_macro_arg = (n); \
-        YY_LESS_LINENO(yyless_macro_arg);\
-		yytext[yyleng] = (yy_hold_char); \
-		(yy_c_buf_p) = yytext + yyless_macro_arg; \
-		(yy_hold_char) = *(yy_c_buf_p); \
-		*(yy_c_buf_p) = '\0'; \
-		yyleng = yyless_macro_arg; \
-		} \
-	while ( 0 )
-
-/* Accessor  methods (get/set functions) to struct members. */
-
-/** Get the current line number.
- * 
- */
-int yyget_lineno  (void)
-{
-        
-    return yylineno;
-}
-
-/** Get the input stream.
- * 
- */
-FILE *yyget_in  (void)
-{
-        return yyin;
-}
-
-/** Get the output stream.
- * 
- */
-FILE *yyget_out  (void)
-{
-        return yyout;
-}
-
-/** Get the length of the current token.
- * 
- */
-int yyget_leng  (void)
-{
-        return yyleng;
-}
-
-/** Get the current token.
- * 
- */
-
-char *yyget_text  (void)
-{
-        return yytext;
-}
-
-/** Set the current line number.
- * @param line_number
- * 
- */
-void yyset_lineno (int  line_number )
-{
-    
-    yylineno = line_number;
-}
-
-/** Set the input stream. This does not discard the current
- * input buffer.
- * @param in_str A readable stream.
- * 
- * @see yy_switch_to_buffer
- */
-void yyset_in (FILE *  in_str )
-{
-        yyin = in_str ;
-}
-
-void yyset_out (FILE *  out_str )
-{
-        yyout = out_str ;
-}
-
-int yyget_debug  (void)
-{
-        return yy_flex_debug;
-}
-
-void yyset_debug (int  bdebug )
-{
-        yy_flex_debug = bdebug ;
-}
-
-static int yy_init_globals (void)
-{
-        /* Initialization is the same as for the non-reentrant scanner.
-     * This function is called from yylex_destroy(), so don't allocate here.
-     */
-
-    /* We do not touch yylineno unless the option is enabled. */
-    yylineno =  1;
-    
-    (yy_buffer_stack) = 0;
-    (yy_buffer_stack_top) = 0;
-    (yy_buffer_stack_max) = 0;
-    (yy_c_buf_p) = (char *) 0;
-    (yy_init) = 0;
-    (yy_start) = 0;
-
-/* Defined in main.c */
-#ifdef YY_STDINIT
-    yyin = stdin;
-    yyout = stdout;
-#else
-    yyin = (FILE *) 0;
-    yyout = (FILE *) 0;
-#endif
-
-    /* For future reference: Set errno on error, since we are called by
-     * yylex_init()
-     */
-    return 0;
-}
-
-/* yylex_destroy is for both reentrant and non-reentrant scanners. */
-int yylex_destroy  (void)
-{
-    
-    /* Pop the buffer stack, destroying each element. */
-	while(YY_CURRENT_BUFFER){
-		yy_delete_buffer(YY_CURRENT_BUFFER  );
-		YY_CURRENT_BUFFER_LVALUE = NULL;
-		yypop_buffer_state();
-	}
-
-	/* Destroy the stack itself. */
-	yyfree((yy_buffer_stack) );
-	(yy_buffer_stack) = NULL;
-
-    /* Reset the globals. This is important in a non-reentrant scanner so the next time
-     * yylex() is called, initialization will occur. */
-    yy_init_globals( );
-
-    return 0;
-}
-
-/*
- * Internal utility routines.
- */
-
-#ifndef yytext_ptr
-static void yy_flex_strncpy (char* s1, yyconst char * s2, int n )
-{
-	register int i;
-	for ( i = 0; i < n; ++i )
-		s1[i] = s2[i];
-}
-#endif
-
-#ifdef YY_NEED_STRLEN
-static int yy_flex_strlen (yyconst char * s )
-{
-	register int n;
-	for ( n = 0; s[n]; ++n )
-		;
-
-	return n;
-}
-#endif
-
-void *yyalloc (yy_size_t  size )
-{
-	return (void *) malloc( size );
-}
-
-void *yyrealloc  (void * ptr, yy_size_t  size )
-{
-	/* The cast to (char *) in the following accommodates both
-	 * implementations that use char* generic pointers, and those
-	 * that use void* generic pointers.  It works with the latter
-	 * because both ANSI C and C++ allow castless assignment from
-	 * any pointer type to void*, and deal with argument conversions
-	 * as though doing an assignment.
-	 */
-	return (void *) realloc( (char *) ptr, size );
-}
-
-void yyfree (void * ptr )
-{
-	free( (char *) ptr );	/* see yyrealloc() for (char *) cast */
-}
-
-#define YYTABLES_NAME "yytables"
-
-#line 129 "tokens.l"
-
-
-
@@ -19,5 +19,6 @@ enum
   TOK_VOICEB, TOK_DATA, TOK_RANGE, TOK_DIGIT, TOK_LOOPBACK, TOK_PRIO,
   TOK_SLAVE, TOK_LONGHAUL, TOK_SHORTHAUL, TOK_IEC, TOK_DSP_DISABLED,
   TOK_BEGIN_KEY, TOK_END_KEY, TOK_SLOT_ID, TOK_CUSTOMER_KEY, TOK_DEJITTER, 
-  TOK_WPLLOFF
+  TOK_WPLLOFF, TOK_DEVICE, TOK_TEMPLATE, TOK_INHERIT,
+  TOK_COUNT			/**< Number of token types, keep last */
 };
@@ -9,9 +9,6 @@
  * Parse Tree Data Structures -- note that none of this is actually a Tree in the formal sense
  */
 
-/** Max token string value length */
-#define S_LEN 148
-
 #ifdef HAVE_STDBOOL_H
 #include <stdbool.h>
 #endif
@@ -31,13 +28,26 @@ typedef struct token
 
   /** Any integer value */
   int ival;
-  /** Any string value */
-  char sval[S_LEN];
+  /** Any string value, in the scanner's buffer */
+  char *sval;
   /** The line number the token was found on */
   int lineno;
 }
 T_TOKEN;
 
+/* The reentrant scanner of tokens.l. The typedef is guarded as in
+ * flex's own output, which includes this header. */
+#ifndef YY_TYPEDEF_YY_SCANNER_T
+#define YY_TYPEDEF_YY_SCANNER_T
+typedef void *yyscan_t;
+#endif
+int yylex_init_extra (T_TOKEN * token, yyscan_t * scanner);
+void yyset_in (FILE * in, yyscan_t scanner);
+char *yyget_text (yyscan_t scanner);
+int yyget_lineno (yyscan_t scanner);
+int yylex (yyscan_t scanner);
+int yylex_destroy (yyscan_t scanner);
+
 typedef struct span
 {
   /** The number of this span (indexed from 1) */
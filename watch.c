@@ -0,0 +1,340 @@
+/*
+   fonulator 3 - foneBRIDGE configuration daemon
+   (C) 2005-2007 Redfone Communications, LLC.
+   www.red-fone.com
+
+   Configuration Watch
+*/
+/** @file
+ *
+ * Keep a device configured while its configuration file is edited,
+ * run with --watch. The file is applied in full once and then watched
+ * with inotify. Every time it is saved it is parsed again, compared
+ * section by section with the configuration last applied by
+ * contextDiff(), and only the sections that changed are applied: a
+ * new framing on [span2] sends one link configuration request, an
+ * edit of [dsp] only the channel types that moved.
+ *
+ * The snapshot read when connecting is kept up to date by every run,
+ * so the device is not read again between changes. After a failed
+ * run the state of the device is unknown, so the next change reads
+ * it again and is applied in full.
+ *
+ * The directory holding the file is watched rather than the file, so
+ * editors that save by renaming a new file over the old one are
+ * followed too. Events less than WATCH_SETTLE apart count as one save.
+ */
+#include "fonulator.h"
+
+#if defined(STDC_HEADERS) || defined(HAVE_STDLIB_H)
+# include <stdlib.h>
+#endif
+
+#if HAVE_UNISTD_H
+#include <unistd.h>
+#endif
+
+#include <errno.h>
+#include <signal.h>
+#include <poll.h>
+
+#ifdef HAVE_SYS_INOTIFY_H
+#include <sys/inotify.h>
+#endif
+
+extern int vbose;
+
+/** Milliseconds without events before a save is taken as complete */
+#define WATCH_SETTLE 100
+
+#ifdef HAVE_SYS_INOTIFY_H
+
+/** The device being kept configured */
+typedef struct
+{
+  const char *path;		/**< Configuration file */
+  const char *key;		/**< Device of a site file, or NULL */
+  bool save_config;		/**< Save the configuration after each run */
+  /** Configuration last applied, as parsed, or NULL to apply in full */
+  T_CONTEXT *applied;
+  T_CONTEXT *ctx;		/**< Context of the last run, with the snapshot */
+  libfb_t *fb;
+}
+T_WATCH;
+
+static volatile sig_atomic_t watch_stop = 0;
+
+/** @brief SIGINT/SIGTERM handler: stop watching */
+static void
+watch_signal (int sig)
+{
+  watch_stop = 1;
+}
+
+/** @return the configuration file, parsed, or NULL on error */
+static T_CONTEXT *
+watch_load (T_WATCH * w)
+{
+  T_CONTEXT *ctx;
+
+  if (w->key != NULL)
+    return siteLoadDevice (w->path, w->key);
+
+  ctx = contextCreate ();
+  if (ctx != NULL && loadConfig (ctx, w->path) != E_SUCCESS)
+    {
+      contextDestroy (ctx);
+      ctx = NULL;
+    }
+  return ctx;
+}
+
+/** @brief Print the sections of a SECTION_* mask */
+static void
+watch_print_sections (unsigned int sections)
+{
+  int i;
+
+  printf ("Applying");
+  if (sections & SECTION_GLOBALS)
+    printf (" [globals]");
+  for (i = 1; i <= IDT_LINKS; i++)
+    if (sections & SECTION_SPAN (i))
+      printf (" [span%d]", i);
+  if (sections & SECTION_DSP)
+    printf (" [dsp]");
+  printf ("\n");
+
+  if (sections & SECTION_KEYS)
+    printf ("Keys changed; keys are not loaded by fonulator.\n");
+}
+
+/** @brief Apply the sections of a configuration that changed
+ *
+ * @param w the watched device
+ * @param new the configuration as parsed, owned by the watch from now on
+ * @return success/error code
+ */
+static FB_STATUS
+watch_apply (T_WATCH * w, T_CONTEXT * new)
+{
+  unsigned int sections = contextDiff (w->applied, new);
+  T_CONTEXT *parsed;
+  FB_STATUS status;
+
+  if (sections == 0)
+    {
+      if (vbose > 0)
+	printf ("%s unchanged\n", w->path);
+      contextDestroy (new);
+      return E_SUCCESS;
+    }
+
+  /* Kept for the next comparison, before prepareConfig() adds spans */
+  parsed = contextClone (new);
+  if (parsed == NULL)
+    {
+      contextDestroy (new);
+      return E_SYSTEM;
+    }
+
+  if (w->fb != NULL && strcmp (w->ctx->fonebridge, new->fonebridge) == 0)
+    {
+      /* Same device: carry its snapshot over */
+      new->snapshot = w->ctx->snapshot;
+      new->dsi = w->ctx->dsi;
+      w->ctx->snapshot = NULL;
+      w->ctx->dsi = NULL;
+      status = (w->applied != NULL) ? E_SUCCESS
+	: statusSnapshot (new, w->fb);
+    }
+  else
+    {
+      if (w->fb != NULL)
+	libfb_destroy (w->fb);
+      w->fb = connectDevice (new);
+      status = (w->fb != NULL) ? E_SUCCESS : E_FBLIB;
+      sections = SECTION_ALL;
+    }
+
+  new->interactive = false;
+  new->sections = sections;
+
+  if (status == E_SUCCESS)
+    {
+      watch_print_sections (sections);
+      status = prepareConfig (new, w->fb);
+    }
+  if (status == E_SUCCESS)
+    status = configureFonebridge (new, w->fb);
+  if (status == E_SUCCESS && w->save_config
+      && storeConfig (w->fb, false) != FBLIB_ESUCCESS)
+    status = E_FBLIB;
+
+  contextDestroy (w->ctx);
+  w->ctx = new;
+  contextDestroy (w->applied);
+  w->applied = parsed;
+
+  if (status != E_SUCCESS)
+    {
+      contextDestroy (w->applied);
+      w->applied = NULL;
+    }
+  return status;
+}
+
+/** @brief Parse the configuration file again and apply the changes */
+static void
+watch_reload (T_WATCH * w)
+{
+  T_CONTEXT *new = watch_load (w);
+  FB_STATUS status;
+
+  if (new == NULL)
+    {
+      fprintf (stderr, "%s not applied; fix it and save it again.\n",
+	       w->path);
+      return;
+    }
+
+  status = watch_apply (w, new);
+  if (status == E_SUCCESS)
+    printf ("%s applied\n", w->path);
+  else
+    fprintf (stderr, "%s failed to apply (%d); the next save is applied "
+	     "in full.\n", w->path, status);
+  fflush (stdout);
+}
+
+/** @brief Wait until the configuration file has been saved
+ *
+ * @param fd the inotify descriptor watching the directory of the file
+ * @param name the name of the file within the directory
+ * @return true once it was saved, false if interrupted
+ */
+static bool
+watch_wait (int fd, const char *name)
+{
+  char buf[4096]
+    __attribute__ ((aligned (__alignof__ (struct inotify_event))));
+  bool changed = false;
+  int timeout = -1;
+
+  while (!watch_stop)
+    {
+      struct pollfd pfd = { fd, POLLIN, 0 };
+      ssize_t n, i;
+      int ready = poll (&pfd, 1, timeout);
+
+      if (ready < 0)
+	{
+	  if (errno != EINTR)
+	    {
+	      perror ("poll");
+	      watch_stop = 1;
+	    }
+	  return false;
+	}
+      if (ready == 0)
+	return changed;
+
+      n = read (fd, buf, sizeof (buf));
+      if (n <= 0)
+	return false;
+
+      for (i = 0; i < n;)
+	{
+	  struct inotify_event *ev = (struct inotify_event *) (buf + i);
+	  if (ev->len > 0 && strcmp (ev->name, name) == 0)
+	    changed = true;
+	  i += sizeof (struct inotify_event) + ev->len;
+	}
+
+      /* Wait for the rest of the save before reading the file */
+      if (changed)
+	timeout = WATCH_SETTLE;
+    }
+  return false;
+}
+#endif
+
+/** @brief Configure a device and keep it configured as its
+ * configuration file changes, until SIGINT or SIGTERM
+ *
+ * @param path the configuration file
+ * @param key the device to use from a site file, or NULL
+ * @param save_config save the configuration on the device after every
+ * change
+ * @return EXIT_SUCCESS on a clean shutdown
+ */
+int
+runWatch (const char *path, const char *key, bool save_config)
+{
+#ifdef HAVE_SYS_INOTIFY_H
+  struct sigaction sa;
+  const char *name = strrchr (path, '/');
+  char *dir;
+  T_WATCH w;
+  int fd;
+
+  if (name == NULL)
+    {
+      dir = strdup (".");
+      name = path;
+    }
+  else
+    {
+      dir = (name == path) ? strdup ("/") : strndup (path, name - path);
+      name++;
+    }
+  if (dir == NULL)
+    {
+      perror ("malloc");
+      return EXIT_FAILURE;
+    }
+
+  fd = inotify_init ();
+  if (fd < 0 || inotify_add_watch (fd, dir, IN_CLOSE_WRITE | IN_MOVED_TO) < 0)
+    {
+      perror ("inotify");
+      if (fd >= 0)
+	close (fd);
+      free (dir);
+      return EXIT_FAILURE;
+    }
+
+  /* No SA_RESTART, so a signal interrupts poll() */
+  memset (&sa, 0, sizeof (sa));
+  sa.sa_handler = watch_signal;
+  sigemptyset (&sa.sa_mask);
+  sigaction (SIGINT, &sa, NULL);
+  sigaction (SIGTERM, &sa, NULL);
+
+  memset (&w, 0, sizeof (w));
+  w.path = path;
+  w.key = key;
+  w.save_config = save_config;
+
+  watch_reload (&w);
+
+  if (vbose > 0)
+    printf ("Watching %s\n", path);
+
+  while (!watch_stop)
+    if (watch_wait (fd, name))
+      watch_reload (&w);
+
+  if (w.fb != NULL)
+    libfb_destroy (w.fb);
+  contextDestroy (w.ctx);
+  contextDestroy (w.applied);
+  close (fd);
+  free (dir);
+  return EXIT_SUCCESS;
+#else
+  fprintf (stderr, "Watching configuration files is not supported on "
+	   "this system.\n");
+  return EXIT_FAILURE;
+#endif
+}